@@ -20,6 +20,7 @@ let package = Package(
         // Targets can depend on other targets in this package and products from dependencies.
         .target(
             name: "SentrySecurity",
+            exclude: ["Encryption/gen_p256_table.py"],
             publicHeadersPath: "include"),
         
         .target(
@@ -28,6 +29,6 @@ let package = Package(
         
         .testTarget(
             name: "SentrySDKTests",
-            dependencies: ["SentrySDK"]),
+            dependencies: ["SentrySDK", "SentrySecurity"]),
     ]
 )
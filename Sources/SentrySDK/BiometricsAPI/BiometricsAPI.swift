@@ -1076,7 +1076,7 @@ final class BiometricsAPI {
     /// Decodes an APDU command response.
     private func unwrapAPDUResponse(response: [UInt8], statusWord: Int, keyENC: [UInt8], keyRMAC: [UInt8], chainingValue: [UInt8], encryptionCounter: [UInt8]) throws -> [UInt8] {
         let responseData = UnsafeMutablePointer<UInt8>.allocate(capacity: response.count + 2)
-        let unwrappedResponse = UnsafeMutablePointer<UInt8>.allocate(capacity: 300)
+        let unwrappedResponse = UnsafeMutablePointer<UInt8>.allocate(capacity: response.count + 2)
         let ENC = UnsafeMutablePointer<UInt8>.allocate(capacity: keyENC.count)
         let RMAC = UnsafeMutablePointer<UInt8>.allocate(capacity: keyRMAC.count)
         let chaining = UnsafeMutablePointer<UInt8>.allocate(capacity: chainingValue.count)
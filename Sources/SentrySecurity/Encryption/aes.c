@@ -11,6 +11,9 @@
 
 #include "stdint.h"
 #include "string.h"
+#include "stdatomic.h"
+#include "aes.h"
+#include "aes_impl.h"
 
 
 // This is the specified AES SBox. To look up a substitution value, put the first
@@ -730,68 +733,585 @@ void aes_decrypt(uint8_t in[], uint8_t out[], uint32_t key[], uint32_t keysize)
    out[15] = state[3][3];
 }
 
-void AES_128(uint8_t* key, uint8_t* plaintext, uint8_t* ciphertext)
+/********************
+** AES-128 FIXED ROUNDS
+********************/
+
+// AES-128-only versions of KeyExpansion()/aes_encrypt()/aes_decrypt(): 10 rounds and a
+// 44-word schedule are fixed at compile time, the rounds are expanded by the macros
+// below and nothing branches on the key size. The generic functions above stay for
+// 192/256-bit keys.
+
+// Four schedule words from the previous four: w[i] = w[i-4] ^ SubWord(RotWord(w[i-1])) ^ Rcon
+#define AES128_EXPAND_ROUND(w, i, rcon) \
+   (w)[(i)] = (w)[(i) - 4] ^ SubWord(KE_ROTWORD((w)[(i) - 1])) ^ ((uint32_t)(rcon) << 24); \
+   (w)[(i) + 1] = (w)[(i) - 3] ^ (w)[(i)]; \
+   (w)[(i) + 2] = (w)[(i) - 2] ^ (w)[(i) + 1]; \
+   (w)[(i) + 3] = (w)[(i) - 1] ^ (w)[(i) + 2];
+
+// Middle round "r" (1..9) of the cipher and of the equivalent inverse cipher
+#define AES128_ENC_ROUND(state, w, r) \
+   SubBytes(state);ShiftRows(state);MixColumns(state);AddRoundKey(state,(uint32_t*)&(w)[4 * (r)]);
+#define AES128_DEC_ROUND(state, w, r) \
+   InvSubBytes(state);InvShiftRows(state);InvMixColumns(state);AddRoundKey(state,(uint32_t*)&(w)[4 * (r)]);
+
+#define AES128_UNROLL_9(ROUND, state, w) \
+   ROUND(state, w, 1) ROUND(state, w, 2) ROUND(state, w, 3) ROUND(state, w, 4) ROUND(state, w, 5) \
+   ROUND(state, w, 6) ROUND(state, w, 7) ROUND(state, w, 8) ROUND(state, w, 9)
+
+// KeyExpansion() for a 16-byte key into w[0..43]
+void KeyExpansion128(const uint8_t key[], uint32_t w[])
 {
-    uint32_t key_schedule[60];
+   w[0] = ((uint32_t)key[0] << 24) | ((uint32_t)key[1] << 16) | ((uint32_t)key[2] << 8) | key[3];
+   w[1] = ((uint32_t)key[4] << 24) | ((uint32_t)key[5] << 16) | ((uint32_t)key[6] << 8) | key[7];
+   w[2] = ((uint32_t)key[8] << 24) | ((uint32_t)key[9] << 16) | ((uint32_t)key[10] << 8) | key[11];
+   w[3] = ((uint32_t)key[12] << 24) | ((uint32_t)key[13] << 16) | ((uint32_t)key[14] << 8) | key[15];
+
+   AES128_EXPAND_ROUND(w, 4, 0x01)
+   AES128_EXPAND_ROUND(w, 8, 0x02)
+   AES128_EXPAND_ROUND(w, 12, 0x04)
+   AES128_EXPAND_ROUND(w, 16, 0x08)
+   AES128_EXPAND_ROUND(w, 20, 0x10)
+   AES128_EXPAND_ROUND(w, 24, 0x20)
+   AES128_EXPAND_ROUND(w, 28, 0x40)
+   AES128_EXPAND_ROUND(w, 32, 0x80)
+   AES128_EXPAND_ROUND(w, 36, 0x1b)
+   AES128_EXPAND_ROUND(w, 40, 0x36)
+}
+
+// aes_encrypt() for a 44-word AES-128 schedule
+void aes_encrypt_128(const uint8_t in[], uint8_t out[], const uint32_t w[])
+{
+    uint8_t state[4][4];
+   state[0][0] = in[0];
+   state[1][0] = in[1];
+   state[2][0] = in[2];
+   state[3][0] = in[3];
+   state[0][1] = in[4];
+   state[1][1] = in[5];
+   state[2][1] = in[6];
+   state[3][1] = in[7];
+   state[0][2] = in[8];
+   state[1][2] = in[9];
+   state[2][2] = in[10];
+   state[3][2] = in[11];
+   state[0][3] = in[12];
+   state[1][3] = in[13];
+   state[2][3] = in[14];
+   state[3][3] = in[15];
 
-    // First set of test vectors.
-    KeyExpansion(key, key_schedule, 128);
-    aes_encrypt(plaintext, ciphertext, key_schedule, 128);
+   AddRoundKey(state,(uint32_t*)&w[0]);
+   AES128_UNROLL_9(AES128_ENC_ROUND, state, w)
+   SubBytes(state);ShiftRows(state);AddRoundKey(state,(uint32_t*)&w[40]);
 
+   out[0] = state[0][0];
+   out[1] = state[1][0];
+   out[2] = state[2][0];
+   out[3] = state[3][0];
+   out[4] = state[0][1];
+   out[5] = state[1][1];
+   out[6] = state[2][1];
+   out[7] = state[3][1];
+   out[8] = state[0][2];
+   out[9] = state[1][2];
+   out[10] = state[2][2];
+   out[11] = state[3][2];
+   out[12] = state[0][3];
+   out[13] = state[1][3];
+   out[14] = state[2][3];
+   out[15] = state[3][3];
 }
 
-void AES_128_CBC_Encrypt(uint8_t* key, uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv)
+// Decrypts one block with the equivalent inverse cipher (FIPS-197 5.3.5). The round
+// order matches aes_encrypt(), so "dk" must be a schedule built by aes128_init() where
+// the middle round keys have already been passed through InvMixColumns.
+void aes_decrypt_eq(const uint8_t in[], uint8_t out[], const uint32_t dk[])
 {
-    uint32_t i;
-    uint32_t Block = len / 16;
-    unsigned char plaintextiv[16];
-    uint32_t* p1 = (unsigned int*)plaintextiv;
-    uint32_t* p2 = (unsigned int*)iv;
-    uint32_t key_schedule[60];
-    
+    uint8_t state[4][4];
+   state[0][0] = in[0];
+   state[1][0] = in[1];
+   state[2][0] = in[2];
+   state[3][0] = in[3];
+   state[0][1] = in[4];
+   state[1][1] = in[5];
+   state[2][1] = in[6];
+   state[3][1] = in[7];
+   state[0][2] = in[8];
+   state[1][2] = in[9];
+   state[2][2] = in[10];
+   state[3][2] = in[11];
+   state[0][3] = in[12];
+   state[1][3] = in[13];
+   state[2][3] = in[14];
+   state[3][3] = in[15];
 
+   AddRoundKey(state,(uint32_t*)&dk[0]);
+   AES128_UNROLL_9(AES128_DEC_ROUND, state, dk)
+   InvSubBytes(state);InvShiftRows(state);AddRoundKey(state,(uint32_t*)&dk[40]);
 
-    // First set of test vectors.
-    KeyExpansion(key, key_schedule, 128);
+   out[0] = state[0][0];
+   out[1] = state[1][0];
+   out[2] = state[2][0];
+   out[3] = state[3][0];
+   out[4] = state[0][1];
+   out[5] = state[1][1];
+   out[6] = state[2][1];
+   out[7] = state[3][1];
+   out[8] = state[0][2];
+   out[9] = state[1][2];
+   out[10] = state[2][2];
+   out[11] = state[3][2];
+   out[12] = state[0][3];
+   out[13] = state[1][3];
+   out[14] = state[2][3];
+   out[15] = state[3][3];
+}
 
-    for (i = 0; i < Block; i++)
+/********************
+** AES-128 KEY CONTEXT
+********************/
+
+// InvMixColumns applied to a single key schedule word (row 0 in the top byte).
+static uint32_t InvMixWord(uint32_t w)
+{
+    uint8_t c0 = (uint8_t)(w >> 24);
+    uint8_t c1 = (uint8_t)(w >> 16);
+    uint8_t c2 = (uint8_t)(w >> 8);
+    uint8_t c3 = (uint8_t)w;
+
+    return ((uint32_t)(gf_mul[c0][5] ^ gf_mul[c1][3] ^ gf_mul[c2][4] ^ gf_mul[c3][2]) << 24) |
+           ((uint32_t)(gf_mul[c0][2] ^ gf_mul[c1][5] ^ gf_mul[c2][3] ^ gf_mul[c3][4]) << 16) |
+           ((uint32_t)(gf_mul[c0][4] ^ gf_mul[c1][2] ^ gf_mul[c2][5] ^ gf_mul[c3][3]) << 8) |
+            (uint32_t)(gf_mul[c0][3] ^ gf_mul[c1][4] ^ gf_mul[c2][2] ^ gf_mul[c3][5]);
+}
+
+// Builds the FIPS-197 word schedule used by the portable engines. The decryption
+// schedule is stored in the order it is consumed: dk[0..3] is the last encryption round
+// key and dk[40..43] the first.
+void aes128_setkey_fips(struct aes128_ctx* ctx, const uint8_t* key, int with_decrypt)
+{
+    int i, r;
+
+    KeyExpansion128(key, ctx->ek);
+    if (!with_decrypt) return;
+
+    for (i = 0; i < 4; i++)
+    {
+        ctx->dk[i] = ctx->ek[40 + i];
+        ctx->dk[40 + i] = ctx->ek[i];
+    }
+    for (r = 1; r < 10; r++)
     {
-        memcpy(plaintextiv, plaintext + (i * 16), 16);
+        for (i = 0; i < 4; i++)
+        {
+            ctx->dk[(r * 4) + i] = InvMixWord(ctx->ek[((10 - r) * 4) + i]);
+        }
+    }
+}
 
-        p1[0] ^= p2[0];
-        p1[1] ^= p2[1];
-        p1[2] ^= p2[2];
-        p1[3] ^= p2[3];
+static void reference_encrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    aes_encrypt_128(in, out, ctx->ek);
+}
 
-        aes_encrypt(plaintextiv, ciphertext + (i * 16), key_schedule, 128);
-        memcpy(iv, ciphertext + (i * 16), 16);
+static void reference_decrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    aes_decrypt_eq(in, out, ctx->dk);
+}
+
+const struct aes128_impl aes128_impl_reference = {
+    AES_IMPL_REFERENCE, aes128_setkey_fips, reference_encrypt, reference_decrypt, NULL, NULL, NULL, NULL, NULL
+};
+
+// NULL until the first context is initialised or aes_set_impl() is called. Atomic because
+// any thread may be the first to initialise a context; every context records the engine it
+// was expanded with, so a later switch never mixes engines within one key.
+static _Atomic(const struct aes128_impl*) g_aes_impl = NULL;
+
+// The AES instructions when the running CPU has them (AES-NI, or ARMv8 AES on arm64),
+// otherwise the fastest constant-time engine it can run.
+//
+// Only CPUs with neither AES instructions nor SSSE3 get the bitsliced engine. Every lone
+// block there runs a full four-block pass, so the serial CBC encryption and CMAC chains
+// of wrap() and unwrap() are several times slower than with AES_IMPL_TTABLE, while CBC
+// decryption and the batch paths fill the lanes and keep most of its throughput. Callers
+// that accept cache-timing leakage for speed can still select AES_IMPL_TTABLE with
+// aes_set_impl().
+static const struct aes128_impl* aes_detect_impl(void)
+{
+#if AES_HAVE_AESNI
+    if (cpu_features() & CPU_FEATURE_AESNI) return &aes128_impl_aesni;
+#endif
+#if AES_HAVE_ARMV8
+    if (cpu_features() & CPU_FEATURE_ARMV8_AES) return &aes128_impl_armv8;
+#endif
+#if AES_HAVE_VPERM
+    if (cpu_features() & CPU_FEATURE_SSSE3) return &aes128_impl_vperm;
+#endif
+    return &aes128_impl_bitslice;
+}
 
+// Concurrent first calls may both run the detection; they store the same engine.
+static const struct aes128_impl* aes_current_impl(void)
+{
+    const struct aes128_impl* impl = atomic_load_explicit(&g_aes_impl, memory_order_acquire);
 
+    if (impl == NULL)
+    {
+        impl = aes_detect_impl();
+        atomic_store_explicit(&g_aes_impl, impl, memory_order_release);
     }
+    return impl;
+}
 
+// Selects the engine used by contexts initialised from now on. Returns 1 on success,
+// 0 if "method" is unknown or not supported by this CPU. Existing contexts keep the
+// engine they were expanded with. Meant for tests and benchmarks: the setting is process
+// wide, so production code should leave the detected engine in place.
+int aes_set_impl(uint16_t method)
+{
+    const struct aes128_impl* impl;
+
+    switch (method) {
+       case AES_IMPL_REFERENCE: impl = &aes128_impl_reference; break;
+       case AES_IMPL_TTABLE: impl = &aes128_impl_ttable; break;
+       case AES_IMPL_BITSLICE: impl = &aes128_impl_bitslice; break;
+#if AES_HAVE_AESNI
+       case AES_IMPL_AESNI:
+           if (!(cpu_features() & CPU_FEATURE_AESNI)) return 0;
+           impl = &aes128_impl_aesni;
+           break;
+#endif
+#if AES_HAVE_VPERM
+       case AES_IMPL_VPERM:
+           if (!(cpu_features() & CPU_FEATURE_SSSE3)) return 0;
+           impl = &aes128_impl_vperm;
+           break;
+#endif
+#if AES_HAVE_ARMV8
+       case AES_IMPL_ARMV8:
+           if (!(cpu_features() & CPU_FEATURE_ARMV8_AES)) return 0;
+           impl = &aes128_impl_armv8;
+           break;
+#endif
+       default: return 0;
+    }
+    atomic_store_explicit(&g_aes_impl, impl, memory_order_release);
+    return 1;
 }
 
-void AES_128_CBC_Decrypt(uint8_t* key, uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv)
+uint16_t aes_get_impl(void)
 {
-    uint32_t i;
+    return aes_current_impl()->method;
+}
+
+// Expands "key" once into "ctx" so that any number of blocks can be processed without
+// running KeyExpansion again. Only the encryption schedule is built; use this for keys
+// that are never used to decrypt (CMAC, CBC encryption, counter IVs).
+void aes128_init_encrypt(struct aes128_ctx* ctx, const uint8_t* key)
+{
+    ctx->impl = aes_current_impl();
+    ctx->impl->setkey(ctx, key, 0);
+}
+
+// Expands "key" into both the encryption and the decryption schedule.
+void aes128_init(struct aes128_ctx* ctx, const uint8_t* key)
+{
+    ctx->impl = aes_current_impl();
+    ctx->impl->setkey(ctx, key, 1);
+}
+
+void aes128_encrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    ctx->impl->encrypt(ctx, in, out);
+}
+
+void aes128_decrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    ctx->impl->decrypt(ctx, in, out);
+}
+
+// CBC encryption of "len" bytes (a multiple of 16). On return "iv" holds the last
+// ciphertext block so consecutive calls continue the same chain.
+void aes128_cbc_encrypt(const struct aes128_ctx* ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv)
+{
+    uint32_t i, j;
     uint32_t Block = len / 16;
-    uint32_t* p1 = (unsigned int*)plaintext;
-    uint32_t* p2 = (unsigned int*)iv;
-    unsigned char ciphertextiv[16];
-    uint32_t key_schedule[60];
+    uint8_t block[16];
 
+    if (ctx->impl->cbc_encrypt != NULL)
+    {
+        ctx->impl->cbc_encrypt(ctx, plaintext, ciphertext, len, iv);
+        return;
+    }
+    for (i = 0; i < Block; i++)
+    {
+        for (j = 0; j < 16; j++)
+        {
+            block[j] = plaintext[(i * 16) + j] ^ iv[j];
+        }
+        aes128_encrypt(ctx, block, ciphertext + (i * 16));
+        memcpy(iv, ciphertext + (i * 16), 16);
+    }
+}
 
-    // First set of test vectors.
-    KeyExpansion(key, key_schedule, 128);
+// CBC decryption of "len" bytes (a multiple of 16). "ciphertext" and "plaintext" may be
+// the same buffer. On return "iv" holds the last ciphertext block.
+void aes128_cbc_decrypt(const struct aes128_ctx* ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv)
+{
+    uint32_t i, j;
+    uint32_t Block = len / 16;
+    uint8_t ciphertextiv[16];
 
+    if (ctx->impl->cbc_decrypt != NULL)
+    {
+        ctx->impl->cbc_decrypt(ctx, ciphertext, plaintext, len, iv);
+        return;
+    }
     for (i = 0; i < Block; i++)
     {
         memcpy(ciphertextiv, ciphertext + (i * 16), 16);
-        aes_decrypt(ciphertextiv, plaintext + (i * 16), key_schedule, 128);
-        p1[(i * 4) + 0] ^= p2[0];
-        p1[(i * 4) + 1] ^= p2[1];
-        p1[(i * 4) + 2] ^= p2[2];
-        p1[(i * 4) + 3] ^= p2[3];
+        aes128_decrypt(ctx, ciphertextiv, plaintext + (i * 16));
+        for (j = 0; j < 16; j++)
+        {
+            plaintext[(i * 16) + j] ^= iv[j];
+        }
         memcpy(iv, ciphertextiv, 16);
     }
 }
+
+/********************
+** AES-128 CBC + CBC-MAC
+********************/
+
+// CBC-encrypts "len" bytes (a multiple of 16) under "ctx" and at the same time runs the
+// CBC-MAC chain "mac" (16 bytes, in/out) under "mac_ctx" over the byte stream
+// S = lead[0..lead_len) | ciphertext, with lead_len < 16. Every complete block of S that
+// is followed by more of S is absorbed; the unabsorbed rest is returned in "lead": the
+// last lead_len ciphertext bytes, or the whole last ciphertext block when lead_len is 0.
+// Block i of S exists once ciphertext block i does, so each step encrypts the next
+// plaintext block and MACs the previous block of S as two independent lanes.
+void aes128_cbc_encrypt_mac(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv, uint8_t* mac, uint8_t* lead, uint32_t lead_len)
+{
+    const struct aes128_ctx* lane_ctx[2];
+    const uint8_t* prev = iv;
+    const uint8_t* block = NULL;
+    uint8_t in[32], out[32];
+    uint8_t first[16];
+    uint32_t i, j, m;
+
+    if (len == 0) return;
+
+    if ((ctx->impl == mac_ctx->impl) && (ctx->impl->cbc_encrypt_mac != NULL))
+    {
+        ctx->impl->cbc_encrypt_mac(ctx, mac_ctx, plaintext, ciphertext, len, iv, mac, lead, lead_len);
+        return;
+    }
+
+    lane_ctx[0] = ctx;
+    lane_ctx[1] = mac_ctx;
+
+    for (i = 0; i < len; i += 16)
+    {
+        m = 1;
+        for (j = 0; j < 16; j++) in[j] = plaintext[i + j] ^ prev[j];
+        if (block != NULL)
+        {
+            for (j = 0; j < 16; j++) in[16 + j] = mac[j] ^ block[j];
+            m = 2;
+        }
+
+        aes128_encrypt_lanes(lane_ctx, in, out, m);
+
+        memcpy(ciphertext + i, out, 16);
+        if (m == 2) memcpy(mac, out + 16, 16);
+        prev = ciphertext + i;
+
+        // block i of S: the lead_len bytes before ciphertext block i and its head
+        if (i > 0)
+        {
+            block = ciphertext + i - lead_len;
+        }
+        else
+        {
+            memcpy(first, lead, lead_len);
+            memcpy(first + lead_len, ciphertext, 16 - lead_len);
+            block = first;
+        }
+    }
+    memcpy(iv, prev, 16);
+
+    if (lead_len > 0)
+    {
+        // the last block of S is followed by lead_len more bytes
+        for (j = 0; j < 16; j++) in[j] = mac[j] ^ block[j];
+        aes128_encrypt(mac_ctx, in, mac);
+        memcpy(lead, ciphertext + len - lead_len, lead_len);
+    }
+    else
+    {
+        memcpy(lead, block, 16);
+    }
+}
+
+// CBC-decrypts "len" bytes (a multiple of 16) under "ctx" and runs the CBC-MAC chain "mac"
+// (16 bytes, in/out) under "mac_ctx" over every ciphertext block. Both consume the same
+// blocks; an engine kernel runs the two chains side by side. Without one the MAC pass
+// goes first and the decryption second: interleaving them block by block only makes the
+// table engines evict their encryption and decryption tables from each other.
+// "ciphertext" and "plaintext" may be the same buffer.
+void aes128_cbc_decrypt_mac(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv, uint8_t* mac)
+{
+    uint32_t i, j;
+
+    if (len == 0) return;
+
+    if ((ctx->impl == mac_ctx->impl) && (ctx->impl->cbc_decrypt_mac != NULL))
+    {
+        ctx->impl->cbc_decrypt_mac(ctx, mac_ctx, ciphertext, plaintext, len, iv, mac);
+        return;
+    }
+
+    for (i = 0; i < len; i += 16)
+    {
+        for (j = 0; j < 16; j++) mac[j] ^= ciphertext[i + j];
+        aes128_encrypt(mac_ctx, mac, mac);
+    }
+    aes128_cbc_decrypt(ctx, ciphertext, plaintext, len, iv);
+}
+
+/********************
+** AES-128 MULTI-LANE
+********************/
+
+// aes128_encrypt_lanes() for one group of n (at most AES128_MAX_LANES) blocks
+static void aes128_encrypt_lane_group(const struct aes128_ctx* const* ctx, const uint8_t* in, uint8_t* out, uint32_t n)
+{
+    const struct aes128_impl* impl;
+    uint32_t i;
+
+    impl = ctx[0]->impl;
+    for (i = 1; i < n; i++)
+    {
+        if (ctx[i]->impl != impl) impl = NULL;
+    }
+
+    if ((impl != NULL) && (impl->encrypt_lanes != NULL))
+    {
+        impl->encrypt_lanes(ctx, in, out, n);
+        return;
+    }
+    for (i = 0; i < n; i++)
+    {
+        ctx[i]->impl->encrypt(ctx[i], in + (i * 16), out + (i * 16));
+    }
+}
+
+// Encrypts n independent blocks: block i is in[16*i..] and is encrypted with ctx[i] into
+// out[16*i..]. The lanes may all use different keys, which lets the engine interleave
+// otherwise serial chains (CBC, CMAC) of unrelated sessions. Any n is accepted; the engine
+// gets the blocks AES128_MAX_LANES at a time. "in" and "out" may be the same buffer.
+void aes128_encrypt_lanes(const struct aes128_ctx* const* ctx, const uint8_t* in, uint8_t* out, uint32_t n)
+{
+    uint32_t m;
+
+    for (; n > 0; n -= m)
+    {
+        m = n;
+        if (m > AES128_MAX_LANES) m = AES128_MAX_LANES;
+        aes128_encrypt_lane_group(ctx, in, out, m);
+        ctx += m;
+        in += m * 16;
+        out += m * 16;
+    }
+}
+
+// aes128_cbc_encrypt_lanes() for one group of n (at most AES128_MAX_LANES) lanes
+static void aes128_cbc_encrypt_lane_group(const struct aes128_ctx* const* ctx, const uint8_t* const* plaintext, uint8_t* const* ciphertext, const uint32_t* len, uint8_t* iv, uint32_t n)
+{
+    const struct aes128_ctx* lane_ctx[AES128_MAX_LANES];
+    uint8_t block[AES128_MAX_LANES * 16];
+    uint32_t lane[AES128_MAX_LANES];
+    uint32_t i, j, k, m;
+    uint32_t Block = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        if ((len[i] / 16) > Block) Block = len[i] / 16;
+    }
+
+    for (j = 0; j < Block; j++)
+    {
+        m = 0;
+        for (i = 0; i < n; i++)
+        {
+            if (j >= (len[i] / 16)) continue;
+            for (k = 0; k < 16; k++)
+            {
+                block[(m * 16) + k] = plaintext[i][(j * 16) + k] ^ iv[(i * 16) + k];
+            }
+            lane_ctx[m] = ctx[i];
+            lane[m] = i;
+            m++;
+        }
+
+        aes128_encrypt_lanes(lane_ctx, block, block, m);
+
+        for (k = 0; k < m; k++)
+        {
+            i = lane[k];
+            memcpy(ciphertext[i] + (j * 16), block + (k * 16), 16);
+            memcpy(iv + (i * 16), block + (k * 16), 16);
+        }
+    }
+}
+
+// Runs n independent CBC encryptions side by side, one block of every unfinished lane per
+// aes128_encrypt_lanes() call. Lane i encrypts len[i] bytes (a multiple of 16, may be 0)
+// from plaintext[i] to ciphertext[i] with ctx[i]; iv[16*i..] is its IV and, as with
+// aes128_cbc_encrypt(), holds the last ciphertext block on return. Any n is accepted; the
+// lanes run AES128_MAX_LANES at a time.
+void aes128_cbc_encrypt_lanes(const struct aes128_ctx* const* ctx, const uint8_t* const* plaintext, uint8_t* const* ciphertext, const uint32_t* len, uint8_t* iv, uint32_t n)
+{
+    uint32_t m;
+
+    for (; n > 0; n -= m)
+    {
+        m = n;
+        if (m > AES128_MAX_LANES) m = AES128_MAX_LANES;
+        aes128_cbc_encrypt_lane_group(ctx, plaintext, ciphertext, len, iv, m);
+        ctx += m;
+        plaintext += m;
+        ciphertext += m;
+        len += m;
+        iv += m * 16;
+    }
+}
+
+/********************
+** AES-128 ONE-SHOT
+********************/
+
+void AES_128(uint8_t* key, uint8_t* plaintext, uint8_t* ciphertext)
+{
+    struct aes128_ctx ctx;
+
+    aes128_init_encrypt(&ctx, key);
+    aes128_encrypt(&ctx, plaintext, ciphertext);
+}
+
+void AES_128_CBC_Encrypt(uint8_t* key, uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv)
+{
+    struct aes128_ctx ctx;
+
+    aes128_init_encrypt(&ctx, key);
+    aes128_cbc_encrypt(&ctx, plaintext, ciphertext, len, iv);
+}
+
+void AES_128_CBC_Decrypt(uint8_t* key, uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv)
+{
+    struct aes128_ctx ctx;
+
+    aes128_init(&ctx, key);
+    aes128_cbc_decrypt(&ctx, ciphertext, plaintext, len, iv);
+}
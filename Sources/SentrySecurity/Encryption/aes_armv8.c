@@ -0,0 +1,275 @@
+/******************************************
+** AES-128 ARMv8 engine
+** Details: Uses the arm64 AES instructions (aese/aesmc/aesd/aesimc) for the round
+            function, so single blocks are both constant time and fast; this is the
+            default engine on every arm64 CPU that has them, which includes all Apple
+            arm64 devices. aese adds the round key before SubBytes/ShiftRows instead of
+            after, so a block takes nine aese/aesmc pairs, one aese and a final XOR.
+            Round keys are stored in aes128_ctx as eleven 16-byte blocks in memory order,
+            with the decryption schedule in the aesimc form of the encryption one (the
+            same layout as the AES-NI engine). The key expansion runs SubWord through
+            aese as well. Only selected by aes.c when cpu_features() reports the
+            extension.
+******************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "aes.h"
+#include "aes_impl.h"
+#include "cpu_features.h"
+
+#if AES_HAVE_ARMV8
+
+#include <string.h>
+#include <arm_neon.h>
+
+// SubWord(w) with the S-box of aese: the word fills all four columns, so ShiftRows only
+// moves equal bytes and lane 0 ends up with the substituted word.
+static inline uint32_t armv8_sub_word(uint32_t w)
+{
+    uint8x16_t v = vaeseq_u8(vreinterpretq_u8_u32(vdupq_n_u32(w)), vdupq_n_u8(0));
+    return vgetq_lane_u32(vreinterpretq_u32_u8(v), 0);
+}
+
+static void armv8_setkey(struct aes128_ctx* ctx, const uint8_t* key, int with_decrypt)
+{
+    static const uint8_t rcon[10] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36 };
+    uint32_t w[44];
+    uint32_t t;
+    int i;
+
+    // words as loaded little-endian, so key byte 0 is the low byte of w[0]
+    memcpy(w, key, 16);
+    for (i = 4; i < 44; i++)
+    {
+        t = w[i - 1];
+        if ((i % 4) == 0)
+        {
+            t = armv8_sub_word(t);
+            t = ((t >> 8) | (t << 24)) ^ rcon[(i / 4) - 1];     // RotWord after SubWord
+        }
+        w[i] = w[i - 4] ^ t;
+    }
+    memcpy(ctx->ek, w, sizeof(w));
+    if (!with_decrypt) return;
+
+    vst1q_u8((uint8_t*)ctx->dk, vld1q_u8((const uint8_t*)(ctx->ek + 40)));
+    for (i = 1; i < 10; i++)
+    {
+        vst1q_u8((uint8_t*)(ctx->dk + (4 * i)), vaesimcq_u8(vld1q_u8((const uint8_t*)(ctx->ek + (40 - (4 * i))))));
+    }
+    vst1q_u8((uint8_t*)(ctx->dk + 40), vld1q_u8((const uint8_t*)ctx->ek));
+}
+
+static inline void armv8_load_keys(uint8x16_t* k, const uint32_t* rk)
+{
+    int i;
+
+    for (i = 0; i < 11; i++) k[i] = vld1q_u8((const uint8_t*)(rk + (4 * i)));
+}
+
+static inline uint8x16_t armv8_encrypt_block(const uint8x16_t* k, uint8x16_t m)
+{
+    m = vaesmcq_u8(vaeseq_u8(m, k[0]));
+    m = vaesmcq_u8(vaeseq_u8(m, k[1]));
+    m = vaesmcq_u8(vaeseq_u8(m, k[2]));
+    m = vaesmcq_u8(vaeseq_u8(m, k[3]));
+    m = vaesmcq_u8(vaeseq_u8(m, k[4]));
+    m = vaesmcq_u8(vaeseq_u8(m, k[5]));
+    m = vaesmcq_u8(vaeseq_u8(m, k[6]));
+    m = vaesmcq_u8(vaeseq_u8(m, k[7]));
+    m = vaesmcq_u8(vaeseq_u8(m, k[8]));
+    return veorq_u8(vaeseq_u8(m, k[9]), k[10]);
+}
+
+static inline uint8x16_t armv8_decrypt_block(const uint8x16_t* k, uint8x16_t m)
+{
+    m = vaesimcq_u8(vaesdq_u8(m, k[0]));
+    m = vaesimcq_u8(vaesdq_u8(m, k[1]));
+    m = vaesimcq_u8(vaesdq_u8(m, k[2]));
+    m = vaesimcq_u8(vaesdq_u8(m, k[3]));
+    m = vaesimcq_u8(vaesdq_u8(m, k[4]));
+    m = vaesimcq_u8(vaesdq_u8(m, k[5]));
+    m = vaesimcq_u8(vaesdq_u8(m, k[6]));
+    m = vaesimcq_u8(vaesdq_u8(m, k[7]));
+    m = vaesimcq_u8(vaesdq_u8(m, k[8]));
+    return veorq_u8(vaesdq_u8(m, k[9]), k[10]);
+}
+
+static void armv8_encrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    uint8x16_t k[11];
+
+    armv8_load_keys(k, ctx->ek);
+    vst1q_u8(out, armv8_encrypt_block(k, vld1q_u8(in)));
+}
+
+static void armv8_decrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    uint8x16_t k[11];
+
+    armv8_load_keys(k, ctx->dk);
+    vst1q_u8(out, armv8_decrypt_block(k, vld1q_u8(in)));
+}
+
+static void armv8_cbc_encrypt(const struct aes128_ctx* ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv)
+{
+    uint8x16_t k[11];
+    uint8x16_t c = vld1q_u8(iv);
+    uint32_t i;
+
+    armv8_load_keys(k, ctx->ek);
+    for (i = 0; i < len / 16; i++)
+    {
+        c = armv8_encrypt_block(k, veorq_u8(vld1q_u8(plaintext + (i * 16)), c));
+        vst1q_u8(ciphertext + (i * 16), c);
+    }
+    vst1q_u8(iv, c);
+}
+
+#define ARMV8_DEC4(r) \
+    b0 = vaesimcq_u8(vaesdq_u8(b0, k[r])); \
+    b1 = vaesimcq_u8(vaesdq_u8(b1, k[r])); \
+    b2 = vaesimcq_u8(vaesdq_u8(b2, k[r])); \
+    b3 = vaesimcq_u8(vaesdq_u8(b3, k[r]));
+
+// CBC decryption with four independent blocks in flight, so the aesd/aesimc pairs of
+// different blocks overlap in the pipeline. Every ciphertext block is loaded before any
+// plaintext of its group is stored, which keeps the in-place case correct. Fewer than
+// four trailing blocks go one at a time.
+static void armv8_cbc_decrypt(const struct aes128_ctx* ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv)
+{
+    uint8x16_t k[11];
+    uint8x16_t prev = vld1q_u8(iv);
+    uint32_t blocks = len / 16;
+    uint32_t i = 0;
+
+    armv8_load_keys(k, ctx->dk);
+    for (; i + 4 <= blocks; i += 4)
+    {
+        const uint8_t* in = ciphertext + (i * 16);
+        uint8_t* out = plaintext + (i * 16);
+        uint8x16_t c0 = vld1q_u8(in);
+        uint8x16_t c1 = vld1q_u8(in + 16);
+        uint8x16_t c2 = vld1q_u8(in + 32);
+        uint8x16_t c3 = vld1q_u8(in + 48);
+        uint8x16_t b0 = c0, b1 = c1, b2 = c2, b3 = c3;
+
+        ARMV8_DEC4(0);
+        ARMV8_DEC4(1);
+        ARMV8_DEC4(2);
+        ARMV8_DEC4(3);
+        ARMV8_DEC4(4);
+        ARMV8_DEC4(5);
+        ARMV8_DEC4(6);
+        ARMV8_DEC4(7);
+        ARMV8_DEC4(8);
+        b0 = veorq_u8(veorq_u8(vaesdq_u8(b0, k[9]), k[10]), prev);
+        b1 = veorq_u8(veorq_u8(vaesdq_u8(b1, k[9]), k[10]), c0);
+        b2 = veorq_u8(veorq_u8(vaesdq_u8(b2, k[9]), k[10]), c1);
+        b3 = veorq_u8(veorq_u8(vaesdq_u8(b3, k[9]), k[10]), c2);
+        prev = c3;
+
+        vst1q_u8(out, b0);
+        vst1q_u8(out + 16, b1);
+        vst1q_u8(out + 32, b2);
+        vst1q_u8(out + 48, b3);
+    }
+
+    for (; i < blocks; i++)
+    {
+        uint8x16_t c = vld1q_u8(ciphertext + (i * 16));
+        vst1q_u8(plaintext + (i * 16), veorq_u8(armv8_decrypt_block(k, c), prev));
+        prev = c;
+    }
+    vst1q_u8(iv, prev);
+}
+
+// aes128_cbc_decrypt_mac(): block i is decrypted in lane a while the MAC chain absorbs it
+// in lane b, so the independent decryptions hide under the latency of the MAC chain.
+static void armv8_cbc_decrypt_mac(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv, uint8_t* mac)
+{
+    uint8x16_t ka[11], kb[11];
+    uint8x16_t prev = vld1q_u8(iv);
+    uint8x16_t x = vld1q_u8(mac);
+    uint8x16_t a, b, c;
+    uint32_t i;
+    int r;
+
+    armv8_load_keys(ka, ctx->dk);
+    armv8_load_keys(kb, mac_ctx->ek);
+    for (i = 0; i < len; i += 16)
+    {
+        c = vld1q_u8(ciphertext + i);
+        a = c;
+        b = veorq_u8(c, x);
+        for (r = 0; r < 9; r++)
+        {
+            a = vaesimcq_u8(vaesdq_u8(a, ka[r]));
+            b = vaesmcq_u8(vaeseq_u8(b, kb[r]));
+        }
+        a = veorq_u8(vaesdq_u8(a, ka[9]), ka[10]);
+        x = veorq_u8(vaeseq_u8(b, kb[9]), kb[10]);
+        vst1q_u8(plaintext + i, veorq_u8(a, prev));
+        prev = c;
+    }
+    vst1q_u8(iv, prev);
+    vst1q_u8(mac, x);
+}
+
+#define ARMV8_ENC_LANES(r) \
+    b0 = vaesmcq_u8(vaeseq_u8(b0, vld1q_u8(k0 + (16 * (r))))); \
+    b1 = vaesmcq_u8(vaeseq_u8(b1, vld1q_u8(k1 + (16 * (r))))); \
+    b2 = vaesmcq_u8(vaeseq_u8(b2, vld1q_u8(k2 + (16 * (r))))); \
+    b3 = vaesmcq_u8(vaeseq_u8(b3, vld1q_u8(k3 + (16 * (r)))));
+
+#define ARMV8_LAST_LANE(b, k) veorq_u8(vaeseq_u8((b), vld1q_u8((k) + 144)), vld1q_u8((k) + 160))
+
+// One block per lane, each with its own round keys. Four lanes are issued round by round
+// so their aese chains overlap in the pipeline; a partial group repeats its last lane.
+static void armv8_encrypt_lanes(const struct aes128_ctx* const* ctx, const uint8_t* in, uint8_t* out, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i += 4)
+    {
+        uint32_t l1 = (i + 1 < n) ? i + 1 : i;
+        uint32_t l2 = (i + 2 < n) ? i + 2 : l1;
+        uint32_t l3 = (i + 3 < n) ? i + 3 : l2;
+        const uint8_t* k0 = (const uint8_t*)ctx[i]->ek;
+        const uint8_t* k1 = (const uint8_t*)ctx[l1]->ek;
+        const uint8_t* k2 = (const uint8_t*)ctx[l2]->ek;
+        const uint8_t* k3 = (const uint8_t*)ctx[l3]->ek;
+        uint8x16_t b0 = vld1q_u8(in + (i * 16));
+        uint8x16_t b1 = vld1q_u8(in + (l1 * 16));
+        uint8x16_t b2 = vld1q_u8(in + (l2 * 16));
+        uint8x16_t b3 = vld1q_u8(in + (l3 * 16));
+
+        ARMV8_ENC_LANES(0);
+        ARMV8_ENC_LANES(1);
+        ARMV8_ENC_LANES(2);
+        ARMV8_ENC_LANES(3);
+        ARMV8_ENC_LANES(4);
+        ARMV8_ENC_LANES(5);
+        ARMV8_ENC_LANES(6);
+        ARMV8_ENC_LANES(7);
+        ARMV8_ENC_LANES(8);
+        b0 = ARMV8_LAST_LANE(b0, k0);
+        b1 = ARMV8_LAST_LANE(b1, k1);
+        b2 = ARMV8_LAST_LANE(b2, k2);
+        b3 = ARMV8_LAST_LANE(b3, k3);
+
+        // Store in reverse so a repeated lane ends up with its own result.
+        vst1q_u8(out + (l3 * 16), b3);
+        vst1q_u8(out + (l2 * 16), b2);
+        vst1q_u8(out + (l1 * 16), b1);
+        vst1q_u8(out + (i * 16), b0);
+    }
+}
+
+const struct aes128_impl aes128_impl_armv8 = {
+    AES_IMPL_ARMV8, armv8_setkey, armv8_encrypt, armv8_decrypt, armv8_cbc_encrypt, armv8_cbc_decrypt,
+    armv8_encrypt_lanes, NULL, armv8_cbc_decrypt_mac
+};
+
+#endif // AES_HAVE_ARMV8
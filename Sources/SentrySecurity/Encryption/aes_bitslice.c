@@ -0,0 +1,680 @@
+/******************************************
+** AES-128 bitsliced (constant-time) engine
+** Details: Processes four blocks at once with no table lookups and no secret-dependent
+            branches or memory accesses, so it does not leak through cache timing the
+            way the byte and T-table engines do. The 512 state bits of four blocks are
+            spread over eight 64-bit words, one word per bit position of every byte, so
+            that SubBytes becomes a fixed Boolean circuit (Boyar-Peralta) and ShiftRows /
+            MixColumns become shifts and rotations of whole words.
+
+            Word layout after ortho(): in q[i], bit i of byte (row r, column c) of block
+            b sits at position 16*r + 4*c + b.
+
+            The key schedule (also computed with the bitsliced S-box) is kept in
+            ctx->bs in compressed form, two words per round key, and expanded on the
+            stack for each call. Decryption uses the same schedule in reverse, so
+            ctx->dk is not used. Single blocks cost as much as four; the engine is
+            fastest in CBC decryption and aes128_encrypt_lanes(), where every lane of
+            the bitsliced state carries real data.
+******************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "aes.h"
+#include "aes_impl.h"
+
+#define GETU32_LE(pt) (((uint32_t)(pt)[0]) | ((uint32_t)(pt)[1] << 8) | ((uint32_t)(pt)[2] << 16) | ((uint32_t)(pt)[3] << 24))
+#define PUTU32_LE(ct, st) { (ct)[0] = (uint8_t)(st); (ct)[1] = (uint8_t)((st) >> 8); (ct)[2] = (uint8_t)((st) >> 16); (ct)[3] = (uint8_t)((st) >> 24); }
+
+/*********************
+** BITSLICE PRIMITIVES
+*********************/
+
+// SubBytes on all 64 bytes held in q. Circuit from Boyar and Peralta, "A depth-16
+// circuit for the AES S-box" (113 gates).
+static void bitslice_Sbox(uint64_t* q)
+{
+    uint64_t x0, x1, x2, x3, x4, x5, x6, x7;
+    uint64_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+    uint64_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+    uint64_t y20, y21;
+    uint64_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+    uint64_t z10, z11, z12, z13, z14, z15, z16, z17;
+    uint64_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+    uint64_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+    uint64_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+    uint64_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+    uint64_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+    uint64_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+    uint64_t t60, t61, t62, t63, t64, t65, t66, t67;
+    uint64_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+    x0 = q[7];
+    x1 = q[6];
+    x2 = q[5];
+    x3 = q[4];
+    x4 = q[3];
+    x5 = q[2];
+    x6 = q[1];
+    x7 = q[0];
+
+    // top linear transformation
+    y14 = x3 ^ x5;
+    y13 = x0 ^ x6;
+    y9 = x0 ^ x3;
+    y8 = x0 ^ x5;
+    t0 = x1 ^ x2;
+    y1 = t0 ^ x7;
+    y4 = y1 ^ x3;
+    y12 = y13 ^ y14;
+    y2 = y1 ^ x0;
+    y5 = y1 ^ x6;
+    y3 = y5 ^ y8;
+    t1 = x4 ^ y12;
+    y15 = t1 ^ x5;
+    y20 = t1 ^ x1;
+    y6 = y15 ^ x7;
+    y10 = y15 ^ t0;
+    y11 = y20 ^ y9;
+    y7 = x7 ^ y11;
+    y17 = y10 ^ y11;
+    y19 = y10 ^ y8;
+    y16 = t0 ^ y11;
+    y21 = y13 ^ y16;
+    y18 = x0 ^ y16;
+
+    // non-linear section
+    t2 = y12 & y15;
+    t3 = y3 & y6;
+    t4 = t3 ^ t2;
+    t5 = y4 & x7;
+    t6 = t5 ^ t2;
+    t7 = y13 & y16;
+    t8 = y5 & y1;
+    t9 = t8 ^ t7;
+    t10 = y2 & y7;
+    t11 = t10 ^ t7;
+    t12 = y9 & y11;
+    t13 = y14 & y17;
+    t14 = t13 ^ t12;
+    t15 = y8 & y10;
+    t16 = t15 ^ t12;
+    t17 = t4 ^ t14;
+    t18 = t6 ^ t16;
+    t19 = t9 ^ t14;
+    t20 = t11 ^ t16;
+    t21 = t17 ^ y20;
+    t22 = t18 ^ y19;
+    t23 = t19 ^ y21;
+    t24 = t20 ^ y18;
+
+    t25 = t21 ^ t22;
+    t26 = t21 & t23;
+    t27 = t24 ^ t26;
+    t28 = t25 & t27;
+    t29 = t28 ^ t22;
+    t30 = t23 ^ t24;
+    t31 = t22 ^ t26;
+    t32 = t31 & t30;
+    t33 = t32 ^ t24;
+    t34 = t23 ^ t33;
+    t35 = t27 ^ t33;
+    t36 = t24 & t35;
+    t37 = t36 ^ t34;
+    t38 = t27 ^ t36;
+    t39 = t29 & t38;
+    t40 = t25 ^ t39;
+
+    t41 = t40 ^ t37;
+    t42 = t29 ^ t33;
+    t43 = t29 ^ t40;
+    t44 = t33 ^ t37;
+    t45 = t42 ^ t41;
+    z0 = t44 & y15;
+    z1 = t37 & y6;
+    z2 = t33 & x7;
+    z3 = t43 & y16;
+    z4 = t40 & y1;
+    z5 = t29 & y7;
+    z6 = t42 & y11;
+    z7 = t45 & y17;
+    z8 = t41 & y10;
+    z9 = t44 & y12;
+    z10 = t37 & y3;
+    z11 = t33 & y4;
+    z12 = t43 & y13;
+    z13 = t40 & y5;
+    z14 = t29 & y2;
+    z15 = t42 & y9;
+    z16 = t45 & y14;
+    z17 = t41 & y8;
+
+    // bottom linear transformation
+    t46 = z15 ^ z16;
+    t47 = z10 ^ z11;
+    t48 = z5 ^ z13;
+    t49 = z9 ^ z10;
+    t50 = z2 ^ z12;
+    t51 = z2 ^ z5;
+    t52 = z7 ^ z8;
+    t53 = z0 ^ z3;
+    t54 = z6 ^ z7;
+    t55 = z16 ^ z17;
+    t56 = z12 ^ t48;
+    t57 = t50 ^ t53;
+    t58 = z4 ^ t46;
+    t59 = z3 ^ t54;
+    t60 = t46 ^ t57;
+    t61 = z14 ^ t57;
+    t62 = t52 ^ t58;
+    t63 = t49 ^ t58;
+    t64 = z4 ^ t59;
+    t65 = t61 ^ t62;
+    t66 = z1 ^ t63;
+    s0 = t59 ^ t63;
+    s6 = t56 ^ ~t62;
+    s7 = t48 ^ ~t60;
+    t67 = t64 ^ t65;
+    s3 = t53 ^ t66;
+    s4 = t51 ^ t66;
+    s5 = t47 ^ t65;
+    s1 = t64 ^ ~s3;
+    s2 = t55 ^ ~t67;
+
+    q[7] = s0;
+    q[6] = s1;
+    q[5] = s2;
+    q[4] = s3;
+    q[3] = s4;
+    q[2] = s5;
+    q[1] = s6;
+    q[0] = s7;
+}
+
+// Inverse affine transform followed by the 0x63 constant, in bitsliced form.
+static void bitslice_inv_affine(uint64_t* q)
+{
+    uint64_t q0, q1, q2, q3, q4, q5, q6, q7;
+
+    q0 = ~q[0];
+    q1 = ~q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = ~q[5];
+    q6 = ~q[6];
+    q7 = q[7];
+    q[7] = q1 ^ q4 ^ q6;
+    q[6] = q0 ^ q3 ^ q5;
+    q[5] = q7 ^ q2 ^ q4;
+    q[4] = q6 ^ q1 ^ q3;
+    q[3] = q5 ^ q0 ^ q2;
+    q[2] = q4 ^ q7 ^ q1;
+    q[1] = q3 ^ q6 ^ q0;
+    q[0] = q2 ^ q5 ^ q7;
+}
+
+// InvSubBytes: S^-1(x) = A^-1(S(A^-1(x ^ 0x63)) ^ 0x63), reusing the forward circuit.
+static void bitslice_invSbox(uint64_t* q)
+{
+    bitslice_inv_affine(q);
+    bitslice_Sbox(q);
+    bitslice_inv_affine(q);
+}
+
+// Transposes the eight words so that each ends up holding a single bit position of
+// every byte. The transform is its own inverse.
+#define SWAPN(cl, ch, s, x, y) { \
+    uint64_t a = (x), b = (y); \
+    (x) = (a & (uint64_t)(cl)) | ((b & (uint64_t)(cl)) << (s)); \
+    (y) = ((a & (uint64_t)(ch)) >> (s)) | (b & (uint64_t)(ch)); }
+
+#define SWAP2(x, y) SWAPN(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, x, y)
+#define SWAP4(x, y) SWAPN(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, x, y)
+#define SWAP8(x, y) SWAPN(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, x, y)
+
+static void ortho(uint64_t* q)
+{
+    SWAP2(q[0], q[1]);
+    SWAP2(q[2], q[3]);
+    SWAP2(q[4], q[5]);
+    SWAP2(q[6], q[7]);
+
+    SWAP4(q[0], q[2]);
+    SWAP4(q[1], q[3]);
+    SWAP4(q[4], q[6]);
+    SWAP4(q[5], q[7]);
+
+    SWAP8(q[0], q[4]);
+    SWAP8(q[1], q[5]);
+    SWAP8(q[2], q[6]);
+    SWAP8(q[3], q[7]);
+}
+
+// Spreads one block (four little-endian words) over two words, ready for ortho().
+static void interleave_in(uint64_t* q0, uint64_t* q1, const uint32_t* w)
+{
+    uint64_t x0 = w[0], x1 = w[1], x2 = w[2], x3 = w[3];
+
+    x0 |= (x0 << 16);
+    x1 |= (x1 << 16);
+    x2 |= (x2 << 16);
+    x3 |= (x3 << 16);
+    x0 &= (uint64_t)0x0000FFFF0000FFFF;
+    x1 &= (uint64_t)0x0000FFFF0000FFFF;
+    x2 &= (uint64_t)0x0000FFFF0000FFFF;
+    x3 &= (uint64_t)0x0000FFFF0000FFFF;
+    x0 |= (x0 << 8);
+    x1 |= (x1 << 8);
+    x2 |= (x2 << 8);
+    x3 |= (x3 << 8);
+    x0 &= (uint64_t)0x00FF00FF00FF00FF;
+    x1 &= (uint64_t)0x00FF00FF00FF00FF;
+    x2 &= (uint64_t)0x00FF00FF00FF00FF;
+    x3 &= (uint64_t)0x00FF00FF00FF00FF;
+    *q0 = x0 | (x2 << 8);
+    *q1 = x1 | (x3 << 8);
+}
+
+static void interleave_out(uint32_t* w, uint64_t q0, uint64_t q1)
+{
+    uint64_t x0, x1, x2, x3;
+
+    x0 = q0 & (uint64_t)0x00FF00FF00FF00FF;
+    x1 = q1 & (uint64_t)0x00FF00FF00FF00FF;
+    x2 = (q0 >> 8) & (uint64_t)0x00FF00FF00FF00FF;
+    x3 = (q1 >> 8) & (uint64_t)0x00FF00FF00FF00FF;
+    x0 |= (x0 >> 8);
+    x1 |= (x1 >> 8);
+    x2 |= (x2 >> 8);
+    x3 |= (x3 >> 8);
+    x0 &= (uint64_t)0x0000FFFF0000FFFF;
+    x1 &= (uint64_t)0x0000FFFF0000FFFF;
+    x2 &= (uint64_t)0x0000FFFF0000FFFF;
+    x3 &= (uint64_t)0x0000FFFF0000FFFF;
+    w[0] = (uint32_t)x0 | (uint32_t)(x0 >> 16);
+    w[1] = (uint32_t)x1 | (uint32_t)(x1 >> 16);
+    w[2] = (uint32_t)x2 | (uint32_t)(x2 >> 16);
+    w[3] = (uint32_t)x3 | (uint32_t)(x3 >> 16);
+}
+
+// Loads four 16-byte blocks (w holds them as 16 little-endian words) into bitsliced form.
+static void bitslice_load(uint64_t* q, const uint32_t* w)
+{
+    int i;
+
+    for (i = 0; i < 4; i++) interleave_in(&q[i], &q[i + 4], w + (i * 4));
+    ortho(q);
+}
+
+static void bitslice_store(uint32_t* w, uint64_t* q)
+{
+    int i;
+
+    ortho(q);
+    for (i = 0; i < 4; i++) interleave_out(w + (i * 4), q[i], q[i + 4]);
+}
+
+static void add_round_key(uint64_t* q, const uint64_t* sk)
+{
+    q[0] ^= sk[0];
+    q[1] ^= sk[1];
+    q[2] ^= sk[2];
+    q[3] ^= sk[3];
+    q[4] ^= sk[4];
+    q[5] ^= sk[5];
+    q[6] ^= sk[6];
+    q[7] ^= sk[7];
+}
+
+static void shift_rows(uint64_t* q)
+{
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        uint64_t x = q[i];
+
+        q[i] = (x & (uint64_t)0x000000000000FFFF)
+             | ((x & (uint64_t)0x00000000FFF00000) >> 4)
+             | ((x & (uint64_t)0x00000000000F0000) << 12)
+             | ((x & (uint64_t)0x0000FF0000000000) >> 8)
+             | ((x & (uint64_t)0x000000FF00000000) << 8)
+             | ((x & (uint64_t)0xF000000000000000) >> 12)
+             | ((x & (uint64_t)0x0FFF000000000000) << 4);
+    }
+}
+
+static void inv_shift_rows(uint64_t* q)
+{
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        uint64_t x = q[i];
+
+        q[i] = (x & (uint64_t)0x000000000000FFFF)
+             | ((x & (uint64_t)0x000000000FFF0000) << 4)
+             | ((x & (uint64_t)0x00000000F0000000) >> 12)
+             | ((x & (uint64_t)0x000000FF00000000) << 8)
+             | ((x & (uint64_t)0x0000FF0000000000) >> 8)
+             | ((x & (uint64_t)0x000F000000000000) << 12)
+             | ((x & (uint64_t)0xFFF0000000000000) >> 4);
+    }
+}
+
+static uint64_t rotr32(uint64_t x)
+{
+    return (x << 32) | (x >> 32);
+}
+
+// Each output row is 2*a[r] ^ 3*a[r+1] ^ a[r+2] ^ a[r+3]; "r" holds the rows shifted by
+// one and rotr32() shifts by two.
+static void mix_columns(uint64_t* q)
+{
+    uint64_t q0, q1, q2, q3, q4, q5, q6, q7;
+    uint64_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+    r0 = (q0 >> 16) | (q0 << 48);
+    r1 = (q1 >> 16) | (q1 << 48);
+    r2 = (q2 >> 16) | (q2 << 48);
+    r3 = (q3 >> 16) | (q3 << 48);
+    r4 = (q4 >> 16) | (q4 << 48);
+    r5 = (q5 >> 16) | (q5 << 48);
+    r6 = (q6 >> 16) | (q6 << 48);
+    r7 = (q7 >> 16) | (q7 << 48);
+
+    q[0] = q7 ^ r7 ^ r0 ^ rotr32(q0 ^ r0);
+    q[1] = q0 ^ r0 ^ q7 ^ r7 ^ r1 ^ rotr32(q1 ^ r1);
+    q[2] = q1 ^ r1 ^ r2 ^ rotr32(q2 ^ r2);
+    q[3] = q2 ^ r2 ^ q7 ^ r7 ^ r3 ^ rotr32(q3 ^ r3);
+    q[4] = q3 ^ r3 ^ q7 ^ r7 ^ r4 ^ rotr32(q4 ^ r4);
+    q[5] = q4 ^ r4 ^ r5 ^ rotr32(q5 ^ r5);
+    q[6] = q5 ^ r5 ^ r6 ^ rotr32(q6 ^ r6);
+    q[7] = q6 ^ r6 ^ r7 ^ rotr32(q7 ^ r7);
+}
+
+// Each output row is 0e*a[r] ^ 0b*a[r+1] ^ 0d*a[r+2] ^ 09*a[r+3]; "r" holds the rows
+// shifted by one and rotr32() shifts by two.
+static void inv_mix_columns(uint64_t* q)
+{
+    uint64_t q0, q1, q2, q3, q4, q5, q6, q7;
+    uint64_t r0, r1, r2, r3, r4, r5, r6, r7;
+
+    q0 = q[0];
+    q1 = q[1];
+    q2 = q[2];
+    q3 = q[3];
+    q4 = q[4];
+    q5 = q[5];
+    q6 = q[6];
+    q7 = q[7];
+    r0 = (q0 >> 16) | (q0 << 48);
+    r1 = (q1 >> 16) | (q1 << 48);
+    r2 = (q2 >> 16) | (q2 << 48);
+    r3 = (q3 >> 16) | (q3 << 48);
+    r4 = (q4 >> 16) | (q4 << 48);
+    r5 = (q5 >> 16) | (q5 << 48);
+    r6 = (q6 >> 16) | (q6 << 48);
+    r7 = (q7 >> 16) | (q7 << 48);
+
+    q[0] = q5 ^ q6 ^ q7 ^ r0 ^ r5 ^ r7 ^ rotr32(q0 ^ q5 ^ q6 ^ r0 ^ r5);
+    q[1] = q0 ^ q5 ^ r0 ^ r1 ^ r5 ^ r6 ^ r7 ^ rotr32(q1 ^ q5 ^ q7 ^ r1 ^ r5 ^ r6);
+    q[2] = q0 ^ q1 ^ q6 ^ r1 ^ r2 ^ r6 ^ r7 ^ rotr32(q0 ^ q2 ^ q6 ^ r2 ^ r6 ^ r7);
+    q[3] = q0 ^ q1 ^ q2 ^ q5 ^ q6 ^ r0 ^ r2 ^ r3 ^ r5 ^ rotr32(q0 ^ q1 ^ q3 ^ q5 ^ q6 ^ q7 ^ r0 ^ r3 ^ r5 ^ r7);
+    q[4] = q1 ^ q2 ^ q3 ^ q5 ^ r1 ^ r3 ^ r4 ^ r5 ^ r6 ^ r7 ^ rotr32(q1 ^ q2 ^ q4 ^ q5 ^ q7 ^ r1 ^ r4 ^ r5 ^ r6);
+    q[5] = q2 ^ q3 ^ q4 ^ q6 ^ r2 ^ r4 ^ r5 ^ r6 ^ r7 ^ rotr32(q2 ^ q3 ^ q5 ^ q6 ^ r2 ^ r5 ^ r6 ^ r7);
+    q[6] = q3 ^ q4 ^ q5 ^ q7 ^ r3 ^ r5 ^ r6 ^ r7 ^ rotr32(q3 ^ q4 ^ q6 ^ q7 ^ r3 ^ r6 ^ r7);
+    q[7] = q4 ^ q5 ^ q6 ^ r4 ^ r6 ^ r7 ^ rotr32(q4 ^ q5 ^ q7 ^ r4 ^ r7);
+}
+
+/*********************
+** KEY SCHEDULE
+*********************/
+
+// SubWord() on one word, without tables.
+static uint32_t bitslice_sub_word(uint32_t x)
+{
+    uint64_t q[8] = { 0 };
+
+    q[0] = x;
+    ortho(q);
+    bitslice_Sbox(q);
+    ortho(q);
+    return (uint32_t)q[0];
+}
+
+// FIPS-197 key expansion on little-endian words, then conversion of every round key to
+// the compressed bitsliced form: one bit per block lane, four bit planes per word.
+static void bitslice_setkey(struct aes128_ctx* ctx, const uint8_t* key, int with_decrypt)
+{
+    static const uint8_t Rcon[10] = { 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36 };
+    uint32_t w[44];
+    uint32_t tmp;
+    int i;
+
+    (void)with_decrypt;
+
+    for (i = 0; i < 4; i++) w[i] = GETU32_LE(key + (i * 4));
+    for (i = 4; i < 44; i++)
+    {
+        tmp = w[i - 1];
+        if ((i % 4) == 0)
+        {
+            tmp = bitslice_sub_word((tmp >> 8) | (tmp << 24)) ^ Rcon[(i / 4) - 1];
+        }
+        w[i] = w[i - 4] ^ tmp;
+    }
+
+    for (i = 0; i < 11; i++)
+    {
+        uint64_t q[8];
+
+        interleave_in(&q[0], &q[4], w + (i * 4));
+        q[1] = q[0];
+        q[2] = q[0];
+        q[3] = q[0];
+        q[5] = q[4];
+        q[6] = q[4];
+        q[7] = q[4];
+        ortho(q);
+        ctx->bs[(i * 2)] = (q[0] & (uint64_t)0x1111111111111111) | (q[1] & (uint64_t)0x2222222222222222)
+                         | (q[2] & (uint64_t)0x4444444444444444) | (q[3] & (uint64_t)0x8888888888888888);
+        ctx->bs[(i * 2) + 1] = (q[4] & (uint64_t)0x1111111111111111) | (q[5] & (uint64_t)0x2222222222222222)
+                             | (q[6] & (uint64_t)0x4444444444444444) | (q[7] & (uint64_t)0x8888888888888888);
+    }
+}
+
+// Replicates every round key bit into the four block lanes.
+static void skey_expand(uint64_t* skey, const uint64_t* comp_skey)
+{
+    int u, v;
+
+    for (u = 0, v = 0; u < 22; u++, v += 4)
+    {
+        uint64_t x0, x1, x2, x3;
+
+        x0 = x1 = x2 = x3 = comp_skey[u];
+        x0 &= (uint64_t)0x1111111111111111;
+        x1 &= (uint64_t)0x2222222222222222;
+        x2 &= (uint64_t)0x4444444444444444;
+        x3 &= (uint64_t)0x8888888888888888;
+        x1 >>= 1;
+        x2 >>= 2;
+        x3 >>= 3;
+        skey[v] = (x0 << 4) - x0;
+        skey[v + 1] = (x1 << 4) - x1;
+        skey[v + 2] = (x2 << 4) - x2;
+        skey[v + 3] = (x3 << 4) - x3;
+    }
+}
+
+// Builds an expanded schedule where block lane b uses the key of comp_skey[b]; lanes past
+// n repeat the last key.
+static void skey_expand_lanes(uint64_t* skey, const uint64_t* const* comp_skey, uint32_t n)
+{
+    const uint64_t m = (uint64_t)0x1111111111111111;
+    uint32_t b;
+    int u;
+
+    for (u = 0; u < 88; u++) skey[u] = 0;
+    for (b = 0; b < 4; b++)
+    {
+        const uint64_t* k = comp_skey[(b < n) ? b : n - 1];
+
+        for (u = 0; u < 22; u++)
+        {
+            uint64_t x = k[u];
+
+            skey[(u * 4)] |= (x & m) << b;
+            skey[(u * 4) + 1] |= ((x >> 1) & m) << b;
+            skey[(u * 4) + 2] |= ((x >> 2) & m) << b;
+            skey[(u * 4) + 3] |= ((x >> 3) & m) << b;
+        }
+    }
+}
+
+/*********************
+** CIPHER
+*********************/
+
+// FIPS-197 cipher on four bitsliced blocks; skey is the expanded schedule.
+static void bitslice_encrypt(const uint64_t* skey, uint64_t* q)
+{
+    int r;
+
+    add_round_key(q, skey);
+    for (r = 1; r < 10; r++)
+    {
+        bitslice_Sbox(q);
+        shift_rows(q);
+        mix_columns(q);
+        add_round_key(q, skey + (r * 8));
+    }
+    bitslice_Sbox(q);
+    shift_rows(q);
+    add_round_key(q, skey + 80);
+}
+
+// FIPS-197 inverse cipher on four bitsliced blocks, with the encryption schedule.
+static void bitslice_decrypt(const uint64_t* skey, uint64_t* q)
+{
+    int r;
+
+    add_round_key(q, skey + 80);
+    for (r = 9; r > 0; r--)
+    {
+        inv_shift_rows(q);
+        bitslice_invSbox(q);
+        add_round_key(q, skey + (r * 8));
+        inv_mix_columns(q);
+    }
+    inv_shift_rows(q);
+    bitslice_invSbox(q);
+    add_round_key(q, skey);
+}
+
+// Runs one block through lane 0; the other lanes carry zero blocks.
+static void bitslice_block(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out, int decrypt)
+{
+    uint64_t skey[88];
+    uint64_t q[8];
+    uint32_t w[16] = { 0 };
+    int j;
+
+    skey_expand(skey, ctx->bs);
+    for (j = 0; j < 4; j++) w[j] = GETU32_LE(in + (j * 4));
+
+    bitslice_load(q, w);
+    if (decrypt) bitslice_decrypt(skey, q);
+    else bitslice_encrypt(skey, q);
+    bitslice_store(w, q);
+
+    for (j = 0; j < 4; j++) PUTU32_LE(out + (j * 4), w[j]);
+}
+
+static void bitslice_encrypt_block(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    bitslice_block(ctx, in, out, 0);
+}
+
+static void bitslice_decrypt_block(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    bitslice_block(ctx, in, out, 1);
+}
+
+// CBC decryption four blocks at a time. The ciphertext of each group is held in local
+// words, so "ciphertext" and "plaintext" may be the same buffer. A trailing group of
+// fewer than four blocks is padded with zero blocks that are never written out.
+static void bitslice_cbc_decrypt(const struct aes128_ctx* ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv)
+{
+    uint64_t skey[88];
+    uint64_t q[8];
+    uint32_t cw[16], w[16], prev[4];
+    uint32_t blocks = len / 16;
+    uint32_t i, j, n;
+
+    skey_expand(skey, ctx->bs);
+    for (j = 0; j < 4; j++) prev[j] = GETU32_LE(iv + (j * 4));
+
+    for (i = 0; i < blocks; i += n)
+    {
+        n = blocks - i;
+        if (n > 4) n = 4;
+
+        for (j = 0; j < n * 4; j++) cw[j] = GETU32_LE(ciphertext + (i * 16) + (j * 4));
+        for (; j < 16; j++) cw[j] = 0;
+
+        bitslice_load(q, cw);
+        bitslice_decrypt(skey, q);
+        bitslice_store(w, q);
+
+        for (j = 0; j < 4; j++) w[j] ^= prev[j];
+        for (j = 4; j < n * 4; j++) w[j] ^= cw[j - 4];
+        for (j = 0; j < n * 4; j++) PUTU32_LE(plaintext + (i * 16) + (j * 4), w[j]);
+        for (j = 0; j < 4; j++) prev[j] = cw[((n - 1) * 4) + j];
+    }
+
+    for (j = 0; j < 4; j++) PUTU32_LE(iv + (j * 4), prev[j]);
+}
+
+// One block per lane, each lane with its own key: four lanes share one bitsliced pass.
+static void bitslice_encrypt_lanes(const struct aes128_ctx* const* ctx, const uint8_t* in, uint8_t* out, uint32_t n)
+{
+    const uint64_t* comp[4];
+    uint64_t skey[88];
+    uint64_t q[8];
+    uint32_t w[16];
+    uint32_t i, j, m;
+
+    for (i = 0; i < n; i += m)
+    {
+        m = n - i;
+        if (m > 4) m = 4;
+
+        for (j = 0; j < m; j++) comp[j] = ctx[i + j]->bs;
+        skey_expand_lanes(skey, comp, m);
+
+        for (j = 0; j < m * 4; j++) w[j] = GETU32_LE(in + (i * 16) + (j * 4));
+        for (; j < 16; j++) w[j] = 0;
+
+        bitslice_load(q, w);
+        bitslice_encrypt(skey, q);
+        bitslice_store(w, q);
+
+        for (j = 0; j < m * 4; j++) PUTU32_LE(out + (i * 16) + (j * 4), w[j]);
+    }
+}
+
+const struct aes128_impl aes128_impl_bitslice = {
+    AES_IMPL_BITSLICE, bitslice_setkey, bitslice_encrypt_block, bitslice_decrypt_block, NULL, bitslice_cbc_decrypt,
+    bitslice_encrypt_lanes, NULL, NULL
+};
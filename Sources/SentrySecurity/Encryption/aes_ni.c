@@ -0,0 +1,367 @@
+/******************************************
+** AES-128 AES-NI engine
+** Details: Uses the x86 AES instructions (aesenc/aesdec/aeskeygenassist) for the round
+            function and key expansion. Round keys are stored in aes128_ctx as eleven
+            16-byte blocks in memory order; the decryption schedule is the aesimc form of
+            the encryption one. Only selected by aes.c when cpuid reports AES-NI.
+******************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "aes.h"
+#include "aes_impl.h"
+#include "cpu_features.h"
+
+#if AES_HAVE_AESNI
+
+#include <string.h>
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+
+#define AESNI_TARGET __attribute__((target("aes,ssse3")))
+
+static AESNI_TARGET inline __m128i aesni_expand_step(__m128i k, __m128i kg)
+{
+    kg = _mm_shuffle_epi32(kg, 0xff);
+    k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+    k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+    k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+    return _mm_xor_si128(k, kg);
+}
+
+// aeskeygenassist needs the round constant as an immediate
+#define AESNI_EXPAND(k, rcon) aesni_expand_step((k), _mm_aeskeygenassist_si128((k), (rcon)))
+
+static AESNI_TARGET void aesni_setkey(struct aes128_ctx* ctx, const uint8_t* key, int with_decrypt)
+{
+    __m128i* ek = (__m128i*)ctx->ek;
+    __m128i* dk = (__m128i*)ctx->dk;
+    __m128i rk[11];
+    int i;
+
+    rk[0] = _mm_loadu_si128((const __m128i*)key);
+    rk[1] = AESNI_EXPAND(rk[0], 0x01);
+    rk[2] = AESNI_EXPAND(rk[1], 0x02);
+    rk[3] = AESNI_EXPAND(rk[2], 0x04);
+    rk[4] = AESNI_EXPAND(rk[3], 0x08);
+    rk[5] = AESNI_EXPAND(rk[4], 0x10);
+    rk[6] = AESNI_EXPAND(rk[5], 0x20);
+    rk[7] = AESNI_EXPAND(rk[6], 0x40);
+    rk[8] = AESNI_EXPAND(rk[7], 0x80);
+    rk[9] = AESNI_EXPAND(rk[8], 0x1b);
+    rk[10] = AESNI_EXPAND(rk[9], 0x36);
+
+    for (i = 0; i < 11; i++) _mm_storeu_si128(ek + i, rk[i]);
+    if (!with_decrypt) return;
+
+    _mm_storeu_si128(dk, rk[10]);
+    for (i = 1; i < 10; i++) _mm_storeu_si128(dk + i, _mm_aesimc_si128(rk[10 - i]));
+    _mm_storeu_si128(dk + 10, rk[0]);
+}
+
+static AESNI_TARGET inline __m128i aesni_encrypt_block(const __m128i* rk, __m128i m)
+{
+    m = _mm_xor_si128(m, _mm_loadu_si128(rk));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 1));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 2));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 3));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 4));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 5));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 6));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 7));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 8));
+    m = _mm_aesenc_si128(m, _mm_loadu_si128(rk + 9));
+    return _mm_aesenclast_si128(m, _mm_loadu_si128(rk + 10));
+}
+
+static AESNI_TARGET inline __m128i aesni_decrypt_block(const __m128i* rk, __m128i m)
+{
+    m = _mm_xor_si128(m, _mm_loadu_si128(rk));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 1));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 2));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 3));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 4));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 5));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 6));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 7));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 8));
+    m = _mm_aesdec_si128(m, _mm_loadu_si128(rk + 9));
+    return _mm_aesdeclast_si128(m, _mm_loadu_si128(rk + 10));
+}
+
+static AESNI_TARGET void aesni_encrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    __m128i m = _mm_loadu_si128((const __m128i*)in);
+    _mm_storeu_si128((__m128i*)out, aesni_encrypt_block((const __m128i*)ctx->ek, m));
+}
+
+static AESNI_TARGET void aesni_decrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    __m128i m = _mm_loadu_si128((const __m128i*)in);
+    _mm_storeu_si128((__m128i*)out, aesni_decrypt_block((const __m128i*)ctx->dk, m));
+}
+
+static AESNI_TARGET void aesni_cbc_encrypt(const struct aes128_ctx* ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv)
+{
+    const __m128i* rk = (const __m128i*)ctx->ek;
+    __m128i c = _mm_loadu_si128((const __m128i*)iv);
+    uint32_t i;
+
+    for (i = 0; i < len / 16; i++)
+    {
+        __m128i p = _mm_loadu_si128((const __m128i*)(plaintext + (i * 16)));
+        c = aesni_encrypt_block(rk, _mm_xor_si128(p, c));
+        _mm_storeu_si128((__m128i*)(ciphertext + (i * 16)), c);
+    }
+    _mm_storeu_si128((__m128i*)iv, c);
+}
+
+#define AESNI_DEC8(k) \
+    b0 = _mm_aesdec_si128(b0, k); \
+    b1 = _mm_aesdec_si128(b1, k); \
+    b2 = _mm_aesdec_si128(b2, k); \
+    b3 = _mm_aesdec_si128(b3, k); \
+    b4 = _mm_aesdec_si128(b4, k); \
+    b5 = _mm_aesdec_si128(b5, k); \
+    b6 = _mm_aesdec_si128(b6, k); \
+    b7 = _mm_aesdec_si128(b7, k);
+
+// pshufb masks for a 16-byte window "lead" bytes into a block pair: loading at
+// aesni_window + 16 - n yields the bytes of a block moved up by n, at + 32 - n its last
+// n bytes moved down to the front (0x80 lanes become zero).
+static const uint8_t aesni_window[48] = {
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80
+};
+
+#define AESNI_ENC_2LANES(op, r) \
+    a = op(a, _mm_loadu_si128(ka + (r))); \
+    b = op(b, _mm_loadu_si128(kb + (r)));
+
+#define AESNI_DEC_ENC_2LANES(op_a, op_b, r) \
+    a = op_a(a, _mm_loadu_si128(ka + (r))); \
+    b = op_b(b, _mm_loadu_si128(kb + (r)));
+
+// aes128_cbc_encrypt_mac(): the CBC chain and the MAC chain step round by round side by
+// side, and the MAC blocks of (lead | ciphertext) are assembled in registers.
+static AESNI_TARGET void aesni_cbc_encrypt_mac(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv, uint8_t* mac, uint8_t* lead, uint32_t lead_len)
+{
+    const __m128i* ka = (const __m128i*)ctx->ek;
+    const __m128i* kb = (const __m128i*)mac_ctx->ek;
+    const __m128i shift_up = _mm_loadu_si128((const __m128i*)(aesni_window + 16 - lead_len));
+    const __m128i shift_down = _mm_loadu_si128((const __m128i*)(aesni_window + 32 - lead_len));
+    __m128i a, b, c, prev, x;
+    uint8_t first[16];
+    uint32_t i;
+
+    // the lead bytes play the part of the ciphertext block before the first one
+    memset(first, 0, 16);
+    memcpy(first + 16 - lead_len, lead, lead_len);
+    prev = _mm_loadu_si128((const __m128i*)first);
+
+    x = _mm_loadu_si128((const __m128i*)mac);
+    c = aesni_encrypt_block(ka, _mm_xor_si128(_mm_loadu_si128((const __m128i*)plaintext), _mm_loadu_si128((const __m128i*)iv)));
+    _mm_storeu_si128((__m128i*)ciphertext, c);
+
+    for (i = 16; i < len; i += 16)
+    {
+        // block i/16 - 1 of S: tail of the block before c, then the head of c
+        b = _mm_or_si128(_mm_shuffle_epi8(prev, shift_down), _mm_shuffle_epi8(c, shift_up));
+        b = _mm_xor_si128(_mm_xor_si128(b, x), _mm_loadu_si128(kb));
+        a = _mm_xor_si128(_mm_xor_si128(_mm_loadu_si128((const __m128i*)(plaintext + i)), c), _mm_loadu_si128(ka));
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 1);
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 2);
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 3);
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 4);
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 5);
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 6);
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 7);
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 8);
+        AESNI_ENC_2LANES(_mm_aesenc_si128, 9);
+        AESNI_ENC_2LANES(_mm_aesenclast_si128, 10);
+        x = b;
+        prev = c;
+        c = a;
+        _mm_storeu_si128((__m128i*)(ciphertext + i), c);
+    }
+    _mm_storeu_si128((__m128i*)iv, c);
+
+    b = _mm_or_si128(_mm_shuffle_epi8(prev, shift_down), _mm_shuffle_epi8(c, shift_up));
+    if (lead_len > 0)
+    {
+        // the last block of S is followed by lead_len more bytes
+        x = aesni_encrypt_block(kb, _mm_xor_si128(b, x));
+        memcpy(lead, ciphertext + len - lead_len, lead_len);
+    }
+    else
+    {
+        _mm_storeu_si128((__m128i*)lead, b);
+    }
+    _mm_storeu_si128((__m128i*)mac, x);
+}
+
+// aes128_cbc_decrypt_mac(): block i is decrypted in lane a while the MAC chain absorbs it
+// in lane b. The decryptions do not depend on each other, so the round latency of the
+// MAC chain hides them entirely.
+static AESNI_TARGET void aesni_cbc_decrypt_mac(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv, uint8_t* mac)
+{
+    const __m128i* ka = (const __m128i*)ctx->dk;
+    const __m128i* kb = (const __m128i*)mac_ctx->ek;
+    __m128i a, b, c;
+    __m128i prev = _mm_loadu_si128((const __m128i*)iv);
+    __m128i x = _mm_loadu_si128((const __m128i*)mac);
+    uint32_t i;
+
+    for (i = 0; i < len; i += 16)
+    {
+        c = _mm_loadu_si128((const __m128i*)(ciphertext + i));
+        a = _mm_xor_si128(c, _mm_loadu_si128(ka));
+        b = _mm_xor_si128(_mm_xor_si128(c, x), _mm_loadu_si128(kb));
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 1);
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 2);
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 3);
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 4);
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 5);
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 6);
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 7);
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 8);
+        AESNI_DEC_ENC_2LANES(_mm_aesdec_si128, _mm_aesenc_si128, 9);
+        AESNI_DEC_ENC_2LANES(_mm_aesdeclast_si128, _mm_aesenclast_si128, 10);
+        x = b;
+        _mm_storeu_si128((__m128i*)(plaintext + i), _mm_xor_si128(a, prev));
+        prev = c;
+    }
+    _mm_storeu_si128((__m128i*)iv, prev);
+    _mm_storeu_si128((__m128i*)mac, x);
+}
+
+// CBC decryption with eight independent blocks in flight: aesdec has a latency of
+// several cycles but can issue every cycle, so a single block leaves the unit mostly
+// idle. The ciphertext is reloaded for the chaining XOR before anything is stored, which
+// keeps the in-place case correct. Fewer than eight trailing blocks go one at a time.
+static AESNI_TARGET void aesni_cbc_decrypt(const struct aes128_ctx* ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv)
+{
+    const __m128i* rk = (const __m128i*)ctx->dk;
+    __m128i prev = _mm_loadu_si128((const __m128i*)iv);
+    uint32_t blocks = len / 16;
+    uint32_t i = 0;
+
+    for (; i + 8 <= blocks; i += 8)
+    {
+        const __m128i* in = (const __m128i*)(ciphertext + (i * 16));
+        __m128i* out = (__m128i*)(plaintext + (i * 16));
+        __m128i b0, b1, b2, b3, b4, b5, b6, b7, c0, c1, c2, c3, c4, c5, c6, c7, k;
+
+        k = _mm_loadu_si128(rk);
+        b0 = _mm_xor_si128(_mm_loadu_si128(in), k);
+        b1 = _mm_xor_si128(_mm_loadu_si128(in + 1), k);
+        b2 = _mm_xor_si128(_mm_loadu_si128(in + 2), k);
+        b3 = _mm_xor_si128(_mm_loadu_si128(in + 3), k);
+        b4 = _mm_xor_si128(_mm_loadu_si128(in + 4), k);
+        b5 = _mm_xor_si128(_mm_loadu_si128(in + 5), k);
+        b6 = _mm_xor_si128(_mm_loadu_si128(in + 6), k);
+        b7 = _mm_xor_si128(_mm_loadu_si128(in + 7), k);
+
+        k = _mm_loadu_si128(rk + 1); AESNI_DEC8(k);
+        k = _mm_loadu_si128(rk + 2); AESNI_DEC8(k);
+        k = _mm_loadu_si128(rk + 3); AESNI_DEC8(k);
+        k = _mm_loadu_si128(rk + 4); AESNI_DEC8(k);
+        k = _mm_loadu_si128(rk + 5); AESNI_DEC8(k);
+        k = _mm_loadu_si128(rk + 6); AESNI_DEC8(k);
+        k = _mm_loadu_si128(rk + 7); AESNI_DEC8(k);
+        k = _mm_loadu_si128(rk + 8); AESNI_DEC8(k);
+        k = _mm_loadu_si128(rk + 9); AESNI_DEC8(k);
+
+        k = _mm_loadu_si128(rk + 10);
+        c0 = _mm_loadu_si128(in);
+        c1 = _mm_loadu_si128(in + 1);
+        c2 = _mm_loadu_si128(in + 2);
+        c3 = _mm_loadu_si128(in + 3);
+        c4 = _mm_loadu_si128(in + 4);
+        c5 = _mm_loadu_si128(in + 5);
+        c6 = _mm_loadu_si128(in + 6);
+        c7 = _mm_loadu_si128(in + 7);
+        b0 = _mm_xor_si128(_mm_aesdeclast_si128(b0, k), prev);
+        b1 = _mm_xor_si128(_mm_aesdeclast_si128(b1, k), c0);
+        b2 = _mm_xor_si128(_mm_aesdeclast_si128(b2, k), c1);
+        b3 = _mm_xor_si128(_mm_aesdeclast_si128(b3, k), c2);
+        b4 = _mm_xor_si128(_mm_aesdeclast_si128(b4, k), c3);
+        b5 = _mm_xor_si128(_mm_aesdeclast_si128(b5, k), c4);
+        b6 = _mm_xor_si128(_mm_aesdeclast_si128(b6, k), c5);
+        b7 = _mm_xor_si128(_mm_aesdeclast_si128(b7, k), c6);
+        prev = c7;
+
+        _mm_storeu_si128(out, b0);
+        _mm_storeu_si128(out + 1, b1);
+        _mm_storeu_si128(out + 2, b2);
+        _mm_storeu_si128(out + 3, b3);
+        _mm_storeu_si128(out + 4, b4);
+        _mm_storeu_si128(out + 5, b5);
+        _mm_storeu_si128(out + 6, b6);
+        _mm_storeu_si128(out + 7, b7);
+    }
+
+    for (; i < blocks; i++)
+    {
+        __m128i c = _mm_loadu_si128((const __m128i*)(ciphertext + (i * 16)));
+        __m128i p = _mm_xor_si128(aesni_decrypt_block(rk, c), prev);
+        _mm_storeu_si128((__m128i*)(plaintext + (i * 16)), p);
+        prev = c;
+    }
+    _mm_storeu_si128((__m128i*)iv, prev);
+}
+
+#define AESNI_ENC_LANES(op, r) \
+    b0 = op(b0, _mm_loadu_si128(k0 + (r))); \
+    b1 = op(b1, _mm_loadu_si128(k1 + (r))); \
+    b2 = op(b2, _mm_loadu_si128(k2 + (r))); \
+    b3 = op(b3, _mm_loadu_si128(k3 + (r)));
+
+// One block per lane, each with its own round keys. Four lanes are issued round by round
+// so their aesenc chains overlap in the pipeline; a partial group repeats its last lane.
+static AESNI_TARGET void aesni_encrypt_lanes(const struct aes128_ctx* const* ctx, const uint8_t* in, uint8_t* out, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0; i < n; i += 4)
+    {
+        uint32_t l1 = (i + 1 < n) ? i + 1 : i;
+        uint32_t l2 = (i + 2 < n) ? i + 2 : l1;
+        uint32_t l3 = (i + 3 < n) ? i + 3 : l2;
+        const __m128i* k0 = (const __m128i*)ctx[i]->ek;
+        const __m128i* k1 = (const __m128i*)ctx[l1]->ek;
+        const __m128i* k2 = (const __m128i*)ctx[l2]->ek;
+        const __m128i* k3 = (const __m128i*)ctx[l3]->ek;
+        __m128i b0, b1, b2, b3;
+
+        b0 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(in + (i * 16))), _mm_loadu_si128(k0));
+        b1 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(in + (l1 * 16))), _mm_loadu_si128(k1));
+        b2 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(in + (l2 * 16))), _mm_loadu_si128(k2));
+        b3 = _mm_xor_si128(_mm_loadu_si128((const __m128i*)(in + (l3 * 16))), _mm_loadu_si128(k3));
+        AESNI_ENC_LANES(_mm_aesenc_si128, 1);
+        AESNI_ENC_LANES(_mm_aesenc_si128, 2);
+        AESNI_ENC_LANES(_mm_aesenc_si128, 3);
+        AESNI_ENC_LANES(_mm_aesenc_si128, 4);
+        AESNI_ENC_LANES(_mm_aesenc_si128, 5);
+        AESNI_ENC_LANES(_mm_aesenc_si128, 6);
+        AESNI_ENC_LANES(_mm_aesenc_si128, 7);
+        AESNI_ENC_LANES(_mm_aesenc_si128, 8);
+        AESNI_ENC_LANES(_mm_aesenc_si128, 9);
+        AESNI_ENC_LANES(_mm_aesenclast_si128, 10);
+
+        // Store in reverse so a repeated lane ends up with its own result.
+        _mm_storeu_si128((__m128i*)(out + (l3 * 16)), b3);
+        _mm_storeu_si128((__m128i*)(out + (l2 * 16)), b2);
+        _mm_storeu_si128((__m128i*)(out + (l1 * 16)), b1);
+        _mm_storeu_si128((__m128i*)(out + (i * 16)), b0);
+    }
+}
+
+const struct aes128_impl aes128_impl_aesni = {
+    AES_IMPL_AESNI, aesni_setkey, aesni_encrypt, aesni_decrypt, aesni_cbc_encrypt, aesni_cbc_decrypt,
+    aesni_encrypt_lanes, aesni_cbc_encrypt_mac, aesni_cbc_decrypt_mac
+};
+
+#endif // AES_HAVE_AESNI
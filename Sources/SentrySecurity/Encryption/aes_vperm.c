@@ -0,0 +1,322 @@
+/******************************************
+** AES-128 vector-permute engine
+** Details: Constant-time AES for x86 CPUs with SSSE3 but without AES-NI, after Hamburg's
+            "Accelerating AES with Vector Permute Instructions". SubBytes is computed as
+            an inversion in GF(2^8) written over the subfield GF(2^4): every GF(2^4)
+            operation is a 16-entry pshufb lookup on the low/high nibbles of all sixteen
+            state bytes at once, so there are no key- or data-dependent memory accesses.
+            MixColumns and ShiftRows are folded into the lookups and byte shuffles.
+            Unlike the bitsliced engine this works on a single block at a time, which
+            suits the one-block AES_128() calls (the wrap() ICV, CMAC subkeys).
+            Round keys are stored in aes128_ctx as eleven 16-byte blocks; every key
+            that feeds an S-box layer carries the 0x63 affine constant, so the rounds
+            never add it.
+******************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "aes.h"
+#include "aes_impl.h"
+#include "cpu_features.h"
+
+#if AES_HAVE_VPERM
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+
+#define VPERM_TARGET __attribute__((target("ssse3")))
+#define VPERM_ALIGN __attribute__((aligned(16)))
+#define VPERM_LOAD(t) _mm_load_si128((const __m128i*)(t))
+
+// A byte X of GF(2^8) is represented as X = i*s + k with i, k in the subfield GF(2^4)
+// (s is a root of s^2 + a*s + a). The input tables map the low and high nibbles of a byte
+// to the nibble coordinates i and k.
+static const uint8_t vperm_ipt_i_lo[16] VPERM_ALIGN = {
+    0x00, 0x00, 0x03, 0x03, 0x0d, 0x0d, 0x0e, 0x0e, 0x0d, 0x0d, 0x0e, 0x0e, 0x00, 0x00, 0x03, 0x03
+};
+static const uint8_t vperm_ipt_i_hi[16] VPERM_ALIGN = {
+    0x00, 0x0b, 0x07, 0x0c, 0x0b, 0x00, 0x0c, 0x07, 0x0c, 0x07, 0x0b, 0x00, 0x07, 0x0c, 0x00, 0x0b
+};
+static const uint8_t vperm_ipt_k_lo[16] VPERM_ALIGN = {
+    0x00, 0x01, 0x07, 0x06, 0x00, 0x01, 0x07, 0x06, 0x02, 0x03, 0x05, 0x04, 0x02, 0x03, 0x05, 0x04
+};
+static const uint8_t vperm_ipt_k_hi[16] VPERM_ALIGN = {
+    0x00, 0x0b, 0x0b, 0x00, 0x0f, 0x04, 0x04, 0x0f, 0x08, 0x03, 0x03, 0x08, 0x07, 0x0c, 0x0c, 0x07
+};
+
+// The decryption input maps a byte through the inverse affine transform first.
+static const uint8_t vperm_dipt_i_lo[16] VPERM_ALIGN = {
+    0x00, 0x05, 0x0a, 0x0f, 0x0a, 0x0f, 0x00, 0x05, 0x03, 0x06, 0x09, 0x0c, 0x09, 0x0c, 0x03, 0x06
+};
+static const uint8_t vperm_dipt_i_hi[16] VPERM_ALIGN = {
+    0x00, 0x06, 0x06, 0x00, 0x04, 0x02, 0x02, 0x04, 0x0a, 0x0c, 0x0c, 0x0a, 0x0e, 0x08, 0x08, 0x0e
+};
+static const uint8_t vperm_dipt_k_lo[16] VPERM_ALIGN = {
+    0x00, 0x0a, 0x03, 0x09, 0x08, 0x02, 0x0b, 0x01, 0x03, 0x09, 0x00, 0x0a, 0x0b, 0x01, 0x08, 0x02
+};
+static const uint8_t vperm_dipt_k_hi[16] VPERM_ALIGN = {
+    0x00, 0x03, 0x0c, 0x0f, 0x04, 0x07, 0x08, 0x0b, 0x0a, 0x09, 0x06, 0x05, 0x0e, 0x0d, 0x02, 0x01
+};
+
+// GF(2^4) inverse and a/x. Index 0 yields 0x80 so that the next pshufb returns 0.
+static const uint8_t vperm_finv[16] VPERM_ALIGN = {
+    0x80, 0x01, 0x08, 0x0d, 0x0f, 0x06, 0x05, 0x0e, 0x02, 0x0c, 0x0b, 0x0a, 0x09, 0x03, 0x07, 0x04
+};
+static const uint8_t vperm_ak[16] VPERM_ALIGN = {
+    0x80, 0x02, 0x01, 0x0c, 0x08, 0x0b, 0x0d, 0x0a, 0x04, 0x0e, 0x07, 0x05, 0x03, 0x06, 0x09, 0x0f
+};
+
+// Output tables: the two inverted coordinates back to a byte, with the affine transform
+// (encryption) and the MixColumns / InvMixColumns multipliers applied.
+static const uint8_t vperm_sbo_u[16] VPERM_ALIGN = {
+    0x00, 0xfa, 0x6a, 0x35, 0xbb, 0x2b, 0x5f, 0x41, 0x8e, 0xcf, 0x1e, 0xe4, 0x90, 0x74, 0xd1, 0xa5
+};
+static const uint8_t vperm_sbo_t[16] VPERM_ALIGN = {
+    0x00, 0x81, 0x76, 0x99, 0xfd, 0x0a, 0xef, 0x7c, 0x64, 0x18, 0x93, 0x12, 0xf7, 0xe5, 0x8b, 0x6e
+};
+static const uint8_t vperm_sb2_u[16] VPERM_ALIGN = {
+    0x00, 0xef, 0xd4, 0x6a, 0x6d, 0x56, 0xbe, 0x82, 0x07, 0x85, 0x3c, 0xd3, 0x3b, 0xe8, 0xb9, 0x51
+};
+static const uint8_t vperm_sb2_t[16] VPERM_ALIGN = {
+    0x00, 0x19, 0xec, 0x29, 0xe1, 0x14, 0xc5, 0xf8, 0xc8, 0x30, 0x3d, 0x24, 0xf5, 0xd1, 0x0d, 0xdc
+};
+static const uint8_t vperm_dsbo_u[16] VPERM_ALIGN = {
+    0x00, 0x9c, 0x1d, 0x8e, 0x44, 0xc5, 0x93, 0xd8, 0xca, 0x12, 0x4b, 0xd7, 0x81, 0x56, 0x59, 0x0f
+};
+static const uint8_t vperm_dsbo_t[16] VPERM_ALIGN = {
+    0x00, 0x6f, 0xc2, 0x99, 0x6b, 0xc6, 0x5b, 0x04, 0xf2, 0xf6, 0x5f, 0x30, 0xad, 0x9d, 0xa9, 0x34
+};
+static const uint8_t vperm_dsb9_u[16] VPERM_ALIGN = {
+    0x00, 0x10, 0xf5, 0x92, 0x52, 0xb7, 0x67, 0x42, 0xc0, 0x82, 0x25, 0x35, 0xe5, 0xd0, 0xa7, 0x77
+};
+static const uint8_t vperm_dsb9_t[16] VPERM_ALIGN = {
+    0x00, 0x3a, 0x88, 0x3d, 0x1e, 0xac, 0xb5, 0x24, 0x23, 0x07, 0x91, 0xab, 0xb2, 0x19, 0x96, 0x8f
+};
+static const uint8_t vperm_dsbb_u[16] VPERM_ALIGN = {
+    0x00, 0x33, 0xcf, 0x95, 0xda, 0x26, 0x5a, 0xe9, 0x4f, 0xa6, 0xb3, 0x80, 0xfc, 0x7c, 0x15, 0x69
+};
+static const uint8_t vperm_dsbb_t[16] VPERM_ALIGN = {
+    0x00, 0xe4, 0x17, 0x14, 0xc8, 0x3b, 0x03, 0x2c, 0xdc, 0xf0, 0x2f, 0xcb, 0xf3, 0x38, 0xdf, 0xe7
+};
+static const uint8_t vperm_dsbd_u[16] VPERM_ALIGN = {
+    0x00, 0x56, 0x81, 0x9c, 0x59, 0x8e, 0x1d, 0x0f, 0xc5, 0xca, 0x12, 0x44, 0xd7, 0x93, 0xd8, 0x4b
+};
+static const uint8_t vperm_dsbd_t[16] VPERM_ALIGN = {
+    0x00, 0x9d, 0xad, 0x6f, 0xa9, 0x99, 0xc2, 0x34, 0xc6, 0xf2, 0xf6, 0x6b, 0x30, 0x5b, 0x04, 0x5f
+};
+static const uint8_t vperm_dsbe_u[16] VPERM_ALIGN = {
+    0x00, 0xe9, 0xa6, 0x15, 0x95, 0xda, 0xb3, 0x7c, 0x80, 0xfc, 0xcf, 0x26, 0x4f, 0x69, 0x33, 0x5a
+};
+static const uint8_t vperm_dsbe_t[16] VPERM_ALIGN = {
+    0x00, 0x2c, 0xf0, 0xdf, 0x14, 0xc8, 0x2f, 0x38, 0xcb, 0xf3, 0x17, 0x3b, 0xdc, 0xe7, 0xe4, 0x03
+};
+
+// Nibble multiplication tables for InvMixColumns on round keys
+static const uint8_t vperm_mul9_lo[16] VPERM_ALIGN = {
+    0x00, 0x09, 0x12, 0x1b, 0x24, 0x2d, 0x36, 0x3f, 0x48, 0x41, 0x5a, 0x53, 0x6c, 0x65, 0x7e, 0x77
+};
+static const uint8_t vperm_mul9_hi[16] VPERM_ALIGN = {
+    0x00, 0x90, 0x3b, 0xab, 0x76, 0xe6, 0x4d, 0xdd, 0xec, 0x7c, 0xd7, 0x47, 0x9a, 0x0a, 0xa1, 0x31
+};
+static const uint8_t vperm_mulb_lo[16] VPERM_ALIGN = {
+    0x00, 0x0b, 0x16, 0x1d, 0x2c, 0x27, 0x3a, 0x31, 0x58, 0x53, 0x4e, 0x45, 0x74, 0x7f, 0x62, 0x69
+};
+static const uint8_t vperm_mulb_hi[16] VPERM_ALIGN = {
+    0x00, 0xb0, 0x7b, 0xcb, 0xf6, 0x46, 0x8d, 0x3d, 0xf7, 0x47, 0x8c, 0x3c, 0x01, 0xb1, 0x7a, 0xca
+};
+static const uint8_t vperm_muld_lo[16] VPERM_ALIGN = {
+    0x00, 0x0d, 0x1a, 0x17, 0x34, 0x39, 0x2e, 0x23, 0x68, 0x65, 0x72, 0x7f, 0x5c, 0x51, 0x46, 0x4b
+};
+static const uint8_t vperm_muld_hi[16] VPERM_ALIGN = {
+    0x00, 0xd0, 0xbb, 0x6b, 0x6d, 0xbd, 0xd6, 0x06, 0xda, 0x0a, 0x61, 0xb1, 0xb7, 0x67, 0x0c, 0xdc
+};
+static const uint8_t vperm_mule_lo[16] VPERM_ALIGN = {
+    0x00, 0x0e, 0x1c, 0x12, 0x38, 0x36, 0x24, 0x2a, 0x70, 0x7e, 0x6c, 0x62, 0x48, 0x46, 0x54, 0x5a
+};
+static const uint8_t vperm_mule_hi[16] VPERM_ALIGN = {
+    0x00, 0xe0, 0xdb, 0x3b, 0xad, 0x4d, 0x76, 0x96, 0x41, 0xa1, 0x9a, 0x7a, 0xec, 0x0c, 0x37, 0xd7
+};
+
+// Byte permutations. rot1..rot3 rotate every column; the enc_/dec_ variants are the same
+// rotations seen through (Inv)ShiftRows, so the row shift can be applied once at the end.
+static const uint8_t vperm_shift_rows[16] VPERM_ALIGN = {
+    0x00, 0x05, 0x0a, 0x0f, 0x04, 0x09, 0x0e, 0x03, 0x08, 0x0d, 0x02, 0x07, 0x0c, 0x01, 0x06, 0x0b
+};
+static const uint8_t vperm_inv_shift_rows[16] VPERM_ALIGN = {
+    0x00, 0x0d, 0x0a, 0x07, 0x04, 0x01, 0x0e, 0x0b, 0x08, 0x05, 0x02, 0x0f, 0x0c, 0x09, 0x06, 0x03
+};
+static const uint8_t vperm_rot1[16] VPERM_ALIGN = {
+    0x01, 0x02, 0x03, 0x00, 0x05, 0x06, 0x07, 0x04, 0x09, 0x0a, 0x0b, 0x08, 0x0d, 0x0e, 0x0f, 0x0c
+};
+static const uint8_t vperm_rot2[16] VPERM_ALIGN = {
+    0x02, 0x03, 0x00, 0x01, 0x06, 0x07, 0x04, 0x05, 0x0a, 0x0b, 0x08, 0x09, 0x0e, 0x0f, 0x0c, 0x0d
+};
+static const uint8_t vperm_rot3[16] VPERM_ALIGN = {
+    0x03, 0x00, 0x01, 0x02, 0x07, 0x04, 0x05, 0x06, 0x0b, 0x08, 0x09, 0x0a, 0x0f, 0x0c, 0x0d, 0x0e
+};
+static const uint8_t vperm_enc_rot1[16] VPERM_ALIGN = {
+    0x05, 0x06, 0x07, 0x04, 0x09, 0x0a, 0x0b, 0x08, 0x0d, 0x0e, 0x0f, 0x0c, 0x01, 0x02, 0x03, 0x00
+};
+static const uint8_t vperm_enc_rot2[16] VPERM_ALIGN = {
+    0x0a, 0x0b, 0x08, 0x09, 0x0e, 0x0f, 0x0c, 0x0d, 0x02, 0x03, 0x00, 0x01, 0x06, 0x07, 0x04, 0x05
+};
+static const uint8_t vperm_dec_rot1[16] VPERM_ALIGN = {
+    0x0d, 0x0e, 0x0f, 0x0c, 0x01, 0x02, 0x03, 0x00, 0x05, 0x06, 0x07, 0x04, 0x09, 0x0a, 0x0b, 0x08
+};
+static const uint8_t vperm_dec_rot2[16] VPERM_ALIGN = {
+    0x0a, 0x0b, 0x08, 0x09, 0x0e, 0x0f, 0x0c, 0x0d, 0x02, 0x03, 0x00, 0x01, 0x06, 0x07, 0x04, 0x05
+};
+static const uint8_t vperm_dec_rot3[16] VPERM_ALIGN = {
+    0x07, 0x04, 0x05, 0x06, 0x0b, 0x08, 0x09, 0x0a, 0x0f, 0x0c, 0x0d, 0x0e, 0x03, 0x00, 0x01, 0x02
+};
+static const uint8_t vperm_rot_word[16] VPERM_ALIGN = {
+    0x0d, 0x0e, 0x0f, 0x0c, 0x0d, 0x0e, 0x0f, 0x0c, 0x0d, 0x0e, 0x0f, 0x0c, 0x0d, 0x0e, 0x0f, 0x0c
+};
+
+static const uint8_t vperm_rcon[10] = {
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1b, 0x36
+};
+
+// Inverts all sixteen bytes of x (after the input transform given by the four tables) and
+// returns the result as the two GF(2^4) coordinates io and jo.
+static VPERM_TARGET inline void vperm_invert(__m128i x, const uint8_t* i_lo, const uint8_t* i_hi,
+    const uint8_t* k_lo, const uint8_t* k_hi, __m128i* io, __m128i* jo)
+{
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    const __m128i finv = VPERM_LOAD(vperm_finv);
+    __m128i lo, hi, i, j, k, a, iak, jak;
+
+    lo = _mm_and_si128(x, mask);
+    hi = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+    i = _mm_xor_si128(_mm_shuffle_epi8(VPERM_LOAD(i_lo), lo), _mm_shuffle_epi8(VPERM_LOAD(i_hi), hi));
+    k = _mm_xor_si128(_mm_shuffle_epi8(VPERM_LOAD(k_lo), lo), _mm_shuffle_epi8(VPERM_LOAD(k_hi), hi));
+    j = _mm_xor_si128(i, k);
+    a = _mm_shuffle_epi8(VPERM_LOAD(vperm_ak), k);
+    iak = _mm_xor_si128(_mm_shuffle_epi8(finv, i), a);
+    jak = _mm_xor_si128(_mm_shuffle_epi8(finv, j), a);
+    *io = _mm_xor_si128(_mm_shuffle_epi8(finv, iak), j);
+    *jo = _mm_xor_si128(_mm_shuffle_epi8(finv, jak), i);
+}
+
+// Looks up a pair of output tables
+static VPERM_TARGET inline __m128i vperm_output(const uint8_t* u, const uint8_t* t, __m128i io, __m128i jo)
+{
+    return _mm_xor_si128(_mm_shuffle_epi8(VPERM_LOAD(u), io), _mm_shuffle_epi8(VPERM_LOAD(t), jo));
+}
+
+// Full SubBytes, 0x63 included (key schedule only)
+static VPERM_TARGET inline __m128i vperm_sub_bytes(__m128i x)
+{
+    __m128i io, jo;
+
+    vperm_invert(x, vperm_ipt_i_lo, vperm_ipt_i_hi, vperm_ipt_k_lo, vperm_ipt_k_hi, &io, &jo);
+    return _mm_xor_si128(vperm_output(vperm_sbo_u, vperm_sbo_t, io, jo), _mm_set1_epi8(0x63));
+}
+
+static VPERM_TARGET inline __m128i vperm_mul(__m128i x, const uint8_t* lo, const uint8_t* hi)
+{
+    const __m128i mask = _mm_set1_epi8(0x0f);
+
+    return _mm_xor_si128(_mm_shuffle_epi8(VPERM_LOAD(lo), _mm_and_si128(x, mask)),
+        _mm_shuffle_epi8(VPERM_LOAD(hi), _mm_and_si128(_mm_srli_epi16(x, 4), mask)));
+}
+
+static VPERM_TARGET __m128i vperm_inv_mix_columns(__m128i x)
+{
+    __m128i r;
+
+    r = vperm_mul(x, vperm_mule_lo, vperm_mule_hi);
+    r = _mm_xor_si128(r, _mm_shuffle_epi8(vperm_mul(x, vperm_mulb_lo, vperm_mulb_hi), VPERM_LOAD(vperm_rot1)));
+    r = _mm_xor_si128(r, _mm_shuffle_epi8(vperm_mul(x, vperm_muld_lo, vperm_muld_hi), VPERM_LOAD(vperm_rot2)));
+    return _mm_xor_si128(r, _mm_shuffle_epi8(vperm_mul(x, vperm_mul9_lo, vperm_mul9_hi), VPERM_LOAD(vperm_rot3)));
+}
+
+static VPERM_TARGET void vperm_setkey(struct aes128_ctx* ctx, const uint8_t* key, int with_decrypt)
+{
+    __m128i* ek = (__m128i*)ctx->ek;
+    __m128i* dk = (__m128i*)ctx->dk;
+    const __m128i c63 = _mm_set1_epi8(0x63);
+    __m128i rk[11];
+    __m128i k, t;
+    int i;
+
+    k = _mm_loadu_si128((const __m128i*)key);
+    rk[0] = k;
+    for (i = 0; i < 10; i++)
+    {
+        // SubWord(RotWord(w3)) ^ Rcon, broadcast to all four words
+        t = vperm_sub_bytes(_mm_shuffle_epi8(k, VPERM_LOAD(vperm_rot_word)));
+        t = _mm_xor_si128(t, _mm_set1_epi32(vperm_rcon[i]));
+        k = _mm_xor_si128(k, _mm_slli_si128(k, 4));
+        k = _mm_xor_si128(k, _mm_slli_si128(k, 8));
+        k = _mm_xor_si128(k, t);
+        rk[i + 1] = k;
+    }
+
+    _mm_storeu_si128(ek, rk[0]);
+    for (i = 1; i < 11; i++) _mm_storeu_si128(ek + i, _mm_xor_si128(rk[i], c63));
+    if (!with_decrypt) return;
+
+    _mm_storeu_si128(dk, _mm_xor_si128(rk[10], c63));
+    for (i = 1; i < 10; i++) _mm_storeu_si128(dk + i, _mm_xor_si128(vperm_inv_mix_columns(rk[10 - i]), c63));
+    _mm_storeu_si128(dk + 10, rk[0]);
+}
+
+static VPERM_TARGET void vperm_encrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    const __m128i* rk = (const __m128i*)ctx->ek;
+    const __m128i rot1 = VPERM_LOAD(vperm_enc_rot1);
+    const __m128i rot2 = VPERM_LOAD(vperm_enc_rot2);
+    const __m128i sr = VPERM_LOAD(vperm_shift_rows);
+    __m128i m, s, d, io, jo;
+    int r;
+
+    m = _mm_xor_si128(_mm_loadu_si128((const __m128i*)in), _mm_loadu_si128(rk));
+    for (r = 1; r < 10; r++)
+    {
+        vperm_invert(m, vperm_ipt_i_lo, vperm_ipt_i_hi, vperm_ipt_k_lo, vperm_ipt_k_hi, &io, &jo);
+        s = vperm_output(vperm_sbo_u, vperm_sbo_t, io, jo);
+        d = vperm_output(vperm_sb2_u, vperm_sb2_t, io, jo);
+        // MixColumns: 2*b[r] ^ 3*b[r+1] ^ b[r+2] ^ b[r+3], ShiftRows last
+        m = _mm_xor_si128(d, _mm_shuffle_epi8(_mm_xor_si128(d, s), rot1));
+        m = _mm_xor_si128(m, _mm_shuffle_epi8(_mm_xor_si128(s, _mm_shuffle_epi8(s, rot1)), rot2));
+        m = _mm_xor_si128(_mm_shuffle_epi8(m, sr), _mm_loadu_si128(rk + r));
+    }
+    vperm_invert(m, vperm_ipt_i_lo, vperm_ipt_i_hi, vperm_ipt_k_lo, vperm_ipt_k_hi, &io, &jo);
+    s = vperm_output(vperm_sbo_u, vperm_sbo_t, io, jo);
+    m = _mm_xor_si128(_mm_shuffle_epi8(s, sr), _mm_loadu_si128(rk + 10));
+    _mm_storeu_si128((__m128i*)out, m);
+}
+
+static VPERM_TARGET void vperm_decrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out)
+{
+    const __m128i* rk = (const __m128i*)ctx->dk;
+    const __m128i rot1 = VPERM_LOAD(vperm_dec_rot1);
+    const __m128i rot2 = VPERM_LOAD(vperm_dec_rot2);
+    const __m128i rot3 = VPERM_LOAD(vperm_dec_rot3);
+    const __m128i isr = VPERM_LOAD(vperm_inv_shift_rows);
+    __m128i m, io, jo;
+    int r;
+
+    m = _mm_xor_si128(_mm_loadu_si128((const __m128i*)in), _mm_loadu_si128(rk));
+    for (r = 1; r < 10; r++)
+    {
+        vperm_invert(m, vperm_dipt_i_lo, vperm_dipt_i_hi, vperm_dipt_k_lo, vperm_dipt_k_hi, &io, &jo);
+        // InvMixColumns: e*b[r] ^ b*b[r+1] ^ d*b[r+2] ^ 9*b[r+3], InvShiftRows last
+        m = vperm_output(vperm_dsbe_u, vperm_dsbe_t, io, jo);
+        m = _mm_xor_si128(m, _mm_shuffle_epi8(vperm_output(vperm_dsbb_u, vperm_dsbb_t, io, jo), rot1));
+        m = _mm_xor_si128(m, _mm_shuffle_epi8(vperm_output(vperm_dsbd_u, vperm_dsbd_t, io, jo), rot2));
+        m = _mm_xor_si128(m, _mm_shuffle_epi8(vperm_output(vperm_dsb9_u, vperm_dsb9_t, io, jo), rot3));
+        m = _mm_xor_si128(_mm_shuffle_epi8(m, isr), _mm_loadu_si128(rk + r));
+    }
+    vperm_invert(m, vperm_dipt_i_lo, vperm_dipt_i_hi, vperm_dipt_k_lo, vperm_dipt_k_hi, &io, &jo);
+    m = vperm_output(vperm_dsbo_u, vperm_dsbo_t, io, jo);
+    m = _mm_xor_si128(_mm_shuffle_epi8(m, isr), _mm_loadu_si128(rk + 10));
+    _mm_storeu_si128((__m128i*)out, m);
+}
+
+const struct aes128_impl aes128_impl_vperm = {
+    AES_IMPL_VPERM, vperm_setkey, vperm_encrypt, vperm_decrypt, NULL, NULL, NULL, NULL, NULL
+};
+
+#endif // AES_HAVE_VPERM
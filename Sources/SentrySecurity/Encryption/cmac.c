@@ -8,6 +8,7 @@
 #include <stdint.h>
 #include <string.h>
 #include "aes.h"
+#include "cmac.h"
 
 
 /* For CMAC Calculation */
@@ -22,7 +23,7 @@ unsigned char const_Zero[16] = {
 
 /* Basic Functions */
 
-void xor_128(unsigned char* a, unsigned char* b, unsigned char* out)
+void xor_128(const unsigned char* a, const unsigned char* b, unsigned char* out)
 {
     int i;
     for (i = 0; i < 16; i++)
@@ -34,7 +35,7 @@ void xor_128(unsigned char* a, unsigned char* b, unsigned char* out)
 
 /* AES-CMAC Generation Function */
 
-void leftshift_onebit(unsigned char* input, unsigned char* output)
+void leftshift_onebit(const unsigned char* input, unsigned char* output)
 {
     int         i;
     unsigned char overflow = 0;
@@ -47,17 +48,10 @@ void leftshift_onebit(unsigned char* input, unsigned char* output)
     return;
 }
 
-void generate_subkey(unsigned char* key, unsigned char* K1, unsigned
-    char* K2)
+/* K1, K2 from L = AES-128(KEY, 0) */
+static void subkeys_from_L(const unsigned char* L, unsigned char* K1, unsigned char* K2)
 {
-    unsigned char L[16];
-    unsigned char Z[16];
     unsigned char tmp[16];
-    int i;
-
-    for (i = 0; i < 16; i++) Z[i] = 0;
-
-    AES_128(key, Z, L);
 
     if ((L[0] & 0x80) == 0) { /* If MSB(L) = 0, then K1 = L << 1 */
         leftshift_onebit(L, K1);
@@ -77,7 +71,29 @@ void generate_subkey(unsigned char* key, unsigned char* K1, unsigned
     return;
 }
 
-void padding(unsigned char* lastb, unsigned char* pad, int length)
+static void generate_subkey_ctx(const struct aes128_ctx* ctx, unsigned char* K1, unsigned
+    char* K2)
+{
+    unsigned char L[16];
+    unsigned char Z[16];
+    int i;
+
+    for (i = 0; i < 16; i++) Z[i] = 0;
+
+    aes128_encrypt(ctx, Z, L);
+    subkeys_from_L(L, K1, K2);
+}
+
+void generate_subkey(unsigned char* key, unsigned char* K1, unsigned
+    char* K2)
+{
+    struct aes128_ctx ctx;
+
+    aes128_init_encrypt(&ctx, key);
+    generate_subkey_ctx(&ctx, K1, K2);
+}
+
+void padding(const unsigned char* lastb, unsigned char* pad, int length)
 {
     int         j;
 
@@ -95,49 +111,278 @@ void padding(unsigned char* lastb, unsigned char* pad, int length)
     }
 }
 
-void AES_CMAC(unsigned char* key, unsigned char* input, int length,  unsigned char* mac)
+/* Expands "key" and derives K1/K2 once, so every MAC under the key only costs its data blocks */
+void cmac_init(struct cmac_ctx* ctx, const unsigned char* key)
 {
-    unsigned char       X[16], Y[16], M_last[16], padded[16];
-    unsigned char       K1[16], K2[16];
-    int         n, i, flag;
-    generate_subkey(key, K1, K2);
+    aes128_init_encrypt(&ctx->aes, key);
+    generate_subkey_ctx(&ctx->aes, ctx->K1, ctx->K2);
+}
 
-    n = (length + 15) / 16;       /* n is number of rounds */
+/* Streaming AES-CMAC */
 
-    if (n == 0) {
-        n = 1;
-        flag = 0;
+/* The last block is only known to be the last one in cmac_final(), so update keeps up to
+   one full block buffered and runs the CBC-MAC on everything before it. Whole blocks are
+   taken straight from the caller's data. */
+void cmac_start(struct cmac_state* st, const struct cmac_ctx* ctx)
+{
+    st->ctx = ctx;
+    memset(st->X, 0, 16);
+    st->buffered = 0;
+}
+
+void cmac_update(struct cmac_state* st, const unsigned char* data, int length)
+{
+    unsigned char Y[16];
+    int take;
+
+    if (length <= 0) return;
+
+    /* complete the buffered block; it is not the last one since more data follows */
+    if (st->buffered > 0) {
+        take = 16 - st->buffered;
+        if (take > length) take = length;
+        memcpy(st->buffer + st->buffered, data, take);
+        st->buffered += take;
+        data += take;
+        length -= take;
+        if (length == 0) return;
+
+        xor_128(st->X, st->buffer, Y);
+        aes128_encrypt(&st->ctx->aes, Y, st->X);
+        st->buffered = 0;
     }
-    else {
-        if ((length % 16) == 0) { /* last block is a complete block */
-            flag = 1;
-        }
-        else { /* last block is not complete block */
-            flag = 0;
-        }
+
+    while (length > 16) {
+        xor_128(st->X, data, Y); /* Y := Mi (+) X  */
+        aes128_encrypt(&st->ctx->aes, Y, st->X); /* X := AES-128(KEY, Y); */
+        data += 16;
+        length -= 16;
     }
 
-    if (flag) { /* last block is complete block */
-        xor_128(&input[16 * (n - 1)], K1, M_last);
+    memcpy(st->buffer, data, length);
+    st->buffered = length;
+}
+
+void cmac_final(struct cmac_state* st, unsigned char* mac)
+{
+    unsigned char M_last[16], padded[16], Y[16];
+
+    if (st->buffered == 16) { /* last block is complete block */
+        xor_128(st->buffer, st->ctx->K1, M_last);
     }
     else {
-        padding(&input[16 * (n - 1)], padded, length % 16);
-        xor_128(padded, K2, M_last);
+        padding(st->buffer, padded, st->buffered);
+        xor_128(padded, st->ctx->K2, M_last);
     }
 
-    for (i = 0; i < 16; i++) X[i] = 0;
-    for (i = 0; i < n - 1; i++) {
-        xor_128(X, &input[16 * i], Y); /* Y := Mi (+) X  */
-        AES_128(key, Y, X);      /* X := AES-128(KEY, Y); */
+    xor_128(st->X, M_last, Y);
+    aes128_encrypt(&st->ctx->aes, Y, mac);
+}
+
+/* CBC-encrypts "len" bytes (a multiple of 16) under "enc" and absorbs the ciphertext into
+   "st": the same as aes128_cbc_encrypt() followed by cmac_update() on the ciphertext, but
+   in one pass with the encryption and MAC chains interleaved (aes128_cbc_encrypt_mac()).
+   "iv" is updated as by aes128_cbc_encrypt(). */
+void cmac_update_cbc_encrypt(struct cmac_state* st, const struct aes128_ctx* enc, const unsigned char* plaintext, unsigned char* ciphertext, uint32_t len, unsigned char* iv)
+{
+    unsigned char Y[16];
+
+    if (len == 0) return;
+
+    /* a full buffered block is followed by the ciphertext, so it is not the last one */
+    if (st->buffered == 16) {
+        xor_128(st->X, st->buffer, Y);
+        aes128_encrypt(&st->ctx->aes, Y, st->X);
+        st->buffered = 0;
     }
 
-    xor_128(X, M_last, Y);
-    AES_128(key, Y, X);
+    aes128_cbc_encrypt_mac(enc, &st->ctx->aes, plaintext, ciphertext, len, iv, st->X, st->buffer, st->buffered);
+    if (st->buffered == 0) st->buffered = 16;
+}
+
+/* Absorbs "len" bytes (a multiple of 16) of ciphertext into "st" and CBC-decrypts them
+   under "dec" (a context built with aes128_init()): the same as cmac_update() followed by
+   aes128_cbc_decrypt(), but with both chains run over the ciphertext in one pass
+   (aes128_cbc_decrypt_mac()) when the ciphertext starts on a block boundary of the MAC
+   input. "iv" is updated as by aes128_cbc_decrypt(); plaintext may overwrite ciphertext. */
+void cmac_update_cbc_decrypt(struct cmac_state* st, const struct aes128_ctx* dec, const unsigned char* ciphertext, unsigned char* plaintext, uint32_t len, unsigned char* iv)
+{
+    unsigned char Y[16];
+
+    if (len == 0) return;
 
-    for (i = 0; i < 16; i++) {
-        mac[i] = X[i];
+    if (st->buffered == 16) {
+        xor_128(st->X, st->buffer, Y);
+        aes128_encrypt(&st->ctx->aes, Y, st->X);
+        st->buffered = 0;
+    }
+
+    if (st->buffered > 0) {
+        cmac_update(st, ciphertext, len);
+        aes128_cbc_decrypt(dec, ciphertext, plaintext, len, iv);
+        return;
+    }
+
+    /* the last block may end the message, so it is only buffered */
+    aes128_cbc_decrypt_mac(dec, &st->ctx->aes, ciphertext, plaintext, len - 16, iv, st->X);
+    memcpy(st->buffer, ciphertext + len - 16, 16);
+    st->buffered = 16;
+    aes128_cbc_decrypt(dec, st->buffer, plaintext + len - 16, 16, iv);
+}
+
+void AES_CMAC_ctx(const struct cmac_ctx* ctx, const unsigned char* input, int length, unsigned char* mac)
+{
+    struct cmac_state st;
+
+    cmac_start(&st, ctx);
+    cmac_update(&st, input, length);
+    cmac_final(&st, mac);
+}
+
+void AES_CMAC(unsigned char* key, unsigned char* input, int length,  unsigned char* mac)
+{
+    struct cmac_ctx     ctx;
+
+    cmac_init(&ctx, key);
+    AES_CMAC_ctx(&ctx, input, length, mac);
+}
+
+/* Multi-lane AES-CMAC */
+
+/* Copies "count" bytes starting at "offset" of the concatenated parts to "out" */
+static void cmac_parts_read(const struct cmac_parts* msg, int offset, unsigned char* out, int count)
+{
+    int k, take;
+
+    for (k = 0; (k < CMAC_MAX_PARTS) && (count > 0); k++) {
+        if (offset >= msg->length[k]) {
+            offset -= msg->length[k];
+            continue;
+        }
+        take = msg->length[k] - offset;
+        if (take > count) take = count;
+        memcpy(out, msg->data[k] + offset, take);
+        out += take;
+        count -= take;
+        offset = 0;
+    }
+}
+
+/* cmac_init_lanes() for one group of n (at most AES128_MAX_LANES) keys */
+static void cmac_init_lane_group(struct cmac_ctx* const* ctx, const unsigned char* const* key, uint32_t n)
+{
+    const struct aes128_ctx* aes[AES128_MAX_LANES];
+    unsigned char L[AES128_MAX_LANES * 16];
+    uint32_t i;
+
+    for (i = 0; i < n; i++) {
+        aes128_init_encrypt(&ctx[i]->aes, key[i]);
+        aes[i] = &ctx[i]->aes;
+    }
+
+    memset(L, 0, n * 16);
+    aes128_encrypt_lanes(aes, L, L, n);
+
+    for (i = 0; i < n; i++) {
+        subkeys_from_L(L + (i * 16), ctx[i]->K1, ctx[i]->K2);
     }
 }
 
+/* cmac_init() for n keys, with L = AES-128(KEY, 0) computed for AES128_MAX_LANES of them
+   at a time */
+void cmac_init_lanes(struct cmac_ctx* const* ctx, const unsigned char* const* key, uint32_t n)
+{
+    uint32_t m;
+
+    for (; n > 0; n -= m) {
+        m = n;
+        if (m > AES128_MAX_LANES) m = AES128_MAX_LANES;
+        cmac_init_lane_group(ctx, key, m);
+        ctx += m;
+        key += m;
+    }
+}
+
+/* Computes the CMAC of n independent messages: msg[i] is MACed with ctx[i] into
+   mac[16*i..]. Every step feeds one block of each unfinished message to
+   aes128_encrypt_lanes(), so the serial CBC-MAC chains of different keys and sessions run
+   interleaved, AES128_MAX_LANES messages at a time. */
+void AES_CMAC_lanes(const struct cmac_ctx* const* ctx, const struct cmac_parts* msg, unsigned char* mac, uint32_t n)
+{
+    memset(mac, 0, n * 16);
+    AES_CMAC_lanes_chained(ctx, msg, mac, n);
+}
+
+/* AES_CMAC_lanes_chained() for one group of n (at most AES128_MAX_LANES) messages */
+static void AES_CMAC_lane_group(const struct cmac_ctx* const* ctx, const struct cmac_parts* msg, unsigned char* mac, uint32_t n)
+{
+    const struct aes128_ctx* lane_ctx[AES128_MAX_LANES];
+    unsigned char block[AES128_MAX_LANES * 16];
+    int length[AES128_MAX_LANES], rounds[AES128_MAX_LANES];
+    uint32_t lane[AES128_MAX_LANES];
+    uint32_t i, m;
+    int j, k, rest, steps = 0;
+
+    for (i = 0; i < n; i++) {
+        length[i] = 0;
+        for (k = 0; k < CMAC_MAX_PARTS; k++) length[i] += msg[i].length[k];
+        rounds[i] = (length[i] + 15) / 16;
+        if (rounds[i] == 0) rounds[i] = 1;
+        if (rounds[i] > steps) steps = rounds[i];
+    }
+
+    for (j = 0; j < steps; j++) {
+        m = 0;
+        for (i = 0; i < n; i++) {
+            unsigned char* y = block + (m * 16);
 
+            if (j >= rounds[i]) continue;
 
+            if (j < rounds[i] - 1) {
+                cmac_parts_read(&msg[i], j * 16, y, 16);
+            }
+            else {
+                rest = length[i] - (j * 16);
+                if (rest == 16) { /* last block is complete block */
+                    cmac_parts_read(&msg[i], j * 16, y, 16);
+                    for (k = 0; k < 16; k++) y[k] ^= ctx[i]->K1[k];
+                }
+                else {
+                    cmac_parts_read(&msg[i], j * 16, y, rest);
+                    y[rest] = 0x80;
+                    for (k = rest + 1; k < 16; k++) y[k] = 0x00;
+                    for (k = 0; k < 16; k++) y[k] ^= ctx[i]->K2[k];
+                }
+            }
+            for (k = 0; k < 16; k++) y[k] ^= mac[(i * 16) + k]; /* Y := Mi (+) X */
+
+            lane_ctx[m] = &ctx[i]->aes;
+            lane[m] = i;
+            m++;
+        }
+
+        aes128_encrypt_lanes(lane_ctx, block, block, m);
+
+        for (k = 0; k < (int)m; k++) {
+            memcpy(mac + (lane[k] * 16), block + (k * 16), 16);
+        }
+    }
+}
+
+/* AES_CMAC_lanes() for messages whose block-aligned prefix has already been absorbed:
+   mac[16*i..] holds the CBC-MAC chain value after that prefix on entry (zero for an
+   empty one) and msg[i] is the rest of the message, which must not be empty unless the
+   prefix is. Lets callers absorb a prefix shared by many messages only once. */
+void AES_CMAC_lanes_chained(const struct cmac_ctx* const* ctx, const struct cmac_parts* msg, unsigned char* mac, uint32_t n)
+{
+    uint32_t m;
+
+    for (; n > 0; n -= m) {
+        m = n;
+        if (m > AES128_MAX_LANES) m = AES128_MAX_LANES;
+        AES_CMAC_lane_group(ctx, msg, mac, m);
+        ctx += m;
+        msg += m;
+        mac += m * 16;
+    }
+}
@@ -0,0 +1,83 @@
+#include "stdint.h"
+#include "stdatomic.h"
+#include "cpu_features.h"
+
+#if CPU_X86_TARGET_ATTRIBUTES
+#include <cpuid.h>
+#endif
+#if CPU_ARM64_AES && defined(__linux__)
+#include <sys/auxv.h>
+#ifndef HWCAP_AES
+#define HWCAP_AES (1 << 3)
+#endif
+#endif
+
+// The probed features with CPU_FEATURES_PROBED added, in one word so a reader sees either
+// 0 or the complete set
+#define CPU_FEATURES_PROBED 0x80000000u
+
+static _Atomic(uint32_t) g_cpu_features = 0;
+
+#if CPU_X86_TARGET_ATTRIBUTES
+// XCR0: which register states the OS saves on a context switch
+static uint32_t cpu_xcr0(void)
+{
+    uint32_t lo, hi;
+
+    __asm__ volatile ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+    return lo;
+}
+#endif
+
+static uint32_t cpu_probe(void)
+{
+    uint32_t features = 0;
+#if CPU_X86_TARGET_ATTRIBUTES
+    unsigned int eax, ebx, ecx, edx;
+    unsigned int ebx7 = 0, ecx7, edx7;
+
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx))
+    {
+        // The AES-NI paths also use SSE2 loads/stores and SSSE3 byte shuffles; every CPU
+        // with AES-NI has both.
+        if ((ecx & bit_AES) && (ecx & bit_SSSE3) && (edx & bit_SSE2)) features |= CPU_FEATURE_AESNI;
+        if ((ecx & bit_SSSE3) && (edx & bit_SSE2)) features |= CPU_FEATURE_SSSE3;
+
+        if (!__get_cpuid_count(7, 0, &eax, &ebx7, &ecx7, &edx7)) ebx7 = 0;
+
+        // The SHA paths byte-swap with SSSE3 and merge state halves with SSE4.1 blends
+        if ((ecx & bit_SSSE3) && (ecx & bit_SSE4_1) && (edx & bit_SSE2) && (ebx7 & bit_SHA)) features |= CPU_FEATURE_SHA;
+
+        // AVX2 also needs the OS to preserve the XMM and YMM state (XCR0 bits 1 and 2)
+        if ((ebx7 & bit_AVX2) && (ecx & bit_OSXSAVE) && ((cpu_xcr0() & 0x6) == 0x6)) features |= CPU_FEATURE_AVX2;
+
+        // Plain integer instructions, no extra OS state
+        if (ebx7 & bit_BMI2) features |= CPU_FEATURE_BMI2;
+        if (ebx7 & bit_ADX) features |= CPU_FEATURE_ADX;
+    }
+#endif
+#if CPU_ARM64_AES
+#if defined(__linux__)
+    // A Linux build that targets the extension may still run on a core without it
+    if (getauxval(AT_HWCAP) & HWCAP_AES) features |= CPU_FEATURE_ARMV8_AES;
+#else
+    // Every Apple arm64 core has the AES instructions
+    features |= CPU_FEATURE_ARMV8_AES;
+#endif
+#endif
+    return features;
+}
+
+// The probe is idempotent, so concurrent first calls at worst run cpuid twice and store
+// the same value.
+uint32_t cpu_features(void)
+{
+    uint32_t features = atomic_load_explicit(&g_cpu_features, memory_order_acquire);
+
+    if (!(features & CPU_FEATURES_PROBED))
+    {
+        features = cpu_probe() | CPU_FEATURES_PROBED;
+        atomic_store_explicit(&g_cpu_features, features, memory_order_release);
+    }
+    return features & ~CPU_FEATURES_PROBED;
+}
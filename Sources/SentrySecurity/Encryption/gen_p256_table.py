@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# Generates p256_table.h: python3 gen_p256_table.py > p256_table.h
+#
+# Entry [i][j] is (j + 1) * 16^i * G in affine coordinates, computed with plain
+# Python integers and independent of uECC.c. Each coordinate is written as four
+# BYTES_TO_WORDS_8 groups, least significant byte first, the order curve->G uses.
+
+p = 0xffffffff00000001000000000000000000000000ffffffffffffffffffffffff
+a = p - 3
+G = (0x6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296,
+     0x4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5)
+
+
+def add(P, Q):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    x1, y1 = P
+    x2, y2 = Q
+    if x1 == x2:
+        if (y1 + y2) % p == 0:
+            return None
+        slope = (3 * x1 * x1 + a) * pow(2 * y1, -1, p) % p
+    else:
+        slope = (y2 - y1) * pow(x2 - x1, -1, p) % p
+    x3 = (slope * slope - x1 - x2) % p
+    return (x3, (slope * (x1 - x3) - y1) % p)
+
+
+def words(value):
+    data = value.to_bytes(32, 'little')
+    return ['BYTES_TO_WORDS_8(%s)' % ', '.join('%02X' % b for b in data[i:i + 8])
+            for i in range(0, 32, 8)]
+
+
+print('''/* Copyright 2015, Kenneth MacKay. Licensed under the BSD 2-clause license. */
+
+#ifndef _UECC_P256_TABLE_H_
+#define _UECC_P256_TABLE_H_
+
+/* Affine multiples of the secp256r1 generator for EccPoint_mult_G_secp256r1:
+   p256_g_table[i][j] = (j + 1) * 16^i * G, x then y, in the same word layout as curve->G.
+   Plain (not Montgomery) coordinates, so the table is the same for every build option.
+   Generated by gen_p256_table.py; regenerate rather than editing. */
+static const uECC_word_t p256_g_table[64][8][num_words_secp256r1 * 2] = {''')
+
+base = G
+for i in range(64):
+    print('    /* (1..8) * 16^%d * G */' % i)
+    point = None
+    for j in range(8):
+        point = add(point, base)
+        w = words(point[0]) + words(point[1])
+        end = ',' if j < 7 else (' },' if i < 63 else ' }')
+        print('%s{ %s, %s,' % ('    { ' if j == 0 else '      ', w[0], w[1]))
+        print('        %s, %s,' % (w[2], w[3]))
+        print('        %s, %s,' % (w[4], w[5]))
+        print('        %s, %s }%s' % (w[6], w[7], end))
+    for _ in range(4):
+        base = add(base, base)
+
+print('''};
+
+#endif /* _UECC_P256_TABLE_H_ */''')
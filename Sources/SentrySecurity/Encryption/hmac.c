@@ -0,0 +1,72 @@
+/****************************************************************/
+ /* HMAC-SHA256                                                  */
+ /* HMAC     Algorithm described in RFC 2104 / FIPS 198-1        */
+ /****************************************************************/
+#include <stdint.h>
+#include <string.h>
+#include "sha.h"
+#include "hmac.h"
+
+#define HMAC_BLOCK_SIZE 64
+
+// Hashes the key (or its digest, for keys longer than a block) XOR ipad and XOR opad into
+// the two states every message under this key continues from
+void hmac_sha256_init(struct hmac_sha256_ctx* ctx, const uint8_t* key, size_t key_len)
+{
+    uint8_t block[HMAC_BLOCK_SIZE];
+    int i;
+
+    memset(block, 0, sizeof(block));
+    if (key_len > HMAC_BLOCK_SIZE) SHA256(key, key_len, block);
+    else if (key_len > 0) memcpy(block, key, key_len);
+
+    for (i = 0; i < HMAC_BLOCK_SIZE; i++) block[i] ^= 0x36;
+    sha_init(&ctx->inner, METHOD_SHA256);
+    sha_update(&ctx->inner, block, HMAC_BLOCK_SIZE);
+
+    for (i = 0; i < HMAC_BLOCK_SIZE; i++) block[i] ^= 0x36 ^ 0x5c;
+    sha_init(&ctx->outer, METHOD_SHA256);
+    sha_update(&ctx->outer, block, HMAC_BLOCK_SIZE);
+
+    memset(block, 0, sizeof(block));
+}
+
+void hmac_sha256_start(struct hmac_sha256_state* st, const struct hmac_sha256_ctx* ctx)
+{
+    st->ctx = ctx;
+    st->inner = ctx->inner;
+}
+
+void hmac_sha256_update(struct hmac_sha256_state* st, const uint8_t* data, size_t len)
+{
+    sha_update(&st->inner, data, len);
+}
+
+// The outer hash is a copy of the precomputed opad state plus the inner digest, which
+// fits in its single final block
+void hmac_sha256_final(struct hmac_sha256_state* st, uint8_t* mac)
+{
+    struct sha_ctx outer = st->ctx->outer;
+    uint8_t digest[HMAC_SHA256_SIZE];
+
+    sha_final(&st->inner, digest);
+    sha_update(&outer, digest, HMAC_SHA256_SIZE);
+    sha_final(&outer, mac);
+}
+
+void HMAC_SHA256_ctx(const struct hmac_sha256_ctx* ctx, const uint8_t* input, size_t len, uint8_t* mac)
+{
+    struct hmac_sha256_state st;
+
+    hmac_sha256_start(&st, ctx);
+    hmac_sha256_update(&st, input, len);
+    hmac_sha256_final(&st, mac);
+}
+
+void HMAC_SHA256(const uint8_t* key, size_t key_len, const uint8_t* input, size_t len, uint8_t* mac)
+{
+    struct hmac_sha256_ctx ctx;
+
+    hmac_sha256_init(&ctx, key, key_len);
+    HMAC_SHA256_ctx(&ctx, input, len, mac);
+}
@@ -0,0 +1,354 @@
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "aes.h"
+#include "cmac.h"
+#include "sha.h"
+#include "hmac.h"
+#include "kdf.h"
+#include "wrapper.h"
+
+#if defined(__APPLE__) || defined(__unix__)
+#include <pthread.h>
+#include <unistd.h>
+#define KDF_HAVE_THREADS 1
+#else
+#define KDF_HAVE_THREADS 0
+#endif
+
+// Fewest derivations worth handing to a thread of its own
+#define KDF_BULK_MIN_PER_THREAD 1024
+
+/********************
+** SCP03 KDF
+********************/
+
+// NIST SP 800-108 KDF in counter mode with AES-CMAC as the PRF, with the fixed input laid
+// out as SCP03 does: label (11 zero bytes and the derivation constant) | 0x00 | L (output
+// length in bits, 2 bytes big-endian) | i (1 byte) | context. The output is the first L
+// bits of CMAC(i = 1) | CMAC(i = 2) | ...
+
+// The 16 bytes in front of the context for iteration "i"
+static void scp03_kdf_header(uint8_t constant, uint32_t out_bits, uint8_t i, uint8_t* header)
+{
+    memset(header, 0, 11);
+    header[11] = constant;
+    header[12] = 0x00;
+    header[13] = (uint8_t)(out_bits >> 8);
+    header[14] = (uint8_t)out_bits;
+    header[15] = i;
+}
+
+static int scp03_kdf_check(uint32_t out_bits)
+{
+    return (out_bits > 0) && (out_bits <= SCP03_KDF_MAX_BITS) && ((out_bits % 8) == 0);
+}
+
+// Derives out_bits (a multiple of 8, at most SCP03_KDF_MAX_BITS) into "out" from the key in
+// "ctx" and "context". Returns 0, or -1 for an unsupported length.
+int scp03_kdf(const struct cmac_ctx* ctx, uint8_t constant, const uint8_t* context, uint32_t context_len, uint8_t* out, uint32_t out_bits)
+{
+    struct cmac_state st;
+    uint8_t header[16];
+    uint8_t block[16];
+    uint32_t out_len = out_bits / 8;
+    uint32_t done, take;
+    uint8_t i;
+
+    if (!scp03_kdf_check(out_bits)) return -1;
+
+    for (i = 1, done = 0; done < out_len; i++, done += take)
+    {
+        scp03_kdf_header(constant, out_bits, i, header);
+        cmac_start(&st, ctx);
+        cmac_update(&st, header, 16);
+        cmac_update(&st, context, context_len);
+        cmac_final(&st, block);
+
+        take = out_len - done;
+        if (take > 16) take = 16;
+        memcpy(out + done, block, take);
+    }
+    return 0;
+}
+
+/********************
+** SCP03 BULK KDF
+********************/
+
+// One contiguous slice of a bulk derivation. "chain" holds, for each iteration i, the
+// CBC-MAC chain value after the 16-byte header, which is the same for every serial.
+struct kdf_bulk_work
+{
+    const struct cmac_ctx* ctx;
+    const uint8_t* chain;
+    const uint8_t* serials;
+    uint32_t serial_len;
+    uint32_t count;
+    uint8_t* keys;
+    uint32_t key_len;
+};
+
+// Runs AES128_MAX_LANES serials at a time through AES_CMAC_lanes_chained(), starting each
+// lane from the shared header chain value, so a serial only costs its own blocks.
+static void scp03_kdf_bulk_slice(const struct kdf_bulk_work* w)
+{
+    const struct cmac_ctx* lane_ctx[AES128_MAX_LANES];
+    struct cmac_parts msg[AES128_MAX_LANES];
+    uint8_t mac[AES128_MAX_LANES * 16];
+    uint32_t s, k, m, done, take;
+    uint8_t i;
+
+    for (k = 0; k < AES128_MAX_LANES; k++)
+    {
+        lane_ctx[k] = w->ctx;
+        msg[k].length[0] = (int)w->serial_len;
+        msg[k].length[1] = 0;
+        msg[k].length[2] = 0;
+    }
+
+    for (s = 0; s < w->count; s += m)
+    {
+        m = w->count - s;
+        if (m > AES128_MAX_LANES) m = AES128_MAX_LANES;
+        for (k = 0; k < m; k++) msg[k].data[0] = w->serials + ((s + k) * w->serial_len);
+
+        for (i = 1, done = 0; done < w->key_len; i++, done += take)
+        {
+            for (k = 0; k < m; k++) memcpy(mac + (k * 16), w->chain + ((i - 1) * 16), 16);
+            AES_CMAC_lanes_chained(lane_ctx, msg, mac, m);
+
+            take = w->key_len - done;
+            if (take > 16) take = 16;
+            for (k = 0; k < m; k++) memcpy(w->keys + ((s + k) * w->key_len) + done, mac + (k * 16), take);
+        }
+    }
+}
+
+#if KDF_HAVE_THREADS
+static void* scp03_kdf_bulk_thread(void* arg)
+{
+    scp03_kdf_bulk_slice((const struct kdf_bulk_work*)arg);
+    return NULL;
+}
+#endif
+
+static double kdf_now(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + ((double)t.tv_nsec / 1e9);
+}
+
+// Derives one key_bits key per serial: keys[key_bits/8 * j..] from serials[serial_len * j..]
+// as the context, all under the master key in "ctx" (expanded once by the caller with
+// cmac_init()). The serials are split into contiguous slices over "threads" worker threads
+// (0 picks one per online core); inside a slice the AES engine interleaves
+// AES128_MAX_LANES derivations. If "stats" is not NULL it receives the wall-clock time and
+// derivations per second. Returns 0, or -1 for bad arguments.
+int scp03_kdf_bulk(const struct cmac_ctx* ctx, uint8_t constant, const uint8_t* serials, uint32_t serial_len, uint32_t count, uint8_t* keys, uint32_t key_bits, uint32_t threads, struct kdf_bulk_stats* stats)
+{
+    struct kdf_bulk_work work[KDF_BULK_MAX_THREADS];
+    uint8_t chain[(SCP03_KDF_MAX_BITS / 128) * 16];
+    uint8_t header[16];
+    uint32_t key_len = key_bits / 8;
+    uint32_t t, first, slice;
+    uint8_t i;
+    double start = kdf_now();
+#if KDF_HAVE_THREADS
+    pthread_t tid[KDF_BULK_MAX_THREADS];
+    int started[KDF_BULK_MAX_THREADS];
+#endif
+
+    if (!scp03_kdf_check(key_bits) || (serial_len == 0)) return -1;
+
+    // the header is a full block followed by the serial: its CBC-MAC step is shared
+    for (i = 1; (uint32_t)(i - 1) * 16 < key_len; i++)
+    {
+        scp03_kdf_header(constant, key_bits, i, header);
+        aes128_encrypt(&ctx->aes, header, chain + ((i - 1) * 16));
+    }
+
+#if KDF_HAVE_THREADS
+    if (threads == 0)
+    {
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = (cores > 0) ? (uint32_t)cores : 1;
+    }
+#else
+    threads = 1;
+#endif
+    if (threads > KDF_BULK_MAX_THREADS) threads = KDF_BULK_MAX_THREADS;
+    if (threads > (count / KDF_BULK_MIN_PER_THREAD)) threads = count / KDF_BULK_MIN_PER_THREAD;
+    if (threads == 0) threads = 1;
+
+    for (t = 0, first = 0; t < threads; t++, first += slice)
+    {
+        slice = (count / threads) + ((t < (count % threads)) ? 1 : 0);
+        work[t].ctx = ctx;
+        work[t].chain = chain;
+        work[t].serials = serials + (first * serial_len);
+        work[t].serial_len = serial_len;
+        work[t].count = slice;
+        work[t].keys = keys + (first * key_len);
+        work[t].key_len = key_len;
+    }
+
+#if KDF_HAVE_THREADS
+    // slice 0 runs on the calling thread; a slice whose thread cannot start runs there too
+    for (t = 1; t < threads; t++)
+    {
+        started[t] = (pthread_create(&tid[t], NULL, scp03_kdf_bulk_thread, &work[t]) == 0);
+    }
+    scp03_kdf_bulk_slice(&work[0]);
+    for (t = 1; t < threads; t++)
+    {
+        if (started[t]) pthread_join(tid[t], NULL);
+        else scp03_kdf_bulk_slice(&work[t]);
+    }
+#else
+    scp03_kdf_bulk_slice(&work[0]);
+#endif
+
+    if (stats != NULL)
+    {
+        stats->derivations = count;
+        stats->threads = threads;
+        stats->seconds = kdf_now() - start;
+        stats->per_second = (stats->seconds > 0) ? (count / stats->seconds) : 0;
+    }
+    return 0;
+}
+
+/********************
+** X9.63 KDF
+********************/
+
+// ANSI X9.63 / NIST SP 800-56A one-step KDF with SHA-1 or SHA-256 as H. The output is the
+// first bytes of H(Z | 00000001 | SharedInfo) | H(Z | 00000002 | SharedInfo) | ...
+// with the counter 4 bytes big-endian. Every hash starts with the same Z, so the full
+// blocks of Z are compressed once and each counter continues from a copy of that state.
+
+// Derives out[0].len + ... + out[count - 1].len bytes from the shared secret "z" and
+// "shared_info" (which may be NULL when info_len is 0), filling the destinations in order
+// so the caller needs no buffer for the whole output. Returns 0, or -1 if the output
+// would need more than 2^32 - 1 hashes.
+int x963_kdf_scatter(uint16_t method, const uint8_t* z, size_t z_len, const uint8_t* shared_info, size_t info_len, const struct kdf_span* out, uint32_t count)
+{
+    struct sha_ctx prefix, st;
+    uint8_t counter[4];
+    uint8_t digest[32];
+    size_t total = 0, pos = 0, off, take;
+    uint32_t span, hash_len, i;
+
+    sha_init(&prefix, method);
+    hash_len = prefix.hashsize;
+
+    for (span = 0; span < count; span++) total += out[span].len;
+    if ((total / hash_len) >= 0xFFFFFFFFUL) return -1;
+
+    sha_update(&prefix, z, z_len);
+
+    for (i = 1, span = 0; ; i++)
+    {
+        while ((span < count) && (out[span].len == 0)) span++;
+        if (span == count) break;
+
+        counter[0] = (uint8_t)(i >> 24);
+        counter[1] = (uint8_t)(i >> 16);
+        counter[2] = (uint8_t)(i >> 8);
+        counter[3] = (uint8_t)i;
+
+        st = prefix;
+        sha_update(&st, counter, 4);
+        sha_update(&st, shared_info, info_len);
+        sha_final(&st, digest);
+
+        for (off = 0; (off < hash_len) && (span < count); off += take)
+        {
+            take = out[span].len - pos;
+            if (take > hash_len - off) take = hash_len - off;
+            memcpy(out[span].out + pos, digest + off, take);
+            pos += take;
+            if (pos == out[span].len)
+            {
+                span++;
+                pos = 0;
+            }
+        }
+    }
+
+    // both hash states have absorbed Z, so they are as secret as the keys
+    secure_wipe(&prefix, sizeof(prefix));
+    secure_wipe(&st, sizeof(st));
+    secure_wipe(digest, sizeof(digest));
+    return 0;
+}
+
+// x963_kdf_scatter() into one contiguous buffer
+int x963_kdf(uint16_t method, const uint8_t* z, size_t z_len, const uint8_t* shared_info, size_t info_len, uint8_t* out, size_t out_len)
+{
+    struct kdf_span span;
+
+    span.out = out;
+    span.len = out_len;
+    return x963_kdf_scatter(method, z, z_len, shared_info, info_len, &span, 1);
+}
+
+/********************
+** HKDF
+********************/
+
+// HKDF with HMAC-SHA256 (RFC 5869). The expand step keys one hmac_sha256_ctx with the PRK,
+// so each output block only hashes T(i - 1) | info | i.
+
+// PRK = HMAC(salt, IKM); an empty salt stands for HMAC_SHA256_SIZE zero bytes, which
+// gives the same key block
+void hkdf_extract(const uint8_t* salt, size_t salt_len, const uint8_t* ikm, size_t ikm_len, uint8_t* prk)
+{
+    HMAC_SHA256(salt, salt_len, ikm, ikm_len, prk);
+}
+
+// OKM = the first okm_len bytes of T(1) | T(2) | ... with T(i) = HMAC(PRK, T(i - 1) | info | i).
+// Returns 0, or -1 if okm_len is above HKDF_SHA256_MAX_LEN.
+int hkdf_expand(const uint8_t* prk, size_t prk_len, const uint8_t* info, size_t info_len, uint8_t* okm, size_t okm_len)
+{
+    struct hmac_sha256_ctx ctx;
+    struct hmac_sha256_state st;
+    uint8_t t[HMAC_SHA256_SIZE];
+    size_t done, take;
+    uint8_t i;
+
+    if (okm_len > HKDF_SHA256_MAX_LEN) return -1;
+
+    hmac_sha256_init(&ctx, prk, prk_len);
+    for (i = 1, done = 0; done < okm_len; i++, done += take)
+    {
+        hmac_sha256_start(&st, &ctx);
+        if (i > 1) hmac_sha256_update(&st, t, HMAC_SHA256_SIZE);
+        hmac_sha256_update(&st, info, info_len);
+        hmac_sha256_update(&st, &i, 1);
+        hmac_sha256_final(&st, t);
+
+        take = okm_len - done;
+        if (take > HMAC_SHA256_SIZE) take = HMAC_SHA256_SIZE;
+        memcpy(okm + done, t, take);
+    }
+
+    memset(t, 0, sizeof(t));
+    memset(&ctx, 0, sizeof(ctx));
+    return 0;
+}
+
+// Extract then expand. Returns 0, or -1 if okm_len is above HKDF_SHA256_MAX_LEN.
+int hkdf(const uint8_t* salt, size_t salt_len, const uint8_t* ikm, size_t ikm_len, const uint8_t* info, size_t info_len, uint8_t* okm, size_t okm_len)
+{
+    uint8_t prk[HMAC_SHA256_SIZE];
+    int ret;
+
+    hkdf_extract(salt, salt_len, ikm, ikm_len, prk);
+    ret = hkdf_expand(prk, HMAC_SHA256_SIZE, info, info_len, okm, okm_len);
+    memset(prk, 0, sizeof(prk));
+    return ret;
+}
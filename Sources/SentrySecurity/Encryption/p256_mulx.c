@@ -0,0 +1,424 @@
+/******************************************
+** P-256 field multiplication with BMI2/ADX
+** Details: 4x64-bit schoolbook multiply and square written around mulx, which leaves the
+            flags alone, and adcx/adox, which carry through CF and OF respectively, so
+            the low and high halves of each row accumulate on two independent carry
+            chains. The 512-bit product stays in r8-r15 and is folded back below p with
+            the NIST fast reduction on 64-bit limbs. Only called from uECC.c when cpuid
+            reports both BMI2 and ADX.
+******************************************/
+
+#include "stdint.h"
+#include "p256_mulx.h"
+
+#if P256_HAVE_MULX
+
+#define P256_MULX_TARGET __attribute__((target("bmi2,adx")))
+
+// One row of the product after the first: z[i..i+4] += a[0..3] * rdx. The low half of each
+// partial product goes into z[i+j] on the CF chain and the high half into z[i+j+1] on the
+// OF chain. "top" is z[i+4], zeroed here, and the xor also clears both flags.
+#define P256_MULX_ROW(z0, z1, z2, z3, top) \
+    "xorl %%" top "d, %%" top "d\n\t" \
+    "mulxq 0(%[a]), %%rax, %%rcx\n\t" \
+    "adcxq %%rax, %%" z0 "\n\t" \
+    "adoxq %%rcx, %%" z1 "\n\t" \
+    "mulxq 8(%[a]), %%rax, %%rcx\n\t" \
+    "adcxq %%rax, %%" z1 "\n\t" \
+    "adoxq %%rcx, %%" z2 "\n\t" \
+    "mulxq 16(%[a]), %%rax, %%rcx\n\t" \
+    "adcxq %%rax, %%" z2 "\n\t" \
+    "adoxq %%rcx, %%" z3 "\n\t" \
+    "mulxq 24(%[a]), %%rax, %%rcx\n\t" \
+    "adcxq %%rax, %%" z3 "\n\t" \
+    "adoxq %%rcx, %%" top "\n\t" \
+    "movl $0, %%eax\n\t" \
+    "adcxq %%rax, %%" top "\n\t"
+
+#define P256_MULX_STORE \
+    "movq %%r8, 0(%[z])\n\t" \
+    "movq %%r9, 8(%[z])\n\t" \
+    "movq %%r10, 16(%[z])\n\t" \
+    "movq %%r11, 24(%[z])\n\t" \
+    "movq %%r12, 32(%[z])\n\t" \
+    "movq %%r13, 40(%[z])\n\t" \
+    "movq %%r14, 48(%[z])\n\t" \
+    "movq %%r15, 56(%[z])\n\t"
+
+// r8-r15 = z[0..7] = a * b
+#define P256_MULX_MUL4 \
+    /* first row: z[0..4] = a * b[0], no previous row to add */ \
+    "movq 0(%[b]), %%rdx\n\t" \
+    "mulxq 0(%[a]), %%r8, %%r9\n\t" \
+    "mulxq 8(%[a]), %%rax, %%r10\n\t" \
+    "addq %%rax, %%r9\n\t" \
+    "mulxq 16(%[a]), %%rax, %%r11\n\t" \
+    "adcq %%rax, %%r10\n\t" \
+    "mulxq 24(%[a]), %%rax, %%r12\n\t" \
+    "adcq %%rax, %%r11\n\t" \
+    "adcq $0, %%r12\n\t" \
+    \
+    "movq 8(%[b]), %%rdx\n\t" \
+    P256_MULX_ROW("r9", "r10", "r11", "r12", "r13") \
+    "movq 16(%[b]), %%rdx\n\t" \
+    P256_MULX_ROW("r10", "r11", "r12", "r13", "r14") \
+    "movq 24(%[b]), %%rdx\n\t" \
+    P256_MULX_ROW("r11", "r12", "r13", "r14", "r15")
+
+// r8-r15 = z[0..7] = a^2. The six cross products a[i]*a[j] (i < j) are summed once, then doubled on
+// the CF chain while the four squares a[i]^2 are added on the OF chain.
+#define P256_MULX_SQR4 \
+    /* a[0] * a[1..3] into z[1..4] */ \
+    "movq 0(%[a]), %%rdx\n\t" \
+    "mulxq 8(%[a]), %%r9, %%r10\n\t" \
+    "mulxq 16(%[a]), %%rax, %%r11\n\t" \
+    "mulxq 24(%[a]), %%rcx, %%r12\n\t" \
+    "addq %%rax, %%r10\n\t" \
+    "adcq %%rcx, %%r11\n\t" \
+    "adcq $0, %%r12\n\t" \
+    \
+    /* a[1] * a[2..3] into z[3..5] */ \
+    "movq 8(%[a]), %%rdx\n\t" \
+    "xorl %%r13d, %%r13d\n\t" \
+    "mulxq 16(%[a]), %%rax, %%rcx\n\t" \
+    "adcxq %%rax, %%r11\n\t" \
+    "adoxq %%rcx, %%r12\n\t" \
+    "mulxq 24(%[a]), %%rax, %%rcx\n\t" \
+    "adcxq %%rax, %%r12\n\t" \
+    "adoxq %%rcx, %%r13\n\t" \
+    "movl $0, %%eax\n\t" \
+    "adcxq %%rax, %%r13\n\t" \
+    \
+    /* a[2] * a[3] into z[5..6] */ \
+    "movq 16(%[a]), %%rdx\n\t" \
+    "mulxq 24(%[a]), %%rax, %%r14\n\t" \
+    "addq %%rax, %%r13\n\t" \
+    "adcq $0, %%r14\n\t" \
+    \
+    /* 2 * cross + squares */ \
+    "xorl %%r15d, %%r15d\n\t" \
+    "movq 0(%[a]), %%rdx\n\t" \
+    "mulxq %%rdx, %%r8, %%rcx\n\t" \
+    "adcxq %%r9, %%r9\n\t" \
+    "adoxq %%rcx, %%r9\n\t" \
+    "movq 8(%[a]), %%rdx\n\t" \
+    "mulxq %%rdx, %%rax, %%rcx\n\t" \
+    "adcxq %%r10, %%r10\n\t" \
+    "adoxq %%rax, %%r10\n\t" \
+    "adcxq %%r11, %%r11\n\t" \
+    "adoxq %%rcx, %%r11\n\t" \
+    "movq 16(%[a]), %%rdx\n\t" \
+    "mulxq %%rdx, %%rax, %%rcx\n\t" \
+    "adcxq %%r12, %%r12\n\t" \
+    "adoxq %%rax, %%r12\n\t" \
+    "adcxq %%r13, %%r13\n\t" \
+    "adoxq %%rcx, %%r13\n\t" \
+    "movq 24(%[a]), %%rdx\n\t" \
+    "mulxq %%rdx, %%rax, %%rcx\n\t" \
+    "adcxq %%r14, %%r14\n\t" \
+    "adoxq %%rax, %%r14\n\t" \
+    "adcxq %%r15, %%r15\n\t" \
+    "adoxq %%rcx, %%r15\n\t"
+
+// z[0..7] = a * b
+static P256_MULX_TARGET inline void p256_mul_4x4(uint64_t* z, const uint64_t* a, const uint64_t* b)
+{
+    __asm__ volatile (
+        P256_MULX_MUL4
+        P256_MULX_STORE
+        :
+        : [z] "r" (z), [a] "r" (a), [b] "r" (b)
+        : "rax", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "cc", "memory");
+}
+
+// z[0..7] = a^2
+static P256_MULX_TARGET inline void p256_sqr_4x4(uint64_t* z, const uint64_t* a)
+{
+    __asm__ volatile (
+        P256_MULX_SQR4
+        P256_MULX_STORE
+        :
+        : [z] "r" (z), [a] "r" (a)
+        : "rax", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "cc", "memory");
+}
+
+// Adds k * (2^256 - p) = k * (2^224 - 2^192 - 2^96 + 1) to r8-r11 for the signed carry k in
+// r12, leaving the new carry in r12. Each term is added sign-extended up to the carry word.
+#define P256_FOLD \
+    "movq %%r12, %%rax\n\t" \
+    "sarq $63, %%rax\n\t" \
+    "movq %%r12, %%rcx\n\t" \
+    "shlq $32, %%rcx\n\t" \
+    "movq %%r12, %%rdx\n\t" \
+    "sarq $32, %%rdx\n\t" \
+    "movq %%rcx, %%r13\n\t" \
+    "subq %%r12, %%r13\n\t" \
+    "xorl %%r14d, %%r14d\n\t" \
+    "addq %%r12, %%r8\n\t" \
+    "adcq %%rax, %%r9\n\t" \
+    "adcq %%rax, %%r10\n\t" \
+    "adcq %%rax, %%r11\n\t" \
+    "adcq %%rax, %%r14\n\t" \
+    "subq %%rcx, %%r9\n\t" \
+    "sbbq %%rdx, %%r10\n\t" \
+    "sbbq %%rax, %%r11\n\t" \
+    "sbbq %%rax, %%r14\n\t" \
+    "addq %%r13, %%r11\n\t" \
+    "adcq %%rax, %%r14\n\t" \
+    "movq %%r14, %%r12\n\t"
+
+// result = t mod p for a 512-bit t, fully reduced. t = T + 2*S1 + 2*S2 + S3 + S4 - D1 - D2
+// - D3 - D4 (mod p) as in FIPS 186-4 D.2.3, with the terms cut out of t[4..7] on 64-bit
+// limbs as in vli_mmod_fast_secp256r1. T accumulates in r8-r11 with a signed carry word
+// in r12, which is then folded back in twice: the first carry is a few units either way,
+// folding it leaves at most one unit, and folding that one leaves the value in [0, 2^256).
+// 2^256 < 2p, so one conditional subtraction of p finishes the job.
+static inline void p256_reduce(uint64_t* result, const uint64_t* t)
+{
+    __asm__ volatile (
+        "movq 0(%[t]), %%r8\n\t"
+        "movq 8(%[t]), %%r9\n\t"
+        "movq 16(%[t]), %%r10\n\t"
+        "movq 24(%[t]), %%r11\n\t"
+        "xorl %%r12d, %%r12d\n\t"
+
+        // 2 * (S1 + S2): S1 = (0, t5 & hi, t6, t7), S2 = (0, t6 << 32, t6 >> 32 | t7 << 32, t7 >> 32)
+        "xorl %%edx, %%edx\n\t"
+        "movq 40(%[t]), %%r13\n\t"
+        "shrq $32, %%r13\n\t"
+        "shlq $32, %%r13\n\t"
+        "movq 48(%[t]), %%rax\n\t"
+        "shlq $32, %%rax\n\t"
+        "movq 48(%[t]), %%r14\n\t"
+        "movq 56(%[t]), %%rcx\n\t"
+        "shrdq $32, %%rcx, %%r14\n\t"
+        "movq 56(%[t]), %%r15\n\t"
+        "shrq $32, %%r15\n\t"
+        "addq %%rax, %%r13\n\t"
+        "adcq 48(%[t]), %%r14\n\t"
+        "adcq 56(%[t]), %%r15\n\t"
+        "adcq $0, %%rdx\n\t"
+        "addq %%r13, %%r9\n\t"
+        "adcq %%r14, %%r10\n\t"
+        "adcq %%r15, %%r11\n\t"
+        "adcq %%rdx, %%r12\n\t"
+        "addq %%r13, %%r9\n\t"
+        "adcq %%r14, %%r10\n\t"
+        "adcq %%r15, %%r11\n\t"
+        "adcq %%rdx, %%r12\n\t"
+
+        // S3 = (t4, t5 & lo, 0, t7)
+        "movl 40(%[t]), %%eax\n\t"
+        "addq 32(%[t]), %%r8\n\t"
+        "adcq %%rax, %%r9\n\t"
+        "adcq $0, %%r10\n\t"
+        "adcq 56(%[t]), %%r11\n\t"
+        "adcq $0, %%r12\n\t"
+
+        // S4 = (t4 >> 32 | t5 << 32, t5 >> 32 | t6 & hi, t7, t6 >> 32 | t4 << 32)
+        "movq 32(%[t]), %%r13\n\t"
+        "movq 40(%[t]), %%rax\n\t"
+        "shrdq $32, %%rax, %%r13\n\t"
+        "movq 40(%[t]), %%r14\n\t"
+        "shrq $32, %%r14\n\t"
+        "movq 48(%[t]), %%rcx\n\t"
+        "shrq $32, %%rcx\n\t"
+        "shlq $32, %%rcx\n\t"
+        "orq %%rcx, %%r14\n\t"
+        "movq 48(%[t]), %%r15\n\t"
+        "movq 32(%[t]), %%rdx\n\t"
+        "shrdq $32, %%rdx, %%r15\n\t"
+        "addq %%r13, %%r8\n\t"
+        "adcq %%r14, %%r9\n\t"
+        "adcq 56(%[t]), %%r10\n\t"
+        "adcq %%r15, %%r11\n\t"
+        "adcq $0, %%r12\n\t"
+
+        // D1 = (t5 >> 32 | t6 << 32, t6 >> 32, 0, t4 & lo | t5 << 32)
+        "movq 40(%[t]), %%r13\n\t"
+        "movq 48(%[t]), %%rax\n\t"
+        "shrdq $32, %%rax, %%r13\n\t"
+        "movq 48(%[t]), %%r14\n\t"
+        "shrq $32, %%r14\n\t"
+        "movl 32(%[t]), %%r15d\n\t"
+        "movq 40(%[t]), %%rcx\n\t"
+        "shlq $32, %%rcx\n\t"
+        "orq %%rcx, %%r15\n\t"
+        "subq %%r13, %%r8\n\t"
+        "sbbq %%r14, %%r9\n\t"
+        "sbbq $0, %%r10\n\t"
+        "sbbq %%r15, %%r11\n\t"
+        "sbbq $0, %%r12\n\t"
+
+        // D2 = (t6, t7, 0, t4 >> 32 | t5 & hi)
+        "movq 32(%[t]), %%r15\n\t"
+        "shrq $32, %%r15\n\t"
+        "movq 40(%[t]), %%rcx\n\t"
+        "shrq $32, %%rcx\n\t"
+        "shlq $32, %%rcx\n\t"
+        "orq %%rcx, %%r15\n\t"
+        "subq 48(%[t]), %%r8\n\t"
+        "sbbq 56(%[t]), %%r9\n\t"
+        "sbbq $0, %%r10\n\t"
+        "sbbq %%r15, %%r11\n\t"
+        "sbbq $0, %%r12\n\t"
+
+        // D3 = (t6 >> 32 | t7 << 32, t7 >> 32 | t4 << 32, t4 >> 32 | t5 << 32, t6 << 32)
+        "movq 48(%[t]), %%r13\n\t"
+        "movq 56(%[t]), %%rax\n\t"
+        "shrdq $32, %%rax, %%r13\n\t"
+        "movq 56(%[t]), %%r14\n\t"
+        "movq 32(%[t]), %%rcx\n\t"
+        "shrdq $32, %%rcx, %%r14\n\t"
+        "movq 32(%[t]), %%r15\n\t"
+        "movq 40(%[t]), %%rdx\n\t"
+        "shrdq $32, %%rdx, %%r15\n\t"
+        "movq 48(%[t]), %%rax\n\t"
+        "shlq $32, %%rax\n\t"
+        "subq %%r13, %%r8\n\t"
+        "sbbq %%r14, %%r9\n\t"
+        "sbbq %%r15, %%r10\n\t"
+        "sbbq %%rax, %%r11\n\t"
+        "sbbq $0, %%r12\n\t"
+
+        // D4 = (t7, t4 & hi, t5, t6 & hi)
+        "movq 32(%[t]), %%r14\n\t"
+        "shrq $32, %%r14\n\t"
+        "shlq $32, %%r14\n\t"
+        "movq 48(%[t]), %%rax\n\t"
+        "shrq $32, %%rax\n\t"
+        "shlq $32, %%rax\n\t"
+        "subq 56(%[t]), %%r8\n\t"
+        "sbbq %%r14, %%r9\n\t"
+        "sbbq 40(%[t]), %%r10\n\t"
+        "sbbq %%rax, %%r11\n\t"
+        "sbbq $0, %%r12\n\t"
+
+        P256_FOLD
+        P256_FOLD
+
+        // r - p, kept when it does not borrow
+        "movq %%r8, %%r13\n\t"
+        "movq %%r9, %%r14\n\t"
+        "movq %%r10, %%r15\n\t"
+        "movq %%r11, %%r12\n\t"
+        "movl $0xffffffff, %%eax\n\t"
+        "movabsq $0xffffffff00000001, %%rcx\n\t"
+        "subq $-1, %%r13\n\t"
+        "sbbq %%rax, %%r14\n\t"
+        "sbbq $0, %%r15\n\t"
+        "sbbq %%rcx, %%r12\n\t"
+        "cmovaeq %%r13, %%r8\n\t"
+        "cmovaeq %%r14, %%r9\n\t"
+        "cmovaeq %%r15, %%r10\n\t"
+        "cmovaeq %%r12, %%r11\n\t"
+
+        "movq %%r8, 0(%[r])\n\t"
+        "movq %%r9, 8(%[r])\n\t"
+        "movq %%r10, 16(%[r])\n\t"
+        "movq %%r11, 24(%[r])\n\t"
+        :
+        : [r] "r" (result), [t] "r" (t)
+        : "rax", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "cc", "memory");
+}
+
+P256_MULX_TARGET void p256_mul_mulx(uint64_t* result, const uint64_t* left, const uint64_t* right)
+{
+    uint64_t product[8];
+
+    p256_mul_4x4(product, left, right);
+    p256_reduce(result, product);
+}
+
+P256_MULX_TARGET void p256_sqr_mulx(uint64_t* result, const uint64_t* left)
+{
+    uint64_t product[8];
+
+    p256_sqr_4x4(product, left);
+    p256_reduce(result, product);
+}
+
+// One word of the Montgomery reduction: with m = z[i] and -1/p = 1 mod 2^64, adding m * p
+// clears z[i]. p[0] = 2^64 - 1 and p[1] = 2^32 - 1 make m * (p[0] + p[1] * 2^64) exactly
+// m * 2^96 - m, so z[i + 1] and z[i + 2] only take m shifted by 32; p[2] is 0 and p[3]
+// needs the one real product. The carry runs up through "rest" into the top word in r8.
+#define P256_MONT_STEP(zi, z1, z2, z3, z4, rest) \
+    "movq %%" zi ", %%rdx\n\t" \
+    "movq %%" zi ", %%rax\n\t" \
+    "shlq $32, %%rax\n\t" \
+    "movq %%" zi ", %%rcx\n\t" \
+    "shrq $32, %%rcx\n\t" \
+    "addq %%rax, %%" z1 "\n\t" \
+    "adcq %%rcx, %%" z2 "\n\t" \
+    "mulxq %[p3], %%rax, %%rcx\n\t" \
+    "adcq %%rax, %%" z3 "\n\t" \
+    "adcq %%rcx, %%" z4 "\n\t" \
+    rest
+
+#define P256_MONT_CARRY(z) "adcq $0, %%" z "\n\t"
+
+// result = r8-r15 / 2^256 mod p. z[0] is done with once its step has started, so r8 holds
+// the carry out of z[7]. For a product of two values below p the sum stays below 2p, and
+// one conditional subtraction of p finishes the job.
+#define P256_MONT_REDUCE \
+    "movq %%r8, %%rdx\n\t" \
+    "movq %%r8, %%rax\n\t" \
+    "shlq $32, %%rax\n\t" \
+    "movq %%r8, %%rcx\n\t" \
+    "shrq $32, %%rcx\n\t" \
+    "xorl %%r8d, %%r8d\n\t" \
+    "addq %%rax, %%r9\n\t" \
+    "adcq %%rcx, %%r10\n\t" \
+    "mulxq %[p3], %%rax, %%rcx\n\t" \
+    "adcq %%rax, %%r11\n\t" \
+    "adcq %%rcx, %%r12\n\t" \
+    P256_MONT_CARRY("r13") P256_MONT_CARRY("r14") P256_MONT_CARRY("r15") P256_MONT_CARRY("r8") \
+    P256_MONT_STEP("r9", "r10", "r11", "r12", "r13", P256_MONT_CARRY("r14") P256_MONT_CARRY("r15") P256_MONT_CARRY("r8")) \
+    P256_MONT_STEP("r10", "r11", "r12", "r13", "r14", P256_MONT_CARRY("r15") P256_MONT_CARRY("r8")) \
+    P256_MONT_STEP("r11", "r12", "r13", "r14", "r15", P256_MONT_CARRY("r8")) \
+    \
+    "movq %%r12, %%r9\n\t" \
+    "movq %%r13, %%r10\n\t" \
+    "movq %%r14, %%r11\n\t" \
+    "movq %%r15, %%rax\n\t" \
+    "movl $0xffffffff, %%ecx\n\t" \
+    "movq %[p3], %%rdx\n\t" \
+    "subq $-1, %%r9\n\t" \
+    "sbbq %%rcx, %%r10\n\t" \
+    "sbbq $0, %%r11\n\t" \
+    "sbbq %%rdx, %%rax\n\t" \
+    "sbbq $0, %%r8\n\t" \
+    "cmovaeq %%r9, %%r12\n\t" \
+    "cmovaeq %%r10, %%r13\n\t" \
+    "cmovaeq %%r11, %%r14\n\t" \
+    "cmovaeq %%rax, %%r15\n\t" \
+    "movq %%r12, 0(%[z])\n\t" \
+    "movq %%r13, 8(%[z])\n\t" \
+    "movq %%r14, 16(%[z])\n\t" \
+    "movq %%r15, 24(%[z])\n\t"
+
+static const uint64_t p256_p3 = 0xffffffff00000001ull;
+
+// Montgomery products, reduced in the same asm block as the product since the word-by-word
+// reduction needs nothing but the registers already holding it
+P256_MULX_TARGET void p256_mont_mul_mulx(uint64_t* result, const uint64_t* left, const uint64_t* right)
+{
+    __asm__ volatile (
+        P256_MULX_MUL4
+        P256_MONT_REDUCE
+        :
+        : [z] "r" (result), [a] "r" (left), [b] "r" (right), [p3] "m" (p256_p3)
+        : "rax", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "cc", "memory");
+}
+
+P256_MULX_TARGET void p256_mont_sqr_mulx(uint64_t* result, const uint64_t* left)
+{
+    __asm__ volatile (
+        P256_MULX_SQR4
+        P256_MONT_REDUCE
+        :
+        : [z] "r" (result), [a] "r" (left), [p3] "m" (p256_p3)
+        : "rax", "rcx", "rdx", "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15", "cc", "memory");
+}
+
+#endif // P256_HAVE_MULX
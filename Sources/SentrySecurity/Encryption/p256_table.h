@@ -0,0 +1,2125 @@
+/* Copyright 2015, Kenneth MacKay. Licensed under the BSD 2-clause license. */
+
+#ifndef _UECC_P256_TABLE_H_
+#define _UECC_P256_TABLE_H_
+
+/* Affine multiples of the secp256r1 generator for EccPoint_mult_G_secp256r1:
+   p256_g_table[i][j] = (j + 1) * 16^i * G, x then y, in the same word layout as curve->G.
+   Plain (not Montgomery) coordinates, so the table is the same for every build option.
+   Generated by gen_p256_table.py; regenerate rather than editing. */
+static const uECC_word_t p256_g_table[64][8][num_words_secp256r1 * 2] = {
+    /* (1..8) * 16^0 * G */
+    { { BYTES_TO_WORDS_8(96, C2, 98, D8, 45, 39, A1, F4), BYTES_TO_WORDS_8(A0, 33, EB, 2D, 81, 7D, 03, 77),
+        BYTES_TO_WORDS_8(F2, 40, A4, 63, E5, E6, BC, F8), BYTES_TO_WORDS_8(47, 42, 2C, E1, F2, D1, 17, 6B),
+        BYTES_TO_WORDS_8(F5, 51, BF, 37, 68, 40, B6, CB), BYTES_TO_WORDS_8(CE, 5E, 31, 6B, 57, 33, CE, 2B),
+        BYTES_TO_WORDS_8(16, 9E, 0F, 7C, 4A, EB, E7, 8E), BYTES_TO_WORDS_8(9B, 7F, 1A, FE, E2, 42, E3, 4F) },
+      { BYTES_TO_WORDS_8(78, 99, 66, 47, FC, 48, 0B, A6), BYTES_TO_WORDS_8(35, 1B, F2, 77, E2, 69, 89, C0),
+        BYTES_TO_WORDS_8(C3, 1A, B5, 04, 03, 38, 52, 8A), BYTES_TO_WORDS_8(7E, 4F, 03, 8D, 18, 7B, F2, 7C),
+        BYTES_TO_WORDS_8(D1, 73, 78, 22, 9D, B7, 04, 9E), BYTES_TO_WORDS_8(29, 82, E9, 3C, E6, AD, 7D, BA),
+        BYTES_TO_WORDS_8(DB, 30, 74, 9F, C6, 9A, 3D, 29), BYTES_TO_WORDS_8(40, D0, 8E, DB, 10, 55, 77, 07) },
+      { BYTES_TO_WORDS_8(6C, FD, E7, C6, 1B, 66, 41, FB), BYTES_TO_WORDS_8(85, A9, AD, EF, 21, B7, C6, E6),
+        BYTES_TO_WORDS_8(65, F1, 4B, 1D, 95, EF, F7, C8), BYTES_TO_WORDS_8(44, 0A, 33, A6, D1, E4, CB, 5E),
+        BYTES_TO_WORDS_8(32, 50, 7D, A2, 27, B1, 79, 9A), BYTES_TO_WORDS_8(3D, B8, 4F, 38, 36, B0, 2A, D8),
+        BYTES_TO_WORDS_8(EC, A2, 64, 1A, CE, 06, 4B, 37), BYTES_TO_WORDS_8(7E, FF, 98, 49, 0C, 64, 34, 87) },
+      { BYTES_TO_WORDS_8(52, 08, 03, 6B, 44, 02, 93, 50), BYTES_TO_WORDS_8(EF, 96, 55, 78, DB, E2, 1F, 03),
+        BYTES_TO_WORDS_8(D0, 2B, E6, 9E, 65, DE, 2D, A0), BYTES_TO_WORDS_8(BB, 8F, D0, 32, 35, 4A, 53, E2),
+        BYTES_TO_WORDS_8(C6, D8, 4E, 18, 3F, C2, 42, 5C), BYTES_TO_WORDS_8(05, E0, 0E, F3, C3, 96, FC, 4E),
+        BYTES_TO_WORDS_8(76, 2D, 86, DA, 5F, EE, DF, 19), BYTES_TO_WORDS_8(C7, 3C, 63, 4C, 5A, 57, F1, E0) },
+      { BYTES_TO_WORDS_8(ED, 33, D0, C3, 0D, 4A, 55, 21), BYTES_TO_WORDS_8(24, E5, 5B, 1F, FD, 82, 8C, EF),
+        BYTES_TO_WORDS_8(DF, 8F, 66, 08, 56, C8, 84, D7), BYTES_TO_WORDS_8(D2, 40, 51, 51, 7A, 0B, 59, 51),
+        BYTES_TO_WORDS_8(A4, 6D, A1, FD, 44, BB, D0, D1), BYTES_TO_WORDS_8(88, 08, D8, D4, 00, 2F, 01, 0D),
+        BYTES_TO_WORDS_8(26, 79, 8A, BF, 36, BF, E1, 8A), BYTES_TO_WORDS_8(7D, 72, 4A, 90, A8, 7D, C1, E0) },
+      { BYTES_TO_WORDS_8(A9, 91, 22, 3C, E9, AA, B0, C6), BYTES_TO_WORDS_8(B4, 15, B2, EB, 0D, 74, 4C, 02),
+        BYTES_TO_WORDS_8(E3, DD, 97, B8, 2C, 24, D3, 92), BYTES_TO_WORDS_8(2C, 60, A4, 76, 2A, 17, 1A, B0),
+        BYTES_TO_WORDS_8(E2, 7F, C7, 8F, 53, 48, 7C, FD), BYTES_TO_WORDS_8(BD, 16, 7E, 1C, 70, F7, 00, 1C),
+        BYTES_TO_WORDS_8(79, 03, A7, FB, 2D, 0E, EC, 6F), BYTES_TO_WORDS_8(D5, DA, 37, 32, 74, 10, 5C, E8) },
+      { BYTES_TO_WORDS_8(A3, B2, 87, 31, 70, 28, 06, 30), BYTES_TO_WORDS_8(5B, EF, 0F, A8, B8, F8, F9, 7E),
+        BYTES_TO_WORDS_8(60, FB, 01, 7C, 66, 30, BB, 25), BYTES_TO_WORDS_8(46, 7B, BF, A0, 6F, 3B, 53, 8E),
+        BYTES_TO_WORDS_8(B4, 00, F4, C1, 86, 1A, 5E, C5), BYTES_TO_WORDS_8(21, 1B, 04, CB, 33, 36, C7, 53),
+        BYTES_TO_WORDS_8(00, 90, F5, A6, 83, 9F, 06, 6D), BYTES_TO_WORDS_8(36, 18, 33, E0, BD, 1D, EB, 73) },
+      { BYTES_TO_WORDS_8(93, B3, 6F, DB, C1, 9D, DD, B4), BYTES_TO_WORDS_8(DB, 97, CE, 0F, 98, 38, D2, C1),
+        BYTES_TO_WORDS_8(AD, 4C, B5, 3A, 2D, 74, 42, 40), BYTES_TO_WORDS_8(53, B0, E9, BE, 9D, 77, D9, 62),
+        BYTES_TO_WORDS_8(7E, 95, 09, 0F, 6A, 0A, 54, DA), BYTES_TO_WORDS_8(78, 6A, E7, BB, F6, 51, ED, A2),
+        BYTES_TO_WORDS_8(E0, CE, 67, 11, 77, 5D, F1, 4F), BYTES_TO_WORDS_8(24, D8, E9, 91, BD, CC, 5A, AD) } },
+    /* (1..8) * 16^1 * G */
+    { { BYTES_TO_WORDS_8(6E, 7C, 27, E1, 87, 47, EB, A5), BYTES_TO_WORDS_8(38, A0, 6C, FF, 2E, 39, 28, CD),
+        BYTES_TO_WORDS_8(5F, 31, 36, 98, 62, 1C, 82, 8B), BYTES_TO_WORDS_8(85, 41, 6B, 8A, 13, 4D, A9, 76),
+        BYTES_TO_WORDS_8(10, 51, 8C, 4B, 72, DD, 9D, 0E), BYTES_TO_WORDS_8(AA, 8B, C7, 0F, 04, A0, 99, 85),
+        BYTES_TO_WORDS_8(20, 87, 1E, E1, B5, A1, B0, 6C), BYTES_TO_WORDS_8(0E, 26, 1F, 34, 61, FE, 85, A9) },
+      { BYTES_TO_WORDS_8(E1, D0, 7E, 2A, D5, 5B, 47, D1), BYTES_TO_WORDS_8(D9, 71, 83, B6, D5, 7F, 55, AA),
+        BYTES_TO_WORDS_8(EF, BE, A5, 8E, 4E, 07, 45, 6C), BYTES_TO_WORDS_8(CA, 42, A2, 90, D6, C7, 77, 23),
+        BYTES_TO_WORDS_8(B2, D2, B8, DD, B1, 67, C0, E7), BYTES_TO_WORDS_8(16, 67, F4, EC, CD, A6, 58, 66),
+        BYTES_TO_WORDS_8(7E, 1B, 90, BF, E9, 90, 8D, 3F), BYTES_TO_WORDS_8(39, A4, 13, 84, B9, 3F, A1, 47) },
+      { BYTES_TO_WORDS_8(CA, 36, 45, 9E, C6, 9D, FB, AB), BYTES_TO_WORDS_8(61, 1A, 20, 0A, 96, 92, 2E, 1C),
+        BYTES_TO_WORDS_8(A1, CD, 70, E0, 5B, 74, CE, 8C), BYTES_TO_WORDS_8(EC, 39, 25, 49, 0E, FB, 82, 94),
+        BYTES_TO_WORDS_8(C8, C1, 8C, F5, 3B, 86, AD, 1F), BYTES_TO_WORDS_8(BB, BF, 07, 57, 29, 5E, 3D, F6),
+        BYTES_TO_WORDS_8(63, 4E, 53, A7, 8C, 63, 5D, 1A), BYTES_TO_WORDS_8(F9, 57, F1, 45, A7, 9C, 1D, 35) },
+      { BYTES_TO_WORDS_8(85, E7, 0E, B9, A6, 10, 41, AA), BYTES_TO_WORDS_8(16, D8, 38, 73, DC, 5E, B3, 25),
+        BYTES_TO_WORDS_8(91, 8E, BF, B1, 5E, 6A, 7A, F6), BYTES_TO_WORDS_8(DE, 14, CC, 8F, FB, 43, 06, 0A),
+        BYTES_TO_WORDS_8(C2, 9C, 1F, 86, 00, D1, C0, BA), BYTES_TO_WORDS_8(D7, 2E, 01, E7, 00, 0D, A1, 0D),
+        BYTES_TO_WORDS_8(70, 0E, 92, A2, CD, DA, 20, C5), BYTES_TO_WORDS_8(55, 79, 9E, 4A, 32, 38, 34, 55) },
+      { BYTES_TO_WORDS_8(13, FF, EC, 95, E2, DA, B1, 49), BYTES_TO_WORDS_8(3C, 63, D0, DB, 1C, 4A, 76, 63),
+        BYTES_TO_WORDS_8(EB, 1E, 08, 53, 51, 5A, 83, 5B), BYTES_TO_WORDS_8(19, 31, E9, 7A, C1, B7, E1, B2),
+        BYTES_TO_WORDS_8(44, 7D, 18, B2, 89, 49, BA, A3), BYTES_TO_WORDS_8(E6, A2, DE, 17, 98, 1A, DA, 87),
+        BYTES_TO_WORDS_8(C3, 58, D7, AA, A2, A1, 33, F2), BYTES_TO_WORDS_8(CC, EB, A3, 13, 13, 44, C0, E6) },
+      { BYTES_TO_WORDS_8(50, 5A, 63, FC, 7A, CB, 24, AD), BYTES_TO_WORDS_8(F4, C2, BA, AC, B2, FC, 12, E5),
+        BYTES_TO_WORDS_8(40, 74, C3, 61, D3, 51, 44, D2), BYTES_TO_WORDS_8(94, 37, 8C, 5C, A3, 03, 20, 49),
+        BYTES_TO_WORDS_8(9A, 8B, 18, B8, 28, 6B, 16, C9), BYTES_TO_WORDS_8(49, E0, B2, E0, 70, C6, 1B, 3C),
+        BYTES_TO_WORDS_8(A2, 79, DC, 6B, F9, 2F, 83, 4D), BYTES_TO_WORDS_8(DE, B4, 33, B3, CF, 69, 15, 1F) },
+      { BYTES_TO_WORDS_8(86, 72, F8, EE, 34, B3, BB, 38), BYTES_TO_WORDS_8(E4, 09, 23, FC, 7D, E8, 03, 07),
+        BYTES_TO_WORDS_8(34, EE, C6, CB, 7D, 17, 34, CB), BYTES_TO_WORDS_8(C2, 6B, 1B, 7F, 2E, 46, 33, B4),
+        BYTES_TO_WORDS_8(D9, 96, 14, 84, F6, 47, C0, 7A), BYTES_TO_WORDS_8(4B, EA, 2C, 6A, 80, 20, CE, 9D),
+        BYTES_TO_WORDS_8(6F, 2E, 69, C1, 72, 4E, 3F, 38), BYTES_TO_WORDS_8(FE, B5, D2, 6E, 52, 54, DA, A0) },
+      { BYTES_TO_WORDS_8(F6, C4, 74, A6, 35, 62, 9E, 6A), BYTES_TO_WORDS_8(62, 59, F8, 78, A6, DE, 56, C5),
+        BYTES_TO_WORDS_8(62, B7, E4, ED, 8E, 2F, CE, D7), BYTES_TO_WORDS_8(6A, 8B, DE, 0B, BA, 7D, 3F, AE),
+        BYTES_TO_WORDS_8(53, 4B, 1F, 71, 3E, 55, E0, 1E), BYTES_TO_WORDS_8(5C, 8A, 5F, 08, 0D, 50, 40, 79),
+        BYTES_TO_WORDS_8(A9, B9, 9D, 24, 13, C2, B8, 24), BYTES_TO_WORDS_8(5A, 99, 69, 0A, FC, 49, 05, 1C) } },
+    /* (1..8) * 16^2 * G */
+    { { BYTES_TO_WORDS_8(1B, 44, D0, 12, 5F, E3, B2, 2D), BYTES_TO_WORDS_8(4C, 56, 6A, 0D, 71, 0B, 0D, 19),
+        BYTES_TO_WORDS_8(61, ED, 03, 86, 52, D1, FF, 87), BYTES_TO_WORDS_8(59, 16, 09, B0, A3, D4, A2, 34),
+        BYTES_TO_WORDS_8(46, B1, 93, 5E, 84, E7, 24, B4), BYTES_TO_WORDS_8(1D, D8, DD, DE, B9, 66, D7, E7),
+        BYTES_TO_WORDS_8(C0, 7F, 77, 6E, 04, 71, CA, 2B), BYTES_TO_WORDS_8(C2, E3, A1, 53, 6A, ED, AA, BE) },
+      { BYTES_TO_WORDS_8(DE, 98, 3F, 9F, A3, CE, 69, 34), BYTES_TO_WORDS_8(FC, 5D, 3C, 0B, AE, B9, 16, A4),
+        BYTES_TO_WORDS_8(9A, 45, 8D, 81, BD, 7B, 89, E8), BYTES_TO_WORDS_8(E4, 59, E7, 8B, 52, 90, C4, 04),
+        BYTES_TO_WORDS_8(96, 6E, 8D, 4E, 43, 49, D9, EB), BYTES_TO_WORDS_8(EE, 05, 46, 4A, 7B, 9D, 1D, 47),
+        BYTES_TO_WORDS_8(07, 81, 2A, 24, 66, 4C, E8, AD), BYTES_TO_WORDS_8(4F, C7, 5C, 40, 46, 0B, E5, 30) },
+      { BYTES_TO_WORDS_8(24, 84, A0, BD, 33, AE, E4, DC), BYTES_TO_WORDS_8(A9, 44, F6, 74, AB, B7, BF, 3A),
+        BYTES_TO_WORDS_8(ED, 23, 5D, A9, FF, C5, 58, 1B), BYTES_TO_WORDS_8(AA, 59, C3, AD, 07, 0A, 8B, A9),
+        BYTES_TO_WORDS_8(0C, 80, 31, E8, A0, 87, 12, 36), BYTES_TO_WORDS_8(2D, 58, DF, A0, 0B, E8, 2B, 75),
+        BYTES_TO_WORDS_8(20, 13, 1D, 8E, 8C, 9E, 31, E5), BYTES_TO_WORDS_8(66, 9B, 49, 22, 47, C6, 54, 47) },
+      { BYTES_TO_WORDS_8(07, CA, 61, 8E, B9, 6B, E7, 80), BYTES_TO_WORDS_8(E2, 27, D5, E1, 9A, 84, C5, CD),
+        BYTES_TO_WORDS_8(0C, E8, 6F, EB, B9, 99, 72, 89), BYTES_TO_WORDS_8(81, F4, D4, 87, 72, 9B, 94, 16),
+        BYTES_TO_WORDS_8(27, 04, 42, A0, E7, 2B, 9C, A0), BYTES_TO_WORDS_8(3A, 98, DF, FE, C6, 6A, 2D, 4D),
+        BYTES_TO_WORDS_8(09, 12, 60, 5B, B7, 97, F9, BD), BYTES_TO_WORDS_8(DE, DE, 0E, 77, 6D, 14, A4, E7) },
+      { BYTES_TO_WORDS_8(6A, 2D, 3C, 88, 5E, 7E, 2D, B5), BYTES_TO_WORDS_8(B3, 29, BD, 81, 8D, 91, 2F, D2),
+        BYTES_TO_WORDS_8(6D, 69, 5A, C8, 78, 6B, 1B, D2), BYTES_TO_WORDS_8(C5, AA, 8D, C8, 09, F0, 34, A0),
+        BYTES_TO_WORDS_8(72, 0E, C3, C2, F2, 6E, 33, F4), BYTES_TO_WORDS_8(7C, 7E, 26, 16, 5F, 03, 06, BE),
+        BYTES_TO_WORDS_8(06, EB, EC, 5C, 54, B8, CD, B0), BYTES_TO_WORDS_8(1F, 9C, 89, CA, 36, 00, 1B, FE) },
+      { BYTES_TO_WORDS_8(CD, 52, 67, 8F, B4, FD, 61, 6D), BYTES_TO_WORDS_8(3B, 92, 3F, 3F, 3C, DD, 1B, B7),
+        BYTES_TO_WORDS_8(CB, 65, B2, 20, E5, 0F, 42, A8), BYTES_TO_WORDS_8(A3, 4D, E1, F0, A7, 60, B6, 3F),
+        BYTES_TO_WORDS_8(7E, 01, C6, 64, C0, E8, 12, 2F), BYTES_TO_WORDS_8(C1, A0, 00, 11, BD, 13, C0, 8B),
+        BYTES_TO_WORDS_8(59, 7D, 57, D9, C4, 69, 28, 4C), BYTES_TO_WORDS_8(7C, 63, 24, 42, 1D, 85, 45, 65) },
+      { BYTES_TO_WORDS_8(78, 8C, BE, 28, DD, 51, 6A, 71), BYTES_TO_WORDS_8(4D, 3E, 79, 2B, F8, 6C, 09, 4A),
+        BYTES_TO_WORDS_8(A1, E9, 62, 09, B4, E2, 76, A0), BYTES_TO_WORDS_8(01, 44, 9D, 31, FF, 26, 22, B5),
+        BYTES_TO_WORDS_8(03, 69, 68, 51, CA, 67, 33, 20), BYTES_TO_WORDS_8(F3, 8F, B5, E5, C8, 7F, 9F, 81),
+        BYTES_TO_WORDS_8(1A, 85, 92, 7E, 69, 36, 1B, CA), BYTES_TO_WORDS_8(40, F5, 39, F5, C9, E0, 1E, 70) },
+      { BYTES_TO_WORDS_8(C0, 45, BE, 1A, 86, 4A, 40, E1), BYTES_TO_WORDS_8(5A, 92, 6F, F4, 5F, 19, 1B, 28),
+        BYTES_TO_WORDS_8(76, 61, B8, 49, 47, 8F, 6A, 88), BYTES_TO_WORDS_8(72, 5F, 47, 16, F7, 67, 1A, B0),
+        BYTES_TO_WORDS_8(6C, 10, 90, 00, BE, 0D, 2F, C7), BYTES_TO_WORDS_8(7F, 2C, B6, 41, 63, 67, FC, 72),
+        BYTES_TO_WORDS_8(94, F9, 4E, 16, 13, 6B, D5, AC), BYTES_TO_WORDS_8(E2, 56, 39, 5A, BF, 1B, 52, 7C) } },
+    /* (1..8) * 16^3 * G */
+    { { BYTES_TO_WORDS_8(3F, 57, 45, A2, DA, E8, 77, F0), BYTES_TO_WORDS_8(64, 0A, FD, F4, F2, 76, 86, 50),
+        BYTES_TO_WORDS_8(D2, 6B, 6D, 2E, 67, 89, 77, 99), BYTES_TO_WORDS_8(4D, 9E, 06, CF, D2, AE, 16, E7),
+        BYTES_TO_WORDS_8(D1, 18, 92, 46, 6B, C2, 5F, 50), BYTES_TO_WORDS_8(B3, C9, 07, FA, F2, 0D, 3D, D1),
+        BYTES_TO_WORDS_8(51, A8, B9, 87, 66, B0, 12, 59), BYTES_TO_WORDS_8(AB, 72, FC, 94, E6, 63, 36, 35) },
+      { BYTES_TO_WORDS_8(B3, 74, 71, 35, 2B, 3C, 11, B5), BYTES_TO_WORDS_8(F4, 51, C4, CE, 2F, 5D, 2E, 6B),
+        BYTES_TO_WORDS_8(1B, E8, B5, 25, CF, 41, 45, 2F), BYTES_TO_WORDS_8(EF, 07, 82, 54, E3, C3, 57, 5A),
+        BYTES_TO_WORDS_8(E3, 37, 34, 38, 59, 59, CF, 88), BYTES_TO_WORDS_8(28, B9, 4B, 13, 00, 67, 88, 28),
+        BYTES_TO_WORDS_8(33, 44, F3, 29, 57, 16, B1, 01), BYTES_TO_WORDS_8(46, 22, 69, 3E, 30, 7B, 7C, 07) },
+      { BYTES_TO_WORDS_8(AC, 08, 70, 65, 30, 79, 98, 7F), BYTES_TO_WORDS_8(FB, ED, 29, E3, CE, 1E, CE, 19),
+        BYTES_TO_WORDS_8(2D, A2, 1D, 4C, 8A, 55, E5, 64), BYTES_TO_WORDS_8(E8, 7C, 50, 6F, 8D, 89, BF, D2),
+        BYTES_TO_WORDS_8(55, EB, 7B, 72, 4A, 53, 11, 81), BYTES_TO_WORDS_8(98, 07, FF, B5, 0A, E1, 9C, 67),
+        BYTES_TO_WORDS_8(56, 0C, A9, 3F, DB, 95, 81, 3F), BYTES_TO_WORDS_8(AA, 77, 6B, 5A, CB, B1, C0, 69) },
+      { BYTES_TO_WORDS_8(FF, 06, B0, AC, 0F, F0, 37, 89), BYTES_TO_WORDS_8(C5, 4F, 7E, 79, 74, A9, 87, 1A),
+        BYTES_TO_WORDS_8(AD, 86, FB, EC, AD, 20, 09, D1), BYTES_TO_WORDS_8(8C, 20, F7, EE, 05, 65, E9, 5C),
+        BYTES_TO_WORDS_8(13, 26, 15, 07, A1, CD, 8D, 81), BYTES_TO_WORDS_8(2B, 5C, 95, BD, BE, 20, 9D, 66),
+        BYTES_TO_WORDS_8(C3, 7B, DE, 2F, F2, D1, 56, EC), BYTES_TO_WORDS_8(D5, 5A, 1F, 38, BD, 6E, 6B, D1) },
+      { BYTES_TO_WORDS_8(80, 15, 2F, 78, A9, 7C, 0D, FD), BYTES_TO_WORDS_8(B7, 3E, 20, 24, EE, DD, E4, B0),
+        BYTES_TO_WORDS_8(F8, 64, 30, 1F, 39, 57, FA, 87), BYTES_TO_WORDS_8(60, CE, 83, E5, 4E, 30, 88, 4D),
+        BYTES_TO_WORDS_8(D7, ED, 16, 56, 6D, B1, 0F, 0C), BYTES_TO_WORDS_8(11, 1E, EB, 68, BD, A3, FC, AA),
+        BYTES_TO_WORDS_8(18, 65, FD, 98, 08, 80, D6, E8), BYTES_TO_WORDS_8(6C, 63, B0, 9A, 70, 4E, A9, 28) },
+      { BYTES_TO_WORDS_8(86, D9, 43, C5, 54, C4, C1, A0), BYTES_TO_WORDS_8(20, 2A, 64, BB, 6E, 4B, 75, 76),
+        BYTES_TO_WORDS_8(16, 9E, 7D, A3, 0A, AA, 8A, B2), BYTES_TO_WORDS_8(42, E6, 0B, C8, A5, 97, 1C, 54),
+        BYTES_TO_WORDS_8(A7, 2E, 4B, 42, 98, 8F, 0B, 7B), BYTES_TO_WORDS_8(BD, 78, 16, C6, C8, DD, B3, 7F),
+        BYTES_TO_WORDS_8(44, B1, 64, EB, 55, 84, D4, 54), BYTES_TO_WORDS_8(32, B6, D2, 2C, 66, 35, 4D, 05) },
+      { BYTES_TO_WORDS_8(11, 8E, C3, E0, DA, C3, 84, 5F), BYTES_TO_WORDS_8(BA, 26, 6E, EA, 1B, 42, 56, 71),
+        BYTES_TO_WORDS_8(9E, AF, E5, 02, 92, 39, 67, 32), BYTES_TO_WORDS_8(EB, 0E, FC, C8, 27, 27, C7, 17),
+        BYTES_TO_WORDS_8(CD, DE, 90, AE, BB, 66, 83, CD), BYTES_TO_WORDS_8(E3, DA, 0C, A6, 45, 99, 53, 7E),
+        BYTES_TO_WORDS_8(2E, 80, 01, E9, CC, 2F, 60, 40), BYTES_TO_WORDS_8(3C, 4B, 66, FE, F4, A4, C5, 95) },
+      { BYTES_TO_WORDS_8(BC, 9F, B7, D0, 05, 1B, 26, 15), BYTES_TO_WORDS_8(19, A9, 31, 1D, 31, B8, A5, 63),
+        BYTES_TO_WORDS_8(33, 04, B1, 35, 46, 3A, 2A, 4B), BYTES_TO_WORDS_8(1B, CA, 25, C6, 27, BD, A5, 71),
+        BYTES_TO_WORDS_8(6B, 7F, 27, 8F, CC, 7C, E3, C2), BYTES_TO_WORDS_8(D0, 32, AA, EB, 51, 60, 6B, C7),
+        BYTES_TO_WORDS_8(EF, F2, 02, 1A, CA, 52, 94, B3), BYTES_TO_WORDS_8(FF, 41, 67, 06, 4D, 52, BF, C5) } },
+    /* (1..8) * 16^4 * G */
+    { { BYTES_TO_WORDS_8(C4, E3, AD, 6E, 5C, 46, E8, 03), BYTES_TO_WORDS_8(05, 2A, 05, C9, 49, B7, 4A, 71),
+        BYTES_TO_WORDS_8(B4, 86, E5, 40, 33, 64, 5C, 8E), BYTES_TO_WORDS_8(0D, E9, 91, 4E, 6F, 36, 18, A0),
+        BYTES_TO_WORDS_8(D0, E8, 26, 6B, 02, 42, 5C, F4), BYTES_TO_WORDS_8(37, 4F, 61, 44, 4E, 28, F7, D5),
+        BYTES_TO_WORDS_8(69, 83, 9D, 34, 78, E5, 6C, 7C), BYTES_TO_WORDS_8(16, 0B, 11, 14, 17, EC, BB, E2) },
+      { BYTES_TO_WORDS_8(2D, 11, A9, 47, E6, CE, BC, FE), BYTES_TO_WORDS_8(EE, E3, 1C, FE, DF, 5A, 7D, EB),
+        BYTES_TO_WORDS_8(45, 4C, 25, EA, 87, 54, A2, 9E), BYTES_TO_WORDS_8(A6, A2, 7D, 70, 5D, E6, 7C, CD),
+        BYTES_TO_WORDS_8(AF, B3, 92, 3A, 0D, BE, BA, FF), BYTES_TO_WORDS_8(A5, 60, EE, 8B, 49, AA, 90, A1),
+        BYTES_TO_WORDS_8(08, 67, EE, A5, 6A, 01, B9, 89), BYTES_TO_WORDS_8(97, 6F, 96, 4C, 4B, 4A, E0, 85) },
+      { BYTES_TO_WORDS_8(06, AF, E0, 59, AC, DE, 1C, 6E), BYTES_TO_WORDS_8(8D, 95, ED, 62, A5, 98, F3, 92),
+        BYTES_TO_WORDS_8(5C, 05, 45, 6D, 5A, 3B, BD, 50), BYTES_TO_WORDS_8(64, 89, 8D, B8, 00, 1F, DF, 9C),
+        BYTES_TO_WORDS_8(E7, AD, 16, 62, DB, 32, 7A, 8D), BYTES_TO_WORDS_8(46, A5, 7C, 19, DC, 22, 85, 82),
+        BYTES_TO_WORDS_8(B0, 94, 8D, DC, BC, 8B, 95, 4D), BYTES_TO_WORDS_8(66, AD, F2, D3, FE, 25, 6D, 91) },
+      { BYTES_TO_WORDS_8(1A, 2F, 21, C3, 96, AD, 88, 6C), BYTES_TO_WORDS_8(EF, 8B, 99, 6C, C3, 0B, AF, E8),
+        BYTES_TO_WORDS_8(59, AE, 05, 37, C7, D4, 67, 8E), BYTES_TO_WORDS_8(71, 34, 96, 09, EA, 0A, 5F, 0F),
+        BYTES_TO_WORDS_8(9A, B0, 12, 77, 1E, 7B, 5D, 75), BYTES_TO_WORDS_8(7C, AF, 29, DE, 0D, D4, 5E, 4F),
+        BYTES_TO_WORDS_8(78, 6B, A1, 4B, DD, AA, 86, 58), BYTES_TO_WORDS_8(95, 3C, 59, C8, B7, B2, A8, F8) },
+      { BYTES_TO_WORDS_8(7E, 09, 05, 93, 93, 2B, 37, 81), BYTES_TO_WORDS_8(19, A5, 3B, 84, 0E, 17, D6, 38),
+        BYTES_TO_WORDS_8(83, 44, 40, 05, 2D, 1B, 6B, AB), BYTES_TO_WORDS_8(ED, 63, A6, D1, D5, D9, BF, 45),
+        BYTES_TO_WORDS_8(04, DC, 8D, 90, 8E, 05, BA, 54), BYTES_TO_WORDS_8(59, C1, D2, BF, 33, 9D, 3B, 68),
+        BYTES_TO_WORDS_8(08, E9, 0C, 47, 05, 83, D8, BA), BYTES_TO_WORDS_8(2B, FD, 5A, 85, 12, DC, D1, 09) },
+      { BYTES_TO_WORDS_8(47, CC, 5B, D9, AC, 49, 03, 00), BYTES_TO_WORDS_8(EF, 80, 7F, 1A, 4B, D4, E2, B0),
+        BYTES_TO_WORDS_8(96, 9A, A7, 8F, E4, FA, 07, 34), BYTES_TO_WORDS_8(00, B4, BF, F9, 6C, F0, 84, 77),
+        BYTES_TO_WORDS_8(B4, B3, FB, 80, 01, DE, FB, 02), BYTES_TO_WORDS_8(B6, FF, F6, D4, CD, B5, 64, F4),
+        BYTES_TO_WORDS_8(CE, E6, FE, B2, 93, E4, 8D, 3F), BYTES_TO_WORDS_8(3A, C4, ED, C3, 3E, 73, A2, CC) },
+      { BYTES_TO_WORDS_8(DF, D6, 3B, B6, A0, F1, 31, CD), BYTES_TO_WORDS_8(C3, AE, 66, DD, C2, 23, FC, D1),
+        BYTES_TO_WORDS_8(6F, 5E, 89, 02, 9C, 9F, 1E, 67), BYTES_TO_WORDS_8(3B, 69, 76, 64, 15, AD, 99, B5),
+        BYTES_TO_WORDS_8(AC, 09, FA, 8E, A3, CE, A1, 8E), BYTES_TO_WORDS_8(45, 4B, 13, 91, F6, C4, 40, 6A),
+        BYTES_TO_WORDS_8(16, C4, 23, 8B, 0B, 36, 37, 46), BYTES_TO_WORDS_8(32, B3, FA, C4, DE, D1, 79, 69) },
+      { BYTES_TO_WORDS_8(BB, 71, 44, FC, 8C, 15, 35, 24), BYTES_TO_WORDS_8(17, E9, E6, E1, F4, 8B, 42, 91),
+        BYTES_TO_WORDS_8(90, 5C, E2, 0A, 87, 0D, 5F, F1), BYTES_TO_WORDS_8(39, 59, 7F, D5, A8, D0, 1A, 47),
+        BYTES_TO_WORDS_8(0C, 3A, 69, 49, FA, 18, 43, 45), BYTES_TO_WORDS_8(2C, 98, 23, 7F, FF, E9, D7, B0),
+        BYTES_TO_WORDS_8(38, D1, 94, 80, B4, 7A, 36, 2A), BYTES_TO_WORDS_8(39, 8E, 8E, 77, 62, CA, 34, 22) } },
+    /* (1..8) * 16^5 * G */
+    { { BYTES_TO_WORDS_8(F1, DF, 96, 7D, CB, CE, 7D, 8F), BYTES_TO_WORDS_8(FE, FC, D5, AA, C1, 31, E4, 30),
+        BYTES_TO_WORDS_8(D5, 98, CD, 70, B5, A0, F6, FE), BYTES_TO_WORDS_8(4F, E5, 1F, 14, 85, 38, C7, 0E),
+        BYTES_TO_WORDS_8(2C, 55, 7B, 7C, AC, 41, C8, 9E), BYTES_TO_WORDS_8(AA, 78, ED, 87, CE, 64, 52, 1D),
+        BYTES_TO_WORDS_8(51, 52, 06, 58, EF, C4, AC, 91), BYTES_TO_WORDS_8(5D, 87, AE, 87, 4E, 4F, 22, D6) },
+      { BYTES_TO_WORDS_8(C9, B7, 60, 96, 39, B5, 83, B1), BYTES_TO_WORDS_8(CF, 6D, FB, 12, 31, 2B, A1, 9B),
+        BYTES_TO_WORDS_8(C6, F0, C8, 32, 25, 0E, 9A, 05), BYTES_TO_WORDS_8(DE, 1C, 6E, 4E, 36, 78, 77, 47),
+        BYTES_TO_WORDS_8(DF, C3, 18, 99, A3, 5F, 20, 5C), BYTES_TO_WORDS_8(CF, EB, 42, F1, C1, 04, 06, 5E),
+        BYTES_TO_WORDS_8(8A, 9E, C8, A7, B6, EF, 73, 73), BYTES_TO_WORDS_8(31, 9E, 38, B8, 00, 9D, D8, 2D) },
+      { BYTES_TO_WORDS_8(E9, 58, 8D, 08, AB, 24, C3, 51), BYTES_TO_WORDS_8(38, 18, E3, 64, 1C, 5C, 4A, E9),
+        BYTES_TO_WORDS_8(B6, A7, 42, 7C, 6A, A4, 92, E9), BYTES_TO_WORDS_8(86, 4A, 06, C7, FD, C3, DA, 96),
+        BYTES_TO_WORDS_8(5E, BC, BE, AE, 12, 93, 34, 80), BYTES_TO_WORDS_8(E3, E6, 87, 94, 9B, E8, 5B, 68),
+        BYTES_TO_WORDS_8(39, C4, 82, 93, 94, C4, 6C, 85), BYTES_TO_WORDS_8(AD, C1, 46, AD, F3, AF, 1F, CB) },
+      { BYTES_TO_WORDS_8(8E, 9D, D6, 26, 3B, 01, D8, 0F), BYTES_TO_WORDS_8(26, 5D, F4, 35, AF, 8F, C3, 2E),
+        BYTES_TO_WORDS_8(D2, 4D, E1, 17, 90, 98, 3D, C7), BYTES_TO_WORDS_8(A8, B5, 91, 34, 8D, 45, 3D, 35),
+        BYTES_TO_WORDS_8(82, 2B, F3, 20, 00, 9D, 2B, 84), BYTES_TO_WORDS_8(A8, A9, 71, FB, 12, FC, 5D, 82),
+        BYTES_TO_WORDS_8(8A, 0A, 04, 0C, E4, FD, 30, 31), BYTES_TO_WORDS_8(24, DE, 5B, 4F, BF, 37, 7D, 9C) },
+      { BYTES_TO_WORDS_8(92, 9F, B2, 2D, 13, AD, 52, 89), BYTES_TO_WORDS_8(C5, B2, 47, B9, 71, D2, 21, 1D),
+        BYTES_TO_WORDS_8(81, 8F, EB, 8A, 37, DC, 05, A1), BYTES_TO_WORDS_8(12, F3, 14, EB, 3C, B2, 97, E2),
+        BYTES_TO_WORDS_8(DB, 8D, E5, A5, C8, 94, F2, 60), BYTES_TO_WORDS_8(41, 41, ED, 85, BB, CE, 23, 12),
+        BYTES_TO_WORDS_8(49, 91, CD, B8, AB, DB, 80, B4), BYTES_TO_WORDS_8(B4, 70, CB, F8, 20, 25, 37, E1) },
+      { BYTES_TO_WORDS_8(6C, 6A, 5E, 5B, C5, AC, 4D, 3F), BYTES_TO_WORDS_8(80, DE, D8, A1, DE, 9F, 67, 86),
+        BYTES_TO_WORDS_8(E5, 07, 3F, D3, B6, BD, 71, 31), BYTES_TO_WORDS_8(5E, 3B, 5A, A3, 3D, BB, 37, A7),
+        BYTES_TO_WORDS_8(5D, 74, 54, 90, D6, C7, 30, B7), BYTES_TO_WORDS_8(0A, ED, 92, 76, 48, 7D, 4E, 0D),
+        BYTES_TO_WORDS_8(15, 5F, 90, 8E, 5D, 76, 1E, 2B), BYTES_TO_WORDS_8(D2, FF, 98, 1F, E0, 53, 8F, C6) },
+      { BYTES_TO_WORDS_8(33, 8C, D8, 8A, 7B, 3B, 94, FD), BYTES_TO_WORDS_8(CA, 6B, 74, D9, 94, E3, 1A, D9),
+        BYTES_TO_WORDS_8(97, DA, 24, 0D, 92, BC, 06, 6B), BYTES_TO_WORDS_8(B6, 94, 2B, FB, 38, 23, D2, 1C),
+        BYTES_TO_WORDS_8(B2, B1, 8F, 24, 84, A7, 8E, 62), BYTES_TO_WORDS_8(49, 1E, CA, 5E, 31, 51, FE, 13),
+        BYTES_TO_WORDS_8(27, BC, 36, B1, 0A, 64, C8, 96), BYTES_TO_WORDS_8(B0, 48, AB, 38, F8, CD, 3A, FC) },
+      { BYTES_TO_WORDS_8(98, C0, 30, E3, 79, 4E, 0D, AF), BYTES_TO_WORDS_8(CC, 17, C6, 5D, 03, BF, E6, 28),
+        BYTES_TO_WORDS_8(6E, A7, 1B, 0B, FF, 80, 71, D5), BYTES_TO_WORDS_8(40, 22, 2E, 17, F0, 6B, AD, DD),
+        BYTES_TO_WORDS_8(58, 7B, B6, 63, 4D, 99, 5A, 3E), BYTES_TO_WORDS_8(40, D1, B9, 2D, AD, 3B, 33, FA),
+        BYTES_TO_WORDS_8(DA, AD, 25, 61, 73, A4, 30, 75), BYTES_TO_WORDS_8(89, 21, 5A, 93, E6, 71, 13, 0B) } },
+    /* (1..8) * 16^6 * G */
+    { { BYTES_TO_WORDS_8(05, D8, 92, E3, DC, C5, 25, 37), BYTES_TO_WORDS_8(D4, 05, 54, 87, 69, 80, 7A, A8),
+        BYTES_TO_WORDS_8(9A, 44, A3, FA, AA, 4D, A5, A4), BYTES_TO_WORDS_8(D7, 93, 6A, 4C, CF, DC, F5, F8),
+        BYTES_TO_WORDS_8(FA, 02, DA, 6C, 51, 19, 66, 02), BYTES_TO_WORDS_8(BA, 43, 21, A5, 64, DA, F3, 51),
+        BYTES_TO_WORDS_8(73, 32, 61, 64, 33, 3E, 9D, 38), BYTES_TO_WORDS_8(54, 30, D6, 66, CF, 76, 81, E5) },
+      { BYTES_TO_WORDS_8(A6, D8, 51, AC, B2, F0, A7, AC), BYTES_TO_WORDS_8(90, 2A, 18, 78, 84, D8, 42, FD),
+        BYTES_TO_WORDS_8(1F, 58, AF, 48, E2, 7F, 31, 9B), BYTES_TO_WORDS_8(9C, 5D, C4, 4B, F2, B0, 18, A1),
+        BYTES_TO_WORDS_8(30, B0, 87, 5C, 5D, B5, 21, 86), BYTES_TO_WORDS_8(7D, 96, 76, E3, 08, 24, 92, 81),
+        BYTES_TO_WORDS_8(6A, 4D, 46, 09, AE, 25, 7B, DF), BYTES_TO_WORDS_8(98, 17, 7E, 0F, FD, 53, 8B, 69) },
+      { BYTES_TO_WORDS_8(F7, 46, A0, 7F, 16, B3, D4, 19), BYTES_TO_WORDS_8(9D, 30, 07, 02, 39, 0F, 11, 17),
+        BYTES_TO_WORDS_8(45, 2D, 6E, 94, C8, 4A, 08, 4E), BYTES_TO_WORDS_8(A9, 83, 58, 86, 4A, 8E, 2C, E1),
+        BYTES_TO_WORDS_8(AD, 46, 26, A1, 28, 5A, A5, 53), BYTES_TO_WORDS_8(34, 19, 31, 13, E1, 04, 0C, DD),
+        BYTES_TO_WORDS_8(F6, 26, 31, 39, D5, 3E, 3B, 43), BYTES_TO_WORDS_8(F3, A2, D9, 0F, 61, 04, EC, 7C) },
+      { BYTES_TO_WORDS_8(0E, 25, F5, 9C, 72, E8, 42, FA), BYTES_TO_WORDS_8(75, 86, 82, 88, E7, 4B, D2, 7B),
+        BYTES_TO_WORDS_8(EA, 15, D7, 66, 95, C2, 9E, DE), BYTES_TO_WORDS_8(2E, 2D, 50, 4E, 2E, CA, C8, FC),
+        BYTES_TO_WORDS_8(A2, D4, 0F, 73, BF, 0F, 2E, 60), BYTES_TO_WORDS_8(20, 21, 3B, C0, 05, BC, 46, 90),
+        BYTES_TO_WORDS_8(5C, DA, 34, 8B, 0A, 88, B9, F6), BYTES_TO_WORDS_8(04, BD, F8, EE, CC, 7B, B5, 30) },
+      { BYTES_TO_WORDS_8(43, 3C, 85, C2, E8, 27, B1, B9), BYTES_TO_WORDS_8(66, E4, 22, AE, 57, 6C, 16, 48),
+        BYTES_TO_WORDS_8(36, 32, D1, E3, EF, E2, 08, 3D), BYTES_TO_WORDS_8(09, 92, 96, 17, 74, D4, 4B, 39),
+        BYTES_TO_WORDS_8(9D, 46, 64, A0, CC, 28, 78, B1), BYTES_TO_WORDS_8(0C, CF, 0F, D9, 12, 67, 2F, D5),
+        BYTES_TO_WORDS_8(67, 07, D6, F1, C2, 3F, 7E, 20), BYTES_TO_WORDS_8(B9, C6, 1D, 15, 52, 6D, 4D, 2B) },
+      { BYTES_TO_WORDS_8(BF, 5C, CB, 74, BA, 08, DA, 18), BYTES_TO_WORDS_8(20, F1, 30, BC, 3A, 7E, 17, 1F),
+        BYTES_TO_WORDS_8(4E, D6, 7E, BC, AD, 8C, A7, 26), BYTES_TO_WORDS_8(95, 90, B1, 28, E3, 1A, 34, 81),
+        BYTES_TO_WORDS_8(6F, 6D, 85, 3E, 67, 26, 17, 46), BYTES_TO_WORDS_8(58, 33, BC, 73, C7, BD, BA, 80),
+        BYTES_TO_WORDS_8(49, 03, CF, 06, FE, 5C, D2, 0D), BYTES_TO_WORDS_8(F4, B5, DE, B2, 28, 77, A4, F2) },
+      { BYTES_TO_WORDS_8(94, 2E, 72, FC, 39, D7, 2D, EC), BYTES_TO_WORDS_8(61, 89, 05, 6D, 39, 10, D8, 4E),
+        BYTES_TO_WORDS_8(33, 04, 94, C5, 56, 66, 5C, 44), BYTES_TO_WORDS_8(E9, 82, DE, 38, DF, 38, 85, CA),
+        BYTES_TO_WORDS_8(27, A5, 49, 10, DF, 62, 0A, 3A), BYTES_TO_WORDS_8(A4, 26, 8B, A4, A8, 53, 09, F2),
+        BYTES_TO_WORDS_8(12, 9F, FB, A1, 26, 31, E7, 11), BYTES_TO_WORDS_8(C3, 05, 9E, EB, 42, FC, 27, 3B) },
+      { BYTES_TO_WORDS_8(03, 5E, A9, 89, 04, AA, 18, 23), BYTES_TO_WORDS_8(3D, 3C, AF, D2, 75, F6, 49, F3),
+        BYTES_TO_WORDS_8(3A, 4E, 2E, CF, 43, 4B, 9A, EE), BYTES_TO_WORDS_8(C0, DD, 35, FA, 5B, E0, BB, 24),
+        BYTES_TO_WORDS_8(4D, 3C, 79, 8D, ED, 45, DF, 87), BYTES_TO_WORDS_8(49, A1, 5A, 37, 2E, A5, 0A, D4),
+        BYTES_TO_WORDS_8(AA, 0F, 76, D2, 4D, 2D, 18, 17), BYTES_TO_WORDS_8(CF, 22, 0A, 09, EE, 05, 94, D4) } },
+    /* (1..8) * 16^7 * G */
+    { { BYTES_TO_WORDS_8(BD, 2D, 92, 6F, 17, 23, 4A, 98), BYTES_TO_WORDS_8(8F, 21, 99, 1F, 16, 31, A6, 1C),
+        BYTES_TO_WORDS_8(B9, 71, 4D, 8E, AD, EA, 85, 3F), BYTES_TO_WORDS_8(31, AF, 4D, FD, BF, B6, 28, 6D),
+        BYTES_TO_WORDS_8(FF, 3C, EF, A0, 02, FF, AB, 44), BYTES_TO_WORDS_8(99, A2, 4D, B8, F0, E9, 24, 4C),
+        BYTES_TO_WORDS_8(1C, 4A, CB, 1C, A6, E1, FB, 40), BYTES_TO_WORDS_8(FA, D2, 1D, 14, 05, D9, 39, AF) },
+      { BYTES_TO_WORDS_8(0A, 24, FB, C4, 4F, 40, 89, 97), BYTES_TO_WORDS_8(50, 52, B7, AF, 5C, 58, EA, 50),
+        BYTES_TO_WORDS_8(2F, 2F, 30, 2D, 7F, 94, 13, E6), BYTES_TO_WORDS_8(15, D8, 93, DD, 61, E6, 31, D1),
+        BYTES_TO_WORDS_8(57, 1A, 50, 02, 14, 0E, F6, 22), BYTES_TO_WORDS_8(F4, CD, EA, CD, EB, D4, 23, 74),
+        BYTES_TO_WORDS_8(D4, 4F, 8F, F4, 37, 4C, 9B, E7), BYTES_TO_WORDS_8(A2, 5D, A9, 61, 84, 2C, 34, 34) },
+      { BYTES_TO_WORDS_8(64, 8B, 16, 9B, F9, DF, 90, B5), BYTES_TO_WORDS_8(40, C8, 86, C5, 2A, D0, 53, A1),
+        BYTES_TO_WORDS_8(7E, 46, 14, FC, 05, 09, DF, D3), BYTES_TO_WORDS_8(DD, E3, BF, 7F, 7A, 15, D3, 7C),
+        BYTES_TO_WORDS_8(6B, B1, BB, 5A, 2B, 0D, 6C, 85), BYTES_TO_WORDS_8(35, 2E, E0, 72, 9B, 4D, AC, 13),
+        BYTES_TO_WORDS_8(FB, FA, DB, BC, 78, 8E, 56, 20), BYTES_TO_WORDS_8(62, 2C, 29, 17, 21, 8D, A0, 9C) },
+      { BYTES_TO_WORDS_8(DE, 7D, 08, B8, D7, FD, E5, 67), BYTES_TO_WORDS_8(E8, E2, 7F, 47, 84, 45, 43, D0),
+        BYTES_TO_WORDS_8(A2, 46, E2, 0B, 81, 02, 2E, 71), BYTES_TO_WORDS_8(15, 76, 80, 2C, F9, 5A, FF, AF),
+        BYTES_TO_WORDS_8(A2, B3, 4E, D4, AC, 46, 83, 17), BYTES_TO_WORDS_8(E7, AB, DD, 92, 52, 17, CF, AA),
+        BYTES_TO_WORDS_8(22, 2A, 0A, E1, 7E, 74, 9A, 09), BYTES_TO_WORDS_8(C2, 60, D0, 2C, A2, 6E, 9F, 65) },
+      { BYTES_TO_WORDS_8(E8, 29, EF, 06, FA, C6, B1, B2), BYTES_TO_WORDS_8(E3, AE, D9, 09, 4B, 55, DC, 64),
+        BYTES_TO_WORDS_8(62, 35, 45, 9D, 19, 43, B2, 56), BYTES_TO_WORDS_8(C4, F8, 2D, 5F, DB, 0B, 86, ED),
+        BYTES_TO_WORDS_8(8F, 0F, B9, B9, 49, 1C, 1A, 50), BYTES_TO_WORDS_8(33, AA, 8D, 2D, 5C, 0F, 63, E7),
+        BYTES_TO_WORDS_8(B1, 7B, 41, 40, B3, F6, 6B, 7C), BYTES_TO_WORDS_8(FD, A7, D5, 75, 43, E7, 37, B8) },
+      { BYTES_TO_WORDS_8(E9, 52, BF, 6D, 23, F9, 8E, 3D), BYTES_TO_WORDS_8(8F, F8, F6, 56, D0, 74, 19, C0),
+        BYTES_TO_WORDS_8(77, 91, 07, 8B, 9B, 73, 65, 6A), BYTES_TO_WORDS_8(3A, 4F, 59, 08, 3B, FB, 65, 3E),
+        BYTES_TO_WORDS_8(48, D3, 10, C7, 1E, 54, 52, 3A), BYTES_TO_WORDS_8(43, BB, AE, 26, D1, 56, 0D, 60),
+        BYTES_TO_WORDS_8(87, 59, F9, 0C, 89, A6, BE, 10), BYTES_TO_WORDS_8(C0, 07, F8, 0E, 60, B6, 9B, E7) },
+      { BYTES_TO_WORDS_8(17, E6, 36, F6, B3, 18, F9, 9D), BYTES_TO_WORDS_8(59, CF, F1, C1, 3B, D0, DC, 47),
+        BYTES_TO_WORDS_8(9D, 2C, 27, 7E, 2E, 1C, 5E, 73), BYTES_TO_WORDS_8(43, 12, D2, D1, 8F, CC, 68, 68),
+        BYTES_TO_WORDS_8(27, 3D, BB, FC, F3, DC, 8D, 1C), BYTES_TO_WORDS_8(D7, 4C, 38, A4, C8, 30, FE, 60),
+        BYTES_TO_WORDS_8(0A, 3F, 31, 79, 38, 90, C5, B3), BYTES_TO_WORDS_8(E6, F9, 1B, B9, A5, 08, D0, EE) },
+      { BYTES_TO_WORDS_8(53, 1F, 37, 00, A1, 69, FB, 99), BYTES_TO_WORDS_8(69, 66, BC, 68, B3, FD, 9D, E8),
+        BYTES_TO_WORDS_8(82, 3A, 85, 73, 0A, 00, B8, 05), BYTES_TO_WORDS_8(7C, E6, F3, B8, CA, A7, 37, 84),
+        BYTES_TO_WORDS_8(AB, BB, 9C, 87, D7, 72, 88, 24), BYTES_TO_WORDS_8(59, E2, FB, DB, FE, 24, E1, 10),
+        BYTES_TO_WORDS_8(8E, BB, 19, 38, F4, 83, 54, 73), BYTES_TO_WORDS_8(40, 2A, 81, 82, 58, D7, 8F, 96) } },
+    /* (1..8) * 16^8 * G */
+    { { BYTES_TO_WORDS_8(43, 59, 5A, 18, 22, 9E, 5A, 3A), BYTES_TO_WORDS_8(B6, DF, 65, 5C, 36, 19, B9, 1A),
+        BYTES_TO_WORDS_8(DA, 71, 2C, 26, 32, 6B, 65, 21), BYTES_TO_WORDS_8(89, AF, 22, AF, 40, 6B, E3, 7F),
+        BYTES_TO_WORDS_8(01, A1, 9C, 69, 2C, 15, 0D, D5), BYTES_TO_WORDS_8(12, F2, 8A, 7B, 86, D5, B3, 74),
+        BYTES_TO_WORDS_8(F1, A6, DC, 07, 04, F4, 09, 9F), BYTES_TO_WORDS_8(24, 36, B6, 25, 58, D4, 97, E6) },
+      { BYTES_TO_WORDS_8(C2, 78, 82, C6, E7, D1, 6D, 33), BYTES_TO_WORDS_8(C0, 47, 0E, A6, B8, 10, DD, A1),
+        BYTES_TO_WORDS_8(5A, FA, AD, 43, A3, CA, 54, 65), BYTES_TO_WORDS_8(43, 43, 86, 47, 71, 94, 77, 61),
+        BYTES_TO_WORDS_8(CF, D2, AB, EF, B2, EC, 03, 9D), BYTES_TO_WORDS_8(A6, A1, 17, 23, 99, 69, 79, 32),
+        BYTES_TO_WORDS_8(73, 64, 98, C8, 05, F0, BF, 03), BYTES_TO_WORDS_8(1F, 79, 68, A5, D5, E7, CE, 4E) },
+      { BYTES_TO_WORDS_8(A8, 22, 09, DF, 91, 80, A7, 76), BYTES_TO_WORDS_8(D9, F8, 5C, 54, D2, E9, 90, 8E),
+        BYTES_TO_WORDS_8(80, 8B, 2F, 02, 56, 4E, 92, 80), BYTES_TO_WORDS_8(73, 2D, 4E, 5B, 40, 6A, 65, 4B),
+        BYTES_TO_WORDS_8(BB, 80, 9A, 99, C5, CA, AD, 4D), BYTES_TO_WORDS_8(69, 0F, 85, B9, E2, B9, 73, D4),
+        BYTES_TO_WORDS_8(D6, C4, D8, 55, C2, 4C, D0, 20), BYTES_TO_WORDS_8(39, 78, E7, 12, 1D, A3, 1E, EE) },
+      { BYTES_TO_WORDS_8(44, 93, 7D, 5A, 96, 93, AB, AE), BYTES_TO_WORDS_8(6B, B5, 01, 01, BA, 1A, 22, F7),
+        BYTES_TO_WORDS_8(19, 60, F9, AB, 58, 87, 3D, 19), BYTES_TO_WORDS_8(1A, 9D, 72, 89, CD, F0, 1C, 52),
+        BYTES_TO_WORDS_8(4A, 06, B7, 96, 81, F2, 29, 45), BYTES_TO_WORDS_8(A1, FB, 95, 5A, CA, 41, 13, 7A),
+        BYTES_TO_WORDS_8(1B, 37, 86, D3, 0E, FE, 83, C5), BYTES_TO_WORDS_8(BA, E9, F9, CB, DA, 20, 02, D6) },
+      { BYTES_TO_WORDS_8(9E, 7E, D0, 69, 88, F8, 04, B5), BYTES_TO_WORDS_8(36, 0C, A6, F6, A1, 7C, 9E, A0),
+        BYTES_TO_WORDS_8(5E, 8E, 3D, FB, E0, 2B, DB, 93), BYTES_TO_WORDS_8(3D, E1, 65, BD, 6E, 95, 78, 9D),
+        BYTES_TO_WORDS_8(EE, C8, D8, C3, 5A, 61, DD, F4), BYTES_TO_WORDS_8(B2, C7, 94, 3B, DA, A2, 60, 74),
+        BYTES_TO_WORDS_8(CE, 10, 32, 1D, 9C, A8, 42, 65), BYTES_TO_WORDS_8(CD, A8, 8E, F4, 6E, 9E, 14, D5) },
+      { BYTES_TO_WORDS_8(18, 14, 28, 3B, F3, 0C, 43, BB), BYTES_TO_WORDS_8(35, 0E, 00, B0, 9B, 01, E5, 7C),
+        BYTES_TO_WORDS_8(06, E7, 39, 36, 61, C2, 56, 4D), BYTES_TO_WORDS_8(DD, A8, 63, 88, AD, B3, 86, 7C),
+        BYTES_TO_WORDS_8(EC, E0, 17, 31, ED, 3E, DD, 79), BYTES_TO_WORDS_8(1B, 86, C0, 7B, 31, 7C, EA, 82),
+        BYTES_TO_WORDS_8(2F, A7, DA, 68, 77, B9, 62, 4C), BYTES_TO_WORDS_8(95, FE, BE, EE, CC, BA, 58, D9) },
+      { BYTES_TO_WORDS_8(0F, 95, C4, 7D, 86, 50, 77, 66), BYTES_TO_WORDS_8(07, 42, 39, BD, AD, B2, 41, 57),
+        BYTES_TO_WORDS_8(16, 63, DB, E4, 46, 68, 23, 57), BYTES_TO_WORDS_8(A9, 3F, 35, E1, 72, 12, CB, 4A),
+        BYTES_TO_WORDS_8(DF, B4, D8, 63, 44, E4, C6, 66), BYTES_TO_WORDS_8(C5, 6A, 86, B5, 80, 42, 9E, DF),
+        BYTES_TO_WORDS_8(9F, E2, 71, CC, F6, 98, F2, 8C), BYTES_TO_WORDS_8(AD, CD, 43, B7, 0F, D2, 6C, 72) },
+      { BYTES_TO_WORDS_8(8C, CE, 3F, 2B, A3, 84, 31, 0B), BYTES_TO_WORDS_8(A7, D1, 43, 15, EC, BD, 4B, BD),
+        BYTES_TO_WORDS_8(0B, 70, 42, CE, EF, C9, 2F, 56), BYTES_TO_WORDS_8(7B, D0, 8E, 32, C1, 11, 6C, 17),
+        BYTES_TO_WORDS_8(9F, F1, C9, A3, 36, 84, A6, 6E), BYTES_TO_WORDS_8(B1, 1A, B5, 5B, 2A, 84, 5D, 5C),
+        BYTES_TO_WORDS_8(7E, 3B, DE, B7, 80, 21, 59, 89), BYTES_TO_WORDS_8(35, 8A, 4B, 93, AE, 8D, 7F, D1) } },
+    /* (1..8) * 16^9 * G */
+    { { BYTES_TO_WORDS_8(45, 34, DE, FD, E1, 4F, FF, 7A), BYTES_TO_WORDS_8(81, A7, AE, A2, DD, A9, BB, 76),
+        BYTES_TO_WORDS_8(9E, 51, 26, FF, E7, 1F, 37, 85), BYTES_TO_WORDS_8(E6, 61, 70, 4D, 38, B6, 65, 69),
+        BYTES_TO_WORDS_8(13, 51, 85, 18, 9E, 38, C4, 7C), BYTES_TO_WORDS_8(D9, 99, 5F, 1A, 05, E6, 7C, F4),
+        BYTES_TO_WORDS_8(BE, 2D, 73, 38, 66, 49, 5E, 32), BYTES_TO_WORDS_8(11, 25, 48, 9C, E3, DA, BC, D1) },
+      { BYTES_TO_WORDS_8(EE, 30, EE, ED, C6, C0, 75, 03), BYTES_TO_WORDS_8(F1, 89, 91, 67, 36, 63, 52, 48),
+        BYTES_TO_WORDS_8(71, 09, 84, B1, FC, 34, A8, 9B), BYTES_TO_WORDS_8(F3, C9, 4A, 97, 2F, E1, A1, 9B),
+        BYTES_TO_WORDS_8(5E, 3C, B4, 67, 3B, B8, 96, 8A), BYTES_TO_WORDS_8(38, 4F, 7D, 8C, BB, 7E, 06, 62),
+        BYTES_TO_WORDS_8(BE, 77, A8, 86, EA, 3E, 7C, 27), BYTES_TO_WORDS_8(6C, EA, 1B, 31, 32, F1, D2, 03) },
+      { BYTES_TO_WORDS_8(C5, CF, 8A, 88, 96, 0F, E4, F5), BYTES_TO_WORDS_8(89, 97, 68, 36, 9B, 58, EF, B1),
+        BYTES_TO_WORDS_8(71, 1A, 09, D4, DB, 7D, 7E, 02), BYTES_TO_WORDS_8(DA, C7, 75, DE, 1D, C5, CB, E1),
+        BYTES_TO_WORDS_8(25, A2, 49, A2, D5, FE, C5, 3B), BYTES_TO_WORDS_8(52, BA, BF, EE, 2B, 29, D3, E7),
+        BYTES_TO_WORDS_8(3C, E2, B9, FD, 4F, 76, 12, B3), BYTES_TO_WORDS_8(ED, DA, E7, CD, 97, 83, 67, EC) },
+      { BYTES_TO_WORDS_8(25, 71, C5, 51, 7F, C6, FB, 8A), BYTES_TO_WORDS_8(10, 5B, 7C, D1, F6, 58, 16, 5A),
+        BYTES_TO_WORDS_8(63, E8, 67, 95, 4D, 54, 5B, 48), BYTES_TO_WORDS_8(55, 00, 02, E9, FB, A1, 0E, C9),
+        BYTES_TO_WORDS_8(94, 8D, FB, DE, 04, A5, 69, C6), BYTES_TO_WORDS_8(69, 9A, E1, 6D, 7D, D0, A3, B6),
+        BYTES_TO_WORDS_8(B1, 60, E6, 36, F6, 7A, 66, 19), BYTES_TO_WORDS_8(6B, DE, 0E, 71, 6C, A6, AC, 05) },
+      { BYTES_TO_WORDS_8(C6, CC, 07, E1, 3F, A5, 8E, 75), BYTES_TO_WORDS_8(28, 82, 3C, 54, E1, 97, 38, 1D),
+        BYTES_TO_WORDS_8(48, 00, A9, 45, 28, 9D, 1E, 73), BYTES_TO_WORDS_8(A1, 8A, 13, 71, 79, 26, 3F, 9C),
+        BYTES_TO_WORDS_8(52, 91, EA, 3D, CD, 94, 07, 84), BYTES_TO_WORDS_8(86, B1, F9, 95, 4E, FD, A8, 51),
+        BYTES_TO_WORDS_8(CA, 6E, 3E, BF, F4, 75, E3, 8B), BYTES_TO_WORDS_8(9C, 1D, B5, 64, 1B, 0C, EE, DA) },
+      { BYTES_TO_WORDS_8(5D, 55, FC, 77, F9, 7D, 06, 61), BYTES_TO_WORDS_8(33, D4, 18, ED, 26, 64, DF, D1),
+        BYTES_TO_WORDS_8(24, 18, DC, 37, 64, 10, 47, AA), BYTES_TO_WORDS_8(39, CB, 01, 6D, 09, 1D, A5, 67),
+        BYTES_TO_WORDS_8(D7, C1, 12, 6C, 94, C5, 9A, 5D), BYTES_TO_WORDS_8(3E, 2B, 13, 43, 54, 75, 63, 43),
+        BYTES_TO_WORDS_8(F2, 94, A7, 3F, 7A, 48, 75, E1), BYTES_TO_WORDS_8(E0, 7B, BF, 14, EA, 5A, 09, C1) },
+      { BYTES_TO_WORDS_8(E7, 49, A4, 95, 43, EB, C5, 21), BYTES_TO_WORDS_8(E4, 2B, 3C, E5, 34, A0, A2, 2F),
+        BYTES_TO_WORDS_8(2B, 92, 40, B1, 17, AC, 6F, 79), BYTES_TO_WORDS_8(72, 2D, 6B, 7C, 57, D9, 30, 5C),
+        BYTES_TO_WORDS_8(D0, 77, 26, AE, 81, A4, 0E, 77), BYTES_TO_WORDS_8(0E, 79, CE, C3, 53, 40, 5E, B7),
+        BYTES_TO_WORDS_8(D0, 92, C5, 99, F7, 65, 4B, 16), BYTES_TO_WORDS_8(92, 1B, 8E, B0, B5, E3, 25, 80) },
+      { BYTES_TO_WORDS_8(FE, D7, 3C, AB, 2D, 1F, BF, C1), BYTES_TO_WORDS_8(8F, DF, 22, F8, 89, 50, F2, 9C),
+        BYTES_TO_WORDS_8(5B, 10, 8C, A4, B4, 1B, 3A, 3D), BYTES_TO_WORDS_8(30, 62, 89, 7C, F7, B8, 88, 0A),
+        BYTES_TO_WORDS_8(D1, 1F, 66, F1, 34, D2, 3B, 6A), BYTES_TO_WORDS_8(4C, 15, D7, 94, 09, 1C, 49, 0C),
+        BYTES_TO_WORDS_8(90, A9, CA, 46, D2, 29, 4D, 1D), BYTES_TO_WORDS_8(C2, 5A, 52, 05, 69, 3B, B6, 15) } },
+    /* (1..8) * 16^10 * G */
+    { { BYTES_TO_WORDS_8(BD, EF, 9A, 4D, 6C, CA, 8F, 25), BYTES_TO_WORDS_8(75, 57, B9, 73, B2, 47, FE, 1E),
+        BYTES_TO_WORDS_8(DC, 43, BC, 41, 0D, 9F, CA, 32), BYTES_TO_WORDS_8(76, 9D, 66, 8C, 1C, 34, BC, 0F),
+        BYTES_TO_WORDS_8(A0, 1C, E7, D3, A9, 6E, 3B, ED), BYTES_TO_WORDS_8(F1, 9F, 0A, 20, 9E, 06, 0B, 95),
+        BYTES_TO_WORDS_8(D3, D3, 57, 49, 1D, 4B, 01, E4), BYTES_TO_WORDS_8(3F, 0E, 36, 2F, 63, 22, 80, BD) },
+      { BYTES_TO_WORDS_8(54, 4B, E4, 73, 8A, DB, A6, F3), BYTES_TO_WORDS_8(F7, 27, 1E, 7C, FA, EE, DB, 54),
+        BYTES_TO_WORDS_8(6C, 54, 20, 26, 35, 6C, CB, 2D), BYTES_TO_WORDS_8(6A, 77, 8F, 9D, 31, 19, 90, 82),
+        BYTES_TO_WORDS_8(AC, E6, 5F, FE, E4, F5, 03, 68), BYTES_TO_WORDS_8(84, 54, 13, 01, A1, A0, 47, 9F),
+        BYTES_TO_WORDS_8(A0, D9, 1D, AC, 6E, 8D, 88, 65), BYTES_TO_WORDS_8(1D, FA, A8, 3E, 71, 6E, A2, E6) },
+      { BYTES_TO_WORDS_8(37, 48, 43, E9, FE, DF, 96, 87), BYTES_TO_WORDS_8(BB, C1, 20, 86, 0B, 14, B3, AD),
+        BYTES_TO_WORDS_8(6D, B0, 4F, FB, 6F, 1C, 34, B1), BYTES_TO_WORDS_8(ED, 7A, A8, C4, AB, 18, 6D, D7),
+        BYTES_TO_WORDS_8(4C, 5B, 21, BB, F9, 04, AA, 4F), BYTES_TO_WORDS_8(C2, CC, B7, 75, E7, 58, A4, 90),
+        BYTES_TO_WORDS_8(32, 93, AB, F7, 14, 42, 0E, DE), BYTES_TO_WORDS_8(44, 66, D9, 2E, A3, 4D, BC, F6) },
+      { BYTES_TO_WORDS_8(20, 4A, 39, EA, CE, 43, E7, A5), BYTES_TO_WORDS_8(81, A2, 98, E1, 18, A5, 1C, B4),
+        BYTES_TO_WORDS_8(92, AC, 17, B5, 7D, D5, 4C, 44), BYTES_TO_WORDS_8(2A, CF, 99, 22, A1, BF, 8D, C4),
+        BYTES_TO_WORDS_8(5B, A7, 77, EA, DB, 80, 05, 4A), BYTES_TO_WORDS_8(E2, B5, 1B, 99, 25, B1, 40, 94),
+        BYTES_TO_WORDS_8(CD, D6, DB, 1B, 41, 2E, FF, 64), BYTES_TO_WORDS_8(BA, 80, 13, 0E, A0, CB, 83, BC) },
+      { BYTES_TO_WORDS_8(22, F2, 07, 9C, 21, 9F, E8, 02), BYTES_TO_WORDS_8(7D, FE, 60, AC, 63, 1C, E2, C5),
+        BYTES_TO_WORDS_8(D1, 53, 17, 1F, 1A, 1D, 48, 4F), BYTES_TO_WORDS_8(60, FF, 67, 61, 50, C6, C0, D5),
+        BYTES_TO_WORDS_8(57, FD, 6F, 0C, 1E, 69, EF, E2), BYTES_TO_WORDS_8(86, 3A, 81, 78, 1A, F5, F3, BA),
+        BYTES_TO_WORDS_8(B9, 75, 9F, F4, 77, 0C, DE, 0C), BYTES_TO_WORDS_8(85, B8, 17, 08, 86, 0B, A3, 15) },
+      { BYTES_TO_WORDS_8(D4, 78, A1, 96, E5, CB, B8, 5B), BYTES_TO_WORDS_8(EF, A8, 08, F4, 4F, BC, 33, 22),
+        BYTES_TO_WORDS_8(9C, 96, CE, 8B, 5B, 01, 39, 44), BYTES_TO_WORDS_8(91, 27, B5, FC, 16, B8, 71, 1B),
+        BYTES_TO_WORDS_8(51, 7F, 50, B5, BB, 7E, 2D, 4A), BYTES_TO_WORDS_8(71, 11, CC, F6, C1, B6, E5, E0),
+        BYTES_TO_WORDS_8(C0, 8F, 73, 8D, C2, F1, 6E, DE), BYTES_TO_WORDS_8(2C, 8E, 8A, A4, 1D, 9D, 65, 7E) },
+      { BYTES_TO_WORDS_8(A6, BF, 93, 4E, A2, 16, 47, 4A), BYTES_TO_WORDS_8(2A, 36, A1, 09, 5A, 29, 9D, D3),
+        BYTES_TO_WORDS_8(E0, 9F, 4C, 6B, A6, CB, 49, E5), BYTES_TO_WORDS_8(2C, F6, 46, 4A, 4E, 36, 4C, 73),
+        BYTES_TO_WORDS_8(74, 07, D1, 98, 99, A7, 6F, FC), BYTES_TO_WORDS_8(C4, 97, 02, 89, 20, 36, A1, EC),
+        BYTES_TO_WORDS_8(48, 5F, 0C, 52, E3, 81, E9, 9D), BYTES_TO_WORDS_8(04, 9D, A7, AA, 03, 15, 95, 09) },
+      { BYTES_TO_WORDS_8(CD, E7, 49, B0, 88, 3F, 01, CD), BYTES_TO_WORDS_8(00, DC, 7F, E5, 7A, 25, F9, E8),
+        BYTES_TO_WORDS_8(01, 93, 3A, FC, 69, 19, E7, 3B), BYTES_TO_WORDS_8(37, F9, CF, 58, 6D, 25, 7F, 98),
+        BYTES_TO_WORDS_8(D6, 35, FA, 6E, BC, 4B, 25, B7), BYTES_TO_WORDS_8(DB, FF, AA, 07, 52, 60, B4, 47),
+        BYTES_TO_WORDS_8(9E, E3, 07, 00, D6, EB, 60, E8), BYTES_TO_WORDS_8(5C, 50, EC, 94, 56, 69, 92, 8E) } },
+    /* (1..8) * 16^11 * G */
+    { { BYTES_TO_WORDS_8(B2, 67, FE, A3, 7A, 19, E3, C6), BYTES_TO_WORDS_8(38, 33, 2E, 0A, E7, BF, A8, 34),
+        BYTES_TO_WORDS_8(B2, 23, 73, A9, 9B, 6B, 66, BC), BYTES_TO_WORDS_8(DC, 85, 3C, 77, 43, C2, 08, 66),
+        BYTES_TO_WORDS_8(28, 7A, B4, E5, 5C, FE, 23, 19), BYTES_TO_WORDS_8(08, 43, C5, 40, 9F, 15, 2B, C2),
+        BYTES_TO_WORDS_8(3F, E0, 46, A7, 0D, 64, 6F, 84), BYTES_TO_WORDS_8(68, C1, 21, C5, BE, 16, A9, A1) },
+      { BYTES_TO_WORDS_8(7F, BC, 78, 03, 9B, 20, C1, 5F), BYTES_TO_WORDS_8(86, 62, E0, 8B, 01, 6E, BC, 58),
+        BYTES_TO_WORDS_8(53, 6E, 97, 6E, 85, BC, 79, 99), BYTES_TO_WORDS_8(A9, 0A, 00, 18, 69, FD, C1, 70),
+        BYTES_TO_WORDS_8(56, B8, AE, A6, 1C, 17, 68, 6D), BYTES_TO_WORDS_8(0D, CB, E1, 61, 2F, F3, A9, F5),
+        BYTES_TO_WORDS_8(43, 85, 42, 22, F1, F6, ED, AA), BYTES_TO_WORDS_8(22, C5, 5B, 0D, C2, AB, DA, F7) },
+      { BYTES_TO_WORDS_8(02, 3E, C7, 2B, AD, EA, E6, 13), BYTES_TO_WORDS_8(2C, 31, 65, EB, 4E, 61, 96, 84),
+        BYTES_TO_WORDS_8(31, 86, 57, 7D, 11, 98, 6A, 20), BYTES_TO_WORDS_8(23, DC, C5, A6, E2, 6A, 95, F0),
+        BYTES_TO_WORDS_8(9D, 21, 11, 86, 99, F6, 2C, 2D), BYTES_TO_WORDS_8(57, 94, AE, BB, 8D, 04, 2D, 67),
+        BYTES_TO_WORDS_8(56, 93, 83, F2, 8A, 05, E2, 76), BYTES_TO_WORDS_8(3C, E0, 44, 11, 60, E6, 3F, 43) },
+      { BYTES_TO_WORDS_8(C2, 03, 7E, E7, F4, B9, 63, BC), BYTES_TO_WORDS_8(2C, 19, B0, BF, 00, C9, 32, FE),
+        BYTES_TO_WORDS_8(AA, 50, EC, AC, DE, 3F, 73, C0), BYTES_TO_WORDS_8(B2, 76, 0D, 25, 52, 8E, AC, 30),
+        BYTES_TO_WORDS_8(83, 3F, DC, D1, FE, 14, 19, A1), BYTES_TO_WORDS_8(DC, 86, 87, CD, 32, BA, 04, 67),
+        BYTES_TO_WORDS_8(A0, 77, 2E, 00, 84, 65, AA, 69), BYTES_TO_WORDS_8(5E, 78, 99, C0, 30, B5, 94, D6) },
+      { BYTES_TO_WORDS_8(5C, E4, 5F, 1C, E5, 2D, E2, 7D), BYTES_TO_WORDS_8(59, 0F, 7C, 38, A8, 81, B2, 88),
+        BYTES_TO_WORDS_8(34, 28, F7, 7C, 9D, 24, 2F, A5), BYTES_TO_WORDS_8(0C, A6, A2, 3C, EA, EB, 98, DB),
+        BYTES_TO_WORDS_8(22, 5A, F4, 3E, C4, 01, A7, 44), BYTES_TO_WORDS_8(1C, 0E, 48, AA, 4F, 20, 83, E9),
+        BYTES_TO_WORDS_8(8C, 2C, 91, D8, 9D, 12, 15, DE), BYTES_TO_WORDS_8(A2, 85, BD, 75, 0B, F3, C0, E0) },
+      { BYTES_TO_WORDS_8(BC, C0, C6, 80, CB, 3A, A4, CB), BYTES_TO_WORDS_8(7F, 68, DF, 83, 72, 8D, 9F, 4D),
+        BYTES_TO_WORDS_8(08, 10, C7, F7, 5F, 85, 5A, 78), BYTES_TO_WORDS_8(4C, 8E, 7E, 07, 2A, 90, 92, 0B),
+        BYTES_TO_WORDS_8(22, DD, F5, BA, D8, E9, 88, D0), BYTES_TO_WORDS_8(3C, D2, 2E, D9, E3, 5E, 78, 04),
+        BYTES_TO_WORDS_8(20, 1E, 16, 2D, 7A, 69, 6E, 0D), BYTES_TO_WORDS_8(8C, 6A, 5F, AD, CD, D3, BB, DD) },
+      { BYTES_TO_WORDS_8(AC, 8E, 12, E2, 0D, E6, 59, AF), BYTES_TO_WORDS_8(CB, 1C, AF, CC, D5, 58, 47, 0C),
+        BYTES_TO_WORDS_8(69, 51, 6A, 7D, 3B, 6B, BA, 21), BYTES_TO_WORDS_8(F4, A5, DD, 0A, 16, C0, 73, 0A),
+        BYTES_TO_WORDS_8(0D, 18, F1, 64, 1D, 29, 59, 38), BYTES_TO_WORDS_8(CA, D9, 55, 77, F1, 59, 37, 79),
+        BYTES_TO_WORDS_8(7C, 0A, F5, 94, DD, B6, 5C, A5), BYTES_TO_WORDS_8(8C, 83, 4E, 04, 56, DA, 3F, 44) },
+      { BYTES_TO_WORDS_8(86, 91, 68, 3E, 3C, A6, 86, 2D), BYTES_TO_WORDS_8(AF, B6, CD, 5E, C0, A6, BB, 36),
+        BYTES_TO_WORDS_8(12, 62, 39, 73, AE, 97, 5A, EF), BYTES_TO_WORDS_8(F5, 0D, 0A, 23, 89, 95, B9, 5B),
+        BYTES_TO_WORDS_8(18, A0, E3, 1B, 0D, 31, FB, ED), BYTES_TO_WORDS_8(C4, DC, C1, 5B, D0, 3E, 64, 92),
+        BYTES_TO_WORDS_8(3E, 41, 3C, A3, 61, D4, 24, 57), BYTES_TO_WORDS_8(59, 31, ED, 77, E9, 83, 9E, 18) } },
+    /* (1..8) * 16^12 * G */
+    { { BYTES_TO_WORDS_8(04, 51, E5, 17, 80, AF, EB, C2), BYTES_TO_WORDS_8(71, 9C, 8E, BB, 5F, 83, 3A, F7),
+        BYTES_TO_WORDS_8(1C, 56, 8B, 4D, C3, 93, DE, 63), BYTES_TO_WORDS_8(37, 87, B7, 27, 52, 76, DE, D8),
+        BYTES_TO_WORDS_8(CD, 08, 2E, E5, 80, EF, 02, 2A), BYTES_TO_WORDS_8(1B, DB, 40, 19, CE, 3F, F7, C2),
+        BYTES_TO_WORDS_8(24, F9, DC, D1, 8A, 62, 4C, 5C), BYTES_TO_WORDS_8(D1, F2, 13, BE, 65, 94, D2, 2F) },
+      { BYTES_TO_WORDS_8(1B, A8, 22, F7, 09, 94, EB, 06), BYTES_TO_WORDS_8(8F, B6, 67, 94, AB, 7B, 22, E9),
+        BYTES_TO_WORDS_8(20, A3, A0, 56, 17, F7, 20, 60), BYTES_TO_WORDS_8(9B, B7, 38, 9A, 6A, B2, 3E, D0),
+        BYTES_TO_WORDS_8(67, 57, A8, D8, 86, 5F, E2, 95), BYTES_TO_WORDS_8(F5, 08, F2, 6D, 28, 1A, FF, 9D),
+        BYTES_TO_WORDS_8(12, D4, 62, 52, 04, 57, E0, 6C), BYTES_TO_WORDS_8(E7, A3, 21, 2C, B0, FC, C5, 50) },
+      { BYTES_TO_WORDS_8(D3, BF, 87, E9, C7, C2, 39, 69), BYTES_TO_WORDS_8(4C, 28, C4, F4, 2F, 47, C5, 87),
+        BYTES_TO_WORDS_8(91, D1, DD, FA, EA, FB, 1D, 55), BYTES_TO_WORDS_8(33, 8E, 51, BD, 6F, 78, A5, E3),
+        BYTES_TO_WORDS_8(7D, 3E, C2, 8C, 6C, 1B, D3, 7E), BYTES_TO_WORDS_8(81, E0, 28, D9, EC, F2, DC, A3),
+        BYTES_TO_WORDS_8(0C, 21, D8, 4A, FF, B9, 77, 84), BYTES_TO_WORDS_8(E6, 40, 58, 53, 09, AD, 4B, F7) },
+      { BYTES_TO_WORDS_8(13, 1C, F6, 03, 0D, 11, 34, E8), BYTES_TO_WORDS_8(D7, 0D, 79, F1, D6, 86, 69, FF),
+        BYTES_TO_WORDS_8(6F, 97, C7, 07, 4E, D9, 3A, 2D), BYTES_TO_WORDS_8(A7, CD, B8, 0E, 01, 91, 40, FE),
+        BYTES_TO_WORDS_8(AE, B3, A0, BD, CD, CE, D3, C3), BYTES_TO_WORDS_8(73, D9, E1, 99, DB, FB, 86, F9),
+        BYTES_TO_WORDS_8(79, 0B, 3B, 09, AF, 6F, 48, 39), BYTES_TO_WORDS_8(32, 40, 40, DA, C1, 59, 17, 08) },
+      { BYTES_TO_WORDS_8(6E, 05, D5, 22, D2, 51, 79, B6), BYTES_TO_WORDS_8(7C, A0, 47, E2, A7, B5, DC, 0E),
+        BYTES_TO_WORDS_8(48, 5E, 6E, E9, FC, 5F, 52, 11), BYTES_TO_WORDS_8(D4, 20, A5, EC, 41, 70, A9, 42),
+        BYTES_TO_WORDS_8(11, DB, F7, B0, C8, 4D, 41, 48), BYTES_TO_WORDS_8(FD, D1, 9F, 6E, 3D, 48, 4E, B6),
+        BYTES_TO_WORDS_8(26, 3B, 56, 6B, D2, 6D, C3, 6E), BYTES_TO_WORDS_8(06, 87, 00, CF, 66, 7F, FC, F2) },
+      { BYTES_TO_WORDS_8(B1, A6, 94, 0A, 9E, 82, CA, 7B), BYTES_TO_WORDS_8(B6, E4, D9, D0, 28, 0C, 30, CA),
+        BYTES_TO_WORDS_8(23, 43, FC, 93, BE, CE, A7, 28), BYTES_TO_WORDS_8(8D, B7, A7, 2A, F3, B9, 73, 58),
+        BYTES_TO_WORDS_8(9D, 4C, 52, DE, 98, 9F, BF, 52), BYTES_TO_WORDS_8(F0, 3D, FB, 9F, 88, 54, 50, 1F),
+        BYTES_TO_WORDS_8(5A, B9, 9B, C3, 9C, 37, E0, F4), BYTES_TO_WORDS_8(B5, 2E, 5E, ED, F4, DB, A7, 17) },
+      { BYTES_TO_WORDS_8(3B, FD, DA, D3, 91, 5F, 74, C6), BYTES_TO_WORDS_8(56, 39, CB, 2D, F0, 99, B8, 6F),
+        BYTES_TO_WORDS_8(D6, 79, 53, D6, 2E, 2C, 23, FE), BYTES_TO_WORDS_8(4C, 96, 27, 1C, 1B, A7, 6C, 0D),
+        BYTES_TO_WORDS_8(E8, E6, 6F, 1A, 42, F1, AD, D6), BYTES_TO_WORDS_8(1A, 77, 88, EE, AB, 48, 22, A0),
+        BYTES_TO_WORDS_8(58, DE, 07, 27, A0, 94, E4, 9F), BYTES_TO_WORDS_8(3D, 29, DE, 8F, B3, 30, 51, A8) },
+      { BYTES_TO_WORDS_8(41, EE, A8, 8F, 24, 0C, D0, 13), BYTES_TO_WORDS_8(48, 36, 74, C7, 44, 66, 4E, CB),
+        BYTES_TO_WORDS_8(03, 44, 15, 63, 70, 95, 80, 1E), BYTES_TO_WORDS_8(95, 58, DD, 39, 08, 30, 0E, C9),
+        BYTES_TO_WORDS_8(AE, C1, D7, C3, 67, 36, A6, 47), BYTES_TO_WORDS_8(6E, CD, AC, 17, 47, 53, 45, 50),
+        BYTES_TO_WORDS_8(62, 03, 84, 53, C6, 10, 07, 9C), BYTES_TO_WORDS_8(3C, E7, 19, 6D, 17, 04, F5, 62) } },
+    /* (1..8) * 16^13 * G */
+    { { BYTES_TO_WORDS_8(83, 5C, 1E, 07, 92, BC, A6, EE), BYTES_TO_WORDS_8(BE, A0, 42, 85, 19, 7F, D2, 8B),
+        BYTES_TO_WORDS_8(B1, E5, 58, 2A, B7, 45, A8, 20), BYTES_TO_WORDS_8(3F, D7, 26, 50, 41, C9, CC, 54),
+        BYTES_TO_WORDS_8(A1, 16, 09, 14, F7, 8E, D0, CF), BYTES_TO_WORDS_8(96, E4, 8E, 5D, CC, 0B, 9E, 92),
+        BYTES_TO_WORDS_8(22, BF, D2, DA, 15, 87, 8F, 3A), BYTES_TO_WORDS_8(32, 45, 51, B4, 45, 3F, 43, 1C) },
+      { BYTES_TO_WORDS_8(25, 7C, 28, 01, 0C, B8, 1B, 83), BYTES_TO_WORDS_8(B2, 64, 6F, 94, 1E, 5B, FD, 83),
+        BYTES_TO_WORDS_8(33, E8, FB, DC, 14, 10, 84, 9D), BYTES_TO_WORDS_8(14, A8, 8A, ED, 1B, 4B, E3, 29),
+        BYTES_TO_WORDS_8(6E, E4, A7, 75, 1D, AD, 23, 1D), BYTES_TO_WORDS_8(39, A4, 15, 6E, 8B, 19, 3A, CF),
+        BYTES_TO_WORDS_8(25, 6B, D9, CC, DF, 7C, 41, C1), BYTES_TO_WORDS_8(A3, B3, EE, 95, DF, 97, 43, EA) },
+      { BYTES_TO_WORDS_8(7C, 16, 76, AF, 22, 36, 5E, 4C), BYTES_TO_WORDS_8(39, 67, 74, C4, 2C, 42, 2F, 2F),
+        BYTES_TO_WORDS_8(F2, D9, CC, 2D, 69, 2C, C2, 39), BYTES_TO_WORDS_8(95, FF, 3E, B7, DC, 2E, 58, 87),
+        BYTES_TO_WORDS_8(F6, 7F, 4D, 6F, 61, BB, 6F, 6C), BYTES_TO_WORDS_8(E8, 7B, 19, 77, 06, 8F, 02, 88),
+        BYTES_TO_WORDS_8(A8, 36, 72, C3, C3, 02, E1, FD), BYTES_TO_WORDS_8(7B, 4A, D6, 0A, 35, 94, 5B, 07) },
+      { BYTES_TO_WORDS_8(83, A3, A3, 53, 3A, BE, D5, F3), BYTES_TO_WORDS_8(09, 24, B6, 3A, 53, 31, 6F, 87),
+        BYTES_TO_WORDS_8(19, 19, 00, 3C, 1D, 5F, 5B, EA), BYTES_TO_WORDS_8(9E, A1, 5B, 7C, 36, 76, A0, D2),
+        BYTES_TO_WORDS_8(40, 06, 7E, 2E, B2, AB, F2, 65), BYTES_TO_WORDS_8(CE, 8B, 59, 3F, FF, AE, 81, 59),
+        BYTES_TO_WORDS_8(30, CE, 9D, BB, F5, A0, 43, 66), BYTES_TO_WORDS_8(C0, FC, B7, 93, B8, 09, AA, 79) },
+      { BYTES_TO_WORDS_8(11, 66, DE, 74, E8, 3E, 72, 46), BYTES_TO_WORDS_8(B0, 1F, 82, 4B, 39, 57, F6, 33),
+        BYTES_TO_WORDS_8(1E, F1, 66, 35, 36, B7, 25, 1C), BYTES_TO_WORDS_8(DB, 36, 27, 1F, CA, 7A, 10, 4A),
+        BYTES_TO_WORDS_8(FE, 05, A8, 58, EE, EB, 58, 03), BYTES_TO_WORDS_8(AC, 32, 21, 5C, 7A, 54, 5D, 07),
+        BYTES_TO_WORDS_8(2E, 05, 00, F7, E8, 64, CE, 34), BYTES_TO_WORDS_8(39, EF, 63, 00, 51, 26, 9B, 80) },
+      { BYTES_TO_WORDS_8(10, 3A, D7, 3B, 98, 1D, 38, E7), BYTES_TO_WORDS_8(0C, 7B, EC, 9D, 12, 80, 52, A2),
+        BYTES_TO_WORDS_8(18, 20, 96, E8, 38, 9D, 30, 13), BYTES_TO_WORDS_8(4C, 39, 23, FE, C4, 84, 60, 20),
+        BYTES_TO_WORDS_8(29, F2, D2, D8, 8D, D1, 12, 49), BYTES_TO_WORDS_8(03, C0, EC, 24, C4, 15, C3, F5),
+        BYTES_TO_WORDS_8(93, 83, EB, 2C, 67, A9, 08, 0C), BYTES_TO_WORDS_8(97, 16, A0, 6D, F8, A0, 33, 61) },
+      { BYTES_TO_WORDS_8(B0, EC, CF, 6D, D0, 4E, BA, FC), BYTES_TO_WORDS_8(46, D8, A8, 30, 1D, FD, 83, E9),
+        BYTES_TO_WORDS_8(F6, 49, BF, 49, 0D, 0E, 4A, 65), BYTES_TO_WORDS_8(C9, DF, AA, 72, B3, 2E, 40, FD),
+        BYTES_TO_WORDS_8(E8, 8D, A0, ED, 3D, 3F, 59, 10), BYTES_TO_WORDS_8(79, 5E, E6, BD, 24, 4C, 4B, 1A),
+        BYTES_TO_WORDS_8(6B, A8, AB, 9B, 38, 26, A6, E9), BYTES_TO_WORDS_8(22, 3A, A6, DD, 30, 40, B3, D6) },
+      { BYTES_TO_WORDS_8(29, 35, A4, 4F, 2D, 53, 48, 77), BYTES_TO_WORDS_8(4A, B3, AB, E1, 1A, 67, 05, D5),
+        BYTES_TO_WORDS_8(BA, D5, 77, 19, 63, EB, DC, 66), BYTES_TO_WORDS_8(6A, 84, FD, B0, 86, D6, 6D, C5),
+        BYTES_TO_WORDS_8(F6, 21, A5, F9, AC, ED, ED, 59), BYTES_TO_WORDS_8(EE, 7E, FB, 16, 78, 46, 9E, 61),
+        BYTES_TO_WORDS_8(11, 8C, 6B, A7, 60, 2C, 5D, 55), BYTES_TO_WORDS_8(63, B2, F1, F3, 85, AA, AC, F2) } },
+    /* (1..8) * 16^14 * G */
+    { { BYTES_TO_WORDS_8(36, 29, D3, 22, 71, B7, 0F, C3), BYTES_TO_WORDS_8(01, 7F, 84, 32, 2E, D0, 0C, E4),
+        BYTES_TO_WORDS_8(38, 7F, 3D, 51, D1, C7, 6C, 9F), BYTES_TO_WORDS_8(7D, A4, 14, 78, 59, 0C, 44, C5),
+        BYTES_TO_WORDS_8(D4, BF, CA, 47, 37, FA, 42, 9A), BYTES_TO_WORDS_8(5D, 1E, E4, 31, 86, D2, A6, D8),
+        BYTES_TO_WORDS_8(AC, F4, EC, 23, 1D, 1E, DC, 2E), BYTES_TO_WORDS_8(A7, 1F, 3E, 38, BA, E9, 7E, D2) },
+      { BYTES_TO_WORDS_8(B9, 32, 2E, 2C, 8D, A1, E1, CB), BYTES_TO_WORDS_8(C0, 92, D4, FB, 3D, 80, 65, F1),
+        BYTES_TO_WORDS_8(12, AB, 5B, 2F, D5, 42, 3E, FF), BYTES_TO_WORDS_8(AF, 15, AA, 2D, 89, 95, 7E, D0),
+        BYTES_TO_WORDS_8(5C, 4F, 1A, 2C, 6A, AD, 78, 5E), BYTES_TO_WORDS_8(1E, E8, 28, 52, F1, 98, ED, 23),
+        BYTES_TO_WORDS_8(4E, EF, 93, F8, 69, 07, 1F, 73), BYTES_TO_WORDS_8(28, 45, 72, 06, 65, 4D, 4E, 77) },
+      { BYTES_TO_WORDS_8(E1, A8, 89, 79, EC, 01, 85, 7D), BYTES_TO_WORDS_8(DD, 4B, EE, 74, F3, 96, 1D, 7C),
+        BYTES_TO_WORDS_8(0A, FE, 9C, 9B, 47, E0, 00, 75), BYTES_TO_WORDS_8(9B, A7, DF, 5C, C4, 03, 4D, 3E),
+        BYTES_TO_WORDS_8(0A, 24, 1C, 44, 88, 13, 79, 98), BYTES_TO_WORDS_8(40, 67, BD, F3, D5, 18, AF, FF),
+        BYTES_TO_WORDS_8(19, A7, CA, D7, CA, 17, C1, AA), BYTES_TO_WORDS_8(75, 64, 5A, 81, D0, 44, F7, 12) },
+      { BYTES_TO_WORDS_8(91, 7B, 9F, F7, EE, AE, 01, 76), BYTES_TO_WORDS_8(7C, 95, 9D, E1, 49, A1, 75, 42),
+        BYTES_TO_WORDS_8(32, 9D, 82, 95, 02, AE, 06, 3A), BYTES_TO_WORDS_8(FC, D8, 6F, B8, 07, 6E, 7F, 43),
+        BYTES_TO_WORDS_8(33, 00, 27, 75, E3, AC, B6, 64), BYTES_TO_WORDS_8(33, 68, 39, 91, 11, 77, 9A, 58),
+        BYTES_TO_WORDS_8(3C, D6, 15, 9B, 28, B8, 38, BF), BYTES_TO_WORDS_8(3A, F1, 89, A8, 7C, D3, E8, 5F) },
+      { BYTES_TO_WORDS_8(02, 79, BB, D9, D0, A8, 39, 69), BYTES_TO_WORDS_8(3F, C7, B7, 86, 72, 6C, C2, D8),
+        BYTES_TO_WORDS_8(9F, 5E, 48, 94, 9E, 24, 9A, 9A), BYTES_TO_WORDS_8(35, 10, D6, B3, 49, 84, B6, 01),
+        BYTES_TO_WORDS_8(53, E6, 3E, E0, B1, 44, 7F, CD), BYTES_TO_WORDS_8(82, 66, 83, 71, 04, 26, EB, FC),
+        BYTES_TO_WORDS_8(81, 15, 6D, C3, E5, 98, F1, 0B), BYTES_TO_WORDS_8(3E, 9C, 37, E9, A1, 63, 90, E5) },
+      { BYTES_TO_WORDS_8(03, 62, 04, 45, ED, DE, 0C, 36), BYTES_TO_WORDS_8(BD, FC, 6C, DC, 8A, 52, 33, 55),
+        BYTES_TO_WORDS_8(63, E4, 06, 7D, 99, 65, 46, 53), BYTES_TO_WORDS_8(77, 7E, FD, 17, B2, 9F, EA, D2),
+        BYTES_TO_WORDS_8(23, A6, 8E, 3E, 7A, F2, 99, 85), BYTES_TO_WORDS_8(F5, C3, 34, 6A, D5, F2, DF, 15),
+        BYTES_TO_WORDS_8(44, 0D, 50, 24, 08, 42, 06, 5B), BYTES_TO_WORDS_8(70, 9A, 90, 9F, B0, 23, AD, 16) },
+      { BYTES_TO_WORDS_8(FE, D9, 71, C3, D4, 56, 9B, C2), BYTES_TO_WORDS_8(BB, D6, 99, 19, 6C, 35, 4B, F0),
+        BYTES_TO_WORDS_8(4C, 3A, AB, C3, A7, 55, 59, 33), BYTES_TO_WORDS_8(A2, 9C, CC, AC, B1, 3C, 2C, 95),
+        BYTES_TO_WORDS_8(3F, A1, 89, 41, D2, E6, 6C, D7), BYTES_TO_WORDS_8(5E, C7, 08, 18, F1, 64, 44, 66),
+        BYTES_TO_WORDS_8(D0, E5, EC, F6, 36, 91, DF, A7), BYTES_TO_WORDS_8(06, 2F, D6, F7, 46, 85, B9, 59) },
+      { BYTES_TO_WORDS_8(C7, D9, 1C, C5, FE, EC, 69, A9), BYTES_TO_WORDS_8(8F, DB, 47, 34, 8A, 7C, 0A, B8),
+        BYTES_TO_WORDS_8(28, EE, 83, 64, 2A, 1E, CA, 79), BYTES_TO_WORDS_8(4F, 84, AB, 5C, 7A, FF, CD, CE),
+        BYTES_TO_WORDS_8(32, 96, 38, 29, C7, EA, 76, EB), BYTES_TO_WORDS_8(3F, 5A, 5E, 64, 6B, D0, 09, 0D),
+        BYTES_TO_WORDS_8(6B, 0F, 7D, 9C, 81, 68, AF, 92), BYTES_TO_WORDS_8(08, 80, 86, 22, 4D, E5, 23, 93) } },
+    /* (1..8) * 16^15 * G */
+    { { BYTES_TO_WORDS_8(48, FD, 66, B0, 72, 41, 9F, BF), BYTES_TO_WORDS_8(83, 15, 97, B8, 1C, 10, 37, 1C),
+        BYTES_TO_WORDS_8(A6, DC, BA, A6, 97, 9B, C7, 06), BYTES_TO_WORDS_8(C5, F1, 27, 42, 7A, 56, 1C, 24),
+        BYTES_TO_WORDS_8(08, 7B, 85, 92, 67, 2C, 7D, 7F), BYTES_TO_WORDS_8(05, 66, A3, AE, 38, 71, A8, 8E),
+        BYTES_TO_WORDS_8(A4, 03, 32, 04, 7C, 81, 63, 93), BYTES_TO_WORDS_8(4B, 2D, 30, D4, 93, 2D, A6, 40) },
+      { BYTES_TO_WORDS_8(7C, FB, 3D, 78, 50, 5B, AE, 42), BYTES_TO_WORDS_8(66, 44, 00, A2, 2E, B5, 18, A5),
+        BYTES_TO_WORDS_8(3C, 17, 3B, 24, A9, 77, 90, 60), BYTES_TO_WORDS_8(8D, 1C, ED, 8B, C7, 20, A2, 4E),
+        BYTES_TO_WORDS_8(3E, E1, 15, 84, E8, E6, D9, E5), BYTES_TO_WORDS_8(80, 44, 32, 52, B4, A2, C2, 28),
+        BYTES_TO_WORDS_8(98, 82, 4C, 95, 9D, 7D, 41, 27), BYTES_TO_WORDS_8(3A, 8D, C8, 1E, 2F, DD, 44, C6) },
+      { BYTES_TO_WORDS_8(1D, 59, F9, 0D, B9, 7D, 1F, 86), BYTES_TO_WORDS_8(2A, C8, B4, 42, C2, 3A, EC, DC),
+        BYTES_TO_WORDS_8(18, 72, 32, AB, C4, D3, A0, CB), BYTES_TO_WORDS_8(E9, 78, 69, 82, 3B, D2, 2F, DE),
+        BYTES_TO_WORDS_8(84, AD, 57, 04, 3D, 97, E1, B4), BYTES_TO_WORDS_8(A4, 36, C0, 88, 1F, 8A, 9A, DA),
+        BYTES_TO_WORDS_8(BB, 2E, B9, 84, EC, B7, EC, 05), BYTES_TO_WORDS_8(F3, 43, 62, 3B, 13, 71, 0D, 40) },
+      { BYTES_TO_WORDS_8(2E, 0D, D7, 87, 94, E8, 02, 0F), BYTES_TO_WORDS_8(0D, CE, 51, 75, 39, D9, 8D, 55),
+        BYTES_TO_WORDS_8(35, 19, 1C, F2, 45, E1, 27, EB), BYTES_TO_WORDS_8(4E, E9, 5A, D7, CE, 51, 86, 9C),
+        BYTES_TO_WORDS_8(28, 5D, F3, 20, 93, DA, D3, 9C), BYTES_TO_WORDS_8(12, CF, 75, 2D, A8, 01, ED, F3),
+        BYTES_TO_WORDS_8(C8, 54, 24, 3A, 29, 6E, B3, 3B), BYTES_TO_WORDS_8(3E, E5, 04, AD, 63, E3, 32, 95) },
+      { BYTES_TO_WORDS_8(2C, 28, 62, F5, 4A, 25, A8, 2E), BYTES_TO_WORDS_8(77, C3, FB, 38, F9, 3A, 2F, F0),
+        BYTES_TO_WORDS_8(40, 13, E1, 24, B0, 48, 39, 99), BYTES_TO_WORDS_8(DD, CB, 4C, 30, B0, 89, F8, 8D),
+        BYTES_TO_WORDS_8(CD, 95, D1, 61, D9, AB, 56, 72), BYTES_TO_WORDS_8(15, BB, F9, CE, 44, 70, 7F, 24),
+        BYTES_TO_WORDS_8(5E, F3, 8A, 18, 63, 1E, 74, 6C), BYTES_TO_WORDS_8(ED, CE, 05, 32, 67, 5B, 52, 74) },
+      { BYTES_TO_WORDS_8(43, A5, A4, 3D, 7E, 0A, E5, 9A), BYTES_TO_WORDS_8(8C, 20, DD, 5E, 2E, 1C, B2, B2),
+        BYTES_TO_WORDS_8(BB, 3F, A0, A7, DC, 86, 9D, 43), BYTES_TO_WORDS_8(5D, 93, CF, AA, 1D, 67, 1A, 21),
+        BYTES_TO_WORDS_8(0B, 9C, B6, 36, BB, 17, 21, 53), BYTES_TO_WORDS_8(F7, 6C, 8A, 41, 54, 0C, 81, 37),
+        BYTES_TO_WORDS_8(8A, 83, 68, A8, DC, 68, 6D, 43), BYTES_TO_WORDS_8(A0, F4, FE, 9B, A8, 47, 6D, F4) },
+      { BYTES_TO_WORDS_8(DD, B2, DD, 0D, 95, 28, D5, F9), BYTES_TO_WORDS_8(A6, 0D, 2C, CC, CD, 64, 88, 07),
+        BYTES_TO_WORDS_8(45, F2, 52, F1, 0C, B8, 1F, 00), BYTES_TO_WORDS_8(F8, 80, 8B, D9, 8C, 75, FD, A0),
+        BYTES_TO_WORDS_8(B2, E6, ED, 73, F8, 4F, D9, 7F), BYTES_TO_WORDS_8(7C, 9A, 40, 89, 6F, E9, 8C, 1C),
+        BYTES_TO_WORDS_8(31, 8F, B0, 13, D3, 1F, 69, F8), BYTES_TO_WORDS_8(D5, 68, 33, C1, 35, D8, E5, 53) },
+      { BYTES_TO_WORDS_8(F3, 2A, D6, C5, 78, F6, A4, 17), BYTES_TO_WORDS_8(36, EC, C0, 6B, A2, 7C, 3E, E9),
+        BYTES_TO_WORDS_8(71, 5A, 2E, A5, C0, FB, 08, A7), BYTES_TO_WORDS_8(14, 24, E9, 6E, 1A, 40, 8A, 29),
+        BYTES_TO_WORDS_8(96, 3D, 0A, AF, F0, 3E, 76, 94), BYTES_TO_WORDS_8(EF, D6, 4E, 60, B9, E6, 66, 48),
+        BYTES_TO_WORDS_8(DF, 90, 0C, C8, FF, 85, 09, E4), BYTES_TO_WORDS_8(66, 04, FE, 04, AA, A3, F9, 18) } },
+    /* (1..8) * 16^16 * G */
+    { { BYTES_TO_WORDS_8(63, DB, 14, 8E, B4, 5C, E7, 90), BYTES_TO_WORDS_8(7E, 1F, 65, AD, AA, 3B, 49, 29),
+        BYTES_TO_WORDS_8(DE, 25, 6E, 32, 2E, 59, 92, 84), BYTES_TO_WORDS_8(A5, AA, 11, 28, BC, 22, A8, 0F),
+        BYTES_TO_WORDS_8(E7, 2E, 46, 5F, 54, 24, 11, E4), BYTES_TO_WORDS_8(F5, 82, FE, 50, 50, A6, B1, 34),
+        BYTES_TO_WORDS_8(8B, 18, DF, B3, BC, D4, 4A, 6F), BYTES_TO_WORDS_8(0D, A8, DB, F5, E8, 4A, F4, BF) },
+      { BYTES_TO_WORDS_8(B5, 57, 5F, A0, BA, 16, 4A, 79), BYTES_TO_WORDS_8(91, 45, 32, 57, 8A, 44, FE, 53),
+        BYTES_TO_WORDS_8(01, 08, 96, 06, 03, 3D, C1, E4), BYTES_TO_WORDS_8(46, C7, 8D, DF, 47, 87, 1A, 03),
+        BYTES_TO_WORDS_8(FD, 43, 03, 9C, 57, EE, 27, 18), BYTES_TO_WORDS_8(F2, DE, B8, 42, 8C, C1, 31, 14),
+        BYTES_TO_WORDS_8(32, 7A, 38, 1E, 6C, AA, E8, 60), BYTES_TO_WORDS_8(86, D5, A8, FD, 64, 2C, 3A, 88) },
+      { BYTES_TO_WORDS_8(EC, CD, B3, 7D, 3F, 45, 2C, 75), BYTES_TO_WORDS_8(F5, EB, 28, B2, 12, 3A, EF, DB),
+        BYTES_TO_WORDS_8(C8, 4B, EA, 7B, 5E, 64, 96, E5), BYTES_TO_WORDS_8(5C, 2F, 91, FF, 64, C0, B2, 85),
+        BYTES_TO_WORDS_8(1F, F8, 03, 4A, 20, 08, 4D, 8F), BYTES_TO_WORDS_8(E0, F8, 4C, E6, 34, 0B, 98, DC),
+        BYTES_TO_WORDS_8(00, 6D, CC, 2F, 2D, FA, C7, 63), BYTES_TO_WORDS_8(36, 15, D1, 39, 8F, 27, 4B, F6) },
+      { BYTES_TO_WORDS_8(22, 23, 0B, 58, 65, 2E, 5E, 01), BYTES_TO_WORDS_8(CA, 3C, 51, 96, 60, AC, CC, 4E),
+        BYTES_TO_WORDS_8(4A, 93, D5, C0, 75, 19, 57, F9), BYTES_TO_WORDS_8(17, 3C, 97, 9B, 2B, 3C, 16, A7),
+        BYTES_TO_WORDS_8(E9, FF, 97, 21, 23, B2, 33, 39), BYTES_TO_WORDS_8(D7, 52, 99, E0, F4, A4, 41, B8),
+        BYTES_TO_WORDS_8(7A, 6B, 5A, 54, 91, 99, 38, 63), BYTES_TO_WORDS_8(A5, 1F, F3, 7A, 79, 9A, 8A, 30) },
+      { BYTES_TO_WORDS_8(30, B0, 07, 86, E4, 5A, 8A, 28), BYTES_TO_WORDS_8(73, D6, 84, E5, 63, FF, DA, 24),
+        BYTES_TO_WORDS_8(9C, F2, 16, EC, AC, FB, 51, 78), BYTES_TO_WORDS_8(67, 14, 02, C4, 76, 03, 0B, 11),
+        BYTES_TO_WORDS_8(3A, 7C, 61, B3, 12, A1, 3A, F4), BYTES_TO_WORDS_8(49, 87, 29, FB, 56, 15, BE, 87),
+        BYTES_TO_WORDS_8(0C, C7, 61, 84, 9F, B8, 6E, 4C), BYTES_TO_WORDS_8(73, E6, 8E, 31, 85, 2B, 43, 84) },
+      { BYTES_TO_WORDS_8(20, 40, 33, 6A, 91, D3, FB, 9A), BYTES_TO_WORDS_8(B9, AF, F9, 8E, 99, 59, 81, A1),
+        BYTES_TO_WORDS_8(AC, 90, 76, 51, 72, 07, 2A, E2), BYTES_TO_WORDS_8(ED, 4E, 5D, 87, 24, 45, 71, 3C),
+        BYTES_TO_WORDS_8(55, 16, 70, BA, 5C, A8, 02, 61), BYTES_TO_WORDS_8(2C, 8C, 93, E7, AF, CA, 2F, 15),
+        BYTES_TO_WORDS_8(8C, 3D, 7F, FF, 29, E7, 89, 48), BYTES_TO_WORDS_8(5C, AF, 1A, 77, 65, 05, 09, 7F) },
+      { BYTES_TO_WORDS_8(08, 6F, A7, 75, 1C, D8, ED, 54), BYTES_TO_WORDS_8(4E, ED, BB, 8B, 53, F2, 95, 32),
+        BYTES_TO_WORDS_8(F8, AA, 1C, 2B, 24, E1, F6, 14), BYTES_TO_WORDS_8(D7, 71, 64, 9F, 44, 4E, 78, 18),
+        BYTES_TO_WORDS_8(93, 49, 82, 6B, 5D, 60, 39, 0B), BYTES_TO_WORDS_8(32, 25, 0A, A6, A7, 74, 9D, FC),
+        BYTES_TO_WORDS_8(71, E6, 71, AC, FD, A8, 77, 17), BYTES_TO_WORDS_8(E7, 1A, 1E, 4A, 7F, ED, 76, 8D) },
+      { BYTES_TO_WORDS_8(80, A2, 42, 5C, 6A, 4A, B0, 6C), BYTES_TO_WORDS_8(0C, 67, B2, 2D, 38, 0C, A5, 02),
+        BYTES_TO_WORDS_8(1F, 99, 4B, EF, 23, 39, 1B, 81), BYTES_TO_WORDS_8(79, 82, AB, 03, 8C, AB, FF, 1B),
+        BYTES_TO_WORDS_8(61, 92, DB, 4D, 36, 42, C7, C9), BYTES_TO_WORDS_8(B6, 4F, D2, A9, 9A, 36, 2A, 98),
+        BYTES_TO_WORDS_8(AA, 1A, 9F, 52, 58, C7, 2A, 33), BYTES_TO_WORDS_8(98, D0, B1, CE, 20, B6, 82, 29) } },
+    /* (1..8) * 16^17 * G */
+    { { BYTES_TO_WORDS_8(87, 69, 6A, B7, 05, 13, F4, 68), BYTES_TO_WORDS_8(FF, 43, DA, 43, B4, 1A, 48, 2B),
+        BYTES_TO_WORDS_8(3F, 1B, EE, D7, 88, 69, DC, 7D), BYTES_TO_WORDS_8(54, 99, 98, A9, D7, 18, BC, 54),
+        BYTES_TO_WORDS_8(49, AE, 9A, 5B, D0, 7C, 45, FE), BYTES_TO_WORDS_8(19, B1, 73, BB, D4, 8E, EB, 52),
+        BYTES_TO_WORDS_8(FD, E2, 73, BA, 51, B8, 91, 73), BYTES_TO_WORDS_8(F3, EA, E6, 11, 12, 8C, 2C, 4B) },
+      { BYTES_TO_WORDS_8(50, 02, 26, 96, 61, 4C, A6, B2), BYTES_TO_WORDS_8(4C, CA, 5C, 35, 18, 0F, 77, BA),
+        BYTES_TO_WORDS_8(96, 4D, FB, A6, 73, 81, 3D, F3), BYTES_TO_WORDS_8(16, FF, 1D, 78, 71, 00, 38, 1F),
+        BYTES_TO_WORDS_8(55, 19, 01, 6B, 2E, 9B, 51, B1), BYTES_TO_WORDS_8(93, D6, 90, 05, 66, 67, 85, 1B),
+        BYTES_TO_WORDS_8(62, CF, A2, 6C, 17, 05, 37, A3), BYTES_TO_WORDS_8(1D, 68, 6C, BA, C4, 1E, 52, B1) },
+      { BYTES_TO_WORDS_8(20, D8, 1F, FD, F5, 47, BF, 38), BYTES_TO_WORDS_8(00, 75, 76, 48, 46, 85, 87, 78),
+        BYTES_TO_WORDS_8(1B, 27, B1, 62, 22, 50, 63, A8), BYTES_TO_WORDS_8(2A, C5, C1, 80, F6, BC, FB, BA),
+        BYTES_TO_WORDS_8(F0, 74, F0, 1B, 52, AD, ED, EA), BYTES_TO_WORDS_8(D6, CA, 1F, 23, A1, 34, 1C, E8),
+        BYTES_TO_WORDS_8(FD, C0, 9B, C8, 5A, BF, E7, 2C), BYTES_TO_WORDS_8(81, DD, B4, 9D, 7C, 99, 87, 14) },
+      { BYTES_TO_WORDS_8(DA, 84, AE, 77, D1, 95, 6D, EA), BYTES_TO_WORDS_8(F3, 34, 20, 22, 55, EA, E6, 58),
+        BYTES_TO_WORDS_8(A0, 73, 92, 78, 2B, BE, E0, 41), BYTES_TO_WORDS_8(9F, 01, DB, AA, 92, A1, EB, 99),
+        BYTES_TO_WORDS_8(AC, 5C, 15, 02, BE, 9D, A3, 8D), BYTES_TO_WORDS_8(10, 8D, 10, D7, 66, D8, 30, B6),
+        BYTES_TO_WORDS_8(4D, 18, 30, 45, 64, 06, F8, F4), BYTES_TO_WORDS_8(D9, BF, EF, E1, CD, C4, 4D, FC) },
+      { BYTES_TO_WORDS_8(7E, 9B, 29, 94, 12, 08, 17, E9), BYTES_TO_WORDS_8(D0, E0, 86, 09, 2D, 9F, E7, 24),
+        BYTES_TO_WORDS_8(EC, 20, C2, 75, FC, 3B, 3C, 2A), BYTES_TO_WORDS_8(FE, 89, 33, 10, F7, 38, 19, 9B),
+        BYTES_TO_WORDS_8(DE, 84, 7B, 44, 57, 28, 7B, C5), BYTES_TO_WORDS_8(32, 82, 6B, F8, 51, E8, CD, 0A),
+        BYTES_TO_WORDS_8(C9, 3E, AA, 1C, 8E, E9, 40, 31), BYTES_TO_WORDS_8(83, 02, 71, F1, 6E, AA, 12, FB) },
+      { BYTES_TO_WORDS_8(06, CA, 09, 04, BA, 26, 3A, CA), BYTES_TO_WORDS_8(6E, 2E, A4, 8F, 5F, 5F, 6C, B4),
+        BYTES_TO_WORDS_8(D8, F3, 7B, 90, EA, F0, 1E, E8), BYTES_TO_WORDS_8(DC, 08, 52, 96, FC, 38, B7, 19),
+        BYTES_TO_WORDS_8(6D, 15, 41, 57, A3, 30, 35, 02), BYTES_TO_WORDS_8(E7, 31, 75, 14, DF, 18, B4, 7C),
+        BYTES_TO_WORDS_8(CF, 7A, 5A, E5, B7, 10, 26, E0), BYTES_TO_WORDS_8(4B, 66, 69, 8F, 2C, D1, AA, 6F) },
+      { BYTES_TO_WORDS_8(C4, C4, 0C, D1, 40, 07, 41, FD), BYTES_TO_WORDS_8(A0, 3D, A5, C4, A2, 35, 1D, B7),
+        BYTES_TO_WORDS_8(2C, 1B, 76, 06, DC, 1F, 38, 7C), BYTES_TO_WORDS_8(90, 75, 01, CC, 85, 19, 77, A6),
+        BYTES_TO_WORDS_8(70, 65, 97, 7C, 23, 3B, 0F, C2), BYTES_TO_WORDS_8(94, 30, FF, A6, 73, 57, 74, BC),
+        BYTES_TO_WORDS_8(3D, 9C, 5D, 1E, 60, D6, 9B, F2), BYTES_TO_WORDS_8(98, DD, 50, F7, 85, 61, 50, 85) },
+      { BYTES_TO_WORDS_8(03, 60, F9, F7, C7, F7, 6B, 89), BYTES_TO_WORDS_8(FA, A5, 04, 76, 3B, 99, 4E, 9D),
+        BYTES_TO_WORDS_8(08, 1E, 62, 21, CE, 45, 59, FC), BYTES_TO_WORDS_8(35, 84, 96, 33, 64, 85, 50, 6D),
+        BYTES_TO_WORDS_8(9C, 96, 7E, AC, AA, CC, 71, 02), BYTES_TO_WORDS_8(D9, A0, 63, 82, DC, D6, C0, D6),
+        BYTES_TO_WORDS_8(F9, EE, C7, A2, 8A, 5D, BC, C6), BYTES_TO_WORDS_8(E7, C6, 68, E9, 57, 73, F5, CC) } },
+    /* (1..8) * 16^18 * G */
+    { { BYTES_TO_WORDS_8(31, E2, AA, 70, D1, FA, AA, 60), BYTES_TO_WORDS_8(7C, 6B, F9, 79, 52, B8, 94, 51),
+        BYTES_TO_WORDS_8(6F, 75, 67, 92, 23, 48, F2, 85), BYTES_TO_WORDS_8(F2, E3, 61, 97, 69, C9, 35, 1D),
+        BYTES_TO_WORDS_8(71, AC, D6, CC, 3A, 06, 67, 58), BYTES_TO_WORDS_8(F1, 66, 9A, 72, A4, 8A, F5, ED),
+        BYTES_TO_WORDS_8(10, F8, EB, 22, B6, 0A, 66, 1D), BYTES_TO_WORDS_8(23, 08, F6, 2D, B6, 6C, 22, C7) },
+      { BYTES_TO_WORDS_8(92, 2D, 43, 26, 74, 32, 1A, 50), BYTES_TO_WORDS_8(03, 39, 47, 2B, 3C, 82, C9, D9),
+        BYTES_TO_WORDS_8(B4, 7A, 39, A6, C2, E1, 10, 99), BYTES_TO_WORDS_8(D8, CD, 00, 78, 5A, 06, 2B, 6F),
+        BYTES_TO_WORDS_8(9F, 7C, E1, 63, 49, 1C, 2D, 6D), BYTES_TO_WORDS_8(CB, BE, 3D, E3, 2D, F0, 3B, 09),
+        BYTES_TO_WORDS_8(C5, 26, 08, 70, CF, 72, 14, EB), BYTES_TO_WORDS_8(E4, A2, E7, E5, 77, EB, CF, 0A) },
+      { BYTES_TO_WORDS_8(AC, 3F, FA, 8C, E1, 3F, 0D, CE), BYTES_TO_WORDS_8(93, 81, 2B, C3, 9F, 86, AD, 23),
+        BYTES_TO_WORDS_8(30, 80, 0D, D6, 45, BB, CE, E2), BYTES_TO_WORDS_8(4C, 23, D2, A6, 47, 40, 3D, DF),
+        BYTES_TO_WORDS_8(19, D4, C7, 8F, 93, 6D, 62, F4), BYTES_TO_WORDS_8(75, 29, 88, 96, E4, 3C, D6, AF),
+        BYTES_TO_WORDS_8(BF, 9D, 0F, 9C, F2, 21, AA, 24), BYTES_TO_WORDS_8(DB, 40, FD, 29, 52, 6F, FA, 48) },
+      { BYTES_TO_WORDS_8(F5, DB, 6E, 8A, 08, 5E, 06, E3), BYTES_TO_WORDS_8(6B, 87, 62, 96, 56, 52, 33, 2F),
+        BYTES_TO_WORDS_8(AF, D0, AD, FD, A7, 1D, 99, 68), BYTES_TO_WORDS_8(74, 77, DD, A3, 2B, C1, 0A, 87),
+        BYTES_TO_WORDS_8(E3, 8C, 2F, F0, DC, D2, 06, 19), BYTES_TO_WORDS_8(7E, 29, 5F, 2E, 02, 64, 3C, D0),
+        BYTES_TO_WORDS_8(67, 5A, D0, 69, D7, EF, E7, 8D), BYTES_TO_WORDS_8(99, 76, 9A, 99, 8B, 72, 43, 75) },
+      { BYTES_TO_WORDS_8(D4, 22, 13, 1F, AE, 25, D9, AE), BYTES_TO_WORDS_8(BB, DC, CC, 4A, 40, 69, 0A, CB),
+        BYTES_TO_WORDS_8(22, F8, 11, A3, 4C, 6C, 1E, EA), BYTES_TO_WORDS_8(44, 61, F9, B1, 6A, AF, B2, DB),
+        BYTES_TO_WORDS_8(11, 53, 8C, 4A, 4F, 2B, 49, AA), BYTES_TO_WORDS_8(5F, 3A, 7E, 7B, 78, C9, 9F, 9A),
+        BYTES_TO_WORDS_8(9D, 3F, 43, D6, 1E, 0D, B6, A1), BYTES_TO_WORDS_8(1A, 56, 13, 2F, B9, 75, AE, EB) },
+      { BYTES_TO_WORDS_8(7A, 6B, 3A, 37, DA, 8A, A5, E8), BYTES_TO_WORDS_8(5B, D4, 52, 62, 6C, F0, AD, F3),
+        BYTES_TO_WORDS_8(09, 6D, 22, 14, AA, 67, B6, 09), BYTES_TO_WORDS_8(34, 21, 22, B5, D1, 9F, B2, 17),
+        BYTES_TO_WORDS_8(AC, EB, 44, 48, 07, 82, 14, 0C), BYTES_TO_WORDS_8(AE, CB, 88, D3, 97, 38, D0, 39),
+        BYTES_TO_WORDS_8(D2, FB, FE, 3E, 66, 4E, 92, E9), BYTES_TO_WORDS_8(4E, 3D, 2F, 35, 90, 44, FB, 15) },
+      { BYTES_TO_WORDS_8(7B, 8F, 13, A1, 3C, A3, 69, F0), BYTES_TO_WORDS_8(F2, E8, F2, 2D, 3E, C9, C1, C4),
+        BYTES_TO_WORDS_8(0B, 5F, 9B, 7F, 26, 8A, FA, CA), BYTES_TO_WORDS_8(D4, 1F, 26, 7F, 59, 7B, BA, 1D),
+        BYTES_TO_WORDS_8(68, F2, 9B, A3, C7, D8, 82, DC), BYTES_TO_WORDS_8(C0, 32, 82, 99, B7, E6, 36, 81),
+        BYTES_TO_WORDS_8(F5, 07, 80, BB, 06, 90, E1, 3A), BYTES_TO_WORDS_8(C6, EF, E7, 5D, 3E, 7D, AF, 6A) },
+      { BYTES_TO_WORDS_8(F3, 6A, C0, 50, 63, E4, A6, 7A), BYTES_TO_WORDS_8(F0, F0, DB, 9F, 74, 8C, 9E, 6A),
+        BYTES_TO_WORDS_8(34, DB, 34, 80, EF, 5F, BF, A0), BYTES_TO_WORDS_8(92, 55, 0D, DA, E6, 13, EC, DB),
+        BYTES_TO_WORDS_8(ED, 43, D2, B6, 7C, 0F, AF, 7C), BYTES_TO_WORDS_8(64, B6, ED, 64, 32, 3A, 24, 42),
+        BYTES_TO_WORDS_8(D4, E4, 45, B7, 48, 73, E5, C0), BYTES_TO_WORDS_8(F8, E5, 19, D6, 8F, 97, 59, F8) } },
+    /* (1..8) * 16^19 * G */
+    { { BYTES_TO_WORDS_8(5F, 4F, 0E, 75, A8, AE, 72, 55), BYTES_TO_WORDS_8(E6, E0, 67, A5, 9A, CA, F5, CB),
+        BYTES_TO_WORDS_8(9A, F2, 02, AA, F7, F0, 8F, 38), BYTES_TO_WORDS_8(EF, 5A, 4B, 84, 59, A9, D9, 55),
+        BYTES_TO_WORDS_8(B0, 7D, A9, BC, 76, EB, 58, C8), BYTES_TO_WORDS_8(15, 1B, AD, 33, C6, 10, 98, 4C),
+        BYTES_TO_WORDS_8(52, EC, C8, BC, 4F, 57, 6D, 76), BYTES_TO_WORDS_8(03, D2, DA, A5, 9A, 7F, CB, 69) },
+      { BYTES_TO_WORDS_8(FB, F8, C6, 57, 4D, CB, 58, 07), BYTES_TO_WORDS_8(D3, B5, 09, 3F, 3E, 32, 17, F5),
+        BYTES_TO_WORDS_8(62, E6, 72, 2F, 4C, 43, F9, 38), BYTES_TO_WORDS_8(61, 16, 8A, A7, 9B, 68, 76, 8C),
+        BYTES_TO_WORDS_8(06, 23, CF, 9B, 9A, B3, C5, 7D), BYTES_TO_WORDS_8(5F, C0, 6B, 13, C3, 1F, B1, F0),
+        BYTES_TO_WORDS_8(CD, 6D, 3D, C6, B0, 89, 84, 28), BYTES_TO_WORDS_8(3A, 9D, 40, 0A, 99, 72, 31, CD) },
+      { BYTES_TO_WORDS_8(E9, 42, B1, FE, 87, 98, 6A, C0), BYTES_TO_WORDS_8(FB, FC, 07, 46, 06, EB, 76, C1),
+        BYTES_TO_WORDS_8(80, D4, AE, 8F, 83, 86, 4D, 79), BYTES_TO_WORDS_8(11, 3E, 6F, E4, EB, 43, 00, 4B),
+        BYTES_TO_WORDS_8(52, 85, C6, 62, 2D, C5, B2, 04), BYTES_TO_WORDS_8(88, 58, 12, 3A, 0F, 29, 23, 0F),
+        BYTES_TO_WORDS_8(87, 2D, 22, 36, 46, 88, 17, DB), BYTES_TO_WORDS_8(1A, AC, 0D, A3, 23, CF, 3C, 17) },
+      { BYTES_TO_WORDS_8(D5, F1, 69, ED, 92, 5F, E4, 1E), BYTES_TO_WORDS_8(44, 12, 5E, CE, 68, 37, 54, 46),
+        BYTES_TO_WORDS_8(87, BF, 81, 92, 16, A4, C6, F0), BYTES_TO_WORDS_8(6A, E4, DF, 93, 9A, 90, B5, 3F),
+        BYTES_TO_WORDS_8(C5, 6C, A5, 99, FE, FE, D4, 13), BYTES_TO_WORDS_8(B0, 62, 05, FD, 88, 56, D3, 25),
+        BYTES_TO_WORDS_8(54, 77, DF, 3B, 3A, 4E, 4A, 70), BYTES_TO_WORDS_8(9F, 80, E8, 0B, AC, 91, 99, 54) },
+      { BYTES_TO_WORDS_8(96, AA, F1, 17, E7, 4A, DD, F6), BYTES_TO_WORDS_8(81, 64, FF, 34, F7, A5, D7, 13),
+        BYTES_TO_WORDS_8(C5, 63, 34, B7, CB, 8D, 72, 32), BYTES_TO_WORDS_8(C2, 6F, AD, 92, 79, D2, EA, 79),
+        BYTES_TO_WORDS_8(B7, 3F, 0A, 4B, CE, 71, BA, 80), BYTES_TO_WORDS_8(5A, 95, B3, 11, 11, D7, 84, DE),
+        BYTES_TO_WORDS_8(42, 65, 25, 56, 93, 43, 6E, 1A), BYTES_TO_WORDS_8(BF, DA, AA, FB, CF, E9, 5D, A9) },
+      { BYTES_TO_WORDS_8(74, A2, 37, 16, 2F, EB, C3, 66), BYTES_TO_WORDS_8(06, 58, 2D, 61, 57, 04, 21, 45),
+        BYTES_TO_WORDS_8(74, C0, 6D, 23, C3, 77, A3, 4D), BYTES_TO_WORDS_8(41, 4A, 3E, 6A, 11, EE, 1D, F0),
+        BYTES_TO_WORDS_8(65, 34, 9D, 83, 70, D4, 3F, 74), BYTES_TO_WORDS_8(97, C4, 94, CF, 6E, 3F, 92, E6),
+        BYTES_TO_WORDS_8(CA, 01, 1D, 1E, 23, 5F, 61, 42), BYTES_TO_WORDS_8(F3, 8B, F4, 9A, BC, AD, CF, 24) },
+      { BYTES_TO_WORDS_8(E6, 9A, 3A, F9, 72, CA, 05, C8), BYTES_TO_WORDS_8(AD, F8, 77, 9C, 05, AA, E0, 8E),
+        BYTES_TO_WORDS_8(3F, 74, AD, 31, 36, 9E, 27, B5), BYTES_TO_WORDS_8(CE, A1, 4D, F2, 50, 00, 8E, 31),
+        BYTES_TO_WORDS_8(79, 7D, 44, DC, 94, 56, 4B, 18), BYTES_TO_WORDS_8(EE, A8, D3, AE, DB, 6F, 53, 94),
+        BYTES_TO_WORDS_8(D0, 4B, 50, 1E, A5, 7C, D1, F4), BYTES_TO_WORDS_8(99, 92, CE, 19, 11, EE, 92, 27) },
+      { BYTES_TO_WORDS_8(7F, BC, E7, BD, 70, 12, 6F, 50), BYTES_TO_WORDS_8(03, 3E, ED, BE, 0C, BB, EA, 7F),
+        BYTES_TO_WORDS_8(53, F2, EA, 6F, E1, 27, E2, 8A), BYTES_TO_WORDS_8(40, 90, DD, E5, 1C, CE, 4A, C3),
+        BYTES_TO_WORDS_8(C4, 06, 78, 69, 80, 39, B6, AE), BYTES_TO_WORDS_8(42, A4, 55, BD, 99, 42, 55, D6),
+        BYTES_TO_WORDS_8(12, 6F, 16, 80, BE, B8, 23, E6), BYTES_TO_WORDS_8(E2, 57, 98, 00, 3A, 3B, EF, E1) } },
+    /* (1..8) * 16^20 * G */
+    { { BYTES_TO_WORDS_8(4C, 96, 51, 43, DE, D2, D3, D4), BYTES_TO_WORDS_8(C1, 12, 54, 6F, 37, 24, 69, 34),
+        BYTES_TO_WORDS_8(08, 5C, 75, 85, A1, BC, 5A, AE), BYTES_TO_WORDS_8(7F, C4, 28, BE, 59, F9, 29, 6E),
+        BYTES_TO_WORDS_8(8F, D8, 3F, 56, BD, 24, 88, 11), BYTES_TO_WORDS_8(63, FB, 0B, 7A, 52, 0C, 64, EF),
+        BYTES_TO_WORDS_8(6D, 24, 84, C1, 6C, EC, 52, 50), BYTES_TO_WORDS_8(F6, 32, 0F, 50, 9F, 5D, 56, 34) },
+      { BYTES_TO_WORDS_8(A4, 4D, E8, E5, EF, F0, E0, 61), BYTES_TO_WORDS_8(AD, 0C, D9, 6E, 77, F0, 09, 3B),
+        BYTES_TO_WORDS_8(94, 68, 6E, 49, 81, A3, CF, 10), BYTES_TO_WORDS_8(0B, 9A, 90, B5, 79, 0F, FA, 8E),
+        BYTES_TO_WORDS_8(D3, 69, 69, 59, 42, 9F, E1, FD), BYTES_TO_WORDS_8(35, 60, 81, 97, 48, 7C, 95, 79),
+        BYTES_TO_WORDS_8(14, FD, AA, 5D, 1C, 6F, A4, 9F), BYTES_TO_WORDS_8(13, D6, 4C, 93, E7, 18, 24, 24) },
+      { BYTES_TO_WORDS_8(CC, 49, 0E, 8C, 03, 01, 95, 3F), BYTES_TO_WORDS_8(0D, 40, C5, 5B, A8, 2D, 23, 41),
+        BYTES_TO_WORDS_8(ED, 40, B7, CB, DE, 88, 82, DD), BYTES_TO_WORDS_8(6E, 0F, 97, 78, A9, D4, 91, D6),
+        BYTES_TO_WORDS_8(52, 41, 0F, D0, C1, B4, 0B, DD), BYTES_TO_WORDS_8(F2, 43, D0, 2A, D0, E1, 5B, AC),
+        BYTES_TO_WORDS_8(52, 0C, 3E, 76, B5, BD, FB, F7), BYTES_TO_WORDS_8(97, F3, 78, 4B, 87, E7, 79, 7A) },
+      { BYTES_TO_WORDS_8(CE, C4, 3A, 02, C0, F2, CA, 4A), BYTES_TO_WORDS_8(97, F3, B3, 1E, E3, 73, 89, 1F),
+        BYTES_TO_WORDS_8(2F, DB, 60, F3, D0, D6, D6, B9), BYTES_TO_WORDS_8(30, DB, 8F, CB, 73, AF, D4, D0),
+        BYTES_TO_WORDS_8(B9, D6, 7D, A4, 60, 03, DF, E3), BYTES_TO_WORDS_8(77, AE, 3A, 86, 1C, 0B, 85, 61),
+        BYTES_TO_WORDS_8(30, 95, 52, 3E, EE, CC, E9, BB), BYTES_TO_WORDS_8(DC, 7D, 5D, F1, C8, F8, 90, ED) },
+      { BYTES_TO_WORDS_8(0A, 93, 9B, 2B, 9F, 6B, 87, 3D), BYTES_TO_WORDS_8(8F, F5, 30, 45, 2A, 35, B1, DE),
+        BYTES_TO_WORDS_8(49, BC, 7B, 7A, DF, B7, E5, DE), BYTES_TO_WORDS_8(C5, D7, E0, A2, 46, 68, 5D, 2A),
+        BYTES_TO_WORDS_8(CA, AE, 2C, 3B, 5F, 34, FF, 86), BYTES_TO_WORDS_8(85, 16, 27, 5E, 43, 73, 5B, EA),
+        BYTES_TO_WORDS_8(58, AB, C4, 03, 39, F0, CC, E5), BYTES_TO_WORDS_8(6D, 47, 76, 68, 09, 7C, 3D, DC) },
+      { BYTES_TO_WORDS_8(9A, 71, 86, B8, 30, E1, C6, 0B), BYTES_TO_WORDS_8(F0, 22, 09, 47, 95, B4, 5C, 16),
+        BYTES_TO_WORDS_8(E3, 75, 2B, 33, 4D, 1C, 85, FD), BYTES_TO_WORDS_8(5B, 91, 45, E4, 8C, 7F, 27, 8B),
+        BYTES_TO_WORDS_8(38, 7C, D3, 6E, FE, 30, 8B, 07), BYTES_TO_WORDS_8(3D, 1A, A3, CE, 80, 37, 21, 55),
+        BYTES_TO_WORDS_8(39, 91, EC, 69, EE, 52, 4B, 6E), BYTES_TO_WORDS_8(BC, 43, 45, 16, 7B, D7, 44, CF) },
+      { BYTES_TO_WORDS_8(EF, 59, 69, 81, D2, CB, 7D, FA), BYTES_TO_WORDS_8(9A, B5, 1D, 74, 56, D0, 79, 76),
+        BYTES_TO_WORDS_8(F8, 5D, 27, 2E, 41, 31, 04, 2F), BYTES_TO_WORDS_8(26, B5, 9B, 38, 6A, 49, 64, 87),
+        BYTES_TO_WORDS_8(10, 50, CD, E0, CB, 11, 03, 66), BYTES_TO_WORDS_8(F1, E3, F9, 72, 41, AD, 56, 28),
+        BYTES_TO_WORDS_8(1F, 96, ED, 96, 27, 41, 0B, 9E), BYTES_TO_WORDS_8(FD, 2F, 00, 1D, D6, 69, 9B, 59) },
+      { BYTES_TO_WORDS_8(42, 7D, 39, 92, 61, DA, 99, E3), BYTES_TO_WORDS_8(AC, 6E, 25, 51, 02, D6, D1, 38),
+        BYTES_TO_WORDS_8(90, 5F, B8, 65, 1B, F7, D6, A6), BYTES_TO_WORDS_8(E8, 52, 54, ED, D0, 8D, 9B, 82),
+        BYTES_TO_WORDS_8(12, 56, DF, E3, 31, 16, B7, 91), BYTES_TO_WORDS_8(5D, 1A, AD, 63, 42, DC, 5A, 5C),
+        BYTES_TO_WORDS_8(AF, 41, 62, 89, 8A, 3C, E7, 99), BYTES_TO_WORDS_8(6D, F4, CC, 3F, 54, EC, 00, D3) } },
+    /* (1..8) * 16^21 * G */
+    { { BYTES_TO_WORDS_8(80, 12, B7, 0C, 11, D4, A7, 28), BYTES_TO_WORDS_8(11, 63, 45, A8, 59, C2, 41, C1),
+        BYTES_TO_WORDS_8(8E, 45, 6F, 79, F0, 2E, 0F, C0), BYTES_TO_WORDS_8(D9, EE, BF, B2, 9E, 6A, 04, FF),
+        BYTES_TO_WORDS_8(19, 39, C3, 5E, 1F, 27, C3, 7E), BYTES_TO_WORDS_8(7A, 48, 28, BD, 6E, 6E, 2B, 01),
+        BYTES_TO_WORDS_8(C9, FC, 4C, DD, DB, ED, 01, 0A), BYTES_TO_WORDS_8(17, 3A, 95, C0, AC, 55, 2F, 43) },
+      { BYTES_TO_WORDS_8(07, DA, B3, B0, C7, 41, BD, B2), BYTES_TO_WORDS_8(AC, 35, DE, 56, F8, 45, 17, 01),
+        BYTES_TO_WORDS_8(F4, 7D, 28, 41, CC, BC, AB, 8F), BYTES_TO_WORDS_8(B0, C2, DD, 34, F3, C0, 90, 58),
+        BYTES_TO_WORDS_8(E0, 13, 38, 8D, E8, 0A, 3D, 62), BYTES_TO_WORDS_8(66, 81, 2A, 3E, CE, 79, A2, 55),
+        BYTES_TO_WORDS_8(26, 27, 79, 4F, FA, 04, 46, 5E), BYTES_TO_WORDS_8(04, 9C, 1D, 8B, 78, AC, 9E, CC) },
+      { BYTES_TO_WORDS_8(E3, 3C, CA, 33, AA, 82, 27, 5F), BYTES_TO_WORDS_8(E2, 77, 6A, AB, 65, 18, 2B, EF),
+        BYTES_TO_WORDS_8(1F, 23, 12, 53, 1F, BC, 95, 1A), BYTES_TO_WORDS_8(D3, DC, D3, 14, 5D, C4, 17, F7),
+        BYTES_TO_WORDS_8(E9, 88, ED, 50, DB, CC, 94, 68), BYTES_TO_WORDS_8(F0, 6D, 17, DC, BD, E2, 53, AF),
+        BYTES_TO_WORDS_8(55, EE, AD, 0A, ED, 54, 9B, CA), BYTES_TO_WORDS_8(2D, 51, 99, 8C, 76, 40, 2C, 42) },
+      { BYTES_TO_WORDS_8(2C, 0C, 78, BF, 83, 3E, C7, FD), BYTES_TO_WORDS_8(17, 68, 66, 2D, 94, 67, DC, FF),
+        BYTES_TO_WORDS_8(93, 68, 43, 02, DD, 66, 4B, C1), BYTES_TO_WORDS_8(0C, 65, 54, 0D, 67, 95, EC, 6E),
+        BYTES_TO_WORDS_8(32, CD, BF, ED, A1, C1, 9E, 08), BYTES_TO_WORDS_8(89, FF, 07, 3A, 15, 66, AB, 79),
+        BYTES_TO_WORDS_8(05, 01, EA, 65, E0, 1D, 28, FC), BYTES_TO_WORDS_8(C2, 32, 77, 99, 50, 53, BB, 14) },
+      { BYTES_TO_WORDS_8(88, CD, 28, 5B, 0D, 43, 68, C3), BYTES_TO_WORDS_8(9A, BD, A9, 02, 75, 09, 8E, 73),
+        BYTES_TO_WORDS_8(2C, B3, 91, 7F, 62, B5, FE, C2), BYTES_TO_WORDS_8(20, 0B, 37, F3, B4, 69, E2, 60),
+        BYTES_TO_WORDS_8(6C, 06, E2, 2B, A4, A8, 9B, E2), BYTES_TO_WORDS_8(B0, 46, C8, C6, 38, 61, 45, 02),
+        BYTES_TO_WORDS_8(76, DF, 28, 97, 88, 11, 92, 60), BYTES_TO_WORDS_8(A9, F0, 79, 65, 5A, 17, 00, FE) },
+      { BYTES_TO_WORDS_8(7A, AE, 3F, F4, 8F, 4E, E0, 0D), BYTES_TO_WORDS_8(B8, 13, 38, 5C, 46, 4F, D7, 06),
+        BYTES_TO_WORDS_8(CA, 8A, 3E, D1, AC, 37, E0, 01), BYTES_TO_WORDS_8(56, AD, 24, 8C, 8B, 93, 09, 22),
+        BYTES_TO_WORDS_8(06, 23, E5, C7, A1, 6A, 6F, 86), BYTES_TO_WORDS_8(46, D9, AF, 17, AF, E6, B8, 53),
+        BYTES_TO_WORDS_8(8C, 8C, 00, 42, 3A, 2F, 00, 28), BYTES_TO_WORDS_8(A5, 55, 2B, B3, 87, E0, F8, 9B) },
+      { BYTES_TO_WORDS_8(94, C5, 1C, 86, 32, 19, 3B, 15), BYTES_TO_WORDS_8(6B, 53, D0, 04, 17, DD, 4B, 96),
+        BYTES_TO_WORDS_8(55, 68, B4, FC, 05, BA, A5, 0A), BYTES_TO_WORDS_8(49, 99, 73, E6, A1, 97, 92, 79),
+        BYTES_TO_WORDS_8(9E, 30, 8D, 0F, 92, 10, 91, 9E), BYTES_TO_WORDS_8(90, 6E, AC, 0B, AE, 86, DA, 27),
+        BYTES_TO_WORDS_8(01, E5, 9F, 78, 18, 91, 06, E1), BYTES_TO_WORDS_8(B0, C9, 23, D5, 8C, F1, 2F, 13) },
+      { BYTES_TO_WORDS_8(55, C5, 9F, 01, E9, D6, D6, 53), BYTES_TO_WORDS_8(D8, 1B, B5, EE, 91, 95, F6, 08),
+        BYTES_TO_WORDS_8(29, A8, 3D, AD, F6, 70, 94, B7), BYTES_TO_WORDS_8(A1, 01, 9C, D0, 0C, 41, E2, A0),
+        BYTES_TO_WORDS_8(8D, 6D, AC, C1, 18, 08, 34, CF), BYTES_TO_WORDS_8(30, 79, 66, 6B, 9F, F1, BA, 8B),
+        BYTES_TO_WORDS_8(89, FE, B2, A5, 7B, B5, C3, 2A), BYTES_TO_WORDS_8(D4, DE, BF, 71, 8C, 64, 29, 1E) } },
+    /* (1..8) * 16^22 * G */
+    { { BYTES_TO_WORDS_8(50, 2E, 85, C5, 4C, B2, D0, C7), BYTES_TO_WORDS_8(C5, 0C, 57, CF, 63, 7E, 2C, 8B),
+        BYTES_TO_WORDS_8(FF, 7E, EE, 49, 23, AA, F9, C1), BYTES_TO_WORDS_8(58, B0, AB, FE, DF, C7, 86, E4),
+        BYTES_TO_WORDS_8(7D, 10, CF, AE, AD, 3C, BA, 66), BYTES_TO_WORDS_8(D8, EB, 92, 33, D6, 63, 44, 69),
+        BYTES_TO_WORDS_8(5A, E0, 51, 9F, 5C, 8A, E8, 9E), BYTES_TO_WORDS_8(2E, A1, 06, 56, ED, 75, FD, 51) },
+      { BYTES_TO_WORDS_8(20, 2E, 69, 78, A3, 2C, 50, 74), BYTES_TO_WORDS_8(EA, D0, 39, C3, 86, 9E, AD, 63),
+        BYTES_TO_WORDS_8(E9, 76, 62, 90, 41, 14, FF, 21), BYTES_TO_WORDS_8(88, CB, 5F, 5A, 24, 6E, A1, 69),
+        BYTES_TO_WORDS_8(8F, 6C, 11, B3, A9, 69, 6E, 99), BYTES_TO_WORDS_8(94, A8, 7D, 0F, 62, 28, 3D, 11),
+        BYTES_TO_WORDS_8(10, BA, DD, 4C, 9A, 1E, F0, 06), BYTES_TO_WORDS_8(01, FC, 1A, 89, CD, 68, C9, A7) },
+      { BYTES_TO_WORDS_8(07, 19, 88, 5C, 45, A6, 6A, C6), BYTES_TO_WORDS_8(DA, B1, 00, 5B, 73, 86, 2C, 14),
+        BYTES_TO_WORDS_8(15, 04, AE, 66, CC, 05, 41, 96), BYTES_TO_WORDS_8(7C, FB, 2F, 8E, BB, 44, CF, 4A),
+        BYTES_TO_WORDS_8(FC, DA, 3C, F6, 56, B4, 26, 29), BYTES_TO_WORDS_8(25, 4B, D8, 7C, 2F, 2B, 35, 99),
+        BYTES_TO_WORDS_8(57, 54, 0A, D1, 5A, 28, 44, 35), BYTES_TO_WORDS_8(7B, 58, FD, 0F, FE, A8, 99, AD) },
+      { BYTES_TO_WORDS_8(71, 8D, BC, 06, 97, E7, BD, 47), BYTES_TO_WORDS_8(17, 0D, 9B, C7, 5B, F9, 39, 7A),
+        BYTES_TO_WORDS_8(5A, 74, 0E, FA, 12, 0E, 19, 21), BYTES_TO_WORDS_8(C7, B2, EF, 7E, 2A, 8B, AD, DC),
+        BYTES_TO_WORDS_8(F2, FC, 97, A2, 2E, FE, 0C, 47), BYTES_TO_WORDS_8(56, 7B, 71, 7B, 07, C4, 26, 27),
+        BYTES_TO_WORDS_8(A3, 0F, 7C, E0, 3C, 99, 11, 22), BYTES_TO_WORDS_8(9B, AF, 1F, B9, 7A, 28, F1, 8B) },
+      { BYTES_TO_WORDS_8(3F, 38, 39, 74, 69, E0, BA, 82), BYTES_TO_WORDS_8(AA, A2, 01, B6, 62, A5, FF, 34),
+        BYTES_TO_WORDS_8(EC, 4E, 23, C8, 92, A2, 7A, DD), BYTES_TO_WORDS_8(49, A6, 88, 41, 83, 22, DF, 4D),
+        BYTES_TO_WORDS_8(37, 23, D5, 23, 18, A8, 2F, 63), BYTES_TO_WORDS_8(69, 82, 1F, 13, 45, D0, D5, 3D),
+        BYTES_TO_WORDS_8(6B, 0C, 8C, D3, 97, AE, AB, 74), BYTES_TO_WORDS_8(3D, 88, 91, 0D, 7B, 62, 1C, E7) },
+      { BYTES_TO_WORDS_8(B0, 5D, F1, 0E, A3, 16, 6B, 1F), BYTES_TO_WORDS_8(F8, 29, C8, 01, D6, 1A, 4C, EF),
+        BYTES_TO_WORDS_8(59, BA, 2E, 88, 31, 83, F7, F3), BYTES_TO_WORDS_8(21, EB, 31, 17, 0A, 84, BE, 89),
+        BYTES_TO_WORDS_8(00, 82, 0B, 1D, C7, 68, 1D, 79), BYTES_TO_WORDS_8(1F, A8, 29, CA, 77, DF, B9, 53),
+        BYTES_TO_WORDS_8(6C, 01, E9, 75, 46, 64, C5, F4), BYTES_TO_WORDS_8(16, 28, B3, 3C, 19, 8C, EC, 70) },
+      { BYTES_TO_WORDS_8(F4, B4, 22, 58, 15, 88, DC, 26), BYTES_TO_WORDS_8(8F, DF, 65, F8, FC, 3A, 35, A5),
+        BYTES_TO_WORDS_8(9B, F3, 7B, 79, E0, E9, 34, 13), BYTES_TO_WORDS_8(9E, 87, 79, 13, 79, 65, B0, 58),
+        BYTES_TO_WORDS_8(CA, FB, 60, 0C, 21, A8, 07, 66), BYTES_TO_WORDS_8(59, 52, 4E, FC, 76, A0, A4, 1C),
+        BYTES_TO_WORDS_8(6C, 83, 62, 02, 5F, A5, 7C, 02), BYTES_TO_WORDS_8(37, 2C, 5A, 14, A4, 8A, A9, 55) },
+      { BYTES_TO_WORDS_8(56, AD, 99, AA, 29, 36, 27, D7), BYTES_TO_WORDS_8(87, 2F, 0E, AD, 5A, A5, FE, 13),
+        BYTES_TO_WORDS_8(C4, 57, 8C, 22, 48, 98, CA, 4D), BYTES_TO_WORDS_8(C5, 8B, 31, 1D, 77, B3, F8, D9),
+        BYTES_TO_WORDS_8(B9, 61, 5C, 5F, 38, 19, E9, D4), BYTES_TO_WORDS_8(B4, 3C, F6, 31, 9A, E5, 5D, 99),
+        BYTES_TO_WORDS_8(A3, A4, 70, FB, 57, 15, 55, C6), BYTES_TO_WORDS_8(77, 23, D2, F0, 41, D6, AA, 07) } },
+    /* (1..8) * 16^23 * G */
+    { { BYTES_TO_WORDS_8(78, 91, 51, 2B, EC, B8, B6, 84), BYTES_TO_WORDS_8(C5, 1F, 3D, A4, 98, 99, 3B, B6),
+        BYTES_TO_WORDS_8(0A, EE, E2, B5, F8, 8C, E0, CF), BYTES_TO_WORDS_8(30, 04, E5, B5, 4B, 7F, 1D, F4),
+        BYTES_TO_WORDS_8(51, 35, 6A, CA, 5D, 66, A1, A7), BYTES_TO_WORDS_8(F9, E1, 19, 69, C3, AC, 49, AB),
+        BYTES_TO_WORDS_8(47, 23, A8, FA, E3, 6D, 04, F1), BYTES_TO_WORDS_8(D6, F8, 9A, BD, BE, 69, A6, E6) },
+      { BYTES_TO_WORDS_8(4B, 9B, 08, 8F, 10, 7E, 93, 2A), BYTES_TO_WORDS_8(3D, 6F, 61, D6, 1B, E9, 80, 0D),
+        BYTES_TO_WORDS_8(45, EC, 81, 38, DA, C3, 5B, F8), BYTES_TO_WORDS_8(91, D5, DD, 19, FF, 69, 23, 3B),
+        BYTES_TO_WORDS_8(4F, 0F, F0, 67, 6F, 55, 65, F0), BYTES_TO_WORDS_8(C1, E7, 23, 27, B0, E7, 70, 39),
+        BYTES_TO_WORDS_8(76, 78, 7D, D2, 3D, 21, 22, 2D), BYTES_TO_WORDS_8(2C, 76, 9A, B2, EC, 02, F1, 5D) },
+      { BYTES_TO_WORDS_8(D9, 01, 35, 1E, 3E, 31, 71, 1A), BYTES_TO_WORDS_8(8B, FC, 61, BB, E1, 2C, E8, 1B),
+        BYTES_TO_WORDS_8(61, 3E, 2D, D6, 91, D6, 32, 33), BYTES_TO_WORDS_8(7F, 4E, 2D, D6, 7E, 82, 5F, D6),
+        BYTES_TO_WORDS_8(9E, 75, 55, EB, C6, 46, 94, AB), BYTES_TO_WORDS_8(E1, 0B, 73, 5D, AD, 3A, C1, 61),
+        BYTES_TO_WORDS_8(FC, 87, 6B, 16, A5, 7C, 7B, 53), BYTES_TO_WORDS_8(FE, 90, 9A, F0, FC, 60, 4B, F2) },
+      { BYTES_TO_WORDS_8(A1, 2A, 35, B8, C7, 0B, 18, BB), BYTES_TO_WORDS_8(20, 10, 9C, 99, 6E, D0, 7C, 99),
+        BYTES_TO_WORDS_8(8F, FF, 9B, 24, 93, 10, 66, C7), BYTES_TO_WORDS_8(06, B4, 55, 04, F0, EE, A3, EC),
+        BYTES_TO_WORDS_8(A3, 2E, C1, EC, 39, AD, F3, 85), BYTES_TO_WORDS_8(23, ED, 78, 9B, 39, 9B, 35, A8),
+        BYTES_TO_WORDS_8(07, 90, A7, 7C, F3, 63, B8, F6), BYTES_TO_WORDS_8(B8, 25, 8C, E7, 81, C2, 6B, 9E) },
+      { BYTES_TO_WORDS_8(4E, D8, 2E, 0F, 24, FE, 62, CB), BYTES_TO_WORDS_8(12, EA, E2, 5F, F3, 4D, 99, E7),
+        BYTES_TO_WORDS_8(AD, C0, 2C, 78, B5, C8, E6, 5E), BYTES_TO_WORDS_8(38, 5C, B0, DE, B6, B5, A9, 55),
+        BYTES_TO_WORDS_8(A3, 95, 64, 54, 50, C5, 9D, 57), BYTES_TO_WORDS_8(F0, D8, A0, 12, D7, B4, FF, E8),
+        BYTES_TO_WORDS_8(3A, F4, D7, 0E, 19, 4D, 17, 29), BYTES_TO_WORDS_8(AB, 19, 9F, AC, 96, 21, F2, C4) },
+      { BYTES_TO_WORDS_8(D4, 47, 4C, 5E, 6B, D2, D4, D6), BYTES_TO_WORDS_8(7E, 5C, 61, A7, 39, 88, 0E, C2),
+        BYTES_TO_WORDS_8(A1, 1C, E5, A5, 14, 5A, BB, 41), BYTES_TO_WORDS_8(CF, F8, 9E, E6, EB, 86, 13, F9),
+        BYTES_TO_WORDS_8(72, DD, 9C, 0E, 49, 8A, D1, 37), BYTES_TO_WORDS_8(3F, 3B, B7, 59, 05, 12, 8E, 5B),
+        BYTES_TO_WORDS_8(C4, F9, 49, 48, DD, 08, 6F, 60), BYTES_TO_WORDS_8(26, 3B, ED, 6F, 31, 74, 35, F4) },
+      { BYTES_TO_WORDS_8(A2, 95, 54, 07, 87, CF, D2, 9B), BYTES_TO_WORDS_8(B2, 00, BC, 48, B6, 1E, DE, 9F),
+        BYTES_TO_WORDS_8(C4, 8B, 54, 62, 0A, D6, 7E, 1F), BYTES_TO_WORDS_8(DA, 71, DB, C7, 6D, 57, DE, 79),
+        BYTES_TO_WORDS_8(B8, 6F, EC, AA, 6A, 8C, 2C, 80), BYTES_TO_WORDS_8(46, A7, 93, 64, 09, F5, 14, 83),
+        BYTES_TO_WORDS_8(C6, 79, DC, 47, AE, 6D, 5E, 78), BYTES_TO_WORDS_8(02, 6A, 18, 6B, 0E, 3D, 2D, 3B) },
+      { BYTES_TO_WORDS_8(3F, D0, 93, 1A, B6, A8, 94, FD), BYTES_TO_WORDS_8(7B, AD, 0D, 1B, CE, 41, 8F, 46),
+        BYTES_TO_WORDS_8(98, EA, 45, FB, B7, 14, A2, CB), BYTES_TO_WORDS_8(FF, DA, B7, 44, 9D, 69, 97, 5C),
+        BYTES_TO_WORDS_8(A7, 2B, 6F, 0E, A9, 9C, 49, 67), BYTES_TO_WORDS_8(59, 61, 53, 74, 32, 0F, 68, 20),
+        BYTES_TO_WORDS_8(EC, F2, 28, CA, A6, F9, 8F, 23), BYTES_TO_WORDS_8(B1, 0F, CB, A4, 53, A3, 37, 47) } },
+    /* (1..8) * 16^24 * G */
+    { { BYTES_TO_WORDS_8(8E, 21, 12, 75, 39, A9, 4A, A8), BYTES_TO_WORDS_8(41, 01, CA, 74, B0, 21, A5, E9),
+        BYTES_TO_WORDS_8(02, E9, A2, 18, 3A, 0B, 88, 57), BYTES_TO_WORDS_8(A6, 77, A6, 12, 66, 50, 5B, 4A),
+        BYTES_TO_WORDS_8(40, 38, 4F, 4C, 7A, DA, EA, 0B), BYTES_TO_WORDS_8(9D, 6D, E2, 19, 54, B1, 6D, 62),
+        BYTES_TO_WORDS_8(40, 7D, 62, E1, FB, 04, 26, C4), BYTES_TO_WORDS_8(F1, 89, C0, EA, 1C, 46, 13, EB) },
+      { BYTES_TO_WORDS_8(42, 58, 8D, BF, CC, ED, 68, 1B), BYTES_TO_WORDS_8(7C, B6, 55, 84, 4D, BE, 74, DA),
+        BYTES_TO_WORDS_8(C5, 37, B3, 3E, 14, 73, 14, 52), BYTES_TO_WORDS_8(43, F5, DA, CC, EC, E9, 8F, CC),
+        BYTES_TO_WORDS_8(C7, 00, 71, 48, C9, 1A, 7E, 56), BYTES_TO_WORDS_8(C8, 77, 86, 45, 2D, 59, F1, 5D),
+        BYTES_TO_WORDS_8(77, FB, 91, 0B, 14, C6, CE, 75), BYTES_TO_WORDS_8(3F, FC, F2, D9, 1C, D0, A5, C2) },
+      { BYTES_TO_WORDS_8(FD, 73, 84, 51, E2, 40, EF, 52), BYTES_TO_WORDS_8(91, 33, 97, C6, 6B, 02, B9, BB),
+        BYTES_TO_WORDS_8(E3, A9, 28, 97, B9, 2A, 29, 85), BYTES_TO_WORDS_8(A0, 8B, 31, 33, 32, 06, 64, 10),
+        BYTES_TO_WORDS_8(05, F8, 5C, 78, 2E, 16, A6, AF), BYTES_TO_WORDS_8(39, D0, 21, 0C, 0D, 19, BE, CF),
+        BYTES_TO_WORDS_8(3C, 88, 85, 65, 9E, 82, E7, C8), BYTES_TO_WORDS_8(D8, A2, 8B, 3B, 82, 32, 68, 9C) },
+      { BYTES_TO_WORDS_8(54, DA, 37, 0C, BE, 89, F3, 23), BYTES_TO_WORDS_8(DE, 84, 11, BC, 6C, B9, B0, 71),
+        BYTES_TO_WORDS_8(61, 62, E8, 37, 0F, B5, 06, 80), BYTES_TO_WORDS_8(CE, D8, 23, 08, 39, 81, C8, 11),
+        BYTES_TO_WORDS_8(F5, 3D, EE, 08, 14, 65, 7C, 56), BYTES_TO_WORDS_8(DF, 2A, 4D, 38, 21, 2B, E3, B3),
+        BYTES_TO_WORDS_8(E4, 1A, F6, CA, 13, AF, 2A, A4), BYTES_TO_WORDS_8(A3, BD, 26, 67, 51, CA, F5, 82) },
+      { BYTES_TO_WORDS_8(F3, 30, 3F, 65, C8, EE, 67, 35), BYTES_TO_WORDS_8(DD, 38, A2, ED, D2, 3E, 42, 2B),
+        BYTES_TO_WORDS_8(21, 3F, 08, 54, 0D, 41, DA, 5E), BYTES_TO_WORDS_8(BF, 27, 5F, F0, 8F, AD, C8, 38),
+        BYTES_TO_WORDS_8(7B, 21, E9, EB, 49, E7, 60, A0), BYTES_TO_WORDS_8(37, DF, 59, 29, 98, FA, 83, 65),
+        BYTES_TO_WORDS_8(1F, 64, BD, DD, 54, 96, 90, F3), BYTES_TO_WORDS_8(16, B1, DC, 76, 78, 61, C2, 83) },
+      { BYTES_TO_WORDS_8(CC, 46, 70, FD, 34, 6E, B6, 62), BYTES_TO_WORDS_8(77, 8D, 2D, E3, B6, 98, 03, 28),
+        BYTES_TO_WORDS_8(51, 5E, 0F, 93, 2E, D1, A5, 23), BYTES_TO_WORDS_8(6C, 87, 5A, 50, 12, 9C, 78, 3F),
+        BYTES_TO_WORDS_8(4D, 3E, 68, 90, 65, 85, 87, 14), BYTES_TO_WORDS_8(D6, 3F, 0B, 8E, 84, DE, 20, 63),
+        BYTES_TO_WORDS_8(A2, 47, 4E, 96, DD, 74, C9, 64), BYTES_TO_WORDS_8(E5, A6, 91, A2, B3, F1, D9, D0) },
+      { BYTES_TO_WORDS_8(84, 15, EF, B6, 11, 69, 3E, 54), BYTES_TO_WORDS_8(BF, 0C, 92, 8F, A3, A2, A9, 77),
+        BYTES_TO_WORDS_8(42, 18, 35, FD, E3, FB, 58, 58), BYTES_TO_WORDS_8(09, BB, 60, E8, BC, 8C, CB, 6F),
+        BYTES_TO_WORDS_8(F2, 10, 31, 1D, C2, F7, C9, C3), BYTES_TO_WORDS_8(25, 43, 8A, 92, D6, F6, 92, 59),
+        BYTES_TO_WORDS_8(9D, 45, 30, AC, 23, 08, 4C, D5), BYTES_TO_WORDS_8(76, 1D, 72, 8B, 3D, A8, F1, A8) },
+      { BYTES_TO_WORDS_8(73, 8F, 69, FD, A1, 95, 5C, 35), BYTES_TO_WORDS_8(EA, 98, 5C, 2A, A7, B3, 4C, CB),
+        BYTES_TO_WORDS_8(71, 8D, 8B, FC, E7, 37, 6E, 67), BYTES_TO_WORDS_8(80, 26, A3, 52, FA, 4E, 7A, 9C),
+        BYTES_TO_WORDS_8(42, F1, 0C, 12, BD, 43, 24, 12), BYTES_TO_WORDS_8(7C, 9E, 87, EA, D5, 7C, B0, 94),
+        BYTES_TO_WORDS_8(9B, E6, AD, D0, C1, 24, C4, 16), BYTES_TO_WORDS_8(7B, 0C, 15, B2, 1A, A7, C4, A2) } },
+    /* (1..8) * 16^25 * G */
+    { { BYTES_TO_WORDS_8(F0, 2D, 8E, 00, 37, D8, 28, 66), BYTES_TO_WORDS_8(F7, E5, 28, 43, 57, B2, C3, 32),
+        BYTES_TO_WORDS_8(50, 0F, BE, 8B, DF, 29, 2C, 01), BYTES_TO_WORDS_8(95, B9, 2A, DE, 0B, 91, B3, 2E),
+        BYTES_TO_WORDS_8(AE, EA, 74, D2, 4E, CC, 10, 09), BYTES_TO_WORDS_8(49, 5F, F6, EC, 20, D1, 40, 95),
+        BYTES_TO_WORDS_8(9F, 99, A4, 8D, 34, 7D, D3, 77), BYTES_TO_WORDS_8(3A, 4B, 47, 37, 23, C0, 29, 3F) },
+      { BYTES_TO_WORDS_8(8E, 42, DC, A1, AC, D9, 39, FE), BYTES_TO_WORDS_8(B1, 5D, 52, 90, 96, 71, EC, 10),
+        BYTES_TO_WORDS_8(26, 48, F0, F8, BD, F5, A2, FB), BYTES_TO_WORDS_8(C2, 65, C9, 25, 1A, 85, 2E, D3),
+        BYTES_TO_WORDS_8(58, E1, CF, 01, B5, D5, 51, B5), BYTES_TO_WORDS_8(68, F7, 94, 46, 90, 8D, F5, 31),
+        BYTES_TO_WORDS_8(40, 83, 8A, A9, 22, 6D, CC, 45), BYTES_TO_WORDS_8(4E, D6, C5, FC, A1, 05, EC, 6B) },
+      { BYTES_TO_WORDS_8(F0, 67, 28, 68, 4B, B8, 02, BF), BYTES_TO_WORDS_8(39, 0A, 19, 1B, E2, 26, 14, A2),
+        BYTES_TO_WORDS_8(F0, 00, 09, 78, 6A, D1, AB, 2A), BYTES_TO_WORDS_8(E2, 7C, 4C, E6, 88, DB, E9, F6),
+        BYTES_TO_WORDS_8(EA, 61, 18, 0F, F1, 3A, 5B, 47), BYTES_TO_WORDS_8(23, B6, 70, F9, A5, 1B, 04, 27),
+        BYTES_TO_WORDS_8(B1, D5, C0, E8, 76, 3B, D9, 81), BYTES_TO_WORDS_8(74, AB, D2, 7A, 0B, 79, CA, 53) },
+      { BYTES_TO_WORDS_8(2D, 66, 2F, E4, E6, 28, FC, 71), BYTES_TO_WORDS_8(BF, 0D, 80, 79, 27, 31, 81, C6),
+        BYTES_TO_WORDS_8(31, 03, 9C, 44, 46, 07, 4D, F5), BYTES_TO_WORDS_8(F4, CF, D2, 2E, 1C, 04, 44, E6),
+        BYTES_TO_WORDS_8(91, D5, E6, 66, 1D, C1, 11, 67), BYTES_TO_WORDS_8(C0, D7, 7F, 91, 8F, 67, E1, 52),
+        BYTES_TO_WORDS_8(D0, B4, C7, 00, 0D, 05, A0, 4B), BYTES_TO_WORDS_8(CF, 5A, 66, DE, B9, FF, 79, BC) },
+      { BYTES_TO_WORDS_8(02, 61, 0D, F2, 38, 04, DD, 9A), BYTES_TO_WORDS_8(40, 39, 45, A3, 78, 53, 6D, F0),
+        BYTES_TO_WORDS_8(5E, 9A, 19, B6, B9, 15, 5C, 78), BYTES_TO_WORDS_8(9D, 44, 0E, 76, 38, DB, 1D, FD),
+        BYTES_TO_WORDS_8(7C, 3B, 00, AE, 91, 64, 0A, DA), BYTES_TO_WORDS_8(83, 39, 51, 11, 12, 19, 3E, 16),
+        BYTES_TO_WORDS_8(00, B7, 83, 78, 1F, 1F, AA, ED), BYTES_TO_WORDS_8(8A, 63, 50, 90, 73, B8, 54, CB) },
+      { BYTES_TO_WORDS_8(E2, 1A, 80, 7E, 9F, 1D, 62, 60), BYTES_TO_WORDS_8(C6, 74, 67, FA, CF, 25, B8, 77),
+        BYTES_TO_WORDS_8(8D, F1, 58, 50, DA, 19, 47, 97), BYTES_TO_WORDS_8(C6, 5A, C1, 42, B9, B0, 14, BB),
+        BYTES_TO_WORDS_8(F1, C5, 1D, 5C, 1E, E5, 0D, 8B), BYTES_TO_WORDS_8(43, 61, 85, 66, BB, 4F, 5E, 79),
+        BYTES_TO_WORDS_8(DE, C7, BA, 36, E6, 3C, 48, 87), BYTES_TO_WORDS_8(74, A6, 13, 45, 7F, 96, AE, 96) },
+      { BYTES_TO_WORDS_8(B7, 7C, C7, C2, 1D, 34, F7, F3), BYTES_TO_WORDS_8(B6, 15, DC, 02, 09, 94, 6D, EF),
+        BYTES_TO_WORDS_8(8F, 69, EE, 65, 3E, A7, E4, 9F), BYTES_TO_WORDS_8(1D, 90, 99, 25, C2, 73, A2, 61),
+        BYTES_TO_WORDS_8(ED, 25, DB, 1D, F8, 11, 46, 85), BYTES_TO_WORDS_8(74, 1F, AE, 70, 9A, AD, C5, C5),
+        BYTES_TO_WORDS_8(C9, 0C, EB, 5E, 9F, 21, EA, F4), BYTES_TO_WORDS_8(D3, D3, 3A, 4D, 33, CD, BA, 5B) },
+      { BYTES_TO_WORDS_8(65, 4C, 31, B7, 72, 08, 03, DD), BYTES_TO_WORDS_8(AD, 6A, 6E, 6F, FB, 7D, 28, 4C),
+        BYTES_TO_WORDS_8(4B, 06, A6, 2C, 27, 52, 9F, B5), BYTES_TO_WORDS_8(15, 53, CB, 11, F3, C3, 26, A6),
+        BYTES_TO_WORDS_8(19, 19, 3F, A6, B5, 7D, 60, B6), BYTES_TO_WORDS_8(3A, 52, 35, 80, D6, 5B, 36, EE),
+        BYTES_TO_WORDS_8(24, C6, EF, E9, 81, B7, 49, D9), BYTES_TO_WORDS_8(4C, C0, 0E, 99, 6B, 2A, 88, BB) } },
+    /* (1..8) * 16^26 * G */
+    { { BYTES_TO_WORDS_8(E0, A7, CC, 3E, EA, A5, 39, C7), BYTES_TO_WORDS_8(3E, 33, 43, 67, 8F, C9, D2, A7),
+        BYTES_TO_WORDS_8(28, 94, 4D, 22, 35, 63, EF, 0F), BYTES_TO_WORDS_8(0C, 2A, 79, 5C, 3C, EE, F2, 7E),
+        BYTES_TO_WORDS_8(94, C0, 2A, 55, DD, 22, 2B, 30), BYTES_TO_WORDS_8(20, 3D, BD, DF, 50, 14, B2, 81),
+        BYTES_TO_WORDS_8(DB, 09, E6, D5, 51, 7F, F6, A4), BYTES_TO_WORDS_8(11, C0, AC, 30, 27, 86, B6, AF) },
+      { BYTES_TO_WORDS_8(0F, 6D, 89, AB, 92, 2C, B0, 6D), BYTES_TO_WORDS_8(3C, 22, 09, 0C, E5, 0B, 88, 5E),
+        BYTES_TO_WORDS_8(6B, C7, 86, 69, EF, 9D, 53, 93), BYTES_TO_WORDS_8(B1, 8D, E6, 86, 24, 47, 46, 06),
+        BYTES_TO_WORDS_8(EA, 28, F5, A4, 08, 45, D7, 90), BYTES_TO_WORDS_8(90, 4F, 3B, C6, 5D, 89, 1B, DB),
+        BYTES_TO_WORDS_8(FE, 7C, 04, F9, CE, F5, B3, F2), BYTES_TO_WORDS_8(BB, 63, 70, FE, 22, EE, F4, F1) },
+      { BYTES_TO_WORDS_8(FA, 0F, 3F, A3, 3D, 58, F3, 72), BYTES_TO_WORDS_8(41, 7A, 80, 11, C6, CA, E4, CA),
+        BYTES_TO_WORDS_8(41, C6, D9, C9, 76, A5, 24, 76), BYTES_TO_WORDS_8(CD, 7A, 88, 16, 27, 57, 04, 37),
+        BYTES_TO_WORDS_8(AC, 35, FA, 60, C6, 3F, ED, 5F), BYTES_TO_WORDS_8(FC, F2, 8B, AA, B7, 3E, BA, 57),
+        BYTES_TO_WORDS_8(4C, FF, 95, 88, BB, B4, 1B, 84), BYTES_TO_WORDS_8(4F, E7, 71, 1A, C6, 08, 64, 5C) },
+      { BYTES_TO_WORDS_8(5E, 82, D5, A8, 4D, 58, 9C, 69), BYTES_TO_WORDS_8(0B, 57, 4D, 38, 7E, 46, EB, 7B),
+        BYTES_TO_WORDS_8(D1, 3F, F0, 4F, 54, 13, A7, 2E), BYTES_TO_WORDS_8(71, FC, 92, 52, F1, E1, 42, 0D),
+        BYTES_TO_WORDS_8(B3, 46, 89, 7A, 97, 08, 18, ED), BYTES_TO_WORDS_8(CB, 40, 43, 4B, EC, B2, 4C, 0C),
+        BYTES_TO_WORDS_8(7E, CA, 85, 5A, A5, 17, 1F, 2C), BYTES_TO_WORDS_8(CB, 9A, F6, 21, 0A, 2B, DA, AD) },
+      { BYTES_TO_WORDS_8(13, 35, 60, 32, 65, 98, 6F, 3C), BYTES_TO_WORDS_8(95, 00, 4A, 81, C6, 4D, C6, F6),
+        BYTES_TO_WORDS_8(97, B6, 8B, C0, 42, AA, 1E, 2D), BYTES_TO_WORDS_8(72, DB, 98, 42, E5, 79, A9, C2),
+        BYTES_TO_WORDS_8(B9, 05, 35, 3C, 2C, 5B, 75, 95), BYTES_TO_WORDS_8(49, 14, 15, 48, DF, 66, C6, 8C),
+        BYTES_TO_WORDS_8(7E, CE, 5B, 93, 81, 80, 27, 54), BYTES_TO_WORDS_8(C8, B5, 6E, 1E, 4A, D7, 9D, EF) },
+      { BYTES_TO_WORDS_8(95, 72, FC, 15, F3, DB, B7, DF), BYTES_TO_WORDS_8(6F, 78, CF, 49, 95, AD, 07, 43),
+        BYTES_TO_WORDS_8(87, D6, 15, F1, E1, 8B, B4, 3F), BYTES_TO_WORDS_8(3A, 69, 03, D6, D7, EC, 67, AE),
+        BYTES_TO_WORDS_8(62, 5B, 4F, FA, 5E, 9C, FF, 04), BYTES_TO_WORDS_8(34, EE, 2A, 2C, 72, 19, 30, FC),
+        BYTES_TO_WORDS_8(C1, D9, 82, 4A, B8, 94, 2B, 07), BYTES_TO_WORDS_8(D2, A6, FA, A5, AE, D2, 3C, D2) },
+      { BYTES_TO_WORDS_8(3E, EE, FD, D9, B1, FF, 46, E6), BYTES_TO_WORDS_8(01, 2E, 30, 6C, 71, 97, 1F, 68),
+        BYTES_TO_WORDS_8(B9, AF, 17, DB, 5C, B1, 2B, 17), BYTES_TO_WORDS_8(E1, 59, FC, B1, 6A, 18, F4, C9),
+        BYTES_TO_WORDS_8(E7, 22, ED, CC, C5, 6C, E6, 51), BYTES_TO_WORDS_8(4F, DF, 58, 7B, 1C, 53, E1, 44),
+        BYTES_TO_WORDS_8(43, 21, 83, B8, 42, 31, F7, 0D), BYTES_TO_WORDS_8(41, A3, B3, 3C, 7F, 0A, 42, 09) },
+      { BYTES_TO_WORDS_8(B2, 80, D7, 9A, 46, 8A, C1, F9), BYTES_TO_WORDS_8(E7, 40, 84, F6, A6, 0D, 3B, 8C),
+        BYTES_TO_WORDS_8(51, E7, 9A, 8F, C2, D0, 19, 0E), BYTES_TO_WORDS_8(B2, 7D, 5C, 94, 9E, 4D, DC, 44),
+        BYTES_TO_WORDS_8(1E, B1, 93, AB, 13, 74, 43, 91), BYTES_TO_WORDS_8(9D, C3, CE, C2, E1, 75, 77, B4),
+        BYTES_TO_WORDS_8(95, 5F, 3F, 68, DC, 19, FD, F8), BYTES_TO_WORDS_8(C9, F9, C2, 45, 87, 91, EB, DB) } },
+    /* (1..8) * 16^27 * G */
+    { { BYTES_TO_WORDS_8(53, E8, 49, EC, 90, F0, 01, 67), BYTES_TO_WORDS_8(4A, E0, 75, 99, 52, 53, CB, A9),
+        BYTES_TO_WORDS_8(7A, A7, 5F, EB, 54, 25, 80, 57), BYTES_TO_WORDS_8(EB, 0A, 64, 21, 64, 41, 51, 0E),
+        BYTES_TO_WORDS_8(B2, 5C, 40, 76, 13, 3D, 6E, 33), BYTES_TO_WORDS_8(36, EE, C9, 90, 41, 39, 68, F5),
+        BYTES_TO_WORDS_8(0D, 03, 91, 3A, A5, B4, 8E, 27), BYTES_TO_WORDS_8(69, 54, 90, 65, EA, 1C, 33, CF) },
+      { BYTES_TO_WORDS_8(65, AA, B7, 5A, DB, BA, 7F, BF), BYTES_TO_WORDS_8(A2, F1, 10, 27, 0A, 7E, E1, 43),
+        BYTES_TO_WORDS_8(D5, 63, B5, 8D, 0F, 64, D8, 83), BYTES_TO_WORDS_8(42, 31, 76, EF, B3, D0, 25, 85),
+        BYTES_TO_WORDS_8(8C, 64, E8, DD, 0F, 83, BE, F9), BYTES_TO_WORDS_8(2A, 09, 3F, 92, C1, CC, DF, D0),
+        BYTES_TO_WORDS_8(76, 69, 67, 1E, 1C, 43, CC, 06), BYTES_TO_WORDS_8(D6, 1F, F9, 11, E1, A7, 63, 0E) },
+      { BYTES_TO_WORDS_8(AD, AF, C6, 1D, 1C, 3F, A2, C4), BYTES_TO_WORDS_8(46, 0F, F8, 95, 22, D9, D3, 1B),
+        BYTES_TO_WORDS_8(77, C6, C0, 64, 5F, D2, 8E, DE), BYTES_TO_WORDS_8(25, CF, CA, 65, 67, A0, 7B, 97),
+        BYTES_TO_WORDS_8(09, AA, 7F, 1D, C5, CD, 62, 4D), BYTES_TO_WORDS_8(15, 1A, DA, 1D, 24, A1, 75, 2F),
+        BYTES_TO_WORDS_8(99, D9, 81, D0, A0, FA, 33, 88), BYTES_TO_WORDS_8(A2, 8F, DB, AE, 43, BC, C3, 1B) },
+      { BYTES_TO_WORDS_8(21, 1B, 4C, 04, ED, 16, DD, 29), BYTES_TO_WORDS_8(0F, 18, D8, C3, 93, 28, 43, D8),
+        BYTES_TO_WORDS_8(D4, 22, BC, 65, 76, 7D, 9E, B3), BYTES_TO_WORDS_8(12, 11, 97, 20, B3, 00, 3E, 1B),
+        BYTES_TO_WORDS_8(C7, 94, F5, B7, 14, 40, E2, 8D), BYTES_TO_WORDS_8(E9, A9, B6, F0, A9, 41, FF, 4F),
+        BYTES_TO_WORDS_8(84, 76, DF, C0, D9, 25, 13, F1), BYTES_TO_WORDS_8(D2, E2, F3, FA, 43, 25, 44, 9B) },
+      { BYTES_TO_WORDS_8(3B, 98, 81, DD, D7, 45, F7, 65), BYTES_TO_WORDS_8(78, AB, 8E, 2F, D0, 0F, 22, 10),
+        BYTES_TO_WORDS_8(CC, FA, FF, 71, 07, B6, 3C, 4C), BYTES_TO_WORDS_8(BE, 3A, 12, 2A, 61, 28, C3, 3B),
+        BYTES_TO_WORDS_8(B6, 37, A6, 11, 85, F2, 99, BD), BYTES_TO_WORDS_8(8D, 84, BB, 8F, 5A, 88, 34, 43),
+        BYTES_TO_WORDS_8(7F, 0A, F0, AA, 5C, 30, 0B, 25), BYTES_TO_WORDS_8(20, 8A, 0C, ED, 6D, 82, B5, A6) },
+      { BYTES_TO_WORDS_8(32, BD, 8C, E1, 3A, B4, 30, 4F), BYTES_TO_WORDS_8(29, C7, 05, 95, 91, 53, E4, E5),
+        BYTES_TO_WORDS_8(A1, 79, A3, BF, 4F, 86, 71, 81), BYTES_TO_WORDS_8(22, C6, C0, 87, 9B, 75, A3, 02),
+        BYTES_TO_WORDS_8(C4, 9E, CF, A6, E1, F4, 27, C3), BYTES_TO_WORDS_8(D0, F6, 8D, 7C, 3A, A8, 19, 64),
+        BYTES_TO_WORDS_8(1E, 1E, 1E, 00, 5B, D7, A5, 1E), BYTES_TO_WORDS_8(1F, 21, 9F, 1F, CC, 56, 83, A8) },
+      { BYTES_TO_WORDS_8(7B, 53, C8, F7, 1F, 6C, F7, 75), BYTES_TO_WORDS_8(61, 80, 1F, 44, B7, AC, 8C, CA),
+        BYTES_TO_WORDS_8(21, 6C, F9, CA, E1, EF, BA, 51), BYTES_TO_WORDS_8(AC, 04, EC, E9, E8, A4, CB, 67),
+        BYTES_TO_WORDS_8(DA, 26, 57, 38, 57, 50, EB, 1C), BYTES_TO_WORDS_8(6E, 3F, 40, D0, 3E, 04, DF, 7B),
+        BYTES_TO_WORDS_8(04, CC, B1, 2F, 1F, C6, E1, A1), BYTES_TO_WORDS_8(84, 89, 1C, EA, ED, ED, 65, 5B) },
+      { BYTES_TO_WORDS_8(65, 00, B9, 5A, EE, BB, 28, C8), BYTES_TO_WORDS_8(B7, 75, FA, BB, 75, C4, DD, 26),
+        BYTES_TO_WORDS_8(76, E8, F2, 59, 39, B9, 9D, 89), BYTES_TO_WORDS_8(E4, 48, 2B, 25, F5, 68, 84, 77),
+        BYTES_TO_WORDS_8(F1, 9F, D7, F2, A2, 6A, F7, C8), BYTES_TO_WORDS_8(AF, DA, AC, 00, EF, CA, BB, 27),
+        BYTES_TO_WORDS_8(E9, E2, 01, 7F, 6A, 13, 65, 6F), BYTES_TO_WORDS_8(A0, 9C, B3, 0E, B1, 1A, 34, 43) } },
+    /* (1..8) * 16^28 * G */
+    { { BYTES_TO_WORDS_8(34, B7, F2, E2, F9, 9B, 69, F0), BYTES_TO_WORDS_8(67, D2, 01, 55, 5B, BB, C3, 79),
+        BYTES_TO_WORDS_8(57, 44, 16, F1, 86, A7, 34, 06), BYTES_TO_WORDS_8(9A, C9, EC, 9E, 29, 02, 4A, 22),
+        BYTES_TO_WORDS_8(DF, 7F, EC, 91, 54, 58, 0F, 84), BYTES_TO_WORDS_8(D0, AF, C7, 73, B6, 04, B7, 07),
+        BYTES_TO_WORDS_8(FF, 7F, 1D, 87, AD, 08, 9A, 14), BYTES_TO_WORDS_8(B4, 22, 6D, 9B, D2, A8, 41, FA) },
+      { BYTES_TO_WORDS_8(07, E6, 91, 19, AE, 3D, DF, A8), BYTES_TO_WORDS_8(DE, 11, 6E, 19, 0E, D1, 10, E3),
+        BYTES_TO_WORDS_8(61, 22, 6B, AF, B8, 78, 0F, 76), BYTES_TO_WORDS_8(A1, BD, A5, BE, 35, 5B, D3, AF),
+        BYTES_TO_WORDS_8(6F, 12, 08, 43, BC, 73, 0B, 5E), BYTES_TO_WORDS_8(41, AF, 55, 21, 87, D9, B7, BA),
+        BYTES_TO_WORDS_8(93, EC, 81, 6B, 26, EE, D8, 96), BYTES_TO_WORDS_8(94, E9, 04, E2, 48, 5F, 55, 03) },
+      { BYTES_TO_WORDS_8(33, 40, 25, 5D, 47, 2F, E9, C9), BYTES_TO_WORDS_8(7A, 70, A4, C2, 80, 82, 36, 78),
+        BYTES_TO_WORDS_8(40, F2, B6, 88, A6, DF, DA, FC), BYTES_TO_WORDS_8(59, EC, 3C, 15, EE, 02, 35, E6),
+        BYTES_TO_WORDS_8(3F, 5E, F0, 68, 89, A8, 8A, 7E), BYTES_TO_WORDS_8(60, F3, FC, 4B, 0C, 5A, 91, 2C),
+        BYTES_TO_WORDS_8(48, CE, 09, 07, 0F, E8, 74, AD), BYTES_TO_WORDS_8(11, 1E, 62, 1F, 7B, 83, C5, A7) },
+      { BYTES_TO_WORDS_8(0A, A0, B9, F0, 51, CC, 16, 7E), BYTES_TO_WORDS_8(8F, E6, 93, 2F, A4, 4D, 17, 05),
+        BYTES_TO_WORDS_8(D5, 75, 61, B5, 97, CC, C7, A0), BYTES_TO_WORDS_8(55, 49, EB, 35, 40, AC, CE, E5),
+        BYTES_TO_WORDS_8(57, 4A, 98, 67, 0E, F8, 7F, 15), BYTES_TO_WORDS_8(4F, 79, FE, 86, 75, DB, ED, 8C),
+        BYTES_TO_WORDS_8(E4, D1, 96, 33, 9C, 45, 4A, 85), BYTES_TO_WORDS_8(B9, 56, CD, 1F, 30, B9, 0C, 66) },
+      { BYTES_TO_WORDS_8(33, 8F, E0, E1, AF, 09, 96, 2B), BYTES_TO_WORDS_8(CA, 2C, 98, CB, 1D, 63, FD, B1),
+        BYTES_TO_WORDS_8(E2, 00, F0, 33, C5, 45, AB, 12), BYTES_TO_WORDS_8(87, 96, EB, 72, C2, DE, 48, 56),
+        BYTES_TO_WORDS_8(C9, F1, 69, 42, AC, D9, EE, 26), BYTES_TO_WORDS_8(51, 79, 11, E0, F2, BB, 72, 3E),
+        BYTES_TO_WORDS_8(69, A2, 77, 4D, C6, F5, 78, F4), BYTES_TO_WORDS_8(43, 70, 8F, 70, 70, DC, FD, 95) },
+      { BYTES_TO_WORDS_8(46, C5, A5, E8, 55, 34, AA, 8D), BYTES_TO_WORDS_8(91, 7B, 18, A3, 8B, A6, 0E, 1F),
+        BYTES_TO_WORDS_8(93, D6, 68, 52, 6D, 4B, 77, 3E), BYTES_TO_WORDS_8(7B, 66, C5, AF, 38, C5, 43, A6),
+        BYTES_TO_WORDS_8(57, F8, FF, D3, 7C, 33, 1E, EB), BYTES_TO_WORDS_8(7B, 4A, C6, 0D, 48, DB, 93, 48),
+        BYTES_TO_WORDS_8(19, 35, FD, 1C, 01, 33, 00, 46), BYTES_TO_WORDS_8(0E, DB, 77, 43, EA, 02, D6, A8) },
+      { BYTES_TO_WORDS_8(43, 8C, B9, FA, 0B, 20, B8, E3), BYTES_TO_WORDS_8(A4, 8A, 3E, 7E, 75, 57, BA, C5),
+        BYTES_TO_WORDS_8(03, 8F, EC, CB, 8E, 2F, 15, 95), BYTES_TO_WORDS_8(26, ED, 80, 33, 9F, C1, 41, 19),
+        BYTES_TO_WORDS_8(17, E2, AB, 22, DA, 10, A2, 8F), BYTES_TO_WORDS_8(39, 56, DF, B8, 3D, 2D, F6, D8),
+        BYTES_TO_WORDS_8(53, 8C, FB, 48, 2A, DB, B6, E2), BYTES_TO_WORDS_8(B6, B2, 5D, 59, 34, B8, 66, 8E) },
+      { BYTES_TO_WORDS_8(0B, 75, 43, 23, B2, 6D, 55, 4F), BYTES_TO_WORDS_8(76, 9C, 32, 7D, A2, 95, 49, 94),
+        BYTES_TO_WORDS_8(9C, 5F, B7, A2, D2, 4F, C6, 8E), BYTES_TO_WORDS_8(02, 79, E6, 2B, 46, 5C, 41, 0E),
+        BYTES_TO_WORDS_8(CC, 56, CD, BE, 15, 7C, 09, A6), BYTES_TO_WORDS_8(06, EC, F7, 5F, A4, 91, F6, 6E),
+        BYTES_TO_WORDS_8(DC, CD, F8, 77, 10, A2, BC, 27), BYTES_TO_WORDS_8(E2, 84, F9, 77, 71, 6E, 05, C3) } },
+    /* (1..8) * 16^29 * G */
+    { { BYTES_TO_WORDS_8(4D, B8, 89, 77, AD, 65, 60, EA), BYTES_TO_WORDS_8(E2, 1C, 04, D1, E4, 5E, 7D, 16),
+        BYTES_TO_WORDS_8(FE, 93, 64, B5, 11, D1, B5, CD), BYTES_TO_WORDS_8(4C, 4B, 37, 57, 14, A6, 89, 4A),
+        BYTES_TO_WORDS_8(A8, 3E, 8E, 01, 7F, 7D, 9B, EF), BYTES_TO_WORDS_8(99, 19, 71, 34, 06, 28, 2E, A7),
+        BYTES_TO_WORDS_8(E6, 77, E6, 9F, 97, EA, C2, 08), BYTES_TO_WORDS_8(5C, 0D, 48, ED, 87, 4E, B0, 45) },
+      { BYTES_TO_WORDS_8(7E, 1F, E1, 64, 03, 9D, 04, 20), BYTES_TO_WORDS_8(08, DB, 7C, 8E, 48, BC, DB, 3B),
+        BYTES_TO_WORDS_8(C7, DD, 54, AE, A0, BB, A4, 8A), BYTES_TO_WORDS_8(6F, 29, 86, C5, 6D, 6E, B6, 55),
+        BYTES_TO_WORDS_8(76, D0, 77, 1C, 67, DC, BD, 04), BYTES_TO_WORDS_8(F9, 94, B5, 21, 06, 61, FE, CC),
+        BYTES_TO_WORDS_8(EB, 23, A2, CC, 04, CC, 86, C3), BYTES_TO_WORDS_8(9B, 41, D1, 1D, 1F, A9, 43, 90) },
+      { BYTES_TO_WORDS_8(34, 4C, E1, 42, 37, B2, 76, 6E), BYTES_TO_WORDS_8(93, 75, 32, 07, BE, 5E, 4C, 83),
+        BYTES_TO_WORDS_8(C9, 77, 13, 78, 0E, B3, A9, A2), BYTES_TO_WORDS_8(92, EF, 70, A8, 48, 96, 9F, CC),
+        BYTES_TO_WORDS_8(6B, 55, BE, 94, 7A, 15, 92, 88), BYTES_TO_WORDS_8(05, 7E, 8C, 82, F1, 17, 99, 29),
+        BYTES_TO_WORDS_8(DB, 89, E6, DB, 33, 66, 11, 43), BYTES_TO_WORDS_8(6F, C9, F8, B5, 2C, FF, 9B, 82) },
+      { BYTES_TO_WORDS_8(06, B5, 4B, CC, 0E, 40, 46, 20), BYTES_TO_WORDS_8(01, 8F, 44, 97, 6A, 4D, 61, 06),
+        BYTES_TO_WORDS_8(0B, 1A, 82, A1, 13, 00, 1D, AB), BYTES_TO_WORDS_8(A8, 79, CB, CD, 91, BC, 3E, DB),
+        BYTES_TO_WORDS_8(0A, E6, B3, 49, 1F, 18, DD, CB), BYTES_TO_WORDS_8(02, D2, F7, E8, F5, 26, 18, B2),
+        BYTES_TO_WORDS_8(58, 92, 53, 85, 5E, 68, 1A, AF), BYTES_TO_WORDS_8(83, 66, 67, 8A, 53, 64, 5A, A9) },
+      { BYTES_TO_WORDS_8(37, 48, DE, 95, 85, 6C, DE, 87), BYTES_TO_WORDS_8(4E, E7, E5, 2D, C8, 86, 42, 8D),
+        BYTES_TO_WORDS_8(75, 8A, D9, 0A, 1D, 8C, F5, F4), BYTES_TO_WORDS_8(1A, 04, AD, FA, A1, 8D, 61, 5C),
+        BYTES_TO_WORDS_8(EE, 7D, 4A, 63, 3B, 58, B8, C0), BYTES_TO_WORDS_8(CA, 78, 22, 64, 49, 66, D3, EC),
+        BYTES_TO_WORDS_8(71, 96, FD, 49, 38, 0E, B8, 88), BYTES_TO_WORDS_8(9D, A1, F3, BC, 17, 91, 71, 4C) },
+      { BYTES_TO_WORDS_8(C0, 67, DC, 40, 8B, 44, CA, B6), BYTES_TO_WORDS_8(8C, 8D, E1, 64, BB, D2, 8D, F0),
+        BYTES_TO_WORDS_8(9A, C0, EE, 87, EE, 7C, DE, 67), BYTES_TO_WORDS_8(7F, C5, E2, AA, 12, CB, BD, 22),
+        BYTES_TO_WORDS_8(DB, 7D, 0E, 3B, 84, 5C, 9A, 8A), BYTES_TO_WORDS_8(74, C7, 89, 3B, 3B, BF, FC, 75),
+        BYTES_TO_WORDS_8(47, 9C, 90, 0D, 8F, 7A, 98, B9), BYTES_TO_WORDS_8(D1, 7D, 3E, AB, 95, 0C, EF, 53) },
+      { BYTES_TO_WORDS_8(96, 53, 63, 56, 26, 34, 89, 25), BYTES_TO_WORDS_8(0C, 6C, 8A, 36, 5A, E1, CA, F2),
+        BYTES_TO_WORDS_8(1E, C1, 71, E6, DD, E2, 85, E5), BYTES_TO_WORDS_8(A2, 06, 5A, 91, 6A, 88, 8A, AB),
+        BYTES_TO_WORDS_8(23, 2C, C9, 3F, 6A, FA, 38, 7E), BYTES_TO_WORDS_8(AD, D6, D2, F7, 83, 05, 36, B9),
+        BYTES_TO_WORDS_8(AB, D5, BC, 48, 82, FF, 68, 56), BYTES_TO_WORDS_8(19, 43, A8, 7D, 7C, CF, 73, E7) },
+      { BYTES_TO_WORDS_8(B1, D1, E5, AD, 79, 22, 5C, 4F), BYTES_TO_WORDS_8(02, B7, 6A, C6, 91, 9E, FA, DD),
+        BYTES_TO_WORDS_8(BF, A3, 64, AA, E3, 74, 21, B9), BYTES_TO_WORDS_8(17, 85, 73, 52, D1, 7D, D3, DE),
+        BYTES_TO_WORDS_8(BB, 78, C7, 12, 77, 77, CC, 81), BYTES_TO_WORDS_8(48, 84, 12, 59, 6D, 07, 3B, F4),
+        BYTES_TO_WORDS_8(B8, 44, 45, 82, B3, AA, 3C, 2B), BYTES_TO_WORDS_8(40, 8C, E7, 84, 5A, 3C, 4E, B1) } },
+    /* (1..8) * 16^30 * G */
+    { { BYTES_TO_WORDS_8(A0, 05, BD, 72, 4A, C8, 38, 34), BYTES_TO_WORDS_8(0D, C8, 1F, 0B, 7D, 33, 82, BA),
+        BYTES_TO_WORDS_8(90, 1F, 6D, F3, 95, F9, C2, ED), BYTES_TO_WORDS_8(5C, 88, 31, 3A, 36, 92, E8, E5),
+        BYTES_TO_WORDS_8(5D, 9F, A6, E1, 2B, DE, 36, C9), BYTES_TO_WORDS_8(AE, 99, D0, 9C, 5B, 99, 73, CA),
+        BYTES_TO_WORDS_8(3E, 5C, 9B, E7, 01, EB, 01, 13), BYTES_TO_WORDS_8(D2, 87, 1B, DA, E4, 9D, 43, 77) },
+      { BYTES_TO_WORDS_8(41, DF, B4, 73, F9, 5C, 66, 0C), BYTES_TO_WORDS_8(51, 6A, 69, 0F, FA, 84, 67, FE),
+        BYTES_TO_WORDS_8(78, 7C, 17, D3, EC, 5F, D9, 44), BYTES_TO_WORDS_8(D1, C8, FE, 3F, 76, ED, 27, C8),
+        BYTES_TO_WORDS_8(4A, 1F, F9, 80, 23, 6A, 5B, 2E), BYTES_TO_WORDS_8(B3, 47, 00, 6C, 10, A6, E9, BF),
+        BYTES_TO_WORDS_8(D3, 3C, EF, 66, 7B, 7D, E1, 60), BYTES_TO_WORDS_8(D5, 5E, DA, F2, 75, 44, 4C, 1E) },
+      { BYTES_TO_WORDS_8(6B, 7D, 46, 01, 81, 52, 09, 4F), BYTES_TO_WORDS_8(51, 4B, A2, 52, 29, 71, 7D, 35),
+        BYTES_TO_WORDS_8(D8, F1, 2C, 64, 11, 86, 01, D1), BYTES_TO_WORDS_8(F5, CC, 35, 94, DF, 93, 23, 5D),
+        BYTES_TO_WORDS_8(58, 54, BC, B1, C6, 73, C6, 07), BYTES_TO_WORDS_8(A8, 73, 04, 51, A7, 07, A7, 72),
+        BYTES_TO_WORDS_8(6D, F4, 5A, 2D, 5B, D8, CB, 7A), BYTES_TO_WORDS_8(7D, 0F, FD, 63, F2, 63, 6E, E6) },
+      { BYTES_TO_WORDS_8(60, 0D, 34, 46, B3, 04, 59, 40), BYTES_TO_WORDS_8(C2, 7D, 6E, 95, 1B, 96, 98, 89),
+        BYTES_TO_WORDS_8(7D, 58, C1, B3, EE, 93, ED, 25), BYTES_TO_WORDS_8(57, 46, B7, 91, 14, 00, 11, B5),
+        BYTES_TO_WORDS_8(A6, CA, 3E, 65, 78, 61, CD, 68), BYTES_TO_WORDS_8(91, 47, 59, 18, B1, 82, B5, 8F),
+        BYTES_TO_WORDS_8(78, F9, 69, F7, 9E, 89, AB, 72), BYTES_TO_WORDS_8(46, 4C, FE, 31, F4, 81, 39, 9C) },
+      { BYTES_TO_WORDS_8(7A, 9F, 15, 9D, 3C, E9, B1, F0), BYTES_TO_WORDS_8(90, E5, 42, F2, 9C, 3A, F9, EC),
+        BYTES_TO_WORDS_8(3F, 87, FF, D2, 2B, FB, DC, 3A), BYTES_TO_WORDS_8(3F, 89, AB, 3A, A5, 57, 36, 45),
+        BYTES_TO_WORDS_8(78, FB, 02, 8A, 70, 2B, C2, 99), BYTES_TO_WORDS_8(5D, DA, 1D, E8, D4, 9B, 94, 6F),
+        BYTES_TO_WORDS_8(28, C7, 01, 3A, 91, F0, 2E, DA), BYTES_TO_WORDS_8(C5, 3D, 02, 88, FF, AE, B5, BF) },
+      { BYTES_TO_WORDS_8(94, 1A, FB, 4C, C6, 76, 32, 97), BYTES_TO_WORDS_8(E9, CD, CD, 63, E3, 06, 2F, A3),
+        BYTES_TO_WORDS_8(45, E6, 80, E4, A2, DD, C3, FF), BYTES_TO_WORDS_8(F0, 32, 24, B7, 21, C2, A0, 27),
+        BYTES_TO_WORDS_8(84, 85, 09, D4, C2, F8, 98, AB), BYTES_TO_WORDS_8(97, 42, 67, 78, 3D, B0, E3, 91),
+        BYTES_TO_WORDS_8(9D, 1E, 82, C1, 8D, EF, F2, F2), BYTES_TO_WORDS_8(92, A7, A0, B3, 3E, AB, F6, C3) },
+      { BYTES_TO_WORDS_8(2A, B4, 6C, D4, F3, ED, ED, 31), BYTES_TO_WORDS_8(93, 90, 23, A7, 53, 28, 05, BC),
+        BYTES_TO_WORDS_8(E7, 73, 3D, A1, EA, AD, 14, 4D), BYTES_TO_WORDS_8(46, 4C, B0, 07, CB, 54, 5B, 43),
+        BYTES_TO_WORDS_8(D0, 2D, F7, DA, ED, 4D, E2, B7), BYTES_TO_WORDS_8(A6, 49, 39, 43, 79, 4C, DC, 5E),
+        BYTES_TO_WORDS_8(5D, 58, E0, C1, 4C, A5, F4, 49), BYTES_TO_WORDS_8(1A, 8A, 71, E4, 31, C0, 26, D7) },
+      { BYTES_TO_WORDS_8(D3, 27, 8E, 67, 79, D4, 93, C1), BYTES_TO_WORDS_8(8F, 68, 4C, 0E, ED, 83, 28, C1),
+        BYTES_TO_WORDS_8(4E, 77, E4, 48, 31, F0, B2, 1C), BYTES_TO_WORDS_8(09, 84, 0E, C4, EE, CA, AA, 60),
+        BYTES_TO_WORDS_8(DE, D2, C4, 28, 02, 61, 7C, FF), BYTES_TO_WORDS_8(4B, 0F, 68, 3A, 78, 00, D4, 46),
+        BYTES_TO_WORDS_8(EE, 04, DE, 03, C8, F7, 54, DA), BYTES_TO_WORDS_8(6D, F6, DE, C5, FC, DF, 77, 96) } },
+    /* (1..8) * 16^31 * G */
+    { { BYTES_TO_WORDS_8(CF, C2, B5, FA, 92, 99, 57, 21), BYTES_TO_WORDS_8(DE, 84, B0, 1F, C2, F0, 12, 53),
+        BYTES_TO_WORDS_8(A4, 90, FA, 04, 41, 47, E7, 71), BYTES_TO_WORDS_8(50, 1F, 22, 1E, 43, 7E, 10, E4),
+        BYTES_TO_WORDS_8(2B, 5C, 95, 2B, 3F, 40, 28, D0), BYTES_TO_WORDS_8(10, 24, 7B, FF, DC, 92, 78, 3C),
+        BYTES_TO_WORDS_8(32, 2B, 1C, 74, 68, C6, 48, 39), BYTES_TO_WORDS_8(9A, 1C, 70, CF, E6, 11, 5F, 1E) },
+      { BYTES_TO_WORDS_8(36, 7A, 9E, 54, B4, 99, 0F, 51), BYTES_TO_WORDS_8(35, 24, 87, 66, 26, 4D, 65, A0),
+        BYTES_TO_WORDS_8(19, 33, D6, 64, 11, F1, 57, A7), BYTES_TO_WORDS_8(39, F8, E6, 41, DB, 95, 52, 2D),
+        BYTES_TO_WORDS_8(67, EB, 32, CE, 95, 81, B6, DD), BYTES_TO_WORDS_8(3B, BA, 30, 97, F9, 44, 7B, EA),
+        BYTES_TO_WORDS_8(C6, 38, 3B, 76, AC, 6C, F1, 3A), BYTES_TO_WORDS_8(32, 72, 80, 06, 28, CF, 8A, F9) },
+      { BYTES_TO_WORDS_8(7E, 7B, B6, 09, 3C, B6, B5, 5B), BYTES_TO_WORDS_8(48, 3D, 1C, 91, 2B, 7B, 6B, 76),
+        BYTES_TO_WORDS_8(42, 11, BC, DE, 01, 97, CF, AA), BYTES_TO_WORDS_8(7D, 9F, 17, EE, 65, 9A, DF, 85),
+        BYTES_TO_WORDS_8(E3, 36, 0A, 83, 9E, 86, B3, 88), BYTES_TO_WORDS_8(A5, 6E, BC, 1F, 9D, 94, FA, 86),
+        BYTES_TO_WORDS_8(73, 29, 0E, FF, 5E, 7D, 6B, BB), BYTES_TO_WORDS_8(08, 63, AF, 39, AA, B7, B4, A6) },
+      { BYTES_TO_WORDS_8(47, 97, A2, 43, 77, 81, ED, CF), BYTES_TO_WORDS_8(97, 86, B9, 7E, C0, 2B, 24, 32),
+        BYTES_TO_WORDS_8(DA, FC, BF, 01, 46, EC, 26, FF), BYTES_TO_WORDS_8(7E, F3, BF, 0B, 2E, 15, 77, 38),
+        BYTES_TO_WORDS_8(37, 46, 4D, F2, 25, 3E, 57, BA), BYTES_TO_WORDS_8(41, E6, FE, CF, 6E, 1F, BD, 9F),
+        BYTES_TO_WORDS_8(30, 37, 9D, B9, 6C, 11, 16, BE), BYTES_TO_WORDS_8(1A, C6, 4B, 01, F9, A7, 70, CC) },
+      { BYTES_TO_WORDS_8(D3, 10, 35, 0B, E6, FD, 7C, 12), BYTES_TO_WORDS_8(E4, D6, A1, 04, 67, 16, D3, 85),
+        BYTES_TO_WORDS_8(28, 29, 2D, 5C, 86, A1, D8, A8), BYTES_TO_WORDS_8(08, CD, 9F, 7F, FE, 93, C4, 23),
+        BYTES_TO_WORDS_8(47, 9A, E8, 3A, C4, 2E, 46, 13), BYTES_TO_WORDS_8(D7, DB, B9, 26, 5E, E3, 99, F7),
+        BYTES_TO_WORDS_8(D8, E6, FF, 4E, 9E, 5D, 27, 0C), BYTES_TO_WORDS_8(23, 14, 34, E4, A9, 56, F4, AD) },
+      { BYTES_TO_WORDS_8(86, AB, 80, 3B, 7C, 44, 6A, 00), BYTES_TO_WORDS_8(3C, 6F, 3E, 93, 88, 34, 6B, C8),
+        BYTES_TO_WORDS_8(57, 52, 12, 0D, 54, 14, D1, 08), BYTES_TO_WORDS_8(3C, 52, 73, C6, 73, 90, DC, B8),
+        BYTES_TO_WORDS_8(6A, 4D, 8B, 04, 4F, 19, 61, 2F), BYTES_TO_WORDS_8(E0, E9, 3C, DB, 99, 45, 4D, CA),
+        BYTES_TO_WORDS_8(63, 18, 14, 84, 7E, C6, 5D, 4B), BYTES_TO_WORDS_8(68, 1E, D4, 6F, 21, 87, 77, EC) },
+      { BYTES_TO_WORDS_8(1F, A7, 49, 8B, 80, 91, C6, AC), BYTES_TO_WORDS_8(39, 7C, 22, 64, 6C, EB, 36, AC),
+        BYTES_TO_WORDS_8(DD, 35, F2, AA, EB, 93, 59, DE), BYTES_TO_WORDS_8(ED, D0, 4D, 31, 0B, 6D, 40, 94),
+        BYTES_TO_WORDS_8(A9, 49, B2, D0, 44, 19, 1C, 47), BYTES_TO_WORDS_8(94, CF, 63, CA, 61, 72, E2, D0),
+        BYTES_TO_WORDS_8(97, E8, 6F, 90, 90, 7C, 20, CD), BYTES_TO_WORDS_8(79, F1, 4D, 86, 7E, E7, AA, 61) },
+      { BYTES_TO_WORDS_8(54, A6, BB, 06, 06, 9A, 46, 59), BYTES_TO_WORDS_8(9F, A7, 5E, 13, BD, FF, 3B, 5E),
+        BYTES_TO_WORDS_8(49, 16, 8E, 0A, 27, 34, 78, A6), BYTES_TO_WORDS_8(69, 45, D0, 40, 6E, 6A, 7A, 43),
+        BYTES_TO_WORDS_8(F3, C0, A7, 37, 60, 40, 55, 37), BYTES_TO_WORDS_8(10, D4, 38, 19, 76, C3, A7, 14),
+        BYTES_TO_WORDS_8(A0, C5, 4D, F3, 5F, 82, 24, AB), BYTES_TO_WORDS_8(92, 24, 7F, 58, 15, 1E, 91, C2) } },
+    /* (1..8) * 16^32 * G */
+    { { BYTES_TO_WORDS_8(85, BD, 89, D7, C9, 4F, C8, 57), BYTES_TO_WORDS_8(C3, EA, 97, C2, 7D, FF, 35, FC),
+        BYTES_TO_WORDS_8(6E, 76, C6, 88, D5, 2F, 98, FB), BYTES_TO_WORDS_8(67, 5E, DB, EE, 9B, 73, 7D, 44),
+        BYTES_TO_WORDS_8(32, 5B, E2, 72, C9, 33, 7E, 0C), BYTES_TO_WORDS_8(00, E5, FA, A7, 95, 9B, 34, 3D),
+        BYTES_TO_WORDS_8(F7, AF, 4A, 3A, 95, 9D, 2E, E1), BYTES_TO_WORDS_8(EE, 31, 41, 83, AB, 25, 48, 2D) },
+      { BYTES_TO_WORDS_8(5E, 66, 6B, 1A, 21, 21, 04, EB), BYTES_TO_WORDS_8(3A, 80, F6, A7, 9E, 77, 2F, 80),
+        BYTES_TO_WORDS_8(C3, 04, 08, 3C, 2A, 1F, 50, 47), BYTES_TO_WORDS_8(D4, A1, 45, 49, 9B, 91, 63, A2),
+        BYTES_TO_WORDS_8(FB, DC, BC, 30, 00, 04, E4, 9E), BYTES_TO_WORDS_8(E2, EF, 00, 4C, DF, 83, 3F, AC),
+        BYTES_TO_WORDS_8(C5, 60, 0D, E6, 9D, 3C, 9D, 2E), BYTES_TO_WORDS_8(FC, 20, ED, 2A, BD, 00, 32, 87) },
+      { BYTES_TO_WORDS_8(68, DB, A6, DE, 8E, 99, E1, 73), BYTES_TO_WORDS_8(C2, 32, 26, 08, 56, D8, FA, DD),
+        BYTES_TO_WORDS_8(F6, F4, DE, 65, F9, 4D, B1, 58), BYTES_TO_WORDS_8(7F, 01, CA, 03, 3E, 53, B6, F8),
+        BYTES_TO_WORDS_8(A9, 0D, 76, AE, B0, 25, BD, 69), BYTES_TO_WORDS_8(ED, A0, 5C, 9C, DD, 70, BD, 6B),
+        BYTES_TO_WORDS_8(C6, 3E, AA, 50, DA, 6D, 04, 2F), BYTES_TO_WORDS_8(86, 54, 44, EC, F5, 4E, 0F, C3) },
+      { BYTES_TO_WORDS_8(0C, 1F, 77, 4D, AC, D3, F1, F6), BYTES_TO_WORDS_8(A8, AE, E0, 3B, E6, 16, AD, AC),
+        BYTES_TO_WORDS_8(F0, 47, 95, 57, DD, 3A, E6, 18), BYTES_TO_WORDS_8(61, 19, 7E, E5, 21, D7, 90, 28),
+        BYTES_TO_WORDS_8(78, 0D, 89, B5, EC, 28, 57, 0A), BYTES_TO_WORDS_8(69, 40, F5, 7E, F7, E7, C0, 7D),
+        BYTES_TO_WORDS_8(EC, 52, 67, 41, D1, E1, 77, AF), BYTES_TO_WORDS_8(2A, 03, DC, 9D, 15, B8, B5, 69) },
+      { BYTES_TO_WORDS_8(53, E7, 24, F9, EB, D4, D5, 66), BYTES_TO_WORDS_8(7C, 72, F8, 2C, 07, 73, 01, 5F),
+        BYTES_TO_WORDS_8(75, FB, ED, 29, 87, F1, 8E, 54), BYTES_TO_WORDS_8(7C, 84, 82, 55, D3, 89, 52, F3),
+        BYTES_TO_WORDS_8(0C, A2, 13, EB, C2, B5, 45, AA), BYTES_TO_WORDS_8(04, 0F, 2D, 29, 57, FC, 62, C5),
+        BYTES_TO_WORDS_8(D8, 1B, 0E, B5, A1, 08, DF, 93), BYTES_TO_WORDS_8(FB, 13, EC, C5, 1E, 78, C1, 75) },
+      { BYTES_TO_WORDS_8(3A, 21, 70, 26, 0D, 93, B6, F8), BYTES_TO_WORDS_8(A4, 9D, 7A, AF, F2, 1B, 6D, 94),
+        BYTES_TO_WORDS_8(CB, 33, 50, 59, C0, C3, 30, 54), BYTES_TO_WORDS_8(80, E4, 5B, EC, FA, 5C, 9F, 92),
+        BYTES_TO_WORDS_8(14, 6F, 48, CD, C5, 59, 30, A5), BYTES_TO_WORDS_8(70, 01, F2, F7, 64, 39, 38, 1B),
+        BYTES_TO_WORDS_8(45, 90, E3, 51, BB, 64, AC, C5), BYTES_TO_WORDS_8(C6, 20, 33, 29, 92, 36, CD, 29) },
+      { BYTES_TO_WORDS_8(7E, 01, 18, 30, 67, CB, 95, 23), BYTES_TO_WORDS_8(D7, 23, DF, D6, FF, 1F, 14, AF),
+        BYTES_TO_WORDS_8(01, 4E, 73, B6, 5F, 18, 34, 48), BYTES_TO_WORDS_8(16, 17, 44, DA, 74, 6B, D0, CF),
+        BYTES_TO_WORDS_8(50, FF, 0D, CE, E4, 7B, AE, A0), BYTES_TO_WORDS_8(77, 97, 77, 6B, 78, 30, 30, 00),
+        BYTES_TO_WORDS_8(50, 79, DA, 87, 95, B3, 03, 81), BYTES_TO_WORDS_8(13, A9, 2B, B7, A9, B7, 47, B6) },
+      { BYTES_TO_WORDS_8(44, 9E, 7E, AC, EF, 22, 58, 4F), BYTES_TO_WORDS_8(81, 17, DA, 71, 5E, FF, E3, D4),
+        BYTES_TO_WORDS_8(05, E3, 3D, 03, 28, 06, 69, 81), BYTES_TO_WORDS_8(6F, 9C, 4D, DD, 67, 88, 8B, 7B),
+        BYTES_TO_WORDS_8(C3, 12, CD, A8, 2A, 02, 67, 07), BYTES_TO_WORDS_8(65, 23, D7, BB, 6D, 7E, 05, 64),
+        BYTES_TO_WORDS_8(B5, AD, D5, 7D, 3C, 07, 46, 22), BYTES_TO_WORDS_8(B4, 80, 16, 51, 3E, 27, C6, 8B) } },
+    /* (1..8) * 16^33 * G */
+    { { BYTES_TO_WORDS_8(36, E7, 7D, 13, AC, 8B, BD, 1E), BYTES_TO_WORDS_8(24, CE, 88, 86, 61, D5, F8, A2),
+        BYTES_TO_WORDS_8(8E, C1, DE, 8C, 2B, 54, 37, 89), BYTES_TO_WORDS_8(3E, CF, 9C, 94, 14, E3, 22, 90),
+        BYTES_TO_WORDS_8(CC, 2E, C4, 44, 08, 5C, EF, F4), BYTES_TO_WORDS_8(57, 76, EA, 44, 6C, 36, 49, 7F),
+        BYTES_TO_WORDS_8(08, CE, 26, 52, 04, BB, D0, 66), BYTES_TO_WORDS_8(94, A3, 04, 29, 4F, 5E, AE, 2F) },
+      { BYTES_TO_WORDS_8(3C, 60, 7A, 75, CF, 52, 2E, 87), BYTES_TO_WORDS_8(97, 62, 39, 64, 69, A9, 30, E1),
+        BYTES_TO_WORDS_8(3E, 13, B1, 01, 78, 1F, 73, C2), BYTES_TO_WORDS_8(9C, 18, DF, FC, F5, 63, 76, A7),
+        BYTES_TO_WORDS_8(68, E4, A8, 4C, 80, 45, 17, D9), BYTES_TO_WORDS_8(48, CE, BA, 8C, 56, 6C, B8, 8A),
+        BYTES_TO_WORDS_8(5A, A3, 76, 54, FA, 82, E9, DA), BYTES_TO_WORDS_8(58, FC, DA, AD, BD, 9C, 13, 4E) },
+      { BYTES_TO_WORDS_8(F5, 01, 9B, D0, B8, 6C, 70, 91), BYTES_TO_WORDS_8(51, C0, 73, 32, 18, 35, 3F, F7),
+        BYTES_TO_WORDS_8(7A, 85, F7, 1A, 3F, 2D, 0F, FB), BYTES_TO_WORDS_8(45, E9, 6F, 07, E3, 72, 58, 6E),
+        BYTES_TO_WORDS_8(DE, 5F, CD, AB, D9, 58, 07, C3), BYTES_TO_WORDS_8(A7, 85, 9A, E0, D4, 79, 31, C1),
+        BYTES_TO_WORDS_8(EB, F0, BE, F3, 4A, 1D, CC, 80), BYTES_TO_WORDS_8(71, 71, D7, C8, 2E, C0, 13, 42) },
+      { BYTES_TO_WORDS_8(E4, FF, 1D, 46, 30, 21, 3E, E8), BYTES_TO_WORDS_8(82, 55, 9B, F7, 6B, 69, 3D, A9),
+        BYTES_TO_WORDS_8(0E, 87, F2, 65, 29, 1D, 91, 12), BYTES_TO_WORDS_8(11, 9A, 88, DB, D2, 98, 70, 1A),
+        BYTES_TO_WORDS_8(DA, 15, 13, 16, ED, 5E, BA, F3), BYTES_TO_WORDS_8(53, B5, 26, DE, 83, 27, 68, 68),
+        BYTES_TO_WORDS_8(27, F3, 76, 6F, 93, 2C, A4, E5), BYTES_TO_WORDS_8(FA, 69, 8B, EE, F5, 74, D4, 39) },
+      { BYTES_TO_WORDS_8(1F, 5B, E4, EF, 47, B7, 39, B5), BYTES_TO_WORDS_8(C2, 68, 61, 2E, FB, 55, D1, 7B),
+        BYTES_TO_WORDS_8(82, DF, 17, 4C, 34, 1E, FD, 4A), BYTES_TO_WORDS_8(50, 3F, DA, A5, B1, 20, 22, 29),
+        BYTES_TO_WORDS_8(26, B0, 4B, 53, 8B, 0B, E4, 5F), BYTES_TO_WORDS_8(04, 41, DD, 4C, 30, 44, C3, F7),
+        BYTES_TO_WORDS_8(7F, 8D, E9, FA, 5F, 79, 7C, E3), BYTES_TO_WORDS_8(AE, 75, F1, 2B, 53, A0, 16, E3) },
+      { BYTES_TO_WORDS_8(D9, 6E, B7, 6D, 68, D0, 93, 04), BYTES_TO_WORDS_8(09, 15, 02, A1, E9, 07, B8, 63),
+        BYTES_TO_WORDS_8(C5, 65, E7, B4, 4A, B7, 6C, CD), BYTES_TO_WORDS_8(86, 3E, 6C, 3D, 9D, F9, A5, 7D),
+        BYTES_TO_WORDS_8(F4, C9, 52, 97, 93, CF, F1, 80), BYTES_TO_WORDS_8(31, 01, 72, 8C, 6B, BB, 1C, 19),
+        BYTES_TO_WORDS_8(43, 56, C7, 42, 13, DD, 29, E5), BYTES_TO_WORDS_8(19, 2F, 10, 28, C0, 9A, 26, DA) },
+      { BYTES_TO_WORDS_8(40, D5, AB, A3, 62, 06, 85, 3E), BYTES_TO_WORDS_8(E4, 6D, 16, 4B, 65, 40, 80, 0E),
+        BYTES_TO_WORDS_8(34, 3A, 09, 21, 87, 4F, 22, C3), BYTES_TO_WORDS_8(0A, 4F, A4, 07, 48, E1, 44, 36),
+        BYTES_TO_WORDS_8(31, A6, 5D, D5, 1C, FE, C6, E1), BYTES_TO_WORDS_8(4D, A1, 6F, A6, ED, 7C, 17, 00),
+        BYTES_TO_WORDS_8(93, E2, A1, 9F, 30, 85, C2, 11), BYTES_TO_WORDS_8(76, 79, C2, DB, 50, 91, 5A, EC) },
+      { BYTES_TO_WORDS_8(AE, C9, 72, 24, 6F, 0F, 10, 84), BYTES_TO_WORDS_8(F2, 34, 32, 26, 4B, 8F, 07, 1A),
+        BYTES_TO_WORDS_8(E9, 7F, 41, 15, 1F, FF, 43, AC), BYTES_TO_WORDS_8(B7, 0B, 33, EA, 60, 22, D9, FF),
+        BYTES_TO_WORDS_8(E4, 3A, D0, 66, D8, C1, CE, A0), BYTES_TO_WORDS_8(34, 8A, 8B, 86, 9C, 2E, 3D, 26),
+        BYTES_TO_WORDS_8(5F, 1E, 71, 25, 32, 63, 99, 59), BYTES_TO_WORDS_8(47, 11, 21, BA, B0, 93, 4B, CF) } },
+    /* (1..8) * 16^34 * G */
+    { { BYTES_TO_WORDS_8(97, 33, CD, 44, C1, 45, 11, 74), BYTES_TO_WORDS_8(B5, 5E, 51, 19, 06, C1, 34, DC),
+        BYTES_TO_WORDS_8(ED, 6D, 15, B5, F2, 6C, 38, 89), BYTES_TO_WORDS_8(23, A7, ED, 19, 04, FF, BA, 73),
+        BYTES_TO_WORDS_8(E4, B8, DC, 9A, 13, 2A, EF, 41), BYTES_TO_WORDS_8(49, 13, 26, F8, 2C, F9, 9E, 77),
+        BYTES_TO_WORDS_8(5E, 82, 8F, C1, E8, D1, 00, 6A), BYTES_TO_WORDS_8(5F, AC, 77, 49, 63, DE, 97, 1E) },
+      { BYTES_TO_WORDS_8(18, 36, D8, DF, 7C, FD, C1, AC), BYTES_TO_WORDS_8(BC, 93, 8D, 31, DC, 55, 0B, 14),
+        BYTES_TO_WORDS_8(1E, 87, F4, A0, AD, 35, CA, 36), BYTES_TO_WORDS_8(05, 43, BA, 91, 63, 45, B5, 6F),
+        BYTES_TO_WORDS_8(26, 06, 43, 02, CB, F5, 39, 3F), BYTES_TO_WORDS_8(3E, D3, E5, AA, 99, 64, 1E, 2F),
+        BYTES_TO_WORDS_8(BA, DA, 09, 21, C5, 68, 3B, ED), BYTES_TO_WORDS_8(A3, B8, C6, 66, 77, D8, 63, F6) },
+      { BYTES_TO_WORDS_8(13, B9, 1F, 16, 52, F9, B0, 7E), BYTES_TO_WORDS_8(97, 12, D3, 56, 61, 24, 10, 3E),
+        BYTES_TO_WORDS_8(4E, D0, BE, 44, DE, 88, 43, 34), BYTES_TO_WORDS_8(18, 0A, E6, 33, 0C, 33, F8, 45),
+        BYTES_TO_WORDS_8(BC, C3, 15, 0C, 7C, 81, D4, 70), BYTES_TO_WORDS_8(73, 33, FC, F6, 79, 08, 6D, F0),
+        BYTES_TO_WORDS_8(60, 77, BA, D8, 76, 80, 0E, F8), BYTES_TO_WORDS_8(6E, 90, D6, BF, 6D, CF, 12, C2) },
+      { BYTES_TO_WORDS_8(71, 9A, BD, 1C, 04, DB, 7B, 35), BYTES_TO_WORDS_8(79, F4, 6E, B4, 70, 1E, D9, 42),
+        BYTES_TO_WORDS_8(B9, E4, 98, DF, EB, C7, 45, A1), BYTES_TO_WORDS_8(13, 21, 86, B2, D0, DE, 54, D5),
+        BYTES_TO_WORDS_8(2E, C3, 8C, 3C, 8B, 4A, 3A, A4), BYTES_TO_WORDS_8(99, 1C, A6, A7, A9, FE, 29, 5F),
+        BYTES_TO_WORDS_8(14, 93, C3, 5A, D4, 7A, 0F, FF), BYTES_TO_WORDS_8(8E, 70, 36, 6C, 4B, F9, B8, 74) },
+      { BYTES_TO_WORDS_8(54, 36, 39, EE, 91, 96, EF, 5A), BYTES_TO_WORDS_8(C7, D7, ED, F3, E1, 4B, 5D, 96),
+        BYTES_TO_WORDS_8(91, 59, CD, 8B, 1C, A0, F5, 65), BYTES_TO_WORDS_8(AB, BD, D7, AC, 49, DC, 44, 55),
+        BYTES_TO_WORDS_8(6F, 20, 53, 8F, BF, 0B, 61, 23), BYTES_TO_WORDS_8(73, 8E, D5, 03, 97, FE, 1E, 24),
+        BYTES_TO_WORDS_8(92, 51, 93, B8, B5, 05, 4C, C0), BYTES_TO_WORDS_8(4A, FD, 87, 50, 89, 85, 3E, ED) },
+      { BYTES_TO_WORDS_8(3A, 59, B5, BA, 55, 3F, B9, E8), BYTES_TO_WORDS_8(A0, A7, 62, E6, 43, 73, CE, 44),
+        BYTES_TO_WORDS_8(4F, B1, 2E, D4, 99, 7C, E1, 54), BYTES_TO_WORDS_8(35, 01, E1, E9, 2C, 0B, 13, 44),
+        BYTES_TO_WORDS_8(89, 8E, 5B, BF, 3D, 76, A5, E3), BYTES_TO_WORDS_8(3F, 2E, CE, CD, DE, 1B, 6D, 77),
+        BYTES_TO_WORDS_8(A1, 80, 05, 5B, 21, 51, CA, 31), BYTES_TO_WORDS_8(4F, 22, 07, 79, C7, 7F, 19, 49) },
+      { BYTES_TO_WORDS_8(FD, 5D, A1, 28, 94, 59, F3, 13), BYTES_TO_WORDS_8(55, 9E, FA, 25, C0, BA, 1D, 74),
+        BYTES_TO_WORDS_8(95, F6, E2, 5A, D5, 2E, 3D, 4B), BYTES_TO_WORDS_8(73, E7, 9E, 61, 90, B7, 57, 27),
+        BYTES_TO_WORDS_8(41, C3, 42, F0, 0C, 84, 8E, FC), BYTES_TO_WORDS_8(6D, 15, A7, 3C, 8A, 97, 68, 17),
+        BYTES_TO_WORDS_8(0D, 50, D5, 3C, 21, 75, C9, 5C), BYTES_TO_WORDS_8(2E, B1, C2, 54, D5, D2, 46, DF) },
+      { BYTES_TO_WORDS_8(8A, 8C, E2, 3B, 7F, 81, 82, DE), BYTES_TO_WORDS_8(85, 04, 13, 22, 66, 77, 61, 9F),
+        BYTES_TO_WORDS_8(71, 51, 62, 29, 54, E4, C4, 63), BYTES_TO_WORDS_8(C7, F1, 05, CF, 8B, D7, 89, B8),
+        BYTES_TO_WORDS_8(9E, F8, FD, EA, 51, FE, 37, 30), BYTES_TO_WORDS_8(C3, B8, 2F, 78, E5, 31, F6, DF),
+        BYTES_TO_WORDS_8(EA, 00, C7, 75, A9, E4, 2B, 18), BYTES_TO_WORDS_8(9B, 1B, 51, FA, 07, 0B, BB, BA) } },
+    /* (1..8) * 16^35 * G */
+    { { BYTES_TO_WORDS_8(3C, E3, A4, 1F, B3, 5F, 2E, 0E), BYTES_TO_WORDS_8(B3, 8C, 09, 8B, C7, BE, 83, 26),
+        BYTES_TO_WORDS_8(98, FB, 76, 29, 6C, 44, 74, C9), BYTES_TO_WORDS_8(BB, 25, 4C, 1A, B9, 46, F6, 9C),
+        BYTES_TO_WORDS_8(63, 45, 0D, 0E, 06, 5E, C4, 19), BYTES_TO_WORDS_8(32, 60, C1, EB, 27, 58, 20, 9E),
+        BYTES_TO_WORDS_8(31, 1F, 82, 8B, 25, 8E, 40, 1E), BYTES_TO_WORDS_8(89, 5A, F6, C1, 4D, 62, B0, 37) },
+      { BYTES_TO_WORDS_8(48, EF, 24, C2, 39, 69, 49, 8C), BYTES_TO_WORDS_8(F5, 15, 5E, 24, 69, 54, AE, 6C),
+        BYTES_TO_WORDS_8(4F, 84, 47, 55, 8D, 7F, 91, 35), BYTES_TO_WORDS_8(98, 32, 52, A4, 03, 19, 25, FE),
+        BYTES_TO_WORDS_8(A7, DF, 36, 51, A0, 60, 69, AE), BYTES_TO_WORDS_8(08, E4, 21, C3, A1, AA, 5A, 45),
+        BYTES_TO_WORDS_8(A0, 36, 1B, 5A, 40, B9, 36, D8), BYTES_TO_WORDS_8(E0, 9B, CA, 97, AC, 9C, AC, 4F) },
+      { BYTES_TO_WORDS_8(67, 1E, BF, C6, 8C, 61, 8B, E9), BYTES_TO_WORDS_8(63, AF, 5C, FE, 49, 67, 56, 4C),
+        BYTES_TO_WORDS_8(0F, 4E, 76, 27, 38, 65, 7A, 9D), BYTES_TO_WORDS_8(99, 64, 1B, 15, DE, 43, CB, 83),
+        BYTES_TO_WORDS_8(97, CC, 9A, 09, B3, E8, 7E, A2), BYTES_TO_WORDS_8(9E, 16, D1, BD, 2C, 42, 74, 28),
+        BYTES_TO_WORDS_8(F8, 18, 44, 62, 6E, 80, B1, EF), BYTES_TO_WORDS_8(F8, F6, 98, 4B, A2, 8C, E2, BC) },
+      { BYTES_TO_WORDS_8(74, 5A, 40, 4D, B6, 5C, CF, BC), BYTES_TO_WORDS_8(A5, E7, D3, BD, 6B, 9F, C2, CE),
+        BYTES_TO_WORDS_8(16, 10, 13, F6, C3, B6, C3, E2), BYTES_TO_WORDS_8(F2, F9, 68, 13, 54, 1E, 41, CC),
+        BYTES_TO_WORDS_8(DB, BD, D1, 18, B6, E6, 5B, 64), BYTES_TO_WORDS_8(0D, FB, 16, 9F, 00, C2, 4F, BE),
+        BYTES_TO_WORDS_8(D0, 86, 01, 35, FC, 27, 15, 57), BYTES_TO_WORDS_8(84, 45, 77, AC, 2F, 81, CB, FE) },
+      { BYTES_TO_WORDS_8(7E, 05, 0F, DC, 48, D7, 0A, 23), BYTES_TO_WORDS_8(D8, 3D, D5, 01, 87, 62, E8, 84),
+        BYTES_TO_WORDS_8(24, 02, 25, 5E, C1, 0F, 34, 03), BYTES_TO_WORDS_8(8C, B0, CE, 60, E5, B3, F3, 3F),
+        BYTES_TO_WORDS_8(5E, 96, 17, A8, DA, F7, 41, 2D), BYTES_TO_WORDS_8(62, 17, 70, C4, 6E, 23, 10, A0),
+        BYTES_TO_WORDS_8(43, 78, 86, 57, 70, D1, 7F, 6F), BYTES_TO_WORDS_8(8F, 57, B6, 3B, 6F, AD, 17, 7F) },
+      { BYTES_TO_WORDS_8(5D, BF, 9E, 76, 0E, 78, D4, 74), BYTES_TO_WORDS_8(2B, C6, 38, 7E, 98, ED, 4F, D6),
+        BYTES_TO_WORDS_8(4F, 65, D4, 90, F3, 73, DC, 80), BYTES_TO_WORDS_8(4F, 17, 9D, 1E, F9, E7, D6, 84),
+        BYTES_TO_WORDS_8(79, C3, 2C, 66, F1, 86, 05, BB), BYTES_TO_WORDS_8(F2, 68, A2, A8, 3A, 9F, 4A, B1),
+        BYTES_TO_WORDS_8(59, D1, 0A, E5, 3D, 03, F7, E4), BYTES_TO_WORDS_8(4D, 7C, 40, 6E, E8, F4, 55, 05) },
+      { BYTES_TO_WORDS_8(F1, 69, 5E, 32, 40, 4B, 11, 15), BYTES_TO_WORDS_8(B5, BC, 22, D4, F2, A8, 67, 63),
+        BYTES_TO_WORDS_8(99, AF, D6, 73, E1, 9D, A1, DD), BYTES_TO_WORDS_8(3F, D8, FF, D8, 2D, DB, 9E, 6E),
+        BYTES_TO_WORDS_8(9B, 7E, 2B, 40, E3, 17, 0E, 72), BYTES_TO_WORDS_8(1B, 28, 9F, 79, 54, 74, 72, 1C),
+        BYTES_TO_WORDS_8(F6, BF, F3, 65, AB, 56, 35, AB), BYTES_TO_WORDS_8(4E, 95, FF, CE, 16, 22, 82, C0) },
+      { BYTES_TO_WORDS_8(7B, 33, E1, AE, 10, 29, 28, 96), BYTES_TO_WORDS_8(B1, A1, C4, 45, 2A, 02, 98, 08),
+        BYTES_TO_WORDS_8(E1, 5D, C3, EF, F3, 6E, 35, CA), BYTES_TO_WORDS_8(1C, 35, A4, F1, 3C, 92, 6C, 8C),
+        BYTES_TO_WORDS_8(BE, 4A, C8, D9, 5C, 1D, 45, CB), BYTES_TO_WORDS_8(2A, FA, DD, C6, C1, 62, 53, 84),
+        BYTES_TO_WORDS_8(84, 8E, AA, 9E, 31, B2, FB, 5E), BYTES_TO_WORDS_8(6A, FF, 40, 4D, C8, 6F, 25, A1) } },
+    /* (1..8) * 16^36 * G */
+    { { BYTES_TO_WORDS_8(6D, 71, 3B, 52, C0, AD, 6F, 82), BYTES_TO_WORDS_8(6B, 1A, 4E, F7, 66, 89, 23, 0D),
+        BYTES_TO_WORDS_8(9E, DF, 18, 8D, 93, C7, A5, E8), BYTES_TO_WORDS_8(34, A5, 8C, 8B, E3, 5B, 1F, F8),
+        BYTES_TO_WORDS_8(01, 24, 63, 12, F5, 02, 40, 46), BYTES_TO_WORDS_8(30, 83, 87, 3A, 50, 58, 07, 66),
+        BYTES_TO_WORDS_8(28, 03, 0E, 38, 9D, D2, 56, 1D), BYTES_TO_WORDS_8(DF, 06, 1F, 9C, 32, 49, 7F, DC) },
+      { BYTES_TO_WORDS_8(39, 95, 78, 90, 27, C5, E0, 46), BYTES_TO_WORDS_8(25, 57, D0, 3B, 71, 1A, 4E, 0E),
+        BYTES_TO_WORDS_8(82, 31, D6, 80, 62, A7, 8E, 15), BYTES_TO_WORDS_8(3F, 4C, 9C, C2, 72, E7, 59, 74),
+        BYTES_TO_WORDS_8(7F, D9, 39, 14, 47, 5A, DF, 3C), BYTES_TO_WORDS_8(91, B3, 7D, 4F, E0, F5, 3A, 38),
+        BYTES_TO_WORDS_8(A9, C1, 2E, 8A, 85, 8E, 7E, EC), BYTES_TO_WORDS_8(EA, 44, 34, 18, F5, C7, 2B, 89) },
+      { BYTES_TO_WORDS_8(8A, 9D, D1, 39, 50, 68, C5, 84), BYTES_TO_WORDS_8(15, 52, A5, 51, 89, 27, 41, 3B),
+        BYTES_TO_WORDS_8(0A, 49, 6D, C1, 35, EC, F6, 5A), BYTES_TO_WORDS_8(38, 86, 12, FB, 50, 84, 00, A6),
+        BYTES_TO_WORDS_8(4F, 2C, 0D, 59, B3, DB, 95, FD), BYTES_TO_WORDS_8(3D, 57, 26, A7, 8F, 00, FE, F0),
+        BYTES_TO_WORDS_8(84, CA, E9, 7B, 5E, D4, F6, C8), BYTES_TO_WORDS_8(72, 7C, A3, 67, C0, 79, 4B, 7B) },
+      { BYTES_TO_WORDS_8(E7, DF, F2, 8E, 8C, 7E, 72, F4), BYTES_TO_WORDS_8(C4, 81, 88, 5B, D9, 4F, 5E, 34),
+        BYTES_TO_WORDS_8(3F, FD, 2E, 7D, F8, C9, 04, C6), BYTES_TO_WORDS_8(92, 84, 7F, 3D, 38, 7C, 1C, 2E),
+        BYTES_TO_WORDS_8(2A, 5F, 5E, C5, A2, CC, 85, 3F), BYTES_TO_WORDS_8(BD, C5, B0, 67, D6, 47, D7, C2),
+        BYTES_TO_WORDS_8(F1, A8, 7E, FF, 29, 45, 9F, 6D), BYTES_TO_WORDS_8(26, BE, F0, 09, 2B, DC, 29, C6) },
+      { BYTES_TO_WORDS_8(9F, AC, 6C, 49, 39, 7B, 98, 26), BYTES_TO_WORDS_8(72, DE, 44, 5C, EA, 8C, E3, 59),
+        BYTES_TO_WORDS_8(1C, 0E, EB, 8F, 79, 09, 4C, C6), BYTES_TO_WORDS_8(54, F3, 7D, 96, B1, 82, 53, DE),
+        BYTES_TO_WORDS_8(D3, 73, A4, AF, FD, 82, E0, 7C), BYTES_TO_WORDS_8(15, 41, D8, 73, 94, E2, E3, C2),
+        BYTES_TO_WORDS_8(2B, 9F, CF, 91, 09, B0, C3, 62), BYTES_TO_WORDS_8(85, 91, 9C, B6, 78, B6, 47, 9C) },
+      { BYTES_TO_WORDS_8(A9, 35, BF, 31, 08, 7C, 4C, 3B), BYTES_TO_WORDS_8(90, 1C, 62, 6D, 36, 30, ED, E2),
+        BYTES_TO_WORDS_8(65, 59, 8B, 63, 98, 07, CB, 40), BYTES_TO_WORDS_8(53, 5E, 34, C5, EC, AB, DF, 74),
+        BYTES_TO_WORDS_8(E1, 68, A2, 36, 7B, B0, 15, 36), BYTES_TO_WORDS_8(8D, 84, 64, C5, 26, A1, 5F, 3F),
+        BYTES_TO_WORDS_8(99, CE, 17, C5, 79, 1E, 28, 69), BYTES_TO_WORDS_8(70, A7, 56, 89, 4C, 1B, 34, 48) },
+      { BYTES_TO_WORDS_8(23, 7A, 80, 86, 37, 96, B2, 7C), BYTES_TO_WORDS_8(3E, FF, 25, 6A, 51, 20, 00, 40),
+        BYTES_TO_WORDS_8(C8, 4E, 19, 51, 9D, B9, 44, 53), BYTES_TO_WORDS_8(08, A9, F2, 07, 08, 7B, 22, A7),
+        BYTES_TO_WORDS_8(94, 58, 11, D4, 83, 19, 47, 1C), BYTES_TO_WORDS_8(C9, CD, 28, B7, 57, 81, BF, E7),
+        BYTES_TO_WORDS_8(AB, 75, A0, 20, 79, 84, DA, 45), BYTES_TO_WORDS_8(E8, 39, 5D, D4, 25, 75, 50, F5) },
+      { BYTES_TO_WORDS_8(73, 18, F2, F2, 33, E8, EB, AC), BYTES_TO_WORDS_8(19, B0, 29, 84, 9D, C1, 2F, 02),
+        BYTES_TO_WORDS_8(28, DC, 28, 02, A9, 38, 31, E6), BYTES_TO_WORDS_8(19, D5, E7, 36, 9B, 79, 86, 8C),
+        BYTES_TO_WORDS_8(40, 91, 15, E5, D7, B7, 05, 89), BYTES_TO_WORDS_8(EC, F0, 61, E8, 06, 43, BF, 5D),
+        BYTES_TO_WORDS_8(D1, 72, A2, 75, E4, 9F, CE, 61), BYTES_TO_WORDS_8(5D, E8, A3, A5, 12, 2C, 0C, 5C) } },
+    /* (1..8) * 16^37 * G */
+    { { BYTES_TO_WORDS_8(7A, 4B, 35, 87, E7, C7, D9, 8E), BYTES_TO_WORDS_8(97, 5C, 91, C3, 56, CA, 2E, 02),
+        BYTES_TO_WORDS_8(1D, DE, 3C, E5, 63, F4, 97, 23), BYTES_TO_WORDS_8(48, 08, 7E, D7, 74, 54, 68, 85),
+        BYTES_TO_WORDS_8(C6, 04, 6E, D1, 2B, 40, 54, 89), BYTES_TO_WORDS_8(BD, FD, D6, 1F, DC, 91, A8, 06),
+        BYTES_TO_WORDS_8(87, 72, 6F, 2A, 3B, 91, BC, EE), BYTES_TO_WORDS_8(B6, 87, F5, 0B, B5, 0E, B5, 20) },
+      { BYTES_TO_WORDS_8(E7, 45, 43, 46, E0, 5A, 6C, 18), BYTES_TO_WORDS_8(C1, 44, 53, 3C, 84, F0, FA, 45),
+        BYTES_TO_WORDS_8(4C, 69, F1, 5A, 7B, C7, 1E, 69), BYTES_TO_WORDS_8(6C, CC, B4, 02, 9F, AB, EC, 80),
+        BYTES_TO_WORDS_8(EF, E3, 42, E0, 52, DE, A3, 97), BYTES_TO_WORDS_8(B4, DB, CC, 5B, CA, 00, E5, 32),
+        BYTES_TO_WORDS_8(84, FC, 19, 3E, F8, C8, 5F, FB), BYTES_TO_WORDS_8(C6, 55, 6D, CA, 8A, 14, 24, F4) },
+      { BYTES_TO_WORDS_8(5D, 16, 26, 7B, FA, C7, 6C, AF), BYTES_TO_WORDS_8(7E, 13, 77, F6, 15, A2, 13, A7),
+        BYTES_TO_WORDS_8(DE, 92, CC, 2F, 09, D2, E9, 49), BYTES_TO_WORDS_8(65, 3E, B2, 52, C7, 44, 73, 61),
+        BYTES_TO_WORDS_8(86, A2, B2, 86, CB, FD, 9B, C4), BYTES_TO_WORDS_8(A4, 71, 71, E3, 16, AC, 99, 98),
+        BYTES_TO_WORDS_8(B2, 20, 82, D1, 0B, D1, B7, 49), BYTES_TO_WORDS_8(5A, 83, 37, A4, 17, 16, 90, E9) },
+      { BYTES_TO_WORDS_8(D4, 2B, 36, 74, 65, 30, 40, 25), BYTES_TO_WORDS_8(3D, C0, 6B, 2F, 21, 9A, 13, 5D),
+        BYTES_TO_WORDS_8(4F, FF, 3E, 84, B1, C0, F1, 33), BYTES_TO_WORDS_8(44, CF, CE, 21, 23, 0F, 5D, E1),
+        BYTES_TO_WORDS_8(B8, 6F, B4, AF, DA, CC, 6A, BE), BYTES_TO_WORDS_8(69, 82, 46, A4, F8, 4B, ED, 23),
+        BYTES_TO_WORDS_8(26, E3, 8B, 30, 39, E0, BF, C1), BYTES_TO_WORDS_8(2E, C2, 7E, 70, E2, CB, 84, 9A) },
+      { BYTES_TO_WORDS_8(70, 27, 44, 50, 66, F7, 1B, 02), BYTES_TO_WORDS_8(D1, BA, 01, E1, A6, F7, 18, 90),
+        BYTES_TO_WORDS_8(2E, FC, 40, 9E, DA, C1, 04, DA), BYTES_TO_WORDS_8(22, 6A, FB, 55, EE, 03, AC, F8),
+        BYTES_TO_WORDS_8(2D, C8, 00, 1B, F1, 64, 28, 3A), BYTES_TO_WORDS_8(02, 1D, 04, 95, BF, 02, 76, A9),
+        BYTES_TO_WORDS_8(17, 6D, 4E, B3, 51, C7, 36, A4), BYTES_TO_WORDS_8(8E, 1E, 9D, 59, 65, 8E, 35, 5A) },
+      { BYTES_TO_WORDS_8(E4, FF, EF, 31, 77, 87, 63, C3), BYTES_TO_WORDS_8(DC, F9, AA, E2, FF, DB, 43, AA),
+        BYTES_TO_WORDS_8(AB, 31, A0, C6, 60, 90, AA, 5B), BYTES_TO_WORDS_8(A1, 61, 29, F2, 83, 3E, 1E, 0C),
+        BYTES_TO_WORDS_8(24, 78, 6A, 89, DA, 48, CB, 5C), BYTES_TO_WORDS_8(53, B6, 25, 56, 6B, DB, F7, 92),
+        BYTES_TO_WORDS_8(16, D2, 60, AF, 2A, F2, 69, E8), BYTES_TO_WORDS_8(5D, 4B, D7, 4D, F6, 0D, 19, 59) },
+      { BYTES_TO_WORDS_8(DE, 60, 54, F6, 86, 6D, E0, FB), BYTES_TO_WORDS_8(B8, 77, BF, AA, D0, F8, 73, 0C),
+        BYTES_TO_WORDS_8(A6, 8E, CC, 30, BE, BC, 6C, 6C), BYTES_TO_WORDS_8(C6, 95, BC, 25, B5, 1F, 73, 8A),
+        BYTES_TO_WORDS_8(07, C2, 8D, FF, 1D, 9A, 85, E9), BYTES_TO_WORDS_8(E3, 8E, 50, 52, 3C, 7E, 86, 35),
+        BYTES_TO_WORDS_8(C4, 4D, B0, FF, 4B, 95, 52, 8F), BYTES_TO_WORDS_8(19, 63, AB, E2, C5, 55, 58, 58) },
+      { BYTES_TO_WORDS_8(65, 9C, 9F, 36, 3B, B9, 76, D3), BYTES_TO_WORDS_8(66, CC, 40, 28, B9, 73, 42, 5B),
+        BYTES_TO_WORDS_8(DC, 34, 6D, DC, 87, 41, F9, 58), BYTES_TO_WORDS_8(3D, 55, B5, DD, 89, 88, A3, E7),
+        BYTES_TO_WORDS_8(5C, EE, A7, AC, E0, E4, 1B, 3B), BYTES_TO_WORDS_8(B7, 1A, 7D, 18, 94, 2B, A2, 58),
+        BYTES_TO_WORDS_8(BD, 45, 21, 19, 26, 7B, E3, 08), BYTES_TO_WORDS_8(72, 91, 21, B1, BA, B5, 37, 54) } },
+    /* (1..8) * 16^38 * G */
+    { { BYTES_TO_WORDS_8(16, 8C, 37, 12, 1B, DC, C6, DD), BYTES_TO_WORDS_8(2A, 62, 15, 46, 55, 07, 36, 9E),
+        BYTES_TO_WORDS_8(7D, 59, F9, 6B, 2D, E5, 19, B3), BYTES_TO_WORDS_8(11, 3B, 2B, C1, 59, B7, 36, 11),
+        BYTES_TO_WORDS_8(27, 81, 48, B3, D0, 9B, F5, 79), BYTES_TO_WORDS_8(E3, CC, 51, E7, 28, AA, 14, 96),
+        BYTES_TO_WORDS_8(B2, EC, E9, 0F, C6, AB, F0, 09), BYTES_TO_WORDS_8(DD, 8F, 16, 45, CF, 0F, EC, 7D) },
+      { BYTES_TO_WORDS_8(77, 39, 4D, F3, FF, DA, E6, D0), BYTES_TO_WORDS_8(5F, 14, D0, 18, 0A, 41, 5C, D9),
+        BYTES_TO_WORDS_8(72, 50, 44, B6, 11, 8C, 6F, 08), BYTES_TO_WORDS_8(4D, 98, 59, 81, 73, F5, F1, 11),
+        BYTES_TO_WORDS_8(71, 4B, 15, 00, EA, 90, BC, 14), BYTES_TO_WORDS_8(06, 82, C6, 3D, 3F, 95, 7E, 93),
+        BYTES_TO_WORDS_8(C7, 48, A7, D3, 87, 9F, 82, CB), BYTES_TO_WORDS_8(85, B9, C0, 79, B5, C1, 98, AB) },
+      { BYTES_TO_WORDS_8(40, 97, 29, 7B, 82, 6D, 0E, 97), BYTES_TO_WORDS_8(34, B1, 3D, 71, 7D, 46, 0F, F4),
+        BYTES_TO_WORDS_8(48, AD, FA, 93, 37, D1, 4A, CC), BYTES_TO_WORDS_8(36, 43, DD, 1C, B7, 3E, 89, 53),
+        BYTES_TO_WORDS_8(09, 75, FF, 3F, 1B, 6F, EA, 51), BYTES_TO_WORDS_8(CD, E8, FD, 21, EF, 32, A1, D8),
+        BYTES_TO_WORDS_8(8D, DC, 75, EA, 28, CE, 41, 38), BYTES_TO_WORDS_8(D8, FB, 85, 94, 7E, 8A, 72, 27) },
+      { BYTES_TO_WORDS_8(96, 6A, 6A, 4D, A8, 0C, 84, BE), BYTES_TO_WORDS_8(3F, 61, 2E, 9A, 77, 9A, 3B, 95),
+        BYTES_TO_WORDS_8(86, 25, 7D, 5E, B7, 18, 80, 9B), BYTES_TO_WORDS_8(48, DC, 1C, AA, B9, 89, 4C, 93),
+        BYTES_TO_WORDS_8(ED, 38, D8, 33, 85, 14, EF, EB), BYTES_TO_WORDS_8(9F, CA, E4, E2, F0, 2D, 7D, 10),
+        BYTES_TO_WORDS_8(9D, 2E, 1B, B3, D6, D6, 16, 45), BYTES_TO_WORDS_8(0A, F4, CA, BC, FF, F4, 6A, 85) },
+      { BYTES_TO_WORDS_8(FC, 00, 80, 73, 56, C9, B3, 30), BYTES_TO_WORDS_8(C1, 3B, F0, 7B, 70, 27, 1E, 4E),
+        BYTES_TO_WORDS_8(60, E5, FA, F1, BA, 76, E3, 57), BYTES_TO_WORDS_8(27, DA, 4C, 75, DD, E9, 64, DD),
+        BYTES_TO_WORDS_8(12, AC, F4, DD, 50, 1C, AA, BF), BYTES_TO_WORDS_8(F8, 48, 1E, B9, 22, D0, 45, BE),
+        BYTES_TO_WORDS_8(FF, 79, CA, 19, 3E, 9E, F8, 6D), BYTES_TO_WORDS_8(C9, 32, 29, 0C, EB, 93, 21, 43) },
+      { BYTES_TO_WORDS_8(B8, A9, 3A, 57, 20, 60, E5, FC), BYTES_TO_WORDS_8(24, D2, 9E, 82, B8, 50, 71, DF),
+        BYTES_TO_WORDS_8(67, F4, 95, B2, 7F, 22, A3, 5A), BYTES_TO_WORDS_8(43, 69, 2C, 59, 7B, 25, BD, D1),
+        BYTES_TO_WORDS_8(1B, D8, 51, 2B, 49, 68, 65, C1), BYTES_TO_WORDS_8(42, 73, CF, 84, D7, 33, CE, 75),
+        BYTES_TO_WORDS_8(41, 0E, 6A, 39, 2E, 92, B4, D0), BYTES_TO_WORDS_8(26, 05, C6, 4B, CC, C0, 7C, 17) },
+      { BYTES_TO_WORDS_8(4A, 8C, 87, 33, 17, 15, 82, EF), BYTES_TO_WORDS_8(55, C0, 51, 85, 3C, D0, 83, D8),
+        BYTES_TO_WORDS_8(21, 1B, A9, E4, 60, 9C, C6, F2), BYTES_TO_WORDS_8(16, D5, FF, 7E, A8, 45, 98, FF),
+        BYTES_TO_WORDS_8(68, DF, 88, 74, 7D, 84, A6, 6B), BYTES_TO_WORDS_8(BC, FE, 5C, B6, 46, 37, F3, F1),
+        BYTES_TO_WORDS_8(DD, E8, F5, DF, 8E, A4, D8, 8F), BYTES_TO_WORDS_8(8F, 42, E2, A4, F4, 9A, 5B, 83) },
+      { BYTES_TO_WORDS_8(C8, 06, C5, AC, A4, 5E, BF, FE), BYTES_TO_WORDS_8(11, 35, 3A, 8D, 01, 0F, 03, A8),
+        BYTES_TO_WORDS_8(C3, 09, DA, 5C, 66, 32, 58, 8F), BYTES_TO_WORDS_8(15, F2, 9D, 9A, 5C, 88, 00, 4D),
+        BYTES_TO_WORDS_8(2C, AA, 35, 18, 0E, 66, FA, D4), BYTES_TO_WORDS_8(33, E1, 6C, A5, CA, 7A, D1, 45),
+        BYTES_TO_WORDS_8(A1, 88, FE, 09, 44, 47, C0, 14), BYTES_TO_WORDS_8(F2, C7, 71, 96, 3A, 3C, 85, 3F) } },
+    /* (1..8) * 16^39 * G */
+    { { BYTES_TO_WORDS_8(2A, 83, 3E, 94, F1, 2E, 76, 9C), BYTES_TO_WORDS_8(70, DF, 86, 17, B0, 0A, E5, 07),
+        BYTES_TO_WORDS_8(8E, F1, 89, 25, A8, 73, F5, 90), BYTES_TO_WORDS_8(1A, A5, C2, A7, 8B, F2, 2B, 0D),
+        BYTES_TO_WORDS_8(7C, D3, 20, 5B, F1, 3A, 26, 48), BYTES_TO_WORDS_8(46, 14, 55, 60, B9, 9D, EC, 27),
+        BYTES_TO_WORDS_8(ED, E7, B4, 94, 0A, A1, 87, 70), BYTES_TO_WORDS_8(AC, 00, BD, 13, 43, 3F, AC, 0C) },
+      { BYTES_TO_WORDS_8(BD, 05, 83, A3, 70, BD, 43, FE), BYTES_TO_WORDS_8(56, 68, 9B, 8F, 6C, F0, 63, 0B),
+        BYTES_TO_WORDS_8(61, B7, 9D, F8, 8B, 21, E9, FB), BYTES_TO_WORDS_8(D8, BA, 0E, 62, C3, ED, FE, 84),
+        BYTES_TO_WORDS_8(A9, BB, 73, 60, F8, 1F, F4, FF), BYTES_TO_WORDS_8(3B, C5, 32, DB, 2D, E1, 68, 25),
+        BYTES_TO_WORDS_8(48, 39, DA, 17, 5C, 5B, 3F, 4A), BYTES_TO_WORDS_8(65, C1, C7, A9, D5, BB, 99, F1) },
+      { BYTES_TO_WORDS_8(66, 96, 2C, 11, BC, C4, EA, 61), BYTES_TO_WORDS_8(F3, CD, FF, 65, C3, C6, F8, 1C),
+        BYTES_TO_WORDS_8(1B, 53, D9, B7, 35, CC, 9B, FD), BYTES_TO_WORDS_8(2C, F8, 67, B9, 5E, E8, E5, 34),
+        BYTES_TO_WORDS_8(66, 36, 2A, 99, 3C, 85, A1, B5), BYTES_TO_WORDS_8(26, A5, E3, C1, 63, ED, 47, 0F),
+        BYTES_TO_WORDS_8(33, 46, BC, CC, 75, 65, 84, 82), BYTES_TO_WORDS_8(6B, A3, 21, 32, 31, 68, CE, C0) },
+      { BYTES_TO_WORDS_8(83, AF, FA, A1, A2, 54, 25, 58), BYTES_TO_WORDS_8(F0, 03, 3E, F0, 34, 9F, 39, 3C),
+        BYTES_TO_WORDS_8(EB, FD, D7, DF, 71, 18, 50, 21), BYTES_TO_WORDS_8(D4, 5B, 47, CB, 86, 08, 89, 5D),
+        BYTES_TO_WORDS_8(BA, 1F, E3, 2C, FF, 13, 84, 49), BYTES_TO_WORDS_8(D2, 33, 46, 21, 79, 71, 5B, 75),
+        BYTES_TO_WORDS_8(6D, 61, B0, 6C, EF, 4D, B1, 46), BYTES_TO_WORDS_8(9A, F6, A2, 84, BD, 38, 09, 97) },
+      { BYTES_TO_WORDS_8(02, 95, 20, 51, E3, 2B, 65, C1), BYTES_TO_WORDS_8(65, 26, D9, 25, 00, 72, 41, 59),
+        BYTES_TO_WORDS_8(54, E1, 19, 09, EF, 93, C4, A6), BYTES_TO_WORDS_8(63, D8, F4, 59, CC, 62, 73, 72),
+        BYTES_TO_WORDS_8(0D, 2B, 04, D7, D3, D1, 77, C6), BYTES_TO_WORDS_8(BB, 60, 27, BB, F9, 37, 8D, A1),
+        BYTES_TO_WORDS_8(20, 1D, E9, 2C, 8C, 0B, 10, 9F), BYTES_TO_WORDS_8(58, AB, AB, 9B, 22, F4, B0, 17) },
+      { BYTES_TO_WORDS_8(21, 15, 89, 3F, BA, 15, FA, C5), BYTES_TO_WORDS_8(66, D1, A2, 35, 8C, A2, 65, 20),
+        BYTES_TO_WORDS_8(3B, 59, 70, 0A, 19, 3D, F7, 2E), BYTES_TO_WORDS_8(04, A9, D7, 4F, 57, D1, AF, B5),
+        BYTES_TO_WORDS_8(F2, AC, D1, F0, C0, 31, CE, AA), BYTES_TO_WORDS_8(61, 1D, 54, 4E, 93, F9, D4, BD),
+        BYTES_TO_WORDS_8(8F, 38, E6, 08, A6, 73, C5, 71), BYTES_TO_WORDS_8(CB, 79, 01, 88, AC, A0, 55, 79) },
+      { BYTES_TO_WORDS_8(59, F9, 47, A4, 28, 79, 5E, 45), BYTES_TO_WORDS_8(68, D3, 71, 82, BA, DA, 47, F9),
+        BYTES_TO_WORDS_8(E9, EE, 49, BB, C4, 14, 3A, 97), BYTES_TO_WORDS_8(EC, 6C, 4A, 05, 60, F2, C3, A0),
+        BYTES_TO_WORDS_8(1F, 67, 8B, 96, 48, D2, 39, B0), BYTES_TO_WORDS_8(C9, 72, D2, 58, 02, 54, B5, B1),
+        BYTES_TO_WORDS_8(08, 82, 62, CB, 10, 8C, 2F, 38), BYTES_TO_WORDS_8(4F, 2C, 4B, 0E, 09, 73, 8C, 50) },
+      { BYTES_TO_WORDS_8(74, 88, FF, BD, B8, C5, 04, 06), BYTES_TO_WORDS_8(5E, D3, 40, 16, FC, CA, C3, 1B),
+        BYTES_TO_WORDS_8(29, 16, 0E, 41, 45, 48, D7, F5), BYTES_TO_WORDS_8(9C, E6, 99, 46, 81, C5, E1, A6),
+        BYTES_TO_WORDS_8(AF, 6D, 07, 93, EF, D8, 85, 18), BYTES_TO_WORDS_8(14, B2, 12, 38, 9F, 99, 89, B7),
+        BYTES_TO_WORDS_8(FD, 2E, 5A, EF, A9, E0, B1, 24), BYTES_TO_WORDS_8(E6, 27, A8, DF, 34, AE, 25, 0C) } },
+    /* (1..8) * 16^40 * G */
+    { { BYTES_TO_WORDS_8(2A, 2F, F8, F7, 5D, C7, E9, AE), BYTES_TO_WORDS_8(3A, F4, FD, 4A, 87, 35, 4C, 9E),
+        BYTES_TO_WORDS_8(26, 13, 37, 37, F4, 2D, 62, F5), BYTES_TO_WORDS_8(17, 36, C7, 6E, 56, 5F, 53, 8A),
+        BYTES_TO_WORDS_8(B7, 94, 30, 22, AC, A0, F9, C5), BYTES_TO_WORDS_8(69, 76, 8C, 4C, 86, 33, E5, CD),
+        BYTES_TO_WORDS_8(BF, 92, 5A, 08, 19, 28, E0, 37), BYTES_TO_WORDS_8(D7, 8B, B0, 68, 84, C0, 55, 04) },
+      { BYTES_TO_WORDS_8(36, 7F, CD, 01, C4, 43, B0, E8), BYTES_TO_WORDS_8(9B, 14, 19, 94, F1, C8, 99, 57),
+        BYTES_TO_WORDS_8(17, FA, BD, 48, 60, 2C, 6E, D3), BYTES_TO_WORDS_8(84, 4D, 81, 88, 7A, A1, AF, 4E),
+        BYTES_TO_WORDS_8(43, 1C, 2D, 0B, 4A, C6, 78, C7), BYTES_TO_WORDS_8(D2, 43, 45, AD, 8C, A5, 36, 50),
+        BYTES_TO_WORDS_8(7B, C4, EF, 27, 15, 53, 45, EE), BYTES_TO_WORDS_8(1F, 20, EC, 51, D8, 74, 79, A4) },
+      { BYTES_TO_WORDS_8(A0, 8F, 34, AB, 17, F2, 14, FB), BYTES_TO_WORDS_8(DD, 41, 15, 05, 59, 24, FE, E0),
+        BYTES_TO_WORDS_8(BC, B4, 24, 6C, 23, 23, A2, C2), BYTES_TO_WORDS_8(2D, 88, EB, DD, 3D, C9, EA, 86),
+        BYTES_TO_WORDS_8(EE, 1C, A5, 4D, 95, 80, E3, 4E), BYTES_TO_WORDS_8(8A, EE, CF, 51, 63, D9, 26, 6C),
+        BYTES_TO_WORDS_8(71, 46, 6F, 8D, 9E, 6F, 43, 5A), BYTES_TO_WORDS_8(8D, 4D, BC, CB, 53, 38, 8F, 94) },
+      { BYTES_TO_WORDS_8(FB, 14, 62, B9, 54, 9D, 31, CC), BYTES_TO_WORDS_8(65, C7, EB, 8F, 7A, 98, DC, 71),
+        BYTES_TO_WORDS_8(89, C5, F1, CD, 96, E4, A9, CD), BYTES_TO_WORDS_8(25, DB, BF, 4F, C4, 2F, 12, C6),
+        BYTES_TO_WORDS_8(F7, FF, AD, B7, 8F, BD, 02, 37), BYTES_TO_WORDS_8(8A, 1F, 27, 1E, 8C, E4, A6, 08),
+        BYTES_TO_WORDS_8(1F, F9, 77, 88, 86, C9, 31, 90), BYTES_TO_WORDS_8(41, AC, 43, 83, EC, 5B, 20, EA) },
+      { BYTES_TO_WORDS_8(03, 2C, 22, 99, FC, 1F, F4, 7A), BYTES_TO_WORDS_8(03, E1, E5, 87, 7E, E7, 8C, 94),
+        BYTES_TO_WORDS_8(07, F4, 59, 48, 78, 7D, 5E, 3F), BYTES_TO_WORDS_8(AE, 3A, FB, F9, BA, 9E, F0, 8B),
+        BYTES_TO_WORDS_8(54, BB, 72, EA, 42, F7, 45, A1), BYTES_TO_WORDS_8(D4, E1, 20, DE, E1, C0, 9E, 9C),
+        BYTES_TO_WORDS_8(30, BA, E5, E7, DB, B1, 48, 3B), BYTES_TO_WORDS_8(73, 7A, E2, E2, AF, BA, 9C, 50) },
+      { BYTES_TO_WORDS_8(FD, 5B, 21, 8D, 7A, 97, 86, 16), BYTES_TO_WORDS_8(B7, 62, 14, 7F, 26, 74, E0, 8B),
+        BYTES_TO_WORDS_8(24, 5D, D6, A2, 0E, 22, B6, 85), BYTES_TO_WORDS_8(9E, 62, 52, 1F, BE, CE, 4F, 8B),
+        BYTES_TO_WORDS_8(6B, C2, 5E, 47, 0A, F0, EA, 06), BYTES_TO_WORDS_8(D6, AD, 21, 9D, D0, 02, D5, F9),
+        BYTES_TO_WORDS_8(FF, 54, 92, DA, CA, B1, 6F, F9), BYTES_TO_WORDS_8(7E, 15, 22, A8, A9, 07, 33, 1F) },
+      { BYTES_TO_WORDS_8(00, 93, AE, D1, C1, A2, 53, B4), BYTES_TO_WORDS_8(80, 82, C4, 75, 04, 47, 1C, 5E),
+        BYTES_TO_WORDS_8(5B, 73, F3, A2, AD, 0B, 13, 19), BYTES_TO_WORDS_8(C6, 0F, E7, B7, CB, 2D, 5E, E8),
+        BYTES_TO_WORDS_8(5E, E2, 46, 15, DD, DF, A0, 72), BYTES_TO_WORDS_8(BB, 31, 8C, DF, 85, E1, B7, DE),
+        BYTES_TO_WORDS_8(07, 27, 3C, 82, 5B, 7B, BA, C7), BYTES_TO_WORDS_8(BF, E0, 1C, D5, A6, AF, 1A, 45) },
+      { BYTES_TO_WORDS_8(84, 6B, 9D, 0E, ED, E9, 7B, E9), BYTES_TO_WORDS_8(87, B9, 86, EE, DD, FF, 4F, 6F),
+        BYTES_TO_WORDS_8(DA, 9F, 01, 13, 2C, 04, B4, 24), BYTES_TO_WORDS_8(37, 21, 81, C1, 22, 40, D9, B6),
+        BYTES_TO_WORDS_8(21, CB, A7, BC, 0F, AA, BC, E1), BYTES_TO_WORDS_8(2A, 38, 4F, EC, EA, 73, 32, C2),
+        BYTES_TO_WORDS_8(D3, 7A, D7, 84, 88, 47, 34, 86), BYTES_TO_WORDS_8(23, 87, 92, 62, 41, 3F, FF, 93) } },
+    /* (1..8) * 16^41 * G */
+    { { BYTES_TO_WORDS_8(1D, C8, 76, E4, 4F, 7F, 83, 9C), BYTES_TO_WORDS_8(5E, 3D, E5, 99, 0E, 03, A3, B7),
+        BYTES_TO_WORDS_8(66, A3, A8, 3D, 27, CD, F7, 9A), BYTES_TO_WORDS_8(01, 1A, B4, DC, DF, 90, 60, AD),
+        BYTES_TO_WORDS_8(DD, 05, 67, EE, 84, BC, 8A, 81), BYTES_TO_WORDS_8(DF, 48, 30, 4F, 36, DC, 3F, 39),
+        BYTES_TO_WORDS_8(A8, D8, 5B, CC, C2, 75, CD, AC), BYTES_TO_WORDS_8(1E, C9, F4, 48, DD, D1, B5, 77) },
+      { BYTES_TO_WORDS_8(4B, 76, ED, CA, C0, 0D, 18, AD), BYTES_TO_WORDS_8(B5, 4C, BD, 86, 75, 1D, 7F, 22),
+        BYTES_TO_WORDS_8(1F, A1, F6, 66, CA, F6, 26, 26), BYTES_TO_WORDS_8(DC, 84, BC, 81, DA, 73, 45, 7E),
+        BYTES_TO_WORDS_8(F7, F2, C2, 17, 5F, 11, 83, 9C), BYTES_TO_WORDS_8(B4, 7F, 1E, D1, C7, F3, ED, 2F),
+        BYTES_TO_WORDS_8(0B, B2, 51, 36, C9, 9F, BB, F1), BYTES_TO_WORDS_8(25, 9F, 06, 96, FD, EF, BB, 8C) },
+      { BYTES_TO_WORDS_8(90, 54, 72, E2, 7C, 73, 24, 0A), BYTES_TO_WORDS_8(90, 59, CB, 23, 06, 24, C3, 4A),
+        BYTES_TO_WORDS_8(3C, 86, 09, 3B, 53, AA, AD, A2), BYTES_TO_WORDS_8(7C, 69, AD, 71, BB, 45, 0B, D9),
+        BYTES_TO_WORDS_8(99, 12, EB, AF, 84, 4F, F8, B0), BYTES_TO_WORDS_8(CC, 66, C4, F3, BF, 07, DC, 0C),
+        BYTES_TO_WORDS_8(D8, CB, 78, 73, 68, B5, D8, 09), BYTES_TO_WORDS_8(0F, 35, BB, C1, 8E, 92, 26, 33) },
+      { BYTES_TO_WORDS_8(3E, E0, F0, C3, 56, 2B, 25, B5), BYTES_TO_WORDS_8(3D, 7A, 18, 50, 5F, 65, 9C, 1A),
+        BYTES_TO_WORDS_8(5F, C2, 30, FC, C8, AA, 77, 79), BYTES_TO_WORDS_8(1F, 02, 65, BF, 3C, 58, 13, AF),
+        BYTES_TO_WORDS_8(22, CB, 5C, 57, FC, 5B, 2F, BB), BYTES_TO_WORDS_8(84, DC, E1, A3, FF, ED, 20, CA),
+        BYTES_TO_WORDS_8(F8, D6, 83, 6D, E4, 0B, F6, DB), BYTES_TO_WORDS_8(B3, 57, 9B, 1A, F8, 31, FE, F8) },
+      { BYTES_TO_WORDS_8(68, 36, 93, 7E, 65, 3A, 6B, A7), BYTES_TO_WORDS_8(F0, AB, 6B, F8, 4C, D8, 02, FB),
+        BYTES_TO_WORDS_8(BE, 06, 1F, FA, 3A, 39, 05, AC), BYTES_TO_WORDS_8(C7, 3F, 21, 31, 17, 92, 25, AC),
+        BYTES_TO_WORDS_8(B5, 6F, 77, 32, 67, 7F, E7, 16), BYTES_TO_WORDS_8(7A, 1E, 9E, C6, 89, 41, 86, 6F),
+        BYTES_TO_WORDS_8(7C, ED, D8, EB, 3E, C1, 0E, 85), BYTES_TO_WORDS_8(BA, A8, DB, 70, 38, A0, 79, 6C) },
+      { BYTES_TO_WORDS_8(83, A4, 2C, B6, 6C, 27, 0B, 56), BYTES_TO_WORDS_8(E6, CE, C6, 6D, FD, 7B, 67, C3),
+        BYTES_TO_WORDS_8(AF, 1D, 31, 12, 9C, C9, D9, 9C), BYTES_TO_WORDS_8(AF, 77, 25, 40, 2C, 0D, 2A, D3),
+        BYTES_TO_WORDS_8(18, 5B, 43, FA, DD, A5, 59, 49), BYTES_TO_WORDS_8(17, 3D, 0D, 76, 2B, 58, 4C, 6D),
+        BYTES_TO_WORDS_8(D9, D0, 97, 05, 47, 62, A2, 73), BYTES_TO_WORDS_8(30, 4B, A7, 78, AD, D4, 17, 0D) },
+      { BYTES_TO_WORDS_8(E3, E7, 8D, 12, 12, 7C, 61, 9A), BYTES_TO_WORDS_8(6D, 99, EA, AB, C3, 2A, 84, 86),
+        BYTES_TO_WORDS_8(BF, 31, B4, A7, BD, 0F, 32, 87), BYTES_TO_WORDS_8(A8, F3, 79, E9, 4A, 37, C3, 7B),
+        BYTES_TO_WORDS_8(29, 5E, 6E, AE, 2E, B3, A0, 67), BYTES_TO_WORDS_8(F0, CC, C0, B4, 39, DB, F2, 55),
+        BYTES_TO_WORDS_8(BD, AC, 4B, 6E, AE, 77, 0C, E0), BYTES_TO_WORDS_8(5D, 4E, 85, 60, 24, F0, 31, B4) },
+      { BYTES_TO_WORDS_8(B9, FC, C3, 8F, 11, BC, 2F, 14), BYTES_TO_WORDS_8(69, B9, 81, 98, 93, A6, A3, B2),
+        BYTES_TO_WORDS_8(D0, AD, E7, AB, 51, 16, E9, 28), BYTES_TO_WORDS_8(D6, 44, A7, CD, F6, 35, 25, DA),
+        BYTES_TO_WORDS_8(9F, 86, 2A, 90, 93, 61, 08, 78), BYTES_TO_WORDS_8(D9, 60, 09, 6A, 24, F5, 8D, ED),
+        BYTES_TO_WORDS_8(D3, CD, 0D, 51, 68, 4C, 45, 24), BYTES_TO_WORDS_8(F2, 6D, 48, 27, 3C, 08, 56, E7) } },
+    /* (1..8) * 16^42 * G */
+    { { BYTES_TO_WORDS_8(05, A2, C4, 93, 36, 2C, 2F, A5), BYTES_TO_WORDS_8(48, A8, 10, F5, 89, DF, 1A, DE),
+        BYTES_TO_WORDS_8(FC, 29, B9, 75, 70, 55, 66, E4), BYTES_TO_WORDS_8(C4, BB, 05, 63, 51, 6C, E0, B6),
+        BYTES_TO_WORDS_8(05, 6D, B3, 5D, 86, 4D, 7F, 53), BYTES_TO_WORDS_8(87, 9F, 2A, A8, 19, 94, F9, 63),
+        BYTES_TO_WORDS_8(3B, D7, 9E, E7, 26, F1, E1, C5), BYTES_TO_WORDS_8(F5, 23, B3, 21, 7C, 27, B4, BD) },
+      { BYTES_TO_WORDS_8(44, FC, DC, FC, F9, 15, F3, 29), BYTES_TO_WORDS_8(13, EB, 97, D7, C6, 74, 36, AF),
+        BYTES_TO_WORDS_8(8D, 1E, EE, 7B, A0, 03, 57, E5), BYTES_TO_WORDS_8(BF, DD, F8, F5, A4, 27, 17, A6),
+        BYTES_TO_WORDS_8(0E, D6, F3, 0E, 7F, 2A, B8, 93), BYTES_TO_WORDS_8(F3, 80, F0, 62, 04, 01, B9, C1),
+        BYTES_TO_WORDS_8(58, E1, BA, 2B, 5A, 2D, 69, DE), BYTES_TO_WORDS_8(6A, 69, 02, 9B, 4F, 9E, FD, 03) },
+      { BYTES_TO_WORDS_8(07, 79, E2, F9, F6, 21, F8, 92), BYTES_TO_WORDS_8(D6, E4, D9, 88, B3, D4, 1A, 77),
+        BYTES_TO_WORDS_8(68, BD, DF, 6F, 5D, 5D, 39, 6B), BYTES_TO_WORDS_8(4E, 1C, 24, 84, 3F, E4, D9, 0E),
+        BYTES_TO_WORDS_8(FB, C4, 78, 6E, 50, 4F, 3F, F1), BYTES_TO_WORDS_8(05, 19, BA, B8, FE, 1C, 15, E9),
+        BYTES_TO_WORDS_8(0C, 0E, 12, EB, D8, 0F, BC, F5), BYTES_TO_WORDS_8(47, 23, 6B, FF, 4A, 87, AF, B5) },
+      { BYTES_TO_WORDS_8(A4, AE, 3F, 55, 4A, 15, FA, 93), BYTES_TO_WORDS_8(C8, 10, 6B, C9, 81, 71, 4A, 32),
+        BYTES_TO_WORDS_8(9E, 6A, BF, 7C, 4B, F3, 89, 8C), BYTES_TO_WORDS_8(4F, B7, BD, E8, 23, 8F, 70, 27),
+        BYTES_TO_WORDS_8(2F, 2D, 80, D0, 75, DE, 1A, B2), BYTES_TO_WORDS_8(D1, 5B, 96, D1, B3, 68, 6D, FC),
+        BYTES_TO_WORDS_8(73, C9, C2, 6C, D6, 25, 02, 30), BYTES_TO_WORDS_8(A4, A4, CA, 49, 61, 18, 5F, 57) },
+      { BYTES_TO_WORDS_8(54, 8F, B3, 35, 25, 57, D0, 36), BYTES_TO_WORDS_8(CE, 07, AF, 5C, 0E, 86, 2A, 2E),
+        BYTES_TO_WORDS_8(F9, E1, FE, 48, DB, 68, 52, C5), BYTES_TO_WORDS_8(7D, 8F, 6D, 07, 10, E4, A7, 57),
+        BYTES_TO_WORDS_8(09, 28, 5F, 24, E6, 81, A7, 5F), BYTES_TO_WORDS_8(A7, EB, 07, A9, 39, 6E, D7, DF),
+        BYTES_TO_WORDS_8(21, DD, 82, BC, 23, 8A, 4C, 19), BYTES_TO_WORDS_8(24, AD, EC, C8, 03, 0F, 7F, FD) },
+      { BYTES_TO_WORDS_8(01, 90, F6, A0, B7, 81, C0, A8), BYTES_TO_WORDS_8(56, 86, 0C, B3, 57, 9D, C9, CF),
+        BYTES_TO_WORDS_8(4F, 5A, B5, 34, D9, 0C, DD, 57), BYTES_TO_WORDS_8(F7, 3B, 24, AE, 9A, 36, D8, 2E),
+        BYTES_TO_WORDS_8(9E, 51, BA, 2D, 2A, A3, 6C, 61), BYTES_TO_WORDS_8(F9, 44, 92, 5A, C5, 59, 39, 9E),
+        BYTES_TO_WORDS_8(DE, D7, FD, B4, BA, 5D, 8A, F3), BYTES_TO_WORDS_8(8A, F2, 90, 6A, 51, 6D, 91, 8D) },
+      { BYTES_TO_WORDS_8(93, 95, A7, A7, F9, BB, FE, 46), BYTES_TO_WORDS_8(79, 49, 5C, D2, 49, 72, 7A, 34),
+        BYTES_TO_WORDS_8(F3, 5C, CA, 8C, 25, 9B, 2D, F5), BYTES_TO_WORDS_8(BE, 5D, EF, F3, E2, 9A, 79, 24),
+        BYTES_TO_WORDS_8(55, 0D, 92, D0, 75, 8D, 38, D6), BYTES_TO_WORDS_8(98, 13, EB, 9B, 1F, 36, 94, 99),
+        BYTES_TO_WORDS_8(00, E3, 63, D3, A9, D1, C3, 32), BYTES_TO_WORDS_8(7B, 7B, C8, 2E, 26, B5, 36, 94) },
+      { BYTES_TO_WORDS_8(B2, 5F, 44, 97, 45, BF, B5, 7F), BYTES_TO_WORDS_8(10, 65, DA, B2, EC, 4A, 84, B0),
+        BYTES_TO_WORDS_8(6C, AE, 77, AB, 7C, E9, BF, 09), BYTES_TO_WORDS_8(61, DC, 66, AA, 7F, 41, EE, 7C),
+        BYTES_TO_WORDS_8(26, 3A, 22, A8, 61, CD, FF, 4F), BYTES_TO_WORDS_8(1F, E3, D0, 9E, 56, E8, 67, A6),
+        BYTES_TO_WORDS_8(B3, 0B, CF, F9, E7, 71, D8, 96), BYTES_TO_WORDS_8(F5, B9, E5, E1, EB, EF, 40, 30) } },
+    /* (1..8) * 16^43 * G */
+    { { BYTES_TO_WORDS_8(DF, 52, AA, A9, E4, F4, D5, 3C), BYTES_TO_WORDS_8(7F, 62, 2A, B4, B1, 52, C4, 18),
+        BYTES_TO_WORDS_8(E6, EC, 91, D9, 89, 41, BC, 6D), BYTES_TO_WORDS_8(F7, 8B, 60, 7F, C9, 11, A5, 45),
+        BYTES_TO_WORDS_8(6C, C1, 5E, 12, 12, BD, 52, 7B), BYTES_TO_WORDS_8(CE, 55, 29, D2, 27, 9B, 91, 5A),
+        BYTES_TO_WORDS_8(D2, 5A, 62, CB, 7F, 33, E3, 3F), BYTES_TO_WORDS_8(6D, 9B, EA, 73, C7, 0E, BE, 73) },
+      { BYTES_TO_WORDS_8(4A, E4, 03, F0, 1B, 52, CC, 13), BYTES_TO_WORDS_8(F2, E5, A0, B3, B6, 88, 06, 02),
+        BYTES_TO_WORDS_8(75, 1B, AB, 44, 04, CA, F7, 2B), BYTES_TO_WORDS_8(8A, E2, AC, B6, BA, A0, D2, 4C),
+        BYTES_TO_WORDS_8(8D, C3, 19, 7B, A9, EC, 93, 49), BYTES_TO_WORDS_8(D6, A5, 7E, C9, D1, E7, E2, BD),
+        BYTES_TO_WORDS_8(26, D1, 18, 62, 75, 10, 13, 6D), BYTES_TO_WORDS_8(05, 24, D2, 71, C3, 08, DF, 6A) },
+      { BYTES_TO_WORDS_8(7F, BC, 75, AE, EF, 53, 67, 65), BYTES_TO_WORDS_8(1F, FB, F7, B6, 0D, 17, C7, 95),
+        BYTES_TO_WORDS_8(7B, 4C, CD, 17, 12, 0F, F4, 8E), BYTES_TO_WORDS_8(43, 93, 2B, E7, 4F, AC, 57, 0B),
+        BYTES_TO_WORDS_8(A9, E9, 72, 09, DD, 72, F1, 04), BYTES_TO_WORDS_8(62, FC, 49, 40, 0E, 6C, F9, B1),
+        BYTES_TO_WORDS_8(FA, 94, 7E, A5, CF, 34, 8C, F2), BYTES_TO_WORDS_8(B5, F3, A9, 77, 82, BF, ED, CE) },
+      { BYTES_TO_WORDS_8(40, BA, 21, F5, A2, 39, D0, 7A), BYTES_TO_WORDS_8(B2, 9D, 82, A0, 59, E4, C4, ED),
+        BYTES_TO_WORDS_8(44, 45, C8, 21, A0, 57, 33, 32), BYTES_TO_WORDS_8(6B, 77, 24, 7B, 37, FE, 51, 74),
+        BYTES_TO_WORDS_8(F9, DC, 18, E5, D3, 1C, A6, D0), BYTES_TO_WORDS_8(39, 54, 5D, 98, B9, 9E, B0, 36),
+        BYTES_TO_WORDS_8(DE, EA, 64, 84, 19, 02, 90, D6), BYTES_TO_WORDS_8(40, 09, C7, FC, 35, 64, 39, 16) },
+      { BYTES_TO_WORDS_8(FF, 25, 31, 83, CF, 33, 74, 13), BYTES_TO_WORDS_8(42, 81, 5A, 5A, B0, 57, 45, 35),
+        BYTES_TO_WORDS_8(99, AE, 1C, CA, D9, 82, 46, CF), BYTES_TO_WORDS_8(48, D1, 4B, 6E, FB, B3, 78, 11),
+        BYTES_TO_WORDS_8(BD, 6A, 48, D8, 09, 97, 0F, E8), BYTES_TO_WORDS_8(1B, 4D, E5, 08, CD, AD, C8, 0D),
+        BYTES_TO_WORDS_8(D1, 0E, 31, EA, 37, E6, 2D, 38), BYTES_TO_WORDS_8(5B, D9, AB, 9B, EA, 97, D6, DF) },
+      { BYTES_TO_WORDS_8(DF, 2B, 15, A2, 1D, 5E, 15, 82), BYTES_TO_WORDS_8(92, 01, E8, FA, 62, B8, 8C, 00),
+        BYTES_TO_WORDS_8(70, 18, CF, 2A, 8F, 06, 89, 15), BYTES_TO_WORDS_8(F9, 61, 72, 12, 3D, 32, 1F, C3),
+        BYTES_TO_WORDS_8(2D, 02, D2, CC, B6, 21, C1, ED), BYTES_TO_WORDS_8(7D, 63, 30, 10, BE, C1, C9, BF),
+        BYTES_TO_WORDS_8(F1, 14, 64, 93, FD, 6D, C9, 9E), BYTES_TO_WORDS_8(80, 75, BE, AB, 48, DD, 89, 26) },
+      { BYTES_TO_WORDS_8(55, D9, 62, F6, CC, 95, 36, 3B), BYTES_TO_WORDS_8(4F, E4, 8C, B4, 85, D6, 44, 84),
+        BYTES_TO_WORDS_8(93, 56, 27, 8D, 7E, 3B, A8, F8), BYTES_TO_WORDS_8(07, E9, 94, 6F, 82, A0, C7, 8A),
+        BYTES_TO_WORDS_8(AE, 3D, 6B, 64, BE, 2D, 6A, BC), BYTES_TO_WORDS_8(8D, 13, 6C, BD, C5, 81, F4, E3),
+        BYTES_TO_WORDS_8(D9, 9A, B5, 4C, 23, E5, D7, C9), BYTES_TO_WORDS_8(1C, 23, 33, 0F, 92, 40, 0F, C8) },
+      { BYTES_TO_WORDS_8(76, 45, 3F, AB, CB, A8, 47, 6C), BYTES_TO_WORDS_8(04, 19, 6A, 25, AB, 8B, D0, E9),
+        BYTES_TO_WORDS_8(5E, F3, 4E, B8, 3B, 3A, A3, 24), BYTES_TO_WORDS_8(A3, CA, 5D, FE, 0D, DC, 8F, 05),
+        BYTES_TO_WORDS_8(9E, 0E, 11, A0, E1, E3, 45, 3A), BYTES_TO_WORDS_8(59, 77, 75, 60, 92, 13, 80, 1E),
+        BYTES_TO_WORDS_8(1E, 87, B8, 06, 46, 9B, DF, C3), BYTES_TO_WORDS_8(E7, E0, A9, 9E, 9E, 3B, EE, 90) } },
+    /* (1..8) * 16^44 * G */
+    { { BYTES_TO_WORDS_8(7B, F5, 76, 90, B9, 1A, CF, 28), BYTES_TO_WORDS_8(07, C6, CA, CE, E3, 86, 0B, 03),
+        BYTES_TO_WORDS_8(3F, A5, F2, 1C, 50, E3, 27, B9), BYTES_TO_WORDS_8(9C, C7, 80, 48, 56, 18, E1, 20),
+        BYTES_TO_WORDS_8(E6, AF, A7, AD, DB, BE, 83, 85), BYTES_TO_WORDS_8(1E, B7, E1, 40, 9B, DC, E0, 9F),
+        BYTES_TO_WORDS_8(97, E9, 6D, FB, E3, C3, BD, 31), BYTES_TO_WORDS_8(F7, 7E, 43, AC, 52, B3, 67, FF) },
+      { BYTES_TO_WORDS_8(55, 08, C2, D4, 44, 95, 84, 9E), BYTES_TO_WORDS_8(5B, 40, A0, 0B, 0F, 6C, DF, 62),
+        BYTES_TO_WORDS_8(2B, D7, 89, 92, 0D, E1, EF, 3F), BYTES_TO_WORDS_8(07, C3, B5, FB, 4D, 0B, ED, 4E),
+        BYTES_TO_WORDS_8(1F, FD, DF, 8B, 3F, 7A, 08, 4C), BYTES_TO_WORDS_8(3F, FE, 34, 2D, D3, CC, 36, 11),
+        BYTES_TO_WORDS_8(C8, 15, C1, 7F, 28, D3, 41, 19), BYTES_TO_WORDS_8(3A, 69, 56, 8A, 28, FB, E0, AC) },
+      { BYTES_TO_WORDS_8(A4, 1D, 66, 4B, ED, 3A, 9E, 84), BYTES_TO_WORDS_8(5C, 4A, A8, 64, AC, 51, 0A, 94),
+        BYTES_TO_WORDS_8(21, 1A, 06, 03, D9, 7F, 7C, 8F), BYTES_TO_WORDS_8(CE, 06, 66, B8, 5B, 2A, CA, FF),
+        BYTES_TO_WORDS_8(5A, 8A, 9B, AF, 5E, 83, 84, 89), BYTES_TO_WORDS_8(6F, 7F, 68, E5, AD, 87, 8F, 47),
+        BYTES_TO_WORDS_8(8C, 6C, F4, 48, A1, C9, 3C, A5), BYTES_TO_WORDS_8(C8, CD, 71, 2B, E3, B0, 1C, CE) },
+      { BYTES_TO_WORDS_8(2B, 72, 24, 05, E6, 37, D6, 83), BYTES_TO_WORDS_8(E7, 2D, A1, E6, 12, 9F, B9, FE),
+        BYTES_TO_WORDS_8(20, 2D, D1, 8E, 16, B1, 45, 0A), BYTES_TO_WORDS_8(F7, 84, CA, 7A, 7C, 43, E0, 42),
+        BYTES_TO_WORDS_8(C6, 76, EA, 1F, C8, 39, 69, 76), BYTES_TO_WORDS_8(5A, 26, 54, AF, 6D, 2A, EA, DB),
+        BYTES_TO_WORDS_8(3E, EA, B4, C9, CC, 84, FD, BA), BYTES_TO_WORDS_8(EE, 20, D9, 01, 09, DA, E1, 2D) },
+      { BYTES_TO_WORDS_8(22, FD, 8C, 9C, 13, 1E, AC, 3C), BYTES_TO_WORDS_8(58, BE, 36, B6, 71, 06, 2B, 4E),
+        BYTES_TO_WORDS_8(4A, 35, AD, 0D, 15, 35, 65, 63), BYTES_TO_WORDS_8(AB, 16, C1, FF, ED, 9C, 20, FF),
+        BYTES_TO_WORDS_8(35, 55, BC, 93, 4E, B1, 89, 23), BYTES_TO_WORDS_8(94, 4B, 68, C9, 92, 4B, 4F, 0D),
+        BYTES_TO_WORDS_8(C8, F1, CF, 4C, D2, 41, 7D, 20), BYTES_TO_WORDS_8(7E, 0F, 9D, 46, 97, F3, 79, AD) },
+      { BYTES_TO_WORDS_8(26, 94, DC, EC, 78, 74, AD, C4), BYTES_TO_WORDS_8(A4, 82, 53, 93, 07, 1D, 41, 0E),
+        BYTES_TO_WORDS_8(DE, DF, 70, 06, 24, F8, 25, 90), BYTES_TO_WORDS_8(65, D8, 68, C2, FB, DE, 0D, B3),
+        BYTES_TO_WORDS_8(5E, 27, C7, 29, 4B, 10, 3E, F3), BYTES_TO_WORDS_8(8F, 23, C0, AE, 9C, 30, 93, 5B),
+        BYTES_TO_WORDS_8(8B, D4, 83, C9, 1B, 87, B3, 4A), BYTES_TO_WORDS_8(53, C1, 14, C0, D5, 4F, BF, 7D) },
+      { BYTES_TO_WORDS_8(3E, 98, 4E, 8F, 85, E5, 07, E8), BYTES_TO_WORDS_8(7C, F7, 17, 70, C8, 6E, 9E, 6D),
+        BYTES_TO_WORDS_8(15, 4B, 3B, D3, 80, 40, 60, 58), BYTES_TO_WORDS_8(A9, 9B, 07, 0B, 2D, F0, D5, 33),
+        BYTES_TO_WORDS_8(A9, 37, EA, 91, 87, DB, 70, 6D), BYTES_TO_WORDS_8(95, 0C, 63, 59, 92, AA, 71, 7A),
+        BYTES_TO_WORDS_8(EB, A1, BB, 55, 16, D6, C3, 73), BYTES_TO_WORDS_8(84, 47, 9C, D3, 76, 5A, EB, 01) },
+      { BYTES_TO_WORDS_8(04, C9, CE, 7B, C3, 4F, F2, C6), BYTES_TO_WORDS_8(28, C2, 5C, 44, F2, CB, A7, 49),
+        BYTES_TO_WORDS_8(C9, 48, EF, C2, 8F, EA, 99, C4), BYTES_TO_WORDS_8(00, FB, 1A, C5, CC, 96, 0D, 07),
+        BYTES_TO_WORDS_8(6F, 31, AB, A3, B2, 4D, 2F, F6), BYTES_TO_WORDS_8(AC, 1B, 68, 34, 7B, EC, BD, 53),
+        BYTES_TO_WORDS_8(77, E9, F0, 55, 2D, 58, 61, FC), BYTES_TO_WORDS_8(21, BC, 0A, FF, F5, 5E, 91, 9B) } },
+    /* (1..8) * 16^45 * G */
+    { { BYTES_TO_WORDS_8(8F, 3A, 27, 99, E8, 52, 14, DD), BYTES_TO_WORDS_8(4A, D5, 4F, 69, 8E, 47, DD, 3F),
+        BYTES_TO_WORDS_8(C9, DA, D7, DF, 7F, EC, 18, 03), BYTES_TO_WORDS_8(7B, 02, 3A, 72, F8, C4, 9C, 5C),
+        BYTES_TO_WORDS_8(6E, 0D, E8, 5C, 69, CA, DA, AD), BYTES_TO_WORDS_8(B5, CA, 1A, A1, 75, 36, 00, 4F),
+        BYTES_TO_WORDS_8(96, AF, 08, 37, 9D, 58, 27, A8), BYTES_TO_WORDS_8(59, D2, FE, 1D, 7A, E0, EF, 84) },
+      { BYTES_TO_WORDS_8(DE, 91, FC, BC, 27, 43, 2E, 0F), BYTES_TO_WORDS_8(D4, 80, 0F, 5C, 27, 67, D4, 8B),
+        BYTES_TO_WORDS_8(4B, 0A, C2, E4, 72, A0, 24, A8), BYTES_TO_WORDS_8(67, 27, B8, DE, 57, A7, 3E, 0E),
+        BYTES_TO_WORDS_8(4C, F5, 82, F5, 5D, 8C, 5E, 14), BYTES_TO_WORDS_8(83, 53, 9C, 14, 50, 08, AF, BF),
+        BYTES_TO_WORDS_8(B3, AA, 6A, 05, F6, AB, F2, 23), BYTES_TO_WORDS_8(56, 21, AE, FF, 92, BF, F2, 13) },
+      { BYTES_TO_WORDS_8(82, E3, 83, 48, 54, 98, 8C, 8C), BYTES_TO_WORDS_8(F3, 36, 55, F5, CE, 4F, 60, D0),
+        BYTES_TO_WORDS_8(31, 74, 00, 52, 39, 40, E2, 5B), BYTES_TO_WORDS_8(5C, D8, DF, BB, 92, E1, C8, 5A),
+        BYTES_TO_WORDS_8(DC, AA, FE, DD, 9B, 3D, 37, 51), BYTES_TO_WORDS_8(2E, 9D, 4D, 3D, A1, EC, 76, DE),
+        BYTES_TO_WORDS_8(76, 39, 96, F0, F2, FF, C8, 39), BYTES_TO_WORDS_8(80, 8C, 7A, 4C, 00, E5, B7, FC) },
+      { BYTES_TO_WORDS_8(7A, ED, 56, A5, AA, 83, F4, C5), BYTES_TO_WORDS_8(57, 0E, F5, 32, 29, DA, BA, F6),
+        BYTES_TO_WORDS_8(4A, C3, 63, 4F, 03, 04, 4A, 15), BYTES_TO_WORDS_8(4F, 8B, C7, F8, E1, AB, 6C, 9A),
+        BYTES_TO_WORDS_8(2E, A7, 54, A0, 3E, 48, 21, 25), BYTES_TO_WORDS_8(16, 07, 22, D1, AF, 7E, B8, FE),
+        BYTES_TO_WORDS_8(40, 57, 55, 7D, FB, 44, E5, 1D), BYTES_TO_WORDS_8(45, 00, D5, FA, 29, 50, 9F, ED) },
+      { BYTES_TO_WORDS_8(E8, A3, 01, EF, 77, 30, A4, BC), BYTES_TO_WORDS_8(4E, 09, 48, 2E, 43, 65, EB, C6),
+        BYTES_TO_WORDS_8(62, 73, D6, E0, 44, 5D, 51, 2D), BYTES_TO_WORDS_8(18, 21, 91, B7, 98, 06, DC, 99),
+        BYTES_TO_WORDS_8(14, 11, F6, 40, FE, 45, 86, 52), BYTES_TO_WORDS_8(94, F2, F8, D7, 34, 70, A6, B7),
+        BYTES_TO_WORDS_8(44, 00, D8, 71, 11, C7, 7A, 69), BYTES_TO_WORDS_8(BC, 82, B9, 23, DD, 9C, C6, 67) },
+      { BYTES_TO_WORDS_8(45, D1, 74, FC, C1, 8E, 3B, E7), BYTES_TO_WORDS_8(BC, B2, 39, 81, D2, 6B, C9, B9),
+        BYTES_TO_WORDS_8(09, 26, CB, 50, E1, B4, DD, A5), BYTES_TO_WORDS_8(04, 1D, 81, 42, C2, 4D, D4, 9C),
+        BYTES_TO_WORDS_8(F7, 56, D4, 40, 62, 40, 6C, 5C), BYTES_TO_WORDS_8(5D, 6E, 81, FE, FB, B8, 39, 33),
+        BYTES_TO_WORDS_8(A3, 43, 84, DD, BA, D0, 5A, 04), BYTES_TO_WORDS_8(33, 4E, 46, FC, DA, CA, AD, 86) },
+      { BYTES_TO_WORDS_8(AB, 35, D5, 4C, 00, 7B, 3F, 38), BYTES_TO_WORDS_8(C3, 4D, 76, E8, 83, D8, 24, 77),
+        BYTES_TO_WORDS_8(F3, B9, CF, CF, 57, 43, 02, 44), BYTES_TO_WORDS_8(16, 06, 04, 8E, 61, F3, E2, AB),
+        BYTES_TO_WORDS_8(1A, 9C, 7B, 51, 34, 1B, 71, 90), BYTES_TO_WORDS_8(D9, 8D, AC, C3, 18, 7A, DE, 7F),
+        BYTES_TO_WORDS_8(95, F7, 2D, 20, 2B, BF, 0D, DE), BYTES_TO_WORDS_8(93, B2, 55, B7, 4C, D6, 02, 4F) },
+      { BYTES_TO_WORDS_8(87, 80, 5A, 73, 7A, 88, C2, BC), BYTES_TO_WORDS_8(71, 88, 6A, 1D, 81, DE, 18, F3),
+        BYTES_TO_WORDS_8(DC, E4, A2, 99, 80, F0, 80, D8), BYTES_TO_WORDS_8(5C, CF, 59, 1B, 6A, A5, 19, ED),
+        BYTES_TO_WORDS_8(57, E5, 9F, 3A, 87, A0, 6C, E5), BYTES_TO_WORDS_8(46, DA, 96, AE, 5A, FD, 8C, A9),
+        BYTES_TO_WORDS_8(E1, AF, 54, AB, 12, 45, 25, 30), BYTES_TO_WORDS_8(B6, 56, 3B, 6C, 3E, 68, BE, CF) } },
+    /* (1..8) * 16^46 * G */
+    { { BYTES_TO_WORDS_8(B3, 3E, 52, 28, B3, 9A, DD, E7), BYTES_TO_WORDS_8(4A, 6C, 6C, 55, 75, 3A, 1A, 35),
+        BYTES_TO_WORDS_8(E3, CD, 3D, 4F, 44, 18, AC, 46), BYTES_TO_WORDS_8(AB, B5, A8, F8, EB, D4, FF, BA),
+        BYTES_TO_WORDS_8(87, F3, AC, D5, 0C, 30, 78, 19), BYTES_TO_WORDS_8(EE, B6, 48, BF, CF, 1C, 51, 24),
+        BYTES_TO_WORDS_8(9C, C0, 5A, 79, B3, 8E, 3A, 00), BYTES_TO_WORDS_8(83, 5E, C9, DB, C5, 3D, A9, 0F) },
+      { BYTES_TO_WORDS_8(FF, 57, 21, 9D, 0F, AD, 03, AE), BYTES_TO_WORDS_8(EE, F1, 07, 7D, 13, 7B, 81, E9),
+        BYTES_TO_WORDS_8(EE, 8E, EB, E4, 8A, 41, 1A, 75), BYTES_TO_WORDS_8(09, 4A, 87, 57, 86, 6C, FB, CA),
+        BYTES_TO_WORDS_8(88, 89, CE, 73, 81, C0, CE, 16), BYTES_TO_WORDS_8(0E, 9E, 3B, 91, 45, B4, 6A, 9C),
+        BYTES_TO_WORDS_8(E0, E2, B4, 9A, B9, CB, A1, 01), BYTES_TO_WORDS_8(7A, C6, C5, D5, 1E, FB, DA, 2A) },
+      { BYTES_TO_WORDS_8(41, 76, 73, F4, 4E, 9B, 09, D0), BYTES_TO_WORDS_8(3A, E1, C2, 66, C1, C0, FA, 1A),
+        BYTES_TO_WORDS_8(B7, 3F, 56, 36, 12, B5, 78, 77), BYTES_TO_WORDS_8(ED, 89, 1C, 44, 22, 45, B4, 91),
+        BYTES_TO_WORDS_8(E0, BB, 01, E1, 29, 2B, 51, F2), BYTES_TO_WORDS_8(03, 7D, 07, 6E, 66, DC, D7, C9),
+        BYTES_TO_WORDS_8(28, B4, 2F, B0, 5A, 23, 13, 2C), BYTES_TO_WORDS_8(76, A9, FD, 37, BD, 63, 44, 3F) },
+      { BYTES_TO_WORDS_8(F9, 2C, 1B, E5, 8C, EB, 00, 47), BYTES_TO_WORDS_8(5C, 79, BF, A4, 48, 8A, D2, 37),
+        BYTES_TO_WORDS_8(A3, A9, 8E, CF, 27, 9A, 87, 9A), BYTES_TO_WORDS_8(CB, 7C, D3, FA, B2, 90, 48, 89),
+        BYTES_TO_WORDS_8(3B, 9D, 97, 35, C8, 7A, 18, 0D), BYTES_TO_WORDS_8(CB, 2E, BC, A3, 16, 71, 8E, 49),
+        BYTES_TO_WORDS_8(38, E4, 48, FD, FD, AB, A0, 88), BYTES_TO_WORDS_8(11, 30, 5B, 7C, FF, 00, 68, D4) },
+      { BYTES_TO_WORDS_8(DF, 01, DD, 26, B8, BA, A2, C6), BYTES_TO_WORDS_8(B9, EF, 8F, 53, 76, FF, 3E, 74),
+        BYTES_TO_WORDS_8(65, 91, 68, C8, C7, A6, 7E, A3), BYTES_TO_WORDS_8(7A, B0, 2D, E8, 5D, 13, 6D, 29),
+        BYTES_TO_WORDS_8(C8, 0D, 3A, AA, 20, D3, 50, 49), BYTES_TO_WORDS_8(60, 6F, E6, E5, 18, F6, FA, DF),
+        BYTES_TO_WORDS_8(CA, 77, C7, 76, 97, 12, 87, 2B), BYTES_TO_WORDS_8(E4, 45, E1, 92, DD, 4E, 05, 14) },
+      { BYTES_TO_WORDS_8(74, 39, E6, CF, 1C, BB, 7A, 42), BYTES_TO_WORDS_8(DF, A2, 66, 24, ED, 33, 5F, D1),
+        BYTES_TO_WORDS_8(C5, BD, F2, 55, 82, E3, C5, B7), BYTES_TO_WORDS_8(35, 79, 8E, AB, 93, D3, 46, 9B),
+        BYTES_TO_WORDS_8(02, 25, FB, FC, A2, D0, ED, AB), BYTES_TO_WORDS_8(50, 59, 41, F5, 5F, ED, 7E, BF),
+        BYTES_TO_WORDS_8(D6, C5, B9, 26, 1E, F0, 54, 05), BYTES_TO_WORDS_8(A2, 71, 8B, 91, E1, EF, CC, F3) },
+      { BYTES_TO_WORDS_8(DD, F5, 50, D6, 06, 6F, 7E, C6), BYTES_TO_WORDS_8(C8, B2, 91, 21, 24, E1, FF, 54),
+        BYTES_TO_WORDS_8(96, 4A, 9E, F1, F1, C2, 13, 8F), BYTES_TO_WORDS_8(31, 7A, 36, 91, F3, 42, 09, 4B),
+        BYTES_TO_WORDS_8(6D, DC, ED, 7A, CC, 5B, EA, C2), BYTES_TO_WORDS_8(62, 3A, E7, E4, 82, 67, 3C, 02),
+        BYTES_TO_WORDS_8(5F, C2, 13, 56, 01, C1, 55, E0), BYTES_TO_WORDS_8(C0, AB, 6C, 36, A6, AA, 32, 74) },
+      { BYTES_TO_WORDS_8(62, 0D, 46, 7E, 26, 60, FF, BC), BYTES_TO_WORDS_8(36, 99, 13, 94, 1E, 2A, 6E, A2),
+        BYTES_TO_WORDS_8(5B, C5, B8, F8, 78, 76, 69, A1), BYTES_TO_WORDS_8(CD, AA, 81, E4, 29, 8E, 3D, 46),
+        BYTES_TO_WORDS_8(7F, 21, 11, 8C, 88, 50, 66, 22), BYTES_TO_WORDS_8(0A, 9B, 46, DA, 14, AC, 9E, 8F),
+        BYTES_TO_WORDS_8(96, 52, F8, 24, 67, 6C, FD, F1), BYTES_TO_WORDS_8(6E, A6, E2, 7A, 4B, 73, 0F, 40) } },
+    /* (1..8) * 16^47 * G */
+    { { BYTES_TO_WORDS_8(01, 11, 11, BA, D8, 08, 52, 83), BYTES_TO_WORDS_8(5F, 3C, DB, 76, 1A, 0B, 9F, 47),
+        BYTES_TO_WORDS_8(96, 4C, 7E, 25, 4D, A3, 22, ED), BYTES_TO_WORDS_8(66, D7, CE, 8F, 09, 2A, AD, 06),
+        BYTES_TO_WORDS_8(F4, 7E, B3, 5F, 9D, BA, A7, C1), BYTES_TO_WORDS_8(AE, 89, 0E, B7, 82, 9D, 42, DE),
+        BYTES_TO_WORDS_8(A0, 62, EB, B9, 1B, C0, A4, 59), BYTES_TO_WORDS_8(35, 5E, F8, 58, 1C, 8B, 5B, 2D) },
+      { BYTES_TO_WORDS_8(30, B8, 5B, F6, D0, 0B, 1F, 2B), BYTES_TO_WORDS_8(DC, A5, 36, 3B, DA, 3C, FE, 08),
+        BYTES_TO_WORDS_8(1A, 94, E5, BF, 6E, CB, 9A, EB), BYTES_TO_WORDS_8(A5, 55, 98, 5F, 01, E9, 57, F6),
+        BYTES_TO_WORDS_8(FB, 93, B1, 87, 4D, A7, B9, C3), BYTES_TO_WORDS_8(5A, E3, C8, F2, 9C, BA, AB, C2),
+        BYTES_TO_WORDS_8(FF, E7, A0, 5D, D2, 3C, C8, 6D), BYTES_TO_WORDS_8(49, AC, CA, 3B, BB, A8, 77, 80) },
+      { BYTES_TO_WORDS_8(6F, EF, 2B, 70, 47, 38, FC, 76), BYTES_TO_WORDS_8(43, EE, 31, 45, 18, 4F, AE, BB),
+        BYTES_TO_WORDS_8(75, D4, D8, 6B, D6, 8B, F7, 04), BYTES_TO_WORDS_8(72, CD, 3B, 6C, 55, CA, A2, F1),
+        BYTES_TO_WORDS_8(A3, 1C, 6C, 8F, FD, D1, B2, 11), BYTES_TO_WORDS_8(40, 2B, D5, 1F, A8, 7E, B4, B0),
+        BYTES_TO_WORDS_8(68, 01, 02, DC, 17, 54, 45, DF), BYTES_TO_WORDS_8(3E, 31, 88, 04, AF, 59, 9B, B3) },
+      { BYTES_TO_WORDS_8(50, A1, 3F, EB, CE, FF, 47, DB), BYTES_TO_WORDS_8(E7, A6, C5, 0E, 52, 19, 57, 85),
+        BYTES_TO_WORDS_8(25, 96, 97, 94, 2C, 00, EF, F0), BYTES_TO_WORDS_8(0C, F2, E2, F8, C9, AB, 6E, E4),
+        BYTES_TO_WORDS_8(9F, 13, 0B, 4A, 4C, 89, 34, B9), BYTES_TO_WORDS_8(4B, 7E, 22, 4C, C2, 8C, F6, 50),
+        BYTES_TO_WORDS_8(3A, FC, 09, 0C, 81, 02, B0, AD), BYTES_TO_WORDS_8(63, 89, C1, 94, C8, CF, 32, 25) },
+      { BYTES_TO_WORDS_8(67, 53, 45, A0, FC, 28, 60, 80), BYTES_TO_WORDS_8(E0, 13, D6, 24, C8, F2, C4, E6),
+        BYTES_TO_WORDS_8(51, 18, BF, 8E, 65, 01, 19, EE), BYTES_TO_WORDS_8(30, 80, 3B, FE, 49, AD, 24, E9),
+        BYTES_TO_WORDS_8(92, 7E, 25, 28, F8, 8C, D1, 5F), BYTES_TO_WORDS_8(2B, 75, A6, 4F, AA, 31, DA, 52),
+        BYTES_TO_WORDS_8(6F, BB, 6F, 3D, 39, 85, 20, 75), BYTES_TO_WORDS_8(D5, 3E, 14, 9A, 97, 7D, C9, FC) },
+      { BYTES_TO_WORDS_8(54, B8, 6A, 87, EA, BC, F0, E0), BYTES_TO_WORDS_8(94, AF, 94, 22, 8E, B8, AC, A0),
+        BYTES_TO_WORDS_8(97, 50, 39, 96, E0, 04, CB, DF), BYTES_TO_WORDS_8(69, 5F, 52, C7, 59, 69, 13, 38),
+        BYTES_TO_WORDS_8(6B, 27, EF, DF, AA, B5, 15, F6), BYTES_TO_WORDS_8(E6, 0F, 81, DE, 36, 96, A5, 5A),
+        BYTES_TO_WORDS_8(9E, 6A, C0, FA, 7C, 25, E0, 39), BYTES_TO_WORDS_8(11, 84, B1, A0, C6, 6A, 13, 20) },
+      { BYTES_TO_WORDS_8(E7, F1, F8, 42, 39, 09, 1F, E9), BYTES_TO_WORDS_8(E2, F9, D1, 4D, 5D, AA, D4, 8D),
+        BYTES_TO_WORDS_8(F6, 22, FB, 05, 51, 93, 0B, A0), BYTES_TO_WORDS_8(6F, 02, F7, C5, 7D, 9C, 9D, F4),
+        BYTES_TO_WORDS_8(72, 99, 4D, 91, B1, 8A, 22, 92), BYTES_TO_WORDS_8(83, 7A, 4D, 4E, 3C, 01, B0, 01),
+        BYTES_TO_WORDS_8(79, F6, 94, B9, B3, D3, E5, 6A), BYTES_TO_WORDS_8(AE, AC, E3, 03, 42, 5D, 58, F5) },
+      { BYTES_TO_WORDS_8(BE, C4, 33, 58, 7E, 96, 24, 77), BYTES_TO_WORDS_8(14, DC, AC, 59, 07, 97, 6A, E0),
+        BYTES_TO_WORDS_8(F0, 50, 67, 51, F4, 5A, BB, 14), BYTES_TO_WORDS_8(2E, FE, 07, AA, 85, 44, 7A, 10),
+        BYTES_TO_WORDS_8(DC, 80, 7C, C8, 48, EC, 66, 65), BYTES_TO_WORDS_8(4A, 0C, 76, 1D, C9, 4F, 3A, 4D),
+        BYTES_TO_WORDS_8(07, 80, E6, 48, EC, 94, 37, 81), BYTES_TO_WORDS_8(CD, D7, E4, B8, 42, 21, A2, 6E) } },
+    /* (1..8) * 16^48 * G */
+    { { BYTES_TO_WORDS_8(BE, 28, 37, 31, FB, 0F, F2, 6C), BYTES_TO_WORDS_8(4A, B9, C6, A3, 91, 95, 43, 96),
+        BYTES_TO_WORDS_8(C5, 5F, 31, 44, 83, FF, 36, 27), BYTES_TO_WORDS_8(76, 92, 84, A7, 77, 96, D3, A6),
+        BYTES_TO_WORDS_8(F4, F5, 57, C3, 33, B8, BA, F2), BYTES_TO_WORDS_8(9B, 05, 84, 22, 0C, 92, 4A, 82),
+        BYTES_TO_WORDS_8(DF, EC, 27, 2D, BD, BA, B8, 66), BYTES_TO_WORDS_8(16, 88, 0B, 9B, 74, 84, 4F, 67) },
+      { BYTES_TO_WORDS_8(08, BB, 74, 59, 8C, 94, 83, 15), BYTES_TO_WORDS_8(25, DD, EA, AE, CA, B0, F3, 75),
+        BYTES_TO_WORDS_8(86, 10, 2A, 2D, AA, 1C, 66, 4A), BYTES_TO_WORDS_8(0D, E8, 62, CE, D2, DC, 06, 3F),
+        BYTES_TO_WORDS_8(99, 3C, 08, 95, A9, 5D, 65, 89), BYTES_TO_WORDS_8(3E, F5, 88, 5E, 90, 06, 16, 83),
+        BYTES_TO_WORDS_8(2E, 9B, 1D, 93, BE, 07, 58, 98), BYTES_TO_WORDS_8(DB, 22, 19, CE, 50, 25, BC, 08) },
+      { BYTES_TO_WORDS_8(64, D8, 15, CF, 69, B5, 54, C0), BYTES_TO_WORDS_8(3C, 8D, CC, A1, C6, FD, 06, 24),
+        BYTES_TO_WORDS_8(35, CF, 26, BE, E7, EC, C8, AF), BYTES_TO_WORDS_8(0D, DB, DE, C5, D7, 66, EF, 07),
+        BYTES_TO_WORDS_8(FE, 07, 09, 74, 27, 54, 62, 54), BYTES_TO_WORDS_8(8B, 4A, CE, 1C, 3B, 0E, 47, 9F),
+        BYTES_TO_WORDS_8(5E, 50, FD, 21, 52, 0C, D4, 06), BYTES_TO_WORDS_8(A5, E6, 9D, B8, 5D, 32, B3, 2D) },
+      { BYTES_TO_WORDS_8(7C, C2, C7, D5, 8F, 1B, 10, 1C), BYTES_TO_WORDS_8(4C, 79, DC, 4B, B9, 28, 32, EB),
+        BYTES_TO_WORDS_8(B7, 97, 7E, 52, 31, 5B, C0, E0), BYTES_TO_WORDS_8(05, 1D, 8A, 91, 29, FF, 61, EC),
+        BYTES_TO_WORDS_8(51, FE, DD, D9, 67, 11, F0, AD), BYTES_TO_WORDS_8(3D, 23, 90, 76, C4, 46, 3C, FE),
+        BYTES_TO_WORDS_8(98, 92, 75, C7, 82, 0F, 96, D0), BYTES_TO_WORDS_8(A1, 57, B2, C1, 3D, 1D, FA, 02) },
+      { BYTES_TO_WORDS_8(5E, C0, C7, 17, 3C, 14, 95, C6), BYTES_TO_WORDS_8(6A, 41, E5, 2C, 95, CB, 83, B2),
+        BYTES_TO_WORDS_8(0B, 8C, F2, 75, 2F, A7, F3, 14), BYTES_TO_WORDS_8(60, C4, 6D, C0, 5F, 4E, DF, 82),
+        BYTES_TO_WORDS_8(6B, F2, FF, D8, 02, 3D, 61, B9), BYTES_TO_WORDS_8(00, B3, 2D, 84, 46, D9, 15, CF),
+        BYTES_TO_WORDS_8(D1, CB, 17, 12, 21, 16, 52, 27), BYTES_TO_WORDS_8(0A, 42, 96, 8C, C9, 88, E1, E4) },
+      { BYTES_TO_WORDS_8(5C, D0, 7D, 1D, E2, 42, 3E, C2), BYTES_TO_WORDS_8(1A, 0E, B0, C1, D4, 84, 4F, C5),
+        BYTES_TO_WORDS_8(D1, 16, D1, E7, 20, FB, A3, 69), BYTES_TO_WORDS_8(61, 17, 79, FF, CD, 8B, B1, 5B),
+        BYTES_TO_WORDS_8(09, A3, 96, CB, F2, 49, C5, 56), BYTES_TO_WORDS_8(16, A4, D2, A4, 87, 75, 18, 95),
+        BYTES_TO_WORDS_8(15, 82, F5, D7, D5, 6D, 1B, F8), BYTES_TO_WORDS_8(74, 48, EA, 2D, 17, 92, AD, 42) },
+      { BYTES_TO_WORDS_8(B0, 68, 03, 54, 41, 1D, AE, 80), BYTES_TO_WORDS_8(9D, 94, EE, 8F, 2F, C2, 24, 13),
+        BYTES_TO_WORDS_8(62, 7A, E4, 38, 8D, 5B, 9E, 7D), BYTES_TO_WORDS_8(6A, 0C, 2B, C1, 9B, FC, 1E, 26),
+        BYTES_TO_WORDS_8(1F, 01, EB, BD, 59, 25, AD, 13), BYTES_TO_WORDS_8(30, 5D, 9B, E3, E1, 0B, 34, 7E),
+        BYTES_TO_WORDS_8(79, FF, 4F, D6, 2C, 85, C8, FD), BYTES_TO_WORDS_8(E9, FC, 86, E3, DB, 2A, 9D, 8A) },
+      { BYTES_TO_WORDS_8(50, 20, 6E, E4, 2D, 33, 09, C4), BYTES_TO_WORDS_8(F0, AB, F5, 00, 39, 2A, AC, F5),
+        BYTES_TO_WORDS_8(E2, 97, 67, 31, 98, 66, 6C, 4D), BYTES_TO_WORDS_8(7F, 34, 1E, E7, BF, BF, 79, 9A),
+        BYTES_TO_WORDS_8(D2, 50, 62, 92, 81, 47, 3F, 7A), BYTES_TO_WORDS_8(31, DE, DF, B6, CC, FA, 94, CA),
+        BYTES_TO_WORDS_8(A9, EF, 24, B2, F3, 71, F6, B6), BYTES_TO_WORDS_8(00, E2, 16, D3, E6, 4D, 8B, E9) } },
+    /* (1..8) * 16^49 * G */
+    { { BYTES_TO_WORDS_8(FD, C6, 14, 45, FF, 62, EF, 6E), BYTES_TO_WORDS_8(3E, 01, AB, 0D, 4D, 3B, 68, FD),
+        BYTES_TO_WORDS_8(36, 59, FF, 10, 57, DB, D4, 33), BYTES_TO_WORDS_8(E0, F4, 9C, 08, 80, DA, 25, AC),
+        BYTES_TO_WORDS_8(41, 05, 83, 05, 77, 39, B5, 60), BYTES_TO_WORDS_8(7A, F3, 3B, 24, E8, 83, 09, 81),
+        BYTES_TO_WORDS_8(8C, 33, 1B, 2A, 31, A9, 3D, 88), BYTES_TO_WORDS_8(7B, 4C, B4, 5C, 98, 9D, C6, EB) },
+      { BYTES_TO_WORDS_8(3C, 2F, 96, 69, 10, 51, 56, B4), BYTES_TO_WORDS_8(89, D2, A0, 71, EA, B5, E6, C1),
+        BYTES_TO_WORDS_8(37, C0, 6B, 29, B5, 42, EC, 4A), BYTES_TO_WORDS_8(B8, 13, 0C, 66, 65, CD, 67, B4),
+        BYTES_TO_WORDS_8(96, 75, 87, 22, CB, 84, 55, F7), BYTES_TO_WORDS_8(72, A4, BD, 6C, DF, 12, B2, 3C),
+        BYTES_TO_WORDS_8(AC, 64, 16, 01, 2A, 5D, 3F, BB), BYTES_TO_WORDS_8(EA, FF, 36, 4D, BC, B9, 91, DC) },
+      { BYTES_TO_WORDS_8(3D, 0E, FD, 32, 7E, 1C, 94, 81), BYTES_TO_WORDS_8(60, AD, 27, 54, DC, E4, 31, E6),
+        BYTES_TO_WORDS_8(47, 55, 16, 1E, 67, 48, D7, B4), BYTES_TO_WORDS_8(8B, 3C, BA, 49, 6C, E6, A7, EE),
+        BYTES_TO_WORDS_8(68, 58, 1D, D9, 68, 1F, 41, 10), BYTES_TO_WORDS_8(CC, E3, 19, 30, A2, AD, CB, 5A),
+        BYTES_TO_WORDS_8(98, 7D, 9B, BE, 27, 3F, 84, 28), BYTES_TO_WORDS_8(61, 92, 88, 9F, 5B, D4, FE, 83) },
+      { BYTES_TO_WORDS_8(8D, 7E, 3C, B4, 97, 15, 9B, 91), BYTES_TO_WORDS_8(F4, 60, 21, EF, BE, 3A, 53, 08),
+        BYTES_TO_WORDS_8(DE, 6C, DA, 26, DE, 80, 92, 97), BYTES_TO_WORDS_8(61, 77, A3, 3F, F9, A6, F9, 92),
+        BYTES_TO_WORDS_8(85, 12, BF, 52, 55, 05, 46, 77), BYTES_TO_WORDS_8(89, 12, A3, CE, 4E, 28, 09, 73),
+        BYTES_TO_WORDS_8(DF, 42, E5, F5, A6, D3, 41, ED), BYTES_TO_WORDS_8(E8, AF, 47, 51, 71, 8D, 61, BF) },
+      { BYTES_TO_WORDS_8(B3, 63, CB, 6C, F2, 14, 9F, 11), BYTES_TO_WORDS_8(5D, 8E, 40, 44, 6C, FE, DF, 7D),
+        BYTES_TO_WORDS_8(7B, C6, 03, 54, B3, 94, D1, BA), BYTES_TO_WORDS_8(BD, 21, 3E, E9, D3, E2, 3D, 9A),
+        BYTES_TO_WORDS_8(CF, 3F, F9, 7D, 97, 32, C5, 01), BYTES_TO_WORDS_8(60, 22, 58, EF, 9F, 1D, C0, 49),
+        BYTES_TO_WORDS_8(4C, 3C, 81, EE, 36, 27, 9F, 80), BYTES_TO_WORDS_8(C8, 12, 11, 61, 90, 9B, 80, 2F) },
+      { BYTES_TO_WORDS_8(FF, C9, D3, 27, F8, 34, CD, B5), BYTES_TO_WORDS_8(FB, 35, 59, 06, 1F, BA, B4, 7D),
+        BYTES_TO_WORDS_8(44, 8D, E4, F6, 69, B4, FB, 65), BYTES_TO_WORDS_8(86, 24, 77, 06, 7A, 76, C4, 3C),
+        BYTES_TO_WORDS_8(83, 73, AA, C5, 3C, C5, 16, 30), BYTES_TO_WORDS_8(3A, 47, 78, 83, 16, 41, 22, 77),
+        BYTES_TO_WORDS_8(DF, 7E, 7B, E3, 65, 27, F2, 94), BYTES_TO_WORDS_8(AD, 81, D3, 8C, 8D, 53, 7C, 55) },
+      { BYTES_TO_WORDS_8(17, 11, 3F, D6, 4D, A3, EC, E4), BYTES_TO_WORDS_8(8B, 6D, 7F, BA, 70, 6F, 89, 34),
+        BYTES_TO_WORDS_8(AF, AD, 3F, 12, 30, 0D, 10, 05), BYTES_TO_WORDS_8(DB, 92, 3B, B5, F4, 82, C3, A7),
+        BYTES_TO_WORDS_8(9A, CB, 34, 19, 5E, 0C, 22, C1), BYTES_TO_WORDS_8(8C, A6, C4, D3, 6E, B7, 4E, AE),
+        BYTES_TO_WORDS_8(B5, CF, 5D, 70, 77, F7, 59, 04), BYTES_TO_WORDS_8(88, BF, 61, 67, 11, E5, 91, 1B) },
+      { BYTES_TO_WORDS_8(6A, FC, AE, AF, 81, 70, 9A, D7), BYTES_TO_WORDS_8(87, D8, 09, B2, A5, 16, 75, FD),
+        BYTES_TO_WORDS_8(11, 3B, E8, BC, 65, 30, 62, A1), BYTES_TO_WORDS_8(F3, BA, 44, 60, 83, FD, E4, 5C),
+        BYTES_TO_WORDS_8(A6, B9, 9D, BF, FB, 6D, 60, 38), BYTES_TO_WORDS_8(CE, AC, E4, B9, 4A, BD, BF, 4A),
+        BYTES_TO_WORDS_8(14, C7, 32, A8, 1E, BC, 31, 1E), BYTES_TO_WORDS_8(68, F3, 50, AA, 08, 21, 04, 61) } },
+    /* (1..8) * 16^50 * G */
+    { { BYTES_TO_WORDS_8(AE, 0B, D2, 2F, 7A, E3, D4, 55), BYTES_TO_WORDS_8(11, A8, B4, D5, 72, 56, 03, 26),
+        BYTES_TO_WORDS_8(3A, 34, 6D, 17, 12, BA, 7B, 02), BYTES_TO_WORDS_8(D9, FC, BC, C3, ED, 50, 52, 28),
+        BYTES_TO_WORDS_8(97, AB, E0, 54, 5A, 45, DE, F9), BYTES_TO_WORDS_8(23, F3, EF, F1, 2C, 1A, 9B, 6E),
+        BYTES_TO_WORDS_8(71, C1, 46, 10, AD, 84, 72, 3F), BYTES_TO_WORDS_8(A8, 7E, AD, F4, 86, C0, 66, 78) },
+      { BYTES_TO_WORDS_8(A7, A9, 0C, 22, DB, EF, F2, F0), BYTES_TO_WORDS_8(62, 66, 7C, 81, 63, E5, 40, 38),
+        BYTES_TO_WORDS_8(C0, 61, 51, 32, CC, D0, 51, B6), BYTES_TO_WORDS_8(4E, B4, 44, 99, D8, 91, C0, DB),
+        BYTES_TO_WORDS_8(6B, E7, C8, 16, 83, 58, 20, 4D), BYTES_TO_WORDS_8(C8, 92, 61, E9, 9F, 30, 67, 63),
+        BYTES_TO_WORDS_8(FC, A5, 4A, 1E, 6D, 92, 57, 2D), BYTES_TO_WORDS_8(95, 67, 85, AE, EA, 80, 2D, 09) },
+      { BYTES_TO_WORDS_8(0B, A5, 36, A6, AB, 76, 88, CC), BYTES_TO_WORDS_8(96, 51, B7, AB, 16, F6, 2E, 5D),
+        BYTES_TO_WORDS_8(F6, BA, 78, FC, 12, FA, 36, 58), BYTES_TO_WORDS_8(5C, A7, D5, 45, 65, C5, E3, F1),
+        BYTES_TO_WORDS_8(B6, 28, 31, AB, 4E, 91, 77, DF), BYTES_TO_WORDS_8(6E, 7A, 2D, D2, 76, A5, 7F, 6B),
+        BYTES_TO_WORDS_8(13, F3, A5, F6, 67, 6A, 73, 6C), BYTES_TO_WORDS_8(E7, FC, 1E, 6E, 7A, 84, B8, 12) },
+      { BYTES_TO_WORDS_8(2D, D7, F7, 7E, D0, 4F, BE, D6), BYTES_TO_WORDS_8(D7, E8, 18, F5, D5, 6D, 3A, AD),
+        BYTES_TO_WORDS_8(88, 6D, E0, 6E, 9C, 48, 22, B3), BYTES_TO_WORDS_8(23, 8F, 93, 1E, A1, BA, 18, 90),
+        BYTES_TO_WORDS_8(68, CE, 36, C0, 4F, 04, 67, 12), BYTES_TO_WORDS_8(EB, 6A, 73, 02, 80, 6D, B5, 4E),
+        BYTES_TO_WORDS_8(B7, 00, BF, 43, F7, 47, C1, E8), BYTES_TO_WORDS_8(C9, C6, F9, 71, D8, 82, C3, C9) },
+      { BYTES_TO_WORDS_8(40, 33, 58, 4E, 21, 13, 7F, 51), BYTES_TO_WORDS_8(B2, F3, 34, 5D, 6B, 1B, 5C, F4),
+        BYTES_TO_WORDS_8(8C, 22, 9B, FA, AB, CD, 87, 6D), BYTES_TO_WORDS_8(A7, 34, E1, 81, 9C, 72, 4D, 58),
+        BYTES_TO_WORDS_8(B9, 24, FB, 74, E9, E5, F6, 72), BYTES_TO_WORDS_8(70, C0, 94, 64, A6, 70, 17, 8F),
+        BYTES_TO_WORDS_8(FA, AF, 30, 30, 59, 7C, 30, CD), BYTES_TO_WORDS_8(AB, 80, 0D, 56, A4, 80, DD, 2F) },
+      { BYTES_TO_WORDS_8(0F, 2E, 18, B5, 80, 46, E2, 08), BYTES_TO_WORDS_8(8B, 00, AD, B2, EE, E6, C0, 86),
+        BYTES_TO_WORDS_8(6C, D3, 8A, DE, 2D, 84, A8, 28), BYTES_TO_WORDS_8(DE, 8D, 47, D5, 98, 72, 7F, A7),
+        BYTES_TO_WORDS_8(57, 2D, B8, C4, 28, 7F, B3, A2), BYTES_TO_WORDS_8(2C, B4, 75, 24, 6E, AC, 68, 33),
+        BYTES_TO_WORDS_8(6A, 5F, 51, CA, BB, 64, 1E, 0F), BYTES_TO_WORDS_8(CB, 4F, 1B, 91, 9C, A6, 48, FA) },
+      { BYTES_TO_WORDS_8(9B, 80, 35, 02, DE, 3E, C8, 92), BYTES_TO_WORDS_8(73, 81, EB, B5, F0, 2D, 57, 3C),
+        BYTES_TO_WORDS_8(45, 3C, 38, C2, 8D, 02, 2E, 1E), BYTES_TO_WORDS_8(7D, DF, 37, C8, 00, AE, AE, BA),
+        BYTES_TO_WORDS_8(62, FD, 54, C1, A5, D8, 61, CD), BYTES_TO_WORDS_8(E5, E7, D2, A1, 42, 3C, 5C, 83),
+        BYTES_TO_WORDS_8(99, F2, 49, CB, 7B, 30, A2, B4), BYTES_TO_WORDS_8(80, 4B, 32, 3F, 83, 88, 57, 32) },
+      { BYTES_TO_WORDS_8(02, A6, 6B, 53, 1F, 6C, 59, 07), BYTES_TO_WORDS_8(A6, A8, 60, FF, 9B, 1E, 2F, DD),
+        BYTES_TO_WORDS_8(A3, 04, 50, 13, 38, 60, 33, 63), BYTES_TO_WORDS_8(24, FB, F3, FE, BB, 13, D5, ED),
+        BYTES_TO_WORDS_8(93, F9, DB, 45, F9, 86, 80, 3B), BYTES_TO_WORDS_8(AC, DC, A5, 2D, 44, 4D, 85, 61),
+        BYTES_TO_WORDS_8(8B, 18, F0, 90, A2, 2C, 59, 7C), BYTES_TO_WORDS_8(A9, F7, B3, 3B, 8C, 59, 7B, 25) } },
+    /* (1..8) * 16^51 * G */
+    { { BYTES_TO_WORDS_8(F1, E4, 07, 3E, 2A, 3A, 1F, 17), BYTES_TO_WORDS_8(7C, 26, DC, D0, 7D, 14, C5, 1F),
+        BYTES_TO_WORDS_8(0E, 89, F8, 7E, C0, EB, 8D, 81), BYTES_TO_WORDS_8(6F, 36, D0, 2E, 06, C1, 72, C4),
+        BYTES_TO_WORDS_8(A9, DA, B0, 86, 3D, 68, 1C, 57), BYTES_TO_WORDS_8(8A, 5D, 2B, E2, B1, B7, F3, 85),
+        BYTES_TO_WORDS_8(D8, 67, D6, 84, 5A, AB, 32, 64), BYTES_TO_WORDS_8(E9, 70, 5F, 94, 01, 0E, 82, 41) },
+      { BYTES_TO_WORDS_8(37, 34, 86, FA, 99, 29, 51, C0), BYTES_TO_WORDS_8(EF, 88, 7F, 98, 96, 90, C4, F8),
+        BYTES_TO_WORDS_8(1E, 97, 29, BA, 6F, DF, CD, 42), BYTES_TO_WORDS_8(E5, CB, 01, FA, CB, 27, 4E, 45),
+        BYTES_TO_WORDS_8(E6, BB, A6, 51, E5, 00, 9B, 17), BYTES_TO_WORDS_8(86, B9, 51, C6, D5, 88, 8D, 6B),
+        BYTES_TO_WORDS_8(7C, 01, 81, 2F, 8F, 5F, 7E, 9E), BYTES_TO_WORDS_8(9E, 1E, F0, 4C, 21, 4B, 4A, 13) },
+      { BYTES_TO_WORDS_8(B1, AC, F8, A2, 4A, 53, 69, 43), BYTES_TO_WORDS_8(3F, 05, 3F, 61, 54, 65, 9D, B3),
+        BYTES_TO_WORDS_8(1E, C3, EC, B8, A4, B7, E1, 85), BYTES_TO_WORDS_8(D6, E3, 45, 95, 39, 8F, F8, 86),
+        BYTES_TO_WORDS_8(19, 8A, 09, 05, D1, 42, B0, 14), BYTES_TO_WORDS_8(71, 52, 16, E9, BE, 62, EA, 4E),
+        BYTES_TO_WORDS_8(21, B1, 91, B5, 8F, 97, 7C, B3), BYTES_TO_WORDS_8(D6, 38, 82, A6, 69, DD, CF, 2C) },
+      { BYTES_TO_WORDS_8(99, A5, 84, 80, 9C, 17, 28, 38), BYTES_TO_WORDS_8(17, 03, 2C, 3C, 62, 30, 41, B9),
+        BYTES_TO_WORDS_8(FF, 1F, C5, 29, 56, 6D, 22, 06), BYTES_TO_WORDS_8(8C, 69, C3, FB, 25, EF, CF, 0E),
+        BYTES_TO_WORDS_8(22, E9, 20, D5, 13, 4C, CB, 3D), BYTES_TO_WORDS_8(B2, 62, 2F, 99, DF, 57, 9D, EE),
+        BYTES_TO_WORDS_8(82, 79, 9A, 9F, 83, 1C, 47, B2), BYTES_TO_WORDS_8(C0, F2, 95, F2, 8B, B9, 32, 81) },
+      { BYTES_TO_WORDS_8(66, AB, AD, FC, B6, 77, 83, D8), BYTES_TO_WORDS_8(02, 56, D3, 3D, 3C, A3, C6, E1),
+        BYTES_TO_WORDS_8(A0, F9, D9, 60, 96, 66, F7, 7D), BYTES_TO_WORDS_8(74, 8E, 94, C9, 1F, BE, A3, A2),
+        BYTES_TO_WORDS_8(12, EB, 1A, 4C, 48, 12, 4A, EF), BYTES_TO_WORDS_8(25, AD, 80, 34, A5, E8, 2D, FB),
+        BYTES_TO_WORDS_8(E1, 5E, 23, 4D, D7, 7E, 50, 06), BYTES_TO_WORDS_8(67, BE, 24, B5, E6, D8, 3B, A9) },
+      { BYTES_TO_WORDS_8(1D, 9E, 3E, E6, DE, 09, B7, 5C), BYTES_TO_WORDS_8(98, 0A, EB, 20, 13, EC, 6D, 89),
+        BYTES_TO_WORDS_8(BF, 4B, 90, 2B, 95, 36, 89, CC), BYTES_TO_WORDS_8(12, C3, D0, 8F, 14, CD, 66, 43),
+        BYTES_TO_WORDS_8(F4, 4B, 36, DB, 87, ED, 57, 6A), BYTES_TO_WORDS_8(45, 40, DF, E0, 19, CC, E7, FB),
+        BYTES_TO_WORDS_8(03, 98, B3, 7B, 69, 95, 69, E8), BYTES_TO_WORDS_8(C1, 75, 10, E3, 81, AD, A2, 2B) },
+      { BYTES_TO_WORDS_8(BF, 25, 7C, 20, 13, 22, 9D, B8), BYTES_TO_WORDS_8(97, 80, 2D, BE, 77, C7, FB, 82),
+        BYTES_TO_WORDS_8(BE, 80, C0, 77, 46, 12, 7E, 36), BYTES_TO_WORDS_8(B9, 8D, E7, 56, ED, 7C, 4E, 35),
+        BYTES_TO_WORDS_8(11, 42, 86, 5A, 99, A3, 23, 51), BYTES_TO_WORDS_8(21, AA, A0, 05, CB, 56, D7, 5F),
+        BYTES_TO_WORDS_8(58, E5, CF, A5, 24, D8, EB, E6), BYTES_TO_WORDS_8(70, 40, 99, BB, E9, 62, 9D, 62) },
+      { BYTES_TO_WORDS_8(21, 0C, 33, 41, BA, 30, 46, 64), BYTES_TO_WORDS_8(DB, 7E, 3B, 4B, 94, 69, 59, 07),
+        BYTES_TO_WORDS_8(18, 9B, 2F, CC, FE, C0, C2, 9E), BYTES_TO_WORDS_8(46, E3, BB, DC, 1D, 5D, 1F, F1),
+        BYTES_TO_WORDS_8(E0, 7A, EE, 49, 77, 6C, E0, 54), BYTES_TO_WORDS_8(15, 77, 92, 57, BD, 2C, AF, 0C),
+        BYTES_TO_WORDS_8(61, 16, 87, 78, 0F, 75, E3, B3), BYTES_TO_WORDS_8(C2, 78, 02, 57, D6, 45, 00, D2) } },
+    /* (1..8) * 16^52 * G */
+    { { BYTES_TO_WORDS_8(5F, B8, 9B, 83, C3, 09, 0F, 32), BYTES_TO_WORDS_8(2C, E6, 50, A0, 06, FB, 01, 01),
+        BYTES_TO_WORDS_8(58, 34, D5, 9A, C9, 82, 75, 55), BYTES_TO_WORDS_8(2B, 43, 66, 16, 8D, 39, D5, 55),
+        BYTES_TO_WORDS_8(6F, 93, ED, 4F, 18, 31, F6, F7), BYTES_TO_WORDS_8(E1, D9, 33, 18, 7F, 6A, 0D, D9),
+        BYTES_TO_WORDS_8(2A, A7, BA, 8E, 9E, 6A, 9C, 05), BYTES_TO_WORDS_8(2D, 8E, FF, 49, 90, 22, 6E, 57) },
+      { BYTES_TO_WORDS_8(55, 11, 49, 4F, 5B, E9, 42, F6), BYTES_TO_WORDS_8(18, C1, F3, FF, 93, EB, B1, 28),
+        BYTES_TO_WORDS_8(8D, 6F, D5, 85, 95, 63, 23, FD), BYTES_TO_WORDS_8(CC, 17, 76, AE, 03, 4F, 9A, 41),
+        BYTES_TO_WORDS_8(C7, BB, 89, D4, 6A, BA, 91, 4B), BYTES_TO_WORDS_8(89, 68, 4C, 07, 22, 4A, AB, C7),
+        BYTES_TO_WORDS_8(45, 45, 80, 84, 14, 4B, 33, 2E), BYTES_TO_WORDS_8(5B, 83, 6E, 3A, 34, 2D, 7C, 23) },
+      { BYTES_TO_WORDS_8(5A, 28, EA, 12, 92, 2B, 7E, C0), BYTES_TO_WORDS_8(D1, 10, B9, F7, E6, C1, 01, 9F),
+        BYTES_TO_WORDS_8(A3, A7, C0, DD, 8D, 05, 58, 78), BYTES_TO_WORDS_8(8B, 88, 4F, 81, 08, 64, B4, 1B),
+        BYTES_TO_WORDS_8(02, C7, 7D, 90, 79, 8A, 0C, DC), BYTES_TO_WORDS_8(4E, A9, 2F, 99, 4B, A3, 52, 1E),
+        BYTES_TO_WORDS_8(FC, A4, B4, 92, B8, D9, 0F, A4), BYTES_TO_WORDS_8(25, 11, AE, AF, BF, 16, 30, 8A) },
+      { BYTES_TO_WORDS_8(34, 8F, 9E, E4, A9, 1B, 84, C0), BYTES_TO_WORDS_8(FC, D0, 35, 0B, AE, 1D, E6, C3),
+        BYTES_TO_WORDS_8(5E, F7, AB, 31, AD, 04, 23, 37), BYTES_TO_WORDS_8(28, 28, DF, DA, B3, 7E, 15, A2),
+        BYTES_TO_WORDS_8(F3, BE, EE, 89, 32, 98, 8E, 1A), BYTES_TO_WORDS_8(4E, 7F, 18, 5B, A3, BB, 4B, 06),
+        BYTES_TO_WORDS_8(A2, E5, FB, CC, 77, 25, B4, 0F), BYTES_TO_WORDS_8(1D, F3, 0D, A7, 7D, 69, 17, 08) },
+      { BYTES_TO_WORDS_8(5A, 78, 39, D5, 00, 29, 01, 45), BYTES_TO_WORDS_8(01, 7F, 29, B8, 76, D0, 88, 8C),
+        BYTES_TO_WORDS_8(54, 7A, 62, 78, 26, 3E, 97, E0), BYTES_TO_WORDS_8(4E, A1, 2F, E0, 70, 4E, BC, 04),
+        BYTES_TO_WORDS_8(BB, E3, 62, CA, 75, 04, 99, 53), BYTES_TO_WORDS_8(C3, 75, 32, 7A, 72, 17, 70, 87),
+        BYTES_TO_WORDS_8(4F, FB, 3D, 3F, CF, A1, F5, A5), BYTES_TO_WORDS_8(C3, 4C, CB, B8, 24, F2, 29, 57) },
+      { BYTES_TO_WORDS_8(2A, 77, 0F, B8, 14, 67, 9C, 4E), BYTES_TO_WORDS_8(B2, E4, 6E, B9, A2, 58, 37, 4C),
+        BYTES_TO_WORDS_8(0E, 91, 9A, 66, 59, F0, 54, 7E), BYTES_TO_WORDS_8(E5, 8C, 91, 3E, 23, 40, 6F, B7),
+        BYTES_TO_WORDS_8(74, FF, EE, 72, 7C, 1D, 48, 2B), BYTES_TO_WORDS_8(25, AE, 16, 6B, 19, 24, BA, 56),
+        BYTES_TO_WORDS_8(98, 99, B0, CE, 74, F2, 18, 96), BYTES_TO_WORDS_8(3C, D9, AE, A7, 11, 72, 19, 05) },
+      { BYTES_TO_WORDS_8(B5, CF, 14, E1, B1, 4B, 2D, 11), BYTES_TO_WORDS_8(A3, A6, D5, A3, 9A, 18, 36, D1),
+        BYTES_TO_WORDS_8(76, 08, DF, B7, E1, 39, 77, 58), BYTES_TO_WORDS_8(73, 81, F8, C1, FD, 92, E4, D3),
+        BYTES_TO_WORDS_8(45, 70, 7F, 69, A5, 9A, EB, BC), BYTES_TO_WORDS_8(EF, 4E, 75, 46, 6E, F0, 88, 9C),
+        BYTES_TO_WORDS_8(A3, FE, 15, BF, 76, 26, EE, 1F), BYTES_TO_WORDS_8(8B, C4, F8, 73, 0A, A7, 04, 36) },
+      { BYTES_TO_WORDS_8(2E, 50, 5C, 2D, 1C, 28, EB, D4), BYTES_TO_WORDS_8(15, 45, F1, 1D, 2D, E6, FC, 27),
+        BYTES_TO_WORDS_8(D2, 76, C3, 88, 2A, 65, 28, FB), BYTES_TO_WORDS_8(E0, D9, 09, F4, B7, 6D, 38, DC),
+        BYTES_TO_WORDS_8(4F, 1E, FC, 7B, 25, 7A, B4, 23), BYTES_TO_WORDS_8(7B, 0B, 76, CC, B3, 3D, 2C, 37),
+        BYTES_TO_WORDS_8(2B, D7, 7A, 9D, 45, 9C, E6, E7), BYTES_TO_WORDS_8(8A, 18, 20, CF, 76, 63, 6C, 52) } },
+    /* (1..8) * 16^53 * G */
+    { { BYTES_TO_WORDS_8(26, 39, 51, 32, 9C, BC, 2D, C6), BYTES_TO_WORDS_8(EC, 85, EC, EF, 40, 89, 26, CC),
+        BYTES_TO_WORDS_8(83, 33, FC, 4B, B2, BA, FE, 94), BYTES_TO_WORDS_8(26, 87, A0, 3C, 46, 86, 42, 88),
+        BYTES_TO_WORDS_8(4D, A5, B8, AF, 2A, 28, E4, 0E), BYTES_TO_WORDS_8(5A, C1, DB, EB, 22, B1, 0E, CE),
+        BYTES_TO_WORDS_8(07, 12, D8, 65, B3, 0D, 66, 69), BYTES_TO_WORDS_8(5A, DD, C2, 01, 9C, 42, 78, F7) },
+      { BYTES_TO_WORDS_8(35, E6, 2A, 7C, EA, 91, 57, 00), BYTES_TO_WORDS_8(7F, 41, D4, 4C, B9, 27, 3D, 0F),
+        BYTES_TO_WORDS_8(9F, 2E, 8A, 80, D4, 9A, 8C, B4), BYTES_TO_WORDS_8(38, 2C, 9B, 19, B0, BE, 9B, 78),
+        BYTES_TO_WORDS_8(B6, 6D, E9, BF, EC, DF, 81, B7), BYTES_TO_WORDS_8(0F, 55, A1, 2C, 9C, 5A, EF, 7F),
+        BYTES_TO_WORDS_8(7A, 21, F1, 62, 9F, B7, 80, 86), BYTES_TO_WORDS_8(C6, 9B, 18, 99, 61, 7E, 35, 14) },
+      { BYTES_TO_WORDS_8(F1, F1, 20, 65, 19, AC, 2B, ED), BYTES_TO_WORDS_8(A4, 7D, 7F, 64, 9E, B4, F1, D7),
+        BYTES_TO_WORDS_8(4A, 6F, CF, 8C, 16, FD, A5, D5), BYTES_TO_WORDS_8(19, 08, 6F, F7, 36, 9D, AD, 3B),
+        BYTES_TO_WORDS_8(4D, DF, 98, 56, 72, 70, 19, 6A), BYTES_TO_WORDS_8(58, 72, B6, 4E, A2, 81, 99, 49),
+        BYTES_TO_WORDS_8(80, 0E, EC, 9D, 7D, FA, D9, BC), BYTES_TO_WORDS_8(59, E6, 24, 3E, E3, 9D, F9, 49) },
+      { BYTES_TO_WORDS_8(CC, B1, 29, F5, 16, 1F, F1, B1), BYTES_TO_WORDS_8(39, 46, B8, 89, FD, B3, 56, 51),
+        BYTES_TO_WORDS_8(BD, 9B, 0A, 3A, 51, 4A, BC, 2C), BYTES_TO_WORDS_8(DE, 72, AD, 5E, 9C, D9, C1, 87),
+        BYTES_TO_WORDS_8(6C, 4D, A9, D5, 8D, 97, 26, CF), BYTES_TO_WORDS_8(E3, 75, B2, C5, B2, 0E, 0D, BB),
+        BYTES_TO_WORDS_8(83, F6, 5E, A5, 6C, 7A, 61, B8), BYTES_TO_WORDS_8(CD, 0B, 5D, 98, C6, 54, 16, 7E) },
+      { BYTES_TO_WORDS_8(66, AE, 85, B1, A8, 44, 1E, 0B), BYTES_TO_WORDS_8(DF, 83, A7, EF, DB, 16, EC, A6),
+        BYTES_TO_WORDS_8(8B, 11, 24, D1, 53, DF, A7, 67), BYTES_TO_WORDS_8(6D, C4, B0, AD, B1, A4, B3, A6),
+        BYTES_TO_WORDS_8(1B, F2, FB, 8B, 3F, 55, EB, 7B), BYTES_TO_WORDS_8(DD, 48, B2, F5, 5D, 0A, BF, BC),
+        BYTES_TO_WORDS_8(D8, E8, 69, D9, 1C, A9, 61, 13), BYTES_TO_WORDS_8(23, 96, 88, 63, D7, E8, B6, 0C) },
+      { BYTES_TO_WORDS_8(4F, E2, A4, 2F, BC, 91, 13, 20), BYTES_TO_WORDS_8(A3, 25, 6F, 9D, 27, FC, C7, 5D),
+        BYTES_TO_WORDS_8(8F, 46, 38, 1D, 82, 51, 06, 55), BYTES_TO_WORDS_8(E0, 5E, 2A, 4F, 83, 7B, C0, 1E),
+        BYTES_TO_WORDS_8(25, 07, 27, 4D, FD, 10, 89, 31), BYTES_TO_WORDS_8(FC, 5D, 75, 77, 93, 3C, CD, EC),
+        BYTES_TO_WORDS_8(58, DC, 7E, 78, CF, 85, 34, F7), BYTES_TO_WORDS_8(11, 75, 18, 20, 49, 54, FC, 83) },
+      { BYTES_TO_WORDS_8(3A, 0E, 63, EC, E4, 4C, 68, A9), BYTES_TO_WORDS_8(C2, F1, F3, 7F, C1, 60, 10, F6),
+        BYTES_TO_WORDS_8(C1, 10, 7F, D8, A7, E3, 27, E2), BYTES_TO_WORDS_8(A4, 14, 91, 6C, 5A, 8F, 84, 1F),
+        BYTES_TO_WORDS_8(0A, 61, CA, 86, F6, 9F, ED, AE), BYTES_TO_WORDS_8(24, 97, 35, FE, 6B, 92, A3, 4B),
+        BYTES_TO_WORDS_8(26, A4, 9D, 1A, 3D, C8, 29, 86), BYTES_TO_WORDS_8(63, F9, 06, CD, 2C, 55, 28, A0) },
+      { BYTES_TO_WORDS_8(7D, 84, 79, 0B, F1, 79, F6, F0), BYTES_TO_WORDS_8(E6, 9B, B1, 6B, B6, A8, 19, 37),
+        BYTES_TO_WORDS_8(D5, 43, 7F, DC, 3D, 6C, DB, 2D), BYTES_TO_WORDS_8(E2, 82, 09, DA, 3A, 04, 00, 28),
+        BYTES_TO_WORDS_8(DA, 9E, 8D, 90, 83, 00, 5B, FE), BYTES_TO_WORDS_8(E9, 3A, 51, B8, DB, 58, 70, A8),
+        BYTES_TO_WORDS_8(3B, DC, A4, 84, 65, 79, C0, B6), BYTES_TO_WORDS_8(09, 29, E8, 67, 46, 17, 99, 0F) } },
+    /* (1..8) * 16^54 * G */
+    { { BYTES_TO_WORDS_8(BB, 1F, 44, D4, 5A, 5D, 0B, 3E), BYTES_TO_WORDS_8(5E, 11, ED, A5, 20, 85, AA, 9E),
+        BYTES_TO_WORDS_8(55, 25, B9, ED, 55, 0C, B6, 7F), BYTES_TO_WORDS_8(D4, 21, DE, 21, 4E, 8C, 95, B4),
+        BYTES_TO_WORDS_8(18, 71, DD, 4A, 9F, 3C, 7E, 4C), BYTES_TO_WORDS_8(41, 38, 46, 2D, 13, F6, B9, 2D),
+        BYTES_TO_WORDS_8(E1, B7, 8C, C3, FB, 41, C0, E5), BYTES_TO_WORDS_8(EF, 40, 66, 99, BF, E7, D6, FC) },
+      { BYTES_TO_WORDS_8(59, 0B, D0, 6B, 17, A1, 4D, FC), BYTES_TO_WORDS_8(C7, 71, 1A, BC, 4D, 70, DD, 2C),
+        BYTES_TO_WORDS_8(58, F2, 4D, F8, 19, EB, 7C, E7), BYTES_TO_WORDS_8(81, 64, 87, D5, 9E, 9E, 1E, A4),
+        BYTES_TO_WORDS_8(15, 6F, 2E, CF, CD, 28, DD, E8), BYTES_TO_WORDS_8(9F, 35, D4, 3D, 56, 53, D2, 5C),
+        BYTES_TO_WORDS_8(B8, 39, C7, EF, D1, 1E, 4E, DA), BYTES_TO_WORDS_8(B6, F2, 30, 3B, 72, 31, DC, 50) },
+      { BYTES_TO_WORDS_8(F1, 07, 1F, 37, 4C, 68, ED, 5A), BYTES_TO_WORDS_8(4A, 0C, D7, 30, B7, ED, 8C, 87),
+        BYTES_TO_WORDS_8(4B, 68, 06, 46, B6, A0, 2E, 23), BYTES_TO_WORDS_8(4D, 44, 20, 7B, 5E, 3F, A4, B3),
+        BYTES_TO_WORDS_8(A5, FD, 1D, E0, F4, 22, CD, 53), BYTES_TO_WORDS_8(CC, 0E, CB, CD, A0, 77, 78, EC),
+        BYTES_TO_WORDS_8(E7, 5E, 97, 69, 73, 22, 83, 41), BYTES_TO_WORDS_8(B8, D6, 8F, 24, 5B, 4F, C6, 34) },
+      { BYTES_TO_WORDS_8(F9, 03, 14, 40, EF, 96, 0C, AB), BYTES_TO_WORDS_8(93, E7, 58, BF, 4E, D9, A6, 32),
+        BYTES_TO_WORDS_8(DF, 86, 68, 7D, A8, 09, 5F, 2C), BYTES_TO_WORDS_8(AC, 35, CC, 94, 2E, 0F, 2A, C0),
+        BYTES_TO_WORDS_8(B0, 80, ED, A7, 39, 96, F5, 21), BYTES_TO_WORDS_8(B5, AD, 00, 60, 06, 13, B9, AB),
+        BYTES_TO_WORDS_8(73, D4, 5C, 7C, 45, 6D, 71, 0F), BYTES_TO_WORDS_8(AE, 1A, 49, 8E, A1, A8, BA, 8E) },
+      { BYTES_TO_WORDS_8(49, 9D, 55, 6B, A4, 97, 7C, FF), BYTES_TO_WORDS_8(44, 9B, DC, 0D, 69, B4, E1, 48),
+        BYTES_TO_WORDS_8(B1, 08, C0, 84, FD, 2F, 66, C2), BYTES_TO_WORDS_8(4A, E1, 6B, A4, 69, 98, 2E, 45),
+        BYTES_TO_WORDS_8(A7, 6B, 0D, DA, 46, 60, 7C, 74), BYTES_TO_WORDS_8(25, E4, 1E, 3B, 6C, 85, 82, 59),
+        BYTES_TO_WORDS_8(52, EE, 61, 67, 7B, 05, C0, F5), BYTES_TO_WORDS_8(D0, 80, 5F, 19, 8F, 8A, 5E, 8C) },
+      { BYTES_TO_WORDS_8(6A, 56, 75, 29, 91, FA, E1, FE), BYTES_TO_WORDS_8(6F, B0, C2, 39, 2D, B7, F2, 6A),
+        BYTES_TO_WORDS_8(5F, D6, B7, 12, 63, 8D, 6C, 27), BYTES_TO_WORDS_8(B8, 19, 72, D2, 79, 0A, 17, 9F),
+        BYTES_TO_WORDS_8(D8, E6, F3, EC, 88, 6C, 57, 5A), BYTES_TO_WORDS_8(5F, 69, DB, F5, 93, A7, A6, A0),
+        BYTES_TO_WORDS_8(78, 85, 4E, 7D, 07, B0, 99, C7), BYTES_TO_WORDS_8(0C, 4A, 86, E8, 2D, AA, A6, 54) },
+      { BYTES_TO_WORDS_8(DA, 94, CE, 53, EB, 67, 7A, 53), BYTES_TO_WORDS_8(60, 9E, 82, 56, 42, 4F, B2, 8B),
+        BYTES_TO_WORDS_8(EE, 74, C4, 3A, DC, E0, CD, 51), BYTES_TO_WORDS_8(BB, 62, 6D, 8C, D4, F5, A7, 19),
+        BYTES_TO_WORDS_8(BB, E7, 25, 30, 16, 47, 04, 73), BYTES_TO_WORDS_8(03, EB, 25, AE, 06, 53, 62, FB),
+        BYTES_TO_WORDS_8(E8, A2, 00, 42, D4, 51, 6A, 2F), BYTES_TO_WORDS_8(C3, 75, 30, A9, A7, 4B, 50, A2) },
+      { BYTES_TO_WORDS_8(33, 8D, 7A, 5F, 87, 73, 91, A6), BYTES_TO_WORDS_8(58, 76, A4, EC, E3, 22, 6C, 9A),
+        BYTES_TO_WORDS_8(6B, E2, 13, 49, E1, 5D, 76, 1A), BYTES_TO_WORDS_8(57, 65, 92, 0D, A1, 50, D5, B8),
+        BYTES_TO_WORDS_8(EE, AB, C3, FE, 7B, B7, 77, 17), BYTES_TO_WORDS_8(0D, 67, 6F, 58, AF, 3A, 1C, 54),
+        BYTES_TO_WORDS_8(88, E1, 73, 70, C9, 90, 17, 7D), BYTES_TO_WORDS_8(30, 1C, 16, ED, E0, 08, D9, DE) } },
+    /* (1..8) * 16^55 * G */
+    { { BYTES_TO_WORDS_8(DF, E1, 12, 6E, 43, E6, 24, AC), BYTES_TO_WORDS_8(04, 1D, 76, 7D, 0B, FD, A7, D8),
+        BYTES_TO_WORDS_8(7C, 02, 46, B3, 13, BF, 34, 41), BYTES_TO_WORDS_8(B6, 32, E9, 88, 96, 91, E0, D0),
+        BYTES_TO_WORDS_8(BE, 8F, D2, 9F, DB, 44, 65, 6A), BYTES_TO_WORDS_8(DF, B8, 46, 98, BD, C4, 4C, 54),
+        BYTES_TO_WORDS_8(67, F8, DB, 91, B6, 60, EB, B4), BYTES_TO_WORDS_8(52, 14, 7D, FE, 59, 9A, 9C, 06) },
+      { BYTES_TO_WORDS_8(D8, C2, DA, 18, CC, 29, 7B, E2), BYTES_TO_WORDS_8(11, BE, 87, F2, DD, 37, 71, 8F),
+        BYTES_TO_WORDS_8(BE, 4A, 06, 3C, BE, C6, D8, 66), BYTES_TO_WORDS_8(CC, A2, A3, 84, AD, 96, C6, 49),
+        BYTES_TO_WORDS_8(E8, AE, A6, E3, 1D, F2, 5C, BA), BYTES_TO_WORDS_8(19, E0, C3, CF, 2A, EC, 0F, 4D),
+        BYTES_TO_WORDS_8(4B, DE, 8D, 08, C7, 62, 89, 57), BYTES_TO_WORDS_8(DF, B6, 54, E8, DA, BE, 7C, FB) },
+      { BYTES_TO_WORDS_8(98, A0, 4A, 08, 10, 85, 0D, BB), BYTES_TO_WORDS_8(02, 3E, 6E, A9, 40, 01, C1, 09),
+        BYTES_TO_WORDS_8(85, FA, C1, BF, AC, 7D, 8A, 39), BYTES_TO_WORDS_8(EB, 08, 33, A1, 54, A4, 17, B5),
+        BYTES_TO_WORDS_8(BF, EF, 40, 45, 9F, B5, 04, 60), BYTES_TO_WORDS_8(FD, 47, 24, 69, 54, 8B, D4, A4),
+        BYTES_TO_WORDS_8(A3, 6F, F2, B0, 2F, 3E, EA, 60), BYTES_TO_WORDS_8(9A, 87, 1F, 0C, 7D, 87, 3D, 0A) },
+      { BYTES_TO_WORDS_8(80, F0, 50, 00, 73, B6, B8, 8E), BYTES_TO_WORDS_8(88, 53, F1, 4B, F9, BB, F5, 95),
+        BYTES_TO_WORDS_8(47, AC, D3, 71, 73, 02, 42, 1C), BYTES_TO_WORDS_8(C7, EB, 6A, 50, 77, 1A, FE, E7),
+        BYTES_TO_WORDS_8(2B, E3, E9, 99, DA, 89, C9, 48), BYTES_TO_WORDS_8(A8, 96, 64, 67, 37, FB, ED, F8),
+        BYTES_TO_WORDS_8(38, 58, CB, 93, 78, 1E, E5, 1D), BYTES_TO_WORDS_8(AF, 5D, E6, 10, 6D, C4, 87, 6A) },
+      { BYTES_TO_WORDS_8(A1, BF, 44, 47, AA, AC, 95, 6D), BYTES_TO_WORDS_8(3D, 64, 93, E0, 7C, D2, 26, CC),
+        BYTES_TO_WORDS_8(87, E3, F3, D8, 12, 27, C2, 7B), BYTES_TO_WORDS_8(F6, 66, 51, 4B, 38, 14, EC, F8),
+        BYTES_TO_WORDS_8(6D, 5F, B6, 32, 63, 4E, 92, C6), BYTES_TO_WORDS_8(60, 00, 90, C3, C5, 7A, 63, 0A),
+        BYTES_TO_WORDS_8(61, 0F, D6, 69, B2, 8F, 36, 32), BYTES_TO_WORDS_8(A6, B9, 3F, 11, B2, 34, 11, 76) },
+      { BYTES_TO_WORDS_8(F5, AF, 0A, 26, E5, 46, 17, C1), BYTES_TO_WORDS_8(F1, 1E, 27, 48, 33, 99, 1B, B7),
+        BYTES_TO_WORDS_8(5E, BC, B4, D1, EE, 4B, 68, 9B), BYTES_TO_WORDS_8(02, 68, 1C, B6, 9A, B4, 19, A0),
+        BYTES_TO_WORDS_8(88, 70, 02, D5, 62, DD, C6, 95), BYTES_TO_WORDS_8(93, 01, 7A, F8, 31, 6B, 22, C2),
+        BYTES_TO_WORDS_8(88, 86, F7, 54, 54, 38, 17, AD), BYTES_TO_WORDS_8(89, 62, 2A, D8, C5, 7C, F4, 5C) },
+      { BYTES_TO_WORDS_8(BB, A4, 27, 32, E9, 3B, 2C, F6), BYTES_TO_WORDS_8(F2, 99, 8D, 0F, F0, B1, E6, 4B),
+        BYTES_TO_WORDS_8(E6, F2, D4, 21, AD, 4E, E7, 94), BYTES_TO_WORDS_8(E7, FA, 7B, DB, 78, FF, 0C, 32),
+        BYTES_TO_WORDS_8(D4, D2, F3, B0, 06, C9, 1C, 58), BYTES_TO_WORDS_8(70, F9, E2, 09, 74, 23, 47, 60),
+        BYTES_TO_WORDS_8(99, 62, FF, 54, A2, 96, 77, AB), BYTES_TO_WORDS_8(92, 86, 2A, 07, D4, E8, 9F, AF) },
+      { BYTES_TO_WORDS_8(2F, 67, 72, FA, 21, 39, EC, 05), BYTES_TO_WORDS_8(95, B0, 47, FA, 7B, FD, 47, 5A),
+        BYTES_TO_WORDS_8(08, 23, B1, 19, F4, 16, 9F, 06), BYTES_TO_WORDS_8(41, 17, 06, B5, 86, FB, 02, 9E),
+        BYTES_TO_WORDS_8(2D, 50, B7, F4, 49, 5D, 4F, B2), BYTES_TO_WORDS_8(DE, C3, D5, 6E, 02, 1A, 74, 11),
+        BYTES_TO_WORDS_8(1E, 0C, 0B, 55, CE, B8, 5A, 26), BYTES_TO_WORDS_8(83, F1, A9, EE, 5F, 30, 22, D6) } },
+    /* (1..8) * 16^56 * G */
+    { { BYTES_TO_WORDS_8(07, DF, 95, E8, 10, 3F, 70, 6A), BYTES_TO_WORDS_8(D8, 6B, 87, 01, FA, F3, 75, FD),
+        BYTES_TO_WORDS_8(FE, 8F, E0, 0C, E7, 06, 5B, EB), BYTES_TO_WORDS_8(EE, DF, 83, 27, 54, B8, F6, 68),
+        BYTES_TO_WORDS_8(55, 26, 71, 78, 8A, 6F, C7, 90), BYTES_TO_WORDS_8(7F, BF, 10, F3, D2, 93, 52, CF),
+        BYTES_TO_WORDS_8(28, 50, A4, FD, 4D, 04, C8, FB), BYTES_TO_WORDS_8(E6, 0C, E4, 92, BA, FE, E1, CB) },
+      { BYTES_TO_WORDS_8(C7, 5F, C1, 80, 1D, 53, 10, 9D), BYTES_TO_WORDS_8(58, 92, E9, 72, F1, 23, 66, 66),
+        BYTES_TO_WORDS_8(41, E5, 55, 0E, CD, 09, CF, F3), BYTES_TO_WORDS_8(5F, 0D, 1C, 8C, 54, 0C, B4, E1),
+        BYTES_TO_WORDS_8(24, 80, 31, 2A, 68, 84, CA, 17), BYTES_TO_WORDS_8(24, B6, 9B, DE, 20, 45, 92, 00),
+        BYTES_TO_WORDS_8(8F, 70, F4, 07, 12, 81, 7D, F4), BYTES_TO_WORDS_8(F9, 4F, 38, 3F, AC, AA, A8, 1E) },
+      { BYTES_TO_WORDS_8(92, 96, A8, 3A, 23, FA, 18, E4), BYTES_TO_WORDS_8(08, 23, 4C, F9, D6, 08, 3B, 71),
+        BYTES_TO_WORDS_8(76, A7, 18, 24, 41, E6, 96, E9), BYTES_TO_WORDS_8(4D, 8F, 66, 81, 71, CA, DF, 3B),
+        BYTES_TO_WORDS_8(08, 03, 51, 1A, 43, DB, DB, 93), BYTES_TO_WORDS_8(13, EF, E2, 45, 63, 0C, DC, C7),
+        BYTES_TO_WORDS_8(33, 53, DA, AE, 51, 61, 42, 49), BYTES_TO_WORDS_8(B8, 67, 51, 56, 68, 1F, 72, 0A) },
+      { BYTES_TO_WORDS_8(7E, BA, 1E, 83, 7E, 59, 5B, A2), BYTES_TO_WORDS_8(56, 9E, 98, 70, 25, 9C, E4, F1),
+        BYTES_TO_WORDS_8(7E, A3, 72, BC, A7, BB, 01, 42), BYTES_TO_WORDS_8(DF, 02, 2A, BA, 5D, 31, 3E, 96),
+        BYTES_TO_WORDS_8(C0, 79, 7C, 8E, 32, 4B, FA, 3D), BYTES_TO_WORDS_8(3C, F1, D5, C0, E5, 0A, 9D, 86),
+        BYTES_TO_WORDS_8(11, 7E, 16, 52, 7C, CB, A3, A2), BYTES_TO_WORDS_8(35, 39, 4A, C8, 13, BA, 02, 5C) },
+      { BYTES_TO_WORDS_8(D7, A1, 7E, C3, 42, 23, 9B, 07), BYTES_TO_WORDS_8(4D, AE, 9A, F8, 58, 36, 39, B2),
+        BYTES_TO_WORDS_8(4F, 9E, 8D, 51, 52, 85, 32, 35), BYTES_TO_WORDS_8(56, 10, 52, B7, 95, AC, A8, AC),
+        BYTES_TO_WORDS_8(A2, 73, A9, 9B, 04, B1, EF, DD), BYTES_TO_WORDS_8(E9, 35, 39, 41, DC, BF, ED, E1),
+        BYTES_TO_WORDS_8(89, 21, 87, 92, 4B, 4C, 30, 94), BYTES_TO_WORDS_8(20, CC, 75, DD, 67, C5, 12, 7F) },
+      { BYTES_TO_WORDS_8(63, 37, 8D, ED, 93, 8A, D5, 02), BYTES_TO_WORDS_8(44, 5D, D2, B3, 41, 1B, 3C, 16),
+        BYTES_TO_WORDS_8(1E, 52, 82, 7C, 20, 21, 08, 8C), BYTES_TO_WORDS_8(A2, 41, 59, 5D, 16, 32, CC, 79),
+        BYTES_TO_WORDS_8(FC, 6B, 5F, BC, F0, B0, AA, 36), BYTES_TO_WORDS_8(6B, 62, D3, 81, 75, C1, AB, AD),
+        BYTES_TO_WORDS_8(3E, FC, 2F, 94, 59, 1D, CC, 27), BYTES_TO_WORDS_8(D0, 53, 30, 07, E8, 93, F8, 9C) },
+      { BYTES_TO_WORDS_8(7F, 5B, 24, D3, 1C, 78, B2, 5D), BYTES_TO_WORDS_8(BF, 7F, 59, 90, 96, 66, 7D, A3),
+        BYTES_TO_WORDS_8(11, 53, D8, 98, AF, 21, 6C, 20), BYTES_TO_WORDS_8(0E, 7C, 66, DB, 04, 47, 90, FA),
+        BYTES_TO_WORDS_8(EF, 6B, DF, 4D, F1, 3D, 83, EF), BYTES_TO_WORDS_8(47, 1D, 4F, 62, D2, EC, 9E, CB),
+        BYTES_TO_WORDS_8(89, C1, F1, 40, ED, A3, 6F, 2D), BYTES_TO_WORDS_8(A4, 36, A8, 74, 36, 8C, 1C, 1A) },
+      { BYTES_TO_WORDS_8(A9, 60, 85, 34, 21, BA, 38, 6C), BYTES_TO_WORDS_8(7C, 21, 6F, 62, FD, 60, E9, B3),
+        BYTES_TO_WORDS_8(20, DA, 40, 86, 47, 69, E3, 7B), BYTES_TO_WORDS_8(93, 43, 99, 05, 90, D9, A2, 6F),
+        BYTES_TO_WORDS_8(57, 27, E5, BA, 77, 93, 60, B9), BYTES_TO_WORDS_8(EE, C5, 51, C5, AB, CD, 39, FE),
+        BYTES_TO_WORDS_8(3A, 5C, 98, A6, 52, A3, 54, 37), BYTES_TO_WORDS_8(E8, C7, 5A, 91, C3, 0C, BA, 9E) } },
+    /* (1..8) * 16^57 * G */
+    { { BYTES_TO_WORDS_8(34, 1F, EA, 67, 17, AB, 4D, D3), BYTES_TO_WORDS_8(0D, 9E, 73, 04, 54, D3, 6B, 64),
+        BYTES_TO_WORDS_8(D6, 53, B3, 93, 17, 1D, B4, C3), BYTES_TO_WORDS_8(66, 4B, 47, 3D, A2, 60, 94, 7F),
+        BYTES_TO_WORDS_8(EC, 63, 90, CD, CA, C2, BE, 58), BYTES_TO_WORDS_8(FC, 4F, E3, 24, 51, 81, FF, C6),
+        BYTES_TO_WORDS_8(61, 66, 07, 8F, BF, F2, F1, 69), BYTES_TO_WORDS_8(87, 61, B0, 8F, 77, 16, D5, D0) },
+      { BYTES_TO_WORDS_8(DB, 5B, 8C, 2B, 05, A0, 45, 2E), BYTES_TO_WORDS_8(76, BC, 71, 27, 72, 59, 0D, 80),
+        BYTES_TO_WORDS_8(FC, 1E, 32, E0, 57, 6A, 79, 9F), BYTES_TO_WORDS_8(97, 3C, DB, 87, 08, 2B, 29, 02),
+        BYTES_TO_WORDS_8(F2, 56, 72, 20, B5, E7, CF, 4B), BYTES_TO_WORDS_8(89, 2D, 66, 16, 11, F0, C8, 34),
+        BYTES_TO_WORDS_8(F6, 85, 41, CF, 01, 05, CF, 70), BYTES_TO_WORDS_8(82, E3, 07, 75, 84, 68, B6, 10) },
+      { BYTES_TO_WORDS_8(9D, 0A, FC, BD, C9, 74, 5B, DC), BYTES_TO_WORDS_8(A0, 7A, F7, 14, 5B, 23, 44, DE),
+        BYTES_TO_WORDS_8(A2, A2, E0, 6A, 64, E3, 60, 2A), BYTES_TO_WORDS_8(02, 9E, 32, 4C, F8, E7, 43, DB),
+        BYTES_TO_WORDS_8(13, D7, 9A, 9E, 3A, 09, B1, F0), BYTES_TO_WORDS_8(54, F0, D2, 56, 73, 04, 39, 88),
+        BYTES_TO_WORDS_8(A4, 9F, EF, 4C, 81, 6C, A5, B8), BYTES_TO_WORDS_8(91, B5, 36, BE, A2, 8D, 16, B0) },
+      { BYTES_TO_WORDS_8(84, A4, 40, 18, 0D, FB, CF, 7B), BYTES_TO_WORDS_8(A0, 05, AE, 5D, B9, DE, F7, EA),
+        BYTES_TO_WORDS_8(5E, 42, 08, 82, E4, FC, 1E, E0), BYTES_TO_WORDS_8(C1, 7A, BF, 54, 60, 6B, A1, F6),
+        BYTES_TO_WORDS_8(11, 91, 8F, 63, 6E, 4E, DC, 87), BYTES_TO_WORDS_8(35, AE, E7, 6F, 7C, 81, DC, AC),
+        BYTES_TO_WORDS_8(09, 94, 39, 4C, 32, 3E, CF, 59), BYTES_TO_WORDS_8(91, D2, 36, 6B, 11, 92, 6C, 71) },
+      { BYTES_TO_WORDS_8(8D, 80, 83, 42, 77, B1, BC, 30), BYTES_TO_WORDS_8(89, 3A, 64, 35, CE, 07, 8F, 0F),
+        BYTES_TO_WORDS_8(98, 78, FA, 21, 91, 5E, 51, B8), BYTES_TO_WORDS_8(AE, 21, 0D, EE, 81, 30, AF, E9),
+        BYTES_TO_WORDS_8(33, 9D, B3, 39, 8E, 2F, 6C, 96), BYTES_TO_WORDS_8(19, 6D, 13, 15, 51, 92, 6B, 97),
+        BYTES_TO_WORDS_8(71, 49, EF, 0F, 55, 26, AF, 85), BYTES_TO_WORDS_8(60, 12, 47, 9C, 48, C8, 76, A9) },
+      { BYTES_TO_WORDS_8(98, 71, CD, FF, 85, C2, 95, 14), BYTES_TO_WORDS_8(96, F4, 76, 9B, FD, 77, 5D, A4),
+        BYTES_TO_WORDS_8(BB, E4, BC, 7A, 7F, 8A, 5B, 99), BYTES_TO_WORDS_8(30, 87, 5E, CB, B5, A9, FF, 3A),
+        BYTES_TO_WORDS_8(35, 66, EB, 30, 24, 30, 9F, 02), BYTES_TO_WORDS_8(02, 2F, 6B, 87, 03, 8F, A5, 10),
+        BYTES_TO_WORDS_8(CD, 59, 78, BF, 89, 80, C9, 75), BYTES_TO_WORDS_8(3D, 63, AC, 8E, 4F, 55, 4D, 2D) },
+      { BYTES_TO_WORDS_8(DF, 26, 84, AD, 2C, F4, 92, 26), BYTES_TO_WORDS_8(0A, 8A, 6F, 4E, 5A, 39, 41, 0F),
+        BYTES_TO_WORDS_8(59, 83, F8, 3B, 38, C9, 3A, 70), BYTES_TO_WORDS_8(80, 69, 80, 2C, 63, 33, B7, 6E),
+        BYTES_TO_WORDS_8(67, 42, 0B, 20, EE, 59, F7, 3F), BYTES_TO_WORDS_8(83, 1B, FE, 83, 7C, E9, 52, 92),
+        BYTES_TO_WORDS_8(8D, 8E, C0, EC, 2C, 4B, 0E, 03), BYTES_TO_WORDS_8(9A, 7A, 30, 17, C1, 6E, C5, 96) },
+      { BYTES_TO_WORDS_8(A4, 0B, C1, DB, DC, AC, 17, 16), BYTES_TO_WORDS_8(36, 8B, F7, 7F, D1, 0E, 7C, BC),
+        BYTES_TO_WORDS_8(C1, 52, 26, AD, D5, FD, 3E, 6A), BYTES_TO_WORDS_8(45, 54, 84, 3E, 5D, 39, 8F, 94),
+        BYTES_TO_WORDS_8(0F, BE, A2, 6D, CA, 40, 6B, 1A), BYTES_TO_WORDS_8(7C, 98, D0, FF, 97, D2, 63, 5A),
+        BYTES_TO_WORDS_8(EF, A9, B5, A1, 00, 13, A4, 72), BYTES_TO_WORDS_8(B5, E9, 1A, D1, 06, 00, BA, 98) } },
+    /* (1..8) * 16^58 * G */
+    { { BYTES_TO_WORDS_8(83, 84, 6D, 8E, D7, B4, C9, CE), BYTES_TO_WORDS_8(0D, 7F, 96, 46, A8, D7, F2, 82),
+        BYTES_TO_WORDS_8(45, E9, 6E, 1B, 9F, F4, 58, 29), BYTES_TO_WORDS_8(3D, 56, 3D, A3, 60, CB, 39, 9C),
+        BYTES_TO_WORDS_8(FB, 50, 2C, 6B, 6F, 35, B3, 94), BYTES_TO_WORDS_8(68, 43, BE, 3D, 2F, E5, AD, BB),
+        BYTES_TO_WORDS_8(46, 65, A1, BC, B7, 96, D1, 03), BYTES_TO_WORDS_8(10, E5, 93, E4, 1E, BF, 97, F0) },
+      { BYTES_TO_WORDS_8(BF, 27, 7F, 6C, 4B, 78, 63, 13), BYTES_TO_WORDS_8(A7, 96, FE, 36, 63, 7A, 06, 41),
+        BYTES_TO_WORDS_8(D1, 3E, 32, 3B, EB, A4, E8, 33), BYTES_TO_WORDS_8(2F, 80, D7, 94, AE, 09, C8, CB),
+        BYTES_TO_WORDS_8(A6, 0F, A3, CA, 63, 9D, C6, EC), BYTES_TO_WORDS_8(9A, AA, 3D, 90, D8, 4D, AD, 07),
+        BYTES_TO_WORDS_8(05, DB, DC, DF, B5, CE, AA, D7), BYTES_TO_WORDS_8(85, 5C, 11, 18, 0E, BB, 9C, BD) },
+      { BYTES_TO_WORDS_8(DA, 4D, A1, 47, F8, 31, 5C, F5), BYTES_TO_WORDS_8(F3, 4D, 4B, 67, 29, 04, 6D, 60),
+        BYTES_TO_WORDS_8(83, 30, 01, 24, F7, 68, 37, 44), BYTES_TO_WORDS_8(D7, DA, EA, 90, CC, 7A, F3, 18),
+        BYTES_TO_WORDS_8(64, 83, AC, 25, C3, CD, 2F, E2), BYTES_TO_WORDS_8(CB, 36, 85, 8A, C7, F7, D8, 77),
+        BYTES_TO_WORDS_8(0B, CD, 1B, EE, EC, FF, BB, D7), BYTES_TO_WORDS_8(26, 2C, 09, AA, BA, 4B, 94, 2F) },
+      { BYTES_TO_WORDS_8(AD, 1C, A8, 60, 87, C1, 5C, BE), BYTES_TO_WORDS_8(3B, 22, 3B, B4, 1C, 3C, 2C, 82),
+        BYTES_TO_WORDS_8(F4, 6C, 50, 49, F3, 1E, 15, 37), BYTES_TO_WORDS_8(18, 26, E5, C6, 24, EE, FB, 8B),
+        BYTES_TO_WORDS_8(3E, 01, F0, 5F, 51, B9, 86, 69), BYTES_TO_WORDS_8(76, 23, FD, AC, EC, C8, 9F, 8D),
+        BYTES_TO_WORDS_8(51, E1, 1B, E7, 9F, 28, FD, 0C), BYTES_TO_WORDS_8(59, 9B, 40, A3, CA, 27, 51, D7) },
+      { BYTES_TO_WORDS_8(BE, 59, 7D, CC, E8, E8, 74, 56), BYTES_TO_WORDS_8(FB, 32, 09, 8E, 58, 18, EA, 98),
+        BYTES_TO_WORDS_8(6B, 73, 72, 47, EE, FF, C5, 4E), BYTES_TO_WORDS_8(DA, 79, 1E, 28, 8C, 35, 13, 54),
+        BYTES_TO_WORDS_8(90, 05, F8, E4, F6, A1, 7E, 2D), BYTES_TO_WORDS_8(67, B3, 00, C9, 15, 5B, E2, 53),
+        BYTES_TO_WORDS_8(5A, 51, 64, 01, D2, 8F, C4, E7), BYTES_TO_WORDS_8(24, B0, 9C, 96, DE, D4, 0F, 68) },
+      { BYTES_TO_WORDS_8(8E, B0, 58, 4F, 80, 49, 28, C2), BYTES_TO_WORDS_8(DD, 57, 1B, 17, ED, 9C, 76, DC),
+        BYTES_TO_WORDS_8(AC, 4C, D6, 2F, E7, C7, B5, FE), BYTES_TO_WORDS_8(73, EC, FF, 27, 03, 1B, 1C, 0B),
+        BYTES_TO_WORDS_8(B2, 3A, 02, F5, AC, 83, 1C, 0F), BYTES_TO_WORDS_8(AA, 55, B9, F7, 6C, EB, 8B, 0D),
+        BYTES_TO_WORDS_8(7C, 6A, 0A, 87, 12, 68, A1, 95), BYTES_TO_WORDS_8(27, 41, 35, 8D, 7A, B8, 8F, 6E) },
+      { BYTES_TO_WORDS_8(A8, 51, 60, 87, 9F, 0C, B8, 8E), BYTES_TO_WORDS_8(A5, 7E, 45, 3A, 96, 73, D7, BE),
+        BYTES_TO_WORDS_8(80, 52, B8, C1, A3, C1, CF, 5D), BYTES_TO_WORDS_8(F0, 94, B1, 91, 26, D1, 2F, 4E),
+        BYTES_TO_WORDS_8(05, 90, CC, E9, 4F, C7, FE, 6A), BYTES_TO_WORDS_8(2E, FE, C4, 92, A5, BA, B8, EB),
+        BYTES_TO_WORDS_8(BC, 31, 8A, 50, A1, 35, 1B, 37), BYTES_TO_WORDS_8(B2, FB, F4, F5, DB, BB, 2A, 12) },
+      { BYTES_TO_WORDS_8(93, 3B, B3, 2F, 78, 15, 11, C2), BYTES_TO_WORDS_8(5C, FC, 3A, D6, 2B, 7B, B0, 76),
+        BYTES_TO_WORDS_8(F1, E8, 41, 10, 42, 79, 78, C0), BYTES_TO_WORDS_8(24, E1, DB, BA, C6, 1B, 18, B8),
+        BYTES_TO_WORDS_8(D6, EA, 54, 7A, 16, 5E, 1A, 91), BYTES_TO_WORDS_8(DC, 27, F6, 4B, B1, C5, AC, F9),
+        BYTES_TO_WORDS_8(75, DD, 67, E9, 4B, 10, EF, DE), BYTES_TO_WORDS_8(CA, E7, CC, 18, 51, 2F, 01, BB) } },
+    /* (1..8) * 16^59 * G */
+    { { BYTES_TO_WORDS_8(E4, D4, 38, 5C, C5, 97, DA, 7D), BYTES_TO_WORDS_8(74, 73, B1, B1, F1, 65, FD, E2),
+        BYTES_TO_WORDS_8(25, 1E, 18, 30, 74, 6E, 56, 97), BYTES_TO_WORDS_8(38, 99, 22, 11, 26, 85, 92, 3D),
+        BYTES_TO_WORDS_8(D3, F0, CC, C0, 00, EF, AA, 6F), BYTES_TO_WORDS_8(7F, BC, 7A, 19, 38, B1, 0A, CC),
+        BYTES_TO_WORDS_8(EA, 69, 28, 5C, 03, 57, F0, 3F), BYTES_TO_WORDS_8(B5, EA, 68, D4, A5, A0, 2C, D3) },
+      { BYTES_TO_WORDS_8(97, 42, 90, D4, 8B, 4A, DE, D9), BYTES_TO_WORDS_8(C2, 5D, 84, 32, FE, B7, 23, 0D),
+        BYTES_TO_WORDS_8(0F, C3, 14, D3, FB, DC, FE, E3), BYTES_TO_WORDS_8(EA, 78, 08, 3B, B5, C1, 51, 55),
+        BYTES_TO_WORDS_8(09, 38, 15, 85, 1A, EC, BD, DD), BYTES_TO_WORDS_8(A6, 67, 69, DB, 83, 73, BE, F2),
+        BYTES_TO_WORDS_8(5C, 5A, E6, 00, 5E, F8, C6, 2D), BYTES_TO_WORDS_8(FA, 3F, F0, DE, 50, F8, AA, 2F) },
+      { BYTES_TO_WORDS_8(8A, 71, D7, 0D, 58, 32, 72, D0), BYTES_TO_WORDS_8(4E, 4E, BE, 19, 65, 1B, C8, 91),
+        BYTES_TO_WORDS_8(F8, DF, 76, 5E, A2, 59, C1, F7), BYTES_TO_WORDS_8(C3, 2F, 90, 2B, 37, 0E, 18, 3B),
+        BYTES_TO_WORDS_8(DB, 82, FD, 9A, 29, 26, 66, 72), BYTES_TO_WORDS_8(D0, 14, 2D, 70, 56, 11, 49, 58),
+        BYTES_TO_WORDS_8(1E, 21, 05, 29, 9D, BC, A4, FA), BYTES_TO_WORDS_8(AA, 58, 6B, F3, 17, B1, B6, F2) },
+      { BYTES_TO_WORDS_8(C2, 58, 20, 8E, E5, 8F, 48, B1), BYTES_TO_WORDS_8(C9, 56, EB, 6B, 6A, 13, 4B, 27),
+        BYTES_TO_WORDS_8(09, 6A, F9, 6E, 1E, 49, F7, 6B), BYTES_TO_WORDS_8(CD, 95, 7D, 4E, 1F, B4, 9C, 6A),
+        BYTES_TO_WORDS_8(95, 14, 6B, C8, 2B, AB, 95, EA), BYTES_TO_WORDS_8(67, F3, A7, 9A, AA, 86, 08, 05),
+        BYTES_TO_WORDS_8(08, 12, A2, 08, A6, 07, B9, 02), BYTES_TO_WORDS_8(66, A9, 97, EC, 45, 3D, D9, ED) },
+      { BYTES_TO_WORDS_8(3D, 65, D3, 93, 11, A5, 81, FA), BYTES_TO_WORDS_8(D5, 67, E4, 74, B2, C4, 4E, 13),
+        BYTES_TO_WORDS_8(B2, 3E, A8, 98, 40, 4F, EF, 45), BYTES_TO_WORDS_8(9F, 9C, D6, 91, 03, FF, 52, F3),
+        BYTES_TO_WORDS_8(8E, F2, 44, 8A, 8C, 67, E6, 79), BYTES_TO_WORDS_8(D0, 82, C5, 72, F9, 95, 19, 5C),
+        BYTES_TO_WORDS_8(05, D5, A6, FD, 3D, D7, 0B, 02), BYTES_TO_WORDS_8(BD, 5E, 6C, CB, 6C, 62, 72, 44) },
+      { BYTES_TO_WORDS_8(A2, 75, 4B, D9, 04, 52, D1, 78), BYTES_TO_WORDS_8(DF, 92, 83, 1D, 8A, DE, 1C, 91),
+        BYTES_TO_WORDS_8(40, 43, 6F, 36, 72, D4, AB, 8E), BYTES_TO_WORDS_8(BB, CF, 77, AC, 9A, E4, 6A, E4),
+        BYTES_TO_WORDS_8(D6, C0, 81, 8A, 90, FD, 99, 47), BYTES_TO_WORDS_8(F4, A6, D4, 87, C9, 66, 67, 81),
+        BYTES_TO_WORDS_8(5B, F8, 90, FE, EF, 17, 50, 84), BYTES_TO_WORDS_8(5E, 33, F5, E5, EB, EB, A6, 9A) },
+      { BYTES_TO_WORDS_8(DA, 78, 44, ED, 1A, DF, 61, D6), BYTES_TO_WORDS_8(54, 01, 0E, 24, C2, F6, 5C, F1),
+        BYTES_TO_WORDS_8(A1, 3C, 79, BF, CD, 45, FB, 0A), BYTES_TO_WORDS_8(23, 8C, 4D, 03, 71, E4, 0E, 67),
+        BYTES_TO_WORDS_8(F0, 63, F5, F4, 4F, FE, 8F, 62), BYTES_TO_WORDS_8(70, 47, F2, 0F, 16, B8, C3, 1C),
+        BYTES_TO_WORDS_8(E8, 50, 87, 13, 5B, 60, 46, 25), BYTES_TO_WORDS_8(CA, 22, A0, 5B, 42, C7, A0, 5C) },
+      { BYTES_TO_WORDS_8(F5, CB, 53, 7A, D1, DF, 5C, 24), BYTES_TO_WORDS_8(59, 51, D4, 44, B9, 76, 8C, 37),
+        BYTES_TO_WORDS_8(DD, 3A, 20, 3F, ED, 29, AC, B6), BYTES_TO_WORDS_8(90, 6D, 70, E5, 7F, FC, B5, DA),
+        BYTES_TO_WORDS_8(1A, FB, 52, 30, 4B, 1D, 8C, BF), BYTES_TO_WORDS_8(97, C9, 66, C1, 73, 51, B1, 87),
+        BYTES_TO_WORDS_8(97, 91, B4, D8, 8F, 59, 39, 50), BYTES_TO_WORDS_8(B4, 57, 05, 6D, 21, CC, F6, 97) } },
+    /* (1..8) * 16^60 * G */
+    { { BYTES_TO_WORDS_8(E3, 8D, 4E, A4, B1, 04, 63, 60), BYTES_TO_WORDS_8(07, 1E, CC, 2E, 6A, 96, 08, 5C),
+        BYTES_TO_WORDS_8(91, 17, BD, 08, CF, 7D, 5A, 3A), BYTES_TO_WORDS_8(B7, 10, 88, 46, B7, 99, 0B, F5),
+        BYTES_TO_WORDS_8(88, 35, 7F, DB, A6, 3B, 3F, 4A), BYTES_TO_WORDS_8(85, 1E, 72, 21, 8D, F1, 75, E9),
+        BYTES_TO_WORDS_8(BB, CE, ED, 2D, 3A, 97, 89, 87), BYTES_TO_WORDS_8(0C, 8F, F1, 55, 1E, 06, B5, E2) },
+      { BYTES_TO_WORDS_8(9C, 74, DC, 60, 2D, 3A, 10, A9), BYTES_TO_WORDS_8(00, D8, 7A, A2, FB, 21, 33, D8),
+        BYTES_TO_WORDS_8(97, 6E, A4, 20, 30, 74, 9C, B0), BYTES_TO_WORDS_8(C9, 98, 71, 22, 54, 89, 14, 2A),
+        BYTES_TO_WORDS_8(F2, 3C, FA, F0, 8F, F2, E1, F2), BYTES_TO_WORDS_8(01, 6F, 9B, C3, CD, 2D, F9, BE),
+        BYTES_TO_WORDS_8(C4, 08, 76, A3, 40, 24, 3C, EA), BYTES_TO_WORDS_8(22, E4, 74, 89, 18, 5A, 21, AA) },
+      { BYTES_TO_WORDS_8(8B, CF, AC, 82, 6B, 6B, DC, DD), BYTES_TO_WORDS_8(A7, 6F, 81, 82, 91, 99, D2, 81),
+        BYTES_TO_WORDS_8(04, 43, 39, 51, E2, 30, 5F, 64), BYTES_TO_WORDS_8(70, 57, 50, A5, 61, 7F, 8D, 59),
+        BYTES_TO_WORDS_8(08, B8, 6C, 0F, 3C, 67, 84, 1B), BYTES_TO_WORDS_8(B9, 40, 35, 35, 8F, 9A, 28, D2),
+        BYTES_TO_WORDS_8(CA, EB, 73, B2, 62, 51, 6C, 54), BYTES_TO_WORDS_8(09, 26, 8F, 4F, F7, 21, 31, 9F) },
+      { BYTES_TO_WORDS_8(BC, 2A, 96, DD, 72, C3, 0C, 1E), BYTES_TO_WORDS_8(CC, BD, 87, 8E, 20, 7D, BB, 1E),
+        BYTES_TO_WORDS_8(87, 2C, 64, 8A, C5, 3E, 7A, CC), BYTES_TO_WORDS_8(53, 44, CC, F4, 78, 48, 5A, 0A),
+        BYTES_TO_WORDS_8(FA, C3, 2C, 9E, BC, AA, 5D, E8), BYTES_TO_WORDS_8(FA, A9, 50, 8E, 4C, A6, 32, 58),
+        BYTES_TO_WORDS_8(17, 30, 90, F2, 4D, B1, 72, 4D), BYTES_TO_WORDS_8(57, DC, B0, 88, 22, 8B, 14, F7) },
+      { BYTES_TO_WORDS_8(3E, 7B, AA, 64, 54, 9A, B3, 9F), BYTES_TO_WORDS_8(EA, 9C, 6C, 05, 1B, EF, C4, 13),
+        BYTES_TO_WORDS_8(10, 58, 1C, 54, 91, 20, FD, 64), BYTES_TO_WORDS_8(4D, 4C, 9F, F4, 12, 20, 5A, 71),
+        BYTES_TO_WORDS_8(1D, 08, 7D, BC, 44, 39, A3, D9), BYTES_TO_WORDS_8(D0, 47, 8B, A8, 88, C5, 1B, 42),
+        BYTES_TO_WORDS_8(62, 3B, 91, 8A, 8F, 28, 79, 1F), BYTES_TO_WORDS_8(0A, 6C, 60, AA, B1, B3, 22, 59) },
+      { BYTES_TO_WORDS_8(98, 22, AE, 18, 70, FA, C3, 85), BYTES_TO_WORDS_8(D6, E0, B3, 81, EF, AD, 07, CB),
+        BYTES_TO_WORDS_8(52, 86, 57, 89, 67, 35, 74, AA), BYTES_TO_WORDS_8(03, 7D, C8, 1A, A1, 3C, 09, F8),
+        BYTES_TO_WORDS_8(B0, 93, 5C, D3, 92, 61, C3, 06), BYTES_TO_WORDS_8(6F, 00, B6, 6D, 0F, 9A, 50, E4),
+        BYTES_TO_WORDS_8(F3, 9C, 7E, 30, EC, 29, 61, B1), BYTES_TO_WORDS_8(10, 9C, F4, 6E, 21, 4F, 07, 32) },
+      { BYTES_TO_WORDS_8(20, B2, 0D, 62, 97, B6, BD, D1), BYTES_TO_WORDS_8(E4, AC, 87, 16, 10, CB, 1C, C7),
+        BYTES_TO_WORDS_8(76, 78, B8, 7F, 89, CE, 09, C4), BYTES_TO_WORDS_8(25, B1, A9, 6A, 5E, 8C, EC, 49),
+        BYTES_TO_WORDS_8(C2, 38, 73, 67, A0, AC, B8, 99), BYTES_TO_WORDS_8(CE, 9C, 3B, E5, 73, 30, 2C, 84),
+        BYTES_TO_WORDS_8(29, 54, 5F, 86, 34, CC, A9, 3D), BYTES_TO_WORDS_8(9B, 62, EA, E5, 4F, 7D, A9, 99) },
+      { BYTES_TO_WORDS_8(CD, A5, 8A, 12, 40, 5B, 92, 93), BYTES_TO_WORDS_8(E7, 68, 97, ED, 38, AF, CE, CE),
+        BYTES_TO_WORDS_8(FC, 93, 6C, DD, FB, B9, FE, 20), BYTES_TO_WORDS_8(B3, F1, 92, 5A, CB, EF, E3, F5),
+        BYTES_TO_WORDS_8(B4, 0F, AA, CE, C7, 99, 27, AB), BYTES_TO_WORDS_8(C9, CE, 10, B1, F4, A6, E0, 84),
+        BYTES_TO_WORDS_8(2B, BD, 07, EB, DF, E2, 51, 4E), BYTES_TO_WORDS_8(05, DE, F3, 9B, 89, A2, CF, 76) } },
+    /* (1..8) * 16^61 * G */
+    { { BYTES_TO_WORDS_8(B4, CF, 37, 60, 05, 94, 19, 9E), BYTES_TO_WORDS_8(85, AA, CD, C3, 46, F2, 00, 74),
+        BYTES_TO_WORDS_8(E0, B0, A0, 0D, 88, F4, 77, 0D), BYTES_TO_WORDS_8(0B, ED, F5, 3F, 82, 31, 25, 04),
+        BYTES_TO_WORDS_8(23, 5D, 77, D8, 5E, 32, B7, 00), BYTES_TO_WORDS_8(D4, 5D, EC, 34, F5, E4, A3, EE),
+        BYTES_TO_WORDS_8(AC, 1F, 66, C8, D0, A4, 8C, 62), BYTES_TO_WORDS_8(7E, 0F, E0, FA, CC, 8B, 0E, C9) },
+      { BYTES_TO_WORDS_8(8B, 5A, 6B, E6, 83, 14, 6E, FD), BYTES_TO_WORDS_8(62, 16, 24, 78, 13, 5A, 38, 37),
+        BYTES_TO_WORDS_8(66, DF, 47, 8D, 12, 6C, AA, DB), BYTES_TO_WORDS_8(40, 6D, 42, ED, DB, A6, D7, B0),
+        BYTES_TO_WORDS_8(E3, 0A, 55, CC, 12, FB, C4, F6), BYTES_TO_WORDS_8(8B, 06, 72, 15, 37, 77, 9B, 23),
+        BYTES_TO_WORDS_8(16, A3, F4, 7E, 68, 0D, 1C, FD), BYTES_TO_WORDS_8(16, F3, AB, 15, 48, 63, 52, F6) },
+      { BYTES_TO_WORDS_8(77, 45, C3, 46, 35, 67, 4F, 78), BYTES_TO_WORDS_8(F7, 2A, A5, E6, C8, 9E, 40, E6),
+        BYTES_TO_WORDS_8(BD, E4, C0, E8, 08, E3, F5, B1), BYTES_TO_WORDS_8(48, CA, 0B, E3, A0, 7A, 55, 27),
+        BYTES_TO_WORDS_8(3C, 19, 16, 04, B8, B9, FE, AD), BYTES_TO_WORDS_8(0B, 38, C4, 74, 73, CA, A2, 18),
+        BYTES_TO_WORDS_8(F3, 34, FD, 49, 5A, D7, C8, 77), BYTES_TO_WORDS_8(3B, 5B, 10, 46, 58, C7, 99, 83) },
+      { BYTES_TO_WORDS_8(88, 59, 37, 82, B2, 74, 1A, 9C), BYTES_TO_WORDS_8(EB, A5, 4A, 96, 75, 32, 72, 68),
+        BYTES_TO_WORDS_8(4C, 53, 9A, 53, 5C, CB, 42, 45), BYTES_TO_WORDS_8(0A, DE, A2, DE, 6B, F3, 0B, 04),
+        BYTES_TO_WORDS_8(CB, 01, 33, 79, D4, A3, D2, 80), BYTES_TO_WORDS_8(F0, F7, 04, AE, 33, BE, 7A, 97),
+        BYTES_TO_WORDS_8(C5, E3, 7E, 76, 67, 68, D1, 37), BYTES_TO_WORDS_8(53, D7, DA, 81, B6, B2, B5, E8) },
+      { BYTES_TO_WORDS_8(D3, F4, 01, A4, B6, FD, 58, EE), BYTES_TO_WORDS_8(01, B3, 95, EA, 50, 2E, 6C, CF),
+        BYTES_TO_WORDS_8(DE, D7, 61, F5, 3B, 78, 50, 8E), BYTES_TO_WORDS_8(64, 73, 58, D2, 17, 78, 68, 8E),
+        BYTES_TO_WORDS_8(6B, D8, 94, 42, 94, 1E, 28, 90), BYTES_TO_WORDS_8(28, 91, A1, 2E, F1, 96, 0B, 90),
+        BYTES_TO_WORDS_8(AE, 3C, 6D, 50, A0, 09, F8, 62), BYTES_TO_WORDS_8(FA, 9B, 2C, 6E, 88, AB, 9C, 98) },
+      { BYTES_TO_WORDS_8(9C, EE, D4, D4, A6, 3A, 41, ED), BYTES_TO_WORDS_8(2B, 67, 85, A4, 69, F4, 6D, 49),
+        BYTES_TO_WORDS_8(F3, 42, E4, CE, 7C, 12, F5, A2), BYTES_TO_WORDS_8(5D, BC, 93, 85, 92, 48, 36, AE),
+        BYTES_TO_WORDS_8(FF, 4F, A5, F9, CE, CC, 0A, CD), BYTES_TO_WORDS_8(E7, 35, 7F, 2D, 4A, CC, 5B, ED),
+        BYTES_TO_WORDS_8(B7, 57, 8D, 4B, 9D, B3, 36, B7), BYTES_TO_WORDS_8(AD, F5, 13, 87, 0C, F1, 85, BA) },
+      { BYTES_TO_WORDS_8(E6, A8, 2A, 6D, E2, 3D, 96, C5), BYTES_TO_WORDS_8(2D, FE, EF, 40, FC, 59, 53, 20),
+        BYTES_TO_WORDS_8(EE, DB, 67, CA, 03, 68, 03, D1), BYTES_TO_WORDS_8(F6, 5C, 3E, 25, 46, 17, A4, 98),
+        BYTES_TO_WORDS_8(5B, F7, 6C, 60, ED, 0B, 74, 69), BYTES_TO_WORDS_8(19, D2, 7E, AB, FA, 17, 02, E3),
+        BYTES_TO_WORDS_8(C9, CE, F5, A2, F5, 42, 15, B1), BYTES_TO_WORDS_8(D6, 63, 34, 7E, 94, C6, 9A, 57) },
+      { BYTES_TO_WORDS_8(9D, B5, CD, F0, 3F, 9E, 78, 0E), BYTES_TO_WORDS_8(E1, 68, EB, 92, 33, 4E, E4, 8B),
+        BYTES_TO_WORDS_8(69, CE, D5, FC, 9B, 13, 70, 3D), BYTES_TO_WORDS_8(E1, E2, 86, 07, 9F, E9, 54, 37),
+        BYTES_TO_WORDS_8(99, 84, 6A, EB, FF, C0, 39, 42), BYTES_TO_WORDS_8(F0, 34, 27, 63, 6F, 9B, 01, 61),
+        BYTES_TO_WORDS_8(DB, 80, 64, 20, 27, 3C, 2F, 01), BYTES_TO_WORDS_8(BE, DC, AD, 96, 74, F8, C2, 24) } },
+    /* (1..8) * 16^62 * G */
+    { { BYTES_TO_WORDS_8(44, BD, 5F, 88, 29, 71, 74, C0), BYTES_TO_WORDS_8(7A, 26, 26, 9F, A3, CA, C2, 89),
+        BYTES_TO_WORDS_8(2C, 22, D5, 16, CE, 71, 54, E0), BYTES_TO_WORDS_8(05, 59, AB, D9, DA, 06, BF, 9B),
+        BYTES_TO_WORDS_8(88, 3E, 1D, 7A, FA, 7D, 44, A3), BYTES_TO_WORDS_8(D2, 6E, 03, 15, DC, BD, D4, C0),
+        BYTES_TO_WORDS_8(E8, 47, 6F, 0A, F3, DA, 55, 67), BYTES_TO_WORDS_8(A3, 20, E1, 4D, A8, 7F, CC, 1B) },
+      { BYTES_TO_WORDS_8(05, 00, 49, D8, 40, 98, E5, 3C), BYTES_TO_WORDS_8(1F, 18, C5, A4, 29, 9D, 59, 90),
+        BYTES_TO_WORDS_8(8C, B7, BF, 2F, 19, AB, DA, 4A), BYTES_TO_WORDS_8(16, F4, ED, BB, B4, 49, EF, F8),
+        BYTES_TO_WORDS_8(DE, AF, 62, BD, 83, 2E, 46, 1A), BYTES_TO_WORDS_8(67, EE, DE, 37, 88, 12, F2, 58),
+        BYTES_TO_WORDS_8(3A, B7, A4, 65, 76, D7, BB, 02), BYTES_TO_WORDS_8(64, 21, 97, EE, A7, 67, 9E, 97) },
+      { BYTES_TO_WORDS_8(06, B5, A7, B4, 92, E7, 7A, 8B), BYTES_TO_WORDS_8(E0, 0B, 86, E7, BA, 8B, 75, 22),
+        BYTES_TO_WORDS_8(E9, 0E, 50, E7, 2A, FB, 9C, 42), BYTES_TO_WORDS_8(D3, 5B, 3B, 5B, F6, F7, 6F, 64),
+        BYTES_TO_WORDS_8(46, F9, 36, 2B, 25, C1, 79, C9), BYTES_TO_WORDS_8(95, 69, 8E, C0, 4F, FC, 2D, 49),
+        BYTES_TO_WORDS_8(E8, 8F, 4A, 80, 31, E3, 61, 5A), BYTES_TO_WORDS_8(A5, 18, 4A, 06, 9D, 2A, 11, BC) },
+      { BYTES_TO_WORDS_8(8B, 33, 7B, F8, 19, EA, DE, ED), BYTES_TO_WORDS_8(A7, EB, 04, 2E, FC, D4, 44, FE),
+        BYTES_TO_WORDS_8(01, 91, 6D, D6, 22, 9B, 3A, 1B), BYTES_TO_WORDS_8(F0, 43, C7, D2, 41, AB, 63, BE),
+        BYTES_TO_WORDS_8(85, 0A, B0, 91, 25, 2F, 21, 9D), BYTES_TO_WORDS_8(AF, 0D, 93, 45, 7E, CB, 53, 70),
+        BYTES_TO_WORDS_8(3B, 35, 0B, B9, BB, 21, 30, 8D), BYTES_TO_WORDS_8(75, F4, 22, 5E, 14, 5F, 12, 1F) },
+      { BYTES_TO_WORDS_8(53, B5, 03, C1, C9, 71, 4B, 15), BYTES_TO_WORDS_8(80, 5A, 38, 83, 27, EA, 60, BE),
+        BYTES_TO_WORDS_8(7E, 50, 7E, B2, 00, 10, 0C, 9D), BYTES_TO_WORDS_8(9A, D3, 17, A6, 7A, 54, C0, 7C),
+        BYTES_TO_WORDS_8(26, A5, 45, CD, A3, CB, 99, 57), BYTES_TO_WORDS_8(7D, 8B, 22, AC, 0A, 5A, 18, 00),
+        BYTES_TO_WORDS_8(C4, 94, FC, 39, CB, 28, D7, BD), BYTES_TO_WORDS_8(5A, 04, 28, 23, BD, 9E, 32, 7B) },
+      { BYTES_TO_WORDS_8(00, 36, 58, 58, 95, 45, 90, 98), BYTES_TO_WORDS_8(10, 53, 3B, 72, FE, 2F, EB, 6B),
+        BYTES_TO_WORDS_8(4A, FD, C5, EB, C7, 80, 22, E6), BYTES_TO_WORDS_8(DE, 26, FE, 9E, 4B, 53, 16, 15),
+        BYTES_TO_WORDS_8(1B, 13, A0, C3, 0C, 8E, 42, 08), BYTES_TO_WORDS_8(09, 0C, 4E, E7, C9, 43, AB, 2B),
+        BYTES_TO_WORDS_8(59, 5C, AA, EC, 99, 42, E7, B0), BYTES_TO_WORDS_8(EA, 88, CE, A7, B6, 43, E3, 60) },
+      { BYTES_TO_WORDS_8(A4, 17, E7, 19, 54, F4, 2E, AC), BYTES_TO_WORDS_8(81, 1B, F0, AC, DA, 2B, DA, 68),
+        BYTES_TO_WORDS_8(54, E1, AE, 6D, 53, ED, 63, 05), BYTES_TO_WORDS_8(4E, DB, C1, 0B, 99, 51, 68, 94),
+        BYTES_TO_WORDS_8(A3, DE, 26, B5, D1, 0F, 5F, A7), BYTES_TO_WORDS_8(9C, CD, 0A, F7, 90, 95, 99, 57),
+        BYTES_TO_WORDS_8(C0, 7D, 66, B2, E6, D0, B8, B3), BYTES_TO_WORDS_8(A8, 91, C5, 0D, 42, 78, 5C, CA) },
+      { BYTES_TO_WORDS_8(1E, D8, 3B, 11, 66, 24, 34, 44), BYTES_TO_WORDS_8(21, E7, EB, CA, F6, 42, 80, 57),
+        BYTES_TO_WORDS_8(E2, B6, 6E, 28, DF, 82, DA, AE), BYTES_TO_WORDS_8(E6, 00, 5D, B0, 42, 6F, 1D, FC),
+        BYTES_TO_WORDS_8(EA, E1, 7E, 5D, 41, D4, E3, 41), BYTES_TO_WORDS_8(DC, C8, 6D, 54, 31, B5, 76, 39),
+        BYTES_TO_WORDS_8(E6, 6C, D7, 7F, D9, 4B, D7, 93), BYTES_TO_WORDS_8(2A, 38, 02, AC, 43, DF, 2C, 6D) } },
+    /* (1..8) * 16^63 * G */
+    { { BYTES_TO_WORDS_8(48, 04, 4C, 44, 33, 32, AD, 1E), BYTES_TO_WORDS_8(E3, 19, 03, C1, 86, 76, 35, 96),
+        BYTES_TO_WORDS_8(E7, 93, 78, 3B, CB, FC, 43, 49), BYTES_TO_WORDS_8(A5, DF, 43, 29, F5, AD, 2F, B1),
+        BYTES_TO_WORDS_8(57, DE, 69, B3, 76, 5E, 57, 96), BYTES_TO_WORDS_8(F2, 4D, FC, 32, 03, E7, 05, 1D),
+        BYTES_TO_WORDS_8(A7, A6, B2, 77, 66, 8F, 6F, E9), BYTES_TO_WORDS_8(AC, F4, B0, 99, 95, 45, E2, 02) },
+      { BYTES_TO_WORDS_8(7B, E2, 47, 8B, 5E, 7E, 62, 58), BYTES_TO_WORDS_8(68, B3, 98, 8D, 2D, D8, F2, 3B),
+        BYTES_TO_WORDS_8(79, 3B, EA, 6C, 9F, F2, 2D, BE), BYTES_TO_WORDS_8(A4, B6, 75, 5E, 22, B2, 54, 60),
+        BYTES_TO_WORDS_8(62, 4B, AE, 64, E7, 29, 18, 00), BYTES_TO_WORDS_8(87, 19, AD, AF, F5, 9C, 78, 1D),
+        BYTES_TO_WORDS_8(F8, E0, 74, F5, D1, 0C, 76, B0), BYTES_TO_WORDS_8(ED, D8, 90, B1, F3, 06, 71, 6E) },
+      { BYTES_TO_WORDS_8(1F, 15, E9, 64, 54, C4, 36, F5), BYTES_TO_WORDS_8(18, 84, 0D, C8, 99, 33, EA, 67),
+        BYTES_TO_WORDS_8(3E, FB, D8, 91, DA, 5D, 25, 43), BYTES_TO_WORDS_8(68, 05, C5, F1, 34, 8E, 38, 48),
+        BYTES_TO_WORDS_8(34, 94, 7A, CD, ED, 49, EE, 1B), BYTES_TO_WORDS_8(10, 83, DE, 53, 11, 41, B1, 99),
+        BYTES_TO_WORDS_8(CC, 2B, 48, 15, 93, 33, 25, 6A), BYTES_TO_WORDS_8(9E, 4E, E4, F4, AB, 63, EC, B0) },
+      { BYTES_TO_WORDS_8(05, 98, B9, 8E, 69, CA, 93, 8D), BYTES_TO_WORDS_8(E3, 11, 9A, E9, 4C, 6D, 08, AD),
+        BYTES_TO_WORDS_8(68, 3A, F3, 0B, 93, BF, C2, B0), BYTES_TO_WORDS_8(FE, 8C, 70, 02, C2, 7F, EE, 01),
+        BYTES_TO_WORDS_8(AF, CC, EE, 10, 4E, 5F, FD, 09), BYTES_TO_WORDS_8(9B, 79, BE, 35, EA, 36, 18, 81),
+        BYTES_TO_WORDS_8(11, 57, 45, F3, 2E, E0, 4B, 12), BYTES_TO_WORDS_8(82, 48, 02, 1B, F0, CE, 55, 96) },
+      { BYTES_TO_WORDS_8(3D, 83, 5B, 8E, A5, B4, DF, D7), BYTES_TO_WORDS_8(19, 24, 0B, CA, 73, 00, 3A, 59),
+        BYTES_TO_WORDS_8(C9, 09, 01, 05, 81, DF, 65, 5E), BYTES_TO_WORDS_8(DA, 53, 14, AE, 47, 64, 8E, DE),
+        BYTES_TO_WORDS_8(C7, 5C, 4C, A1, 9A, C1, FC, F0), BYTES_TO_WORDS_8(C9, C6, 01, 29, 13, 03, 7E, 98),
+        BYTES_TO_WORDS_8(65, E2, 6D, BD, 8C, 28, 32, E3), BYTES_TO_WORDS_8(D8, 13, 09, 15, 3C, 46, E1, 05) },
+      { BYTES_TO_WORDS_8(4E, F4, F6, 2B, 71, 05, 42, 75), BYTES_TO_WORDS_8(24, 0E, 33, C9, 59, 3A, 40, 4A),
+        BYTES_TO_WORDS_8(E9, B0, D4, FD, A2, 79, D2, CE), BYTES_TO_WORDS_8(E4, 0E, 0A, E4, EE, F2, 6C, 01),
+        BYTES_TO_WORDS_8(A8, 03, 16, 61, 3F, 5C, 22, 53), BYTES_TO_WORDS_8(9B, 8B, 86, 90, E4, 53, CF, AF),
+        BYTES_TO_WORDS_8(BD, 53, CE, 0D, 39, 38, 2E, B5), BYTES_TO_WORDS_8(A8, D5, A7, 4E, 62, CF, E9, B8) },
+      { BYTES_TO_WORDS_8(48, DF, F7, C1, EA, 93, 25, 3E), BYTES_TO_WORDS_8(7B, 31, 71, B8, 3E, 47, 67, B2),
+        BYTES_TO_WORDS_8(85, F3, 58, 4E, 4E, 5B, 55, 8E), BYTES_TO_WORDS_8(9E, 7E, EC, A4, D0, 12, 8B, B1),
+        BYTES_TO_WORDS_8(46, B5, 46, E8, 90, D5, B3, 91), BYTES_TO_WORDS_8(59, E5, D1, 83, E4, F7, 83, 3C),
+        BYTES_TO_WORDS_8(3B, C3, AC, C5, 6B, 42, EC, 5C), BYTES_TO_WORDS_8(44, FB, 59, A3, 22, 19, 53, FF) },
+      { BYTES_TO_WORDS_8(54, 2B, 5F, 37, 8F, EC, 2D, B5), BYTES_TO_WORDS_8(50, 23, E9, E3, 60, 35, FE, 4E),
+        BYTES_TO_WORDS_8(BC, 24, 15, 89, 11, E9, 66, 50), BYTES_TO_WORDS_8(13, 23, 6B, 2E, 91, 0A, B2, 77),
+        BYTES_TO_WORDS_8(FF, 67, CC, D6, FC, 01, A8, CA), BYTES_TO_WORDS_8(F1, E0, 50, E8, A1, 3D, 62, DF),
+        BYTES_TO_WORDS_8(72, 8A, 03, DD, FC, 0B, B1, F7), BYTES_TO_WORDS_8(F7, A3, CE, 25, 18, 29, DC, A3) } }
+};
+
+#endif /* _UECC_P256_TABLE_H_ */
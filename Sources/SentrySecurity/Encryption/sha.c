@@ -1,7 +1,10 @@
 
 #include "stdint.h"
 #include "string.h"
+#include "stdatomic.h"
 #include "sha.h"
+#include "sha_impl.h"
+#include "cpu_features.h"
 
 
 
@@ -10,7 +13,7 @@
 struct sha_initial_ctx
 {
     uint16_t hashsize;
-    void (*transform)(struct sha_ctx*, uint32_t[]);
+    void (*transform)(uint32_t* state, const uint8_t* data, size_t blocks);
     uint32_t state[8];
 };
 
@@ -20,19 +23,11 @@ struct sha_initial_ctx
 // DBL_INT_ADD treats two unsigned ints a and b as one 64-bit integer and adds c to it
 #define DBL_INT_ADD(a,b,c) if ((a) > 0xffffffff - (c)) ++(b); (a) += (c);
 #define ROTLEFT(a,b) (((a) << (b)) | ((a) >> (32-(b))))
-#define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32-(b))))
-
-#define CH(x,y,z) (((x) & (y)) ^ (~(x) & (z)))
-#define MAJ(x,y,z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
-#define EP0(x) (ROTRIGHT(x,2) ^ ROTRIGHT(x,13) ^ ROTRIGHT(x,22))
-#define EP1(x) (ROTRIGHT(x,6) ^ ROTRIGHT(x,11) ^ ROTRIGHT(x,25))
-#define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
-#define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
 
 #define rol(value, bits) (((value) << (bits)) | ((value) >> (32 - (bits))))
 
-static void sha1_transform(struct sha_ctx *ctx, uint32_t v[]);
-static void sha256_transform(struct sha_ctx *ctx, uint32_t v[]);
+static void sha1_transform(uint32_t* state, const uint8_t* data, size_t blocks);
+static void sha256_transform(uint32_t* state, const uint8_t* data, size_t blocks);
 
 static const struct sha_initial_ctx sha256_initial_ctx = {
     32, sha256_transform, { 0x6a09e667,0xbb67ae85,0x3c6ef372,0xa54ff53a,0x510e527f,0x9b05688c,0x1f83d9ab,0x5be0cd19 }
@@ -41,7 +36,7 @@ static const struct sha_initial_ctx sha1_initial_ctx = {
     20, sha1_transform, { 0x67452301,0xEFCDAB89,0x98BADCFE,0x10325476,0xC3D2E1F0 }
 };
 
-static const uint32_t k[64] =
+const uint32_t sha256_k[64] =
 {
    0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5,0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5,
    0xd807aa98,0x12835b01,0x243185be,0x550c7dc3,0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174,
@@ -62,31 +57,47 @@ static void brev(void *d, const void *s, int n)
     }
 }
 
-static void sha256_transform(struct sha_ctx *ctx, uint32_t v[])
-{
-    uint32_t i,t1,t2;
-    uint32_t *m = (uint32_t *)(ctx->data);
-
-        for (i=0; i<64; ++i) {
-            t1 = v[7] + EP1(v[4]) + CH(v[4],v[5],v[6]) + k[i] + m[i%16];
-            t2 = EP0(v[0]) + MAJ(v[0],v[1],v[2]);
-            v[7] = v[6];
-            v[6] = v[5];
-            v[5] = v[4];
-            v[4] = v[3] + t1;
-            v[3] = v[2];
-            v[2] = v[1];
-            v[1] = v[0];
-            v[0] = t1 + t2;
-            m[i%16] = SIG1(m[(i+16-2)%16]) + m[(i+16-7)%16] + SIG0(m[(i+16-15)%16]) + m[i%16];
-        }
+// Message schedule word i, computed as round i needs it: the first sixteen are loaded
+// straight from the big-endian block, the rest expand in a sixteen-word ring. The index
+// is a constant in every expansion, so the ring lives in registers.
+#define SHA256_SCHED(i) ((i) < 16 \
+    ? (w[(i) & 15] = SHA_LOAD_BE32(data + (4 * ((i) & 15)))) \
+    : (w[(i) & 15] += SIG1(w[((i) - 2) & 15]) + w[((i) - 7) & 15] + SIG0(w[((i) - 15) & 15])))
+#define SHA256_WK(i) (sha256_k[i] + SHA256_SCHED(i))
 
+static void sha256_transform(uint32_t* state, const uint8_t* data, size_t blocks)
+{
+    uint32_t a, b, c, d, e, f, g, h;
+    uint32_t w[16];
+
+    for (; blocks > 0; blocks--, data += 64) {
+        a = state[0]; b = state[1]; c = state[2]; d = state[3];
+        e = state[4]; f = state[5]; g = state[6]; h = state[7];
+
+        SHA256_ROUNDS8(0, SHA256_WK);
+        SHA256_ROUNDS8(8, SHA256_WK);
+        SHA256_ROUNDS8(16, SHA256_WK);
+        SHA256_ROUNDS8(24, SHA256_WK);
+        SHA256_ROUNDS8(32, SHA256_WK);
+        SHA256_ROUNDS8(40, SHA256_WK);
+        SHA256_ROUNDS8(48, SHA256_WK);
+        SHA256_ROUNDS8(56, SHA256_WK);
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
 }
 
-static void sha1_transform(struct sha_ctx *ctx, uint32_t v[])
+static void sha1_transform(uint32_t* state, const uint8_t* data, size_t blocks)
 {
     unsigned int i;
-        uint32_t *m = (uint32_t *)(ctx->data);
+    uint32_t m[16];
+    uint32_t v[5];
+
+    for (; blocks > 0; blocks--, data += 64) {
+        MEMCPY((uint8_t *)m, data, 64);
+        brev(m, m, 16);
+        MEMCPY((uint8_t *)v, (uint8_t *)state, 20);
 
       for(i=0; i<80; i++) {
           uint32_t t;
@@ -106,68 +117,157 @@ static void sha1_transform(struct sha_ctx *ctx, uint32_t v[])
         m[i%16]= rol(m[(i+16-3)%16]^m[(i+16-8)%16]^m[(i+16-14)%16]^m[i%16],1);
     }
 
+        for (i=0; i<5; i++) {
+            state[i] += v[i];
+        }
+    }
+}
+
+// 0, the fastest transforms the CPU supports, until sha_set_impl() is called. Atomic
+// because any thread may initialise a context while a test switches transforms.
+static _Atomic(uint16_t) g_sha_impl = 0;
+
+// The fastest transforms the running CPU supports
+static uint16_t sha_detect_impl(void)
+{
+#if SHA_HAVE_SHANI
+    if (cpu_features() & CPU_FEATURE_SHA) return SHA_IMPL_SHANI;
+#endif
+#if SHA_HAVE_VEC
+    if (cpu_features() & CPU_FEATURE_AVX2) return SHA_IMPL_AVX2;
+    if (cpu_features() & CPU_FEATURE_SSSE3) return SHA_IMPL_SSSE3;
+#endif
+    return SHA_IMPL_PORTABLE;
+}
+
+static uint16_t sha_current_impl(void)
+{
+    uint16_t impl = atomic_load_explicit(&g_sha_impl, memory_order_relaxed);
+
+    return (impl != 0) ? impl : sha_detect_impl();
+}
+
+// Selects the transforms of contexts initialised from now on. Returns 1 on success, 0 if
+// "method" is unknown or not supported by this CPU. Meant for tests and benchmarks: the
+// setting is process wide, so production code should leave the detected one in place.
+int sha_set_impl(uint16_t method)
+{
+    switch (method) {
+       case SHA_IMPL_PORTABLE: break;
+#if SHA_HAVE_SHANI
+       case SHA_IMPL_SHANI:
+           if (!(cpu_features() & CPU_FEATURE_SHA)) return 0;
+           break;
+#endif
+#if SHA_HAVE_VEC
+       case SHA_IMPL_AVX2:
+           if (!(cpu_features() & CPU_FEATURE_AVX2)) return 0;
+           break;
+       case SHA_IMPL_SSSE3:
+           if (!(cpu_features() & CPU_FEATURE_SSSE3)) return 0;
+           break;
+#endif
+       default: return 0;
+    }
+    atomic_store_explicit(&g_sha_impl, method, memory_order_relaxed);
+    return 1;
+}
+
+uint16_t sha_get_impl(void)
+{
+    return sha_current_impl();
 }
 
 int sha_init(struct sha_ctx *ctx, uint16_t method)
 {
     const struct sha_initial_ctx *ictx = (method == METHOD_SHA1) ? &sha1_initial_ctx : &sha256_initial_ctx;
+    uint16_t impl = sha_current_impl();
+
     MEMCPY((uint8_t *)ctx, (uint8_t *)ictx, sizeof(struct sha_initial_ctx));
+    // the accelerated transforms take the same state and message layout
+#if SHA_HAVE_SHANI
+    if (impl == SHA_IMPL_SHANI) {
+        ctx->transform = (method == METHOD_SHA1) ? sha1_transform_shani : sha256_transform_shani;
+    }
+#endif
+#if SHA_HAVE_VEC
+    if (method != METHOD_SHA1) {
+        if (impl == SHA_IMPL_AVX2) ctx->transform = sha256_transform_avx2;
+        else if (impl == SHA_IMPL_SSSE3) ctx->transform = sha256_transform_ssse3;
+    }
+#endif
     ctx->datalen = 0;
     return sizeof(struct sha_ctx);
 }
 
-void sha_update(struct sha_ctx *ctx, uint8_t*  data, uint16_t len)
+// Tops up a partly filled block first, then runs the whole blocks straight from "data"
+// through one transform call and keeps only the remainder
+void sha_update(struct sha_ctx *ctx, const uint8_t* data, size_t len)
 {
-    unsigned int i, j, a;
-        uint32_t v[8];
+    size_t used = (size_t)(ctx->datalen & 63);
+    size_t take, blocks;
 
-    j = ctx->datalen & 63;
+    if (len == 0) return;
     ctx->datalen += len;
 
-      for( i = 0; i < len; i++ ){
-        ctx->data[ j++ ] = data[i];
-        if( 64 == j ){
-                        MEMCPY((uint8_t *)v, (uint8_t *)ctx->state, ctx->hashsize);
-                        brev(ctx->data, ctx->data, 16);
-                        ctx->transform(ctx, v);
-                        for (a=0; a<(uint16_t)(ctx->hashsize/4); a++) {
-                            ctx->state[a] += v[a];
-                        }
-            j = 0;
-        }
+    if (used > 0) {
+        take = 64 - used;
+        if (take > len) take = len;
+        MEMCPY(ctx->data + used, data, take);
+        if (used + take < 64) return;
+        ctx->transform(ctx->state, ctx->data, 1);
+        data += take;
+        len -= take;
     }
+
+    blocks = len / 64;
+    if (blocks > 0) {
+        ctx->transform(ctx->state, data, blocks);
+        data += blocks * 64;
+        len -= blocks * 64;
+    }
+    if (len > 0) MEMCPY(ctx->data, data, len);
 }
 
 void sha_final(struct sha_ctx *ctx, uint8_t* digest)
 {
-        uint32_t finalcount[2];
-
-        finalcount[0] = ctx->datalen >> 29;
-    finalcount[1] = ctx->datalen << 3;
-        brev(finalcount, finalcount, 2);
+    uint64_t bits = ctx->datalen << 3;
+    size_t used = (size_t)(ctx->datalen & 63);
+    int i;
 
-    sha_update(ctx, (uint8_t *)"\200", 1);
-    while ((ctx->datalen & 63) != 56) {
-        sha_update(ctx, (uint8_t *)"", 1);
+    // 0x80, zeros up to 8 bytes before the end of a block, and the bit count big-endian
+    ctx->data[used++] = 0x80;
+    if (used > 56) {
+        memset(ctx->data + used, 0, 64 - used);
+        ctx->transform(ctx->state, ctx->data, 1);
+        used = 0;
     }
-    sha_update(ctx, (uint8_t *)&finalcount, 8); /* Should cause a transform() */
+    memset(ctx->data + used, 0, 56 - used);
+    for (i = 0; i < 8; i++) {
+        ctx->data[63 - i] = (uint8_t)(bits >> (8 * i));
+    }
+    ctx->transform(ctx->state, ctx->data, 1);
 
         brev(&ctx->state, &ctx->state, ctx->hashsize / 4);
         MEMCPY(digest, (uint8_t *)ctx->state, ctx->hashsize);
 }
 
-struct sha_ctx ctx;// __attribute__ ((used)) __attribute__ ((section(".section.workspace")));;;
-
-void SHA256(uint8_t* msg, uint16_t msg_len, uint8_t* digest)
+// The one-shot helpers keep their context on the caller's stack, so concurrent calls
+// from different threads do not share any state
+void SHA256(const uint8_t* msg, size_t msg_len, uint8_t* digest)
 {
+    struct sha_ctx ctx;
+
     sha_init(&ctx, METHOD_SHA256);
     sha_update(&ctx, msg, msg_len);
     sha_final(&ctx, digest);
 }
 
 
-void SHA1(uint8_t* msg, uint16_t msg_len, uint8_t* digest)
+void SHA1(const uint8_t* msg, size_t msg_len, uint8_t* digest)
 {
+    struct sha_ctx ctx;
+
     sha_init(&ctx, METHOD_SHA1);
     sha_update(&ctx, msg, msg_len);
     sha_final(&ctx, digest);
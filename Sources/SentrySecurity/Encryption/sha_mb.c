@@ -0,0 +1,517 @@
+/******************************************
+** Multi-buffer SHA-256
+** Details: Hashes independent messages side by side, one message per 32-bit lane of
+            an SSSE3 (4 lanes) or AVX2 (8 lanes) register. Every lane pads its own
+            message, and a lane whose message is finished is refilled with the next
+            pending one, so messages of different lengths keep all lanes busy. Without
+            vector units (or when the SHA extensions make one message at a time
+            faster) the messages go one by one through the sha_init() transform.
+******************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "string.h"
+#include "time.h"
+#include "sha.h"
+#include "sha_mb.h"
+#include "sha_impl.h"
+#include "cpu_features.h"
+
+#if SHA_HAVE_VEC
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <immintrin.h>
+
+#define SHAMB_SSSE3_TARGET __attribute__((target("ssse3")))
+#define SHAMB_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+// One compression of every lane. "state" is word-major, state[w * lanes + lane], and
+// block[lane] is that lane's next 64-byte message block.
+typedef void (*sha256_mb_compress_fn)(uint32_t* state, const uint8_t* const* block);
+
+// Where one lane is in its message: the full blocks still to read in place, then one or
+// two padding blocks built in "tail".
+struct sha256_mb_lane
+{
+    const uint8_t* msg;
+    size_t full;
+    uint32_t tail_blocks;
+    uint32_t tail_next;
+    uint8_t tail[128];
+    uint8_t* digest;
+};
+
+static void sha256_mb_lane_load(struct sha256_mb_lane* lane, const uint8_t* msg, size_t len, uint8_t* digest)
+{
+    uint64_t bits = (uint64_t)len << 3;
+    size_t rest = len & 63;
+    uint8_t* end;
+    int i;
+
+    lane->msg = msg;
+    lane->full = len / 64;
+    lane->tail_blocks = (rest < 56) ? 1 : 2;
+    lane->tail_next = 0;
+    lane->digest = digest;
+
+    memset(lane->tail, 0, sizeof(lane->tail));
+    memcpy(lane->tail, msg + (len - rest), rest);
+    lane->tail[rest] = 0x80;
+    end = lane->tail + (64 * lane->tail_blocks);
+    for (i = 1; i <= 8; i++, bits >>= 8) end[-i] = (uint8_t)bits;
+}
+
+static const uint8_t* sha256_mb_lane_block(const struct sha256_mb_lane* lane)
+{
+    return (lane->full > 0) ? lane->msg : (lane->tail + (64 * lane->tail_next));
+}
+
+// Steps past the block just hashed; returns 1 when that was the last one
+static int sha256_mb_lane_advance(struct sha256_mb_lane* lane)
+{
+    if (lane->full > 0)
+    {
+        lane->full--;
+        lane->msg += 64;
+        return 0;
+    }
+    lane->tail_next++;
+    return lane->tail_next == lane->tail_blocks;
+}
+
+static void sha256_mb_store_digest(const uint32_t* state, uint32_t lanes, uint32_t l, uint8_t* digest)
+{
+    uint32_t w, v;
+
+    for (w = 0; w < 8; w++)
+    {
+        v = state[(w * lanes) + l];
+        digest[(4 * w) + 0] = (uint8_t)(v >> 24);
+        digest[(4 * w) + 1] = (uint8_t)(v >> 16);
+        digest[(4 * w) + 2] = (uint8_t)(v >> 8);
+        digest[(4 * w) + 3] = (uint8_t)v;
+    }
+}
+
+/********************
+** VECTOR LANES
+********************/
+
+#if SHA_HAVE_VEC
+
+// The round and schedule steps are written once against these vector operations, which
+// each compress function defines for its register width.
+#define MB_ROR(x, n)        MB_OR(MB_SRL(x, n), MB_SLL(x, 32 - (n)))
+#define MB_EP0(x)           MB_XOR(MB_XOR(MB_ROR(x, 2), MB_ROR(x, 13)), MB_ROR(x, 22))
+#define MB_EP1(x)           MB_XOR(MB_XOR(MB_ROR(x, 6), MB_ROR(x, 11)), MB_ROR(x, 25))
+#define MB_SIG0(x)          MB_XOR(MB_XOR(MB_ROR(x, 7), MB_ROR(x, 18)), MB_SRL(x, 3))
+#define MB_SIG1(x)          MB_XOR(MB_XOR(MB_ROR(x, 17), MB_ROR(x, 19)), MB_SRL(x, 10))
+#define MB_CH(x, y, z)      MB_XOR(MB_AND(x, y), MB_ANDNOT(x, z))
+#define MB_MAJ(x, y, z)     MB_OR(MB_AND(x, y), MB_AND(z, MB_OR(x, y)))
+
+#define MB_SCHED(i) \
+    if ((i) >= 16) w[(i) & 15] = MB_ADD(MB_ADD(MB_SIG1(w[((i) - 2) & 15]), w[((i) - 7) & 15]), MB_ADD(MB_SIG0(w[((i) - 15) & 15]), w[(i) & 15]));
+
+#define MB_ROUND(a,b,c,d,e,f,g,h, i) do { \
+        MB_SCHED(i) \
+        t1 = MB_ADD(MB_ADD(h, MB_EP1(e)), MB_ADD(MB_CH(e,f,g), MB_ADD(MB_SET1(sha256_k[i]), w[(i) & 15]))); \
+        d = MB_ADD(d, t1); \
+        h = MB_ADD(t1, MB_ADD(MB_EP0(a), MB_MAJ(a,b,c))); \
+    } while (0)
+
+#define MB_ROUNDS8(i) \
+    MB_ROUND(a,b,c,d,e,f,g,h, (i) + 0); \
+    MB_ROUND(h,a,b,c,d,e,f,g, (i) + 1); \
+    MB_ROUND(g,h,a,b,c,d,e,f, (i) + 2); \
+    MB_ROUND(f,g,h,a,b,c,d,e, (i) + 3); \
+    MB_ROUND(e,f,g,h,a,b,c,d, (i) + 4); \
+    MB_ROUND(d,e,f,g,h,a,b,c, (i) + 5); \
+    MB_ROUND(c,d,e,f,g,h,a,b, (i) + 6); \
+    MB_ROUND(b,c,d,e,f,g,h,a, (i) + 7)
+
+// SSSE3, four lanes
+
+// Message words "offset / 4" .. + 3 of four blocks, byte-swapped and transposed so that
+// w[j] holds word j of every lane
+static SHAMB_SSSE3_TARGET inline void sha256_mb_load_x4(const uint8_t* const* block, int offset, __m128i* w)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i r0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(block[0] + offset)), bswap);
+    __m128i r1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(block[1] + offset)), bswap);
+    __m128i r2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(block[2] + offset)), bswap);
+    __m128i r3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(block[3] + offset)), bswap);
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+
+    w[0] = _mm_unpacklo_epi64(t0, t1);
+    w[1] = _mm_unpackhi_epi64(t0, t1);
+    w[2] = _mm_unpacklo_epi64(t2, t3);
+    w[3] = _mm_unpackhi_epi64(t2, t3);
+}
+
+#define MB_ADD(x, y)        _mm_add_epi32(x, y)
+#define MB_XOR(x, y)        _mm_xor_si128(x, y)
+#define MB_AND(x, y)        _mm_and_si128(x, y)
+#define MB_OR(x, y)         _mm_or_si128(x, y)
+#define MB_ANDNOT(x, y)     _mm_andnot_si128(x, y)
+#define MB_SRL(x, n)        _mm_srli_epi32(x, n)
+#define MB_SLL(x, n)        _mm_slli_epi32(x, n)
+#define MB_SET1(x)          _mm_set1_epi32((int)(x))
+
+static SHAMB_SSSE3_TARGET void sha256_mb_compress_ssse3(uint32_t* state, const uint8_t* const* block)
+{
+    __m128i a, b, c, d, e, f, g, h, t1;
+    __m128i w[16];
+    int i;
+
+    for (i = 0; i < 4; i++)
+    {
+        sha256_mb_load_x4(block, 16 * i, w + (4 * i));
+    }
+
+    a = _mm_loadu_si128((const __m128i*)(state + 0));
+    b = _mm_loadu_si128((const __m128i*)(state + 4));
+    c = _mm_loadu_si128((const __m128i*)(state + 8));
+    d = _mm_loadu_si128((const __m128i*)(state + 12));
+    e = _mm_loadu_si128((const __m128i*)(state + 16));
+    f = _mm_loadu_si128((const __m128i*)(state + 20));
+    g = _mm_loadu_si128((const __m128i*)(state + 24));
+    h = _mm_loadu_si128((const __m128i*)(state + 28));
+
+    for (i = 0; i < 64; i += 8)
+    {
+        MB_ROUNDS8(i);
+    }
+
+    _mm_storeu_si128((__m128i*)(state + 0), _mm_add_epi32(a, _mm_loadu_si128((const __m128i*)(state + 0))));
+    _mm_storeu_si128((__m128i*)(state + 4), _mm_add_epi32(b, _mm_loadu_si128((const __m128i*)(state + 4))));
+    _mm_storeu_si128((__m128i*)(state + 8), _mm_add_epi32(c, _mm_loadu_si128((const __m128i*)(state + 8))));
+    _mm_storeu_si128((__m128i*)(state + 12), _mm_add_epi32(d, _mm_loadu_si128((const __m128i*)(state + 12))));
+    _mm_storeu_si128((__m128i*)(state + 16), _mm_add_epi32(e, _mm_loadu_si128((const __m128i*)(state + 16))));
+    _mm_storeu_si128((__m128i*)(state + 20), _mm_add_epi32(f, _mm_loadu_si128((const __m128i*)(state + 20))));
+    _mm_storeu_si128((__m128i*)(state + 24), _mm_add_epi32(g, _mm_loadu_si128((const __m128i*)(state + 24))));
+    _mm_storeu_si128((__m128i*)(state + 28), _mm_add_epi32(h, _mm_loadu_si128((const __m128i*)(state + 28))));
+}
+
+#undef MB_ADD
+#undef MB_XOR
+#undef MB_AND
+#undef MB_OR
+#undef MB_ANDNOT
+#undef MB_SRL
+#undef MB_SLL
+#undef MB_SET1
+
+// AVX2, eight lanes
+
+// sha256_mb_load_x4() for eight words of eight blocks
+static SHAMB_AVX2_TARGET inline void sha256_mb_load_x8(const uint8_t* const* block, int offset, __m256i* w)
+{
+    const __m256i bswap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL, 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m256i r[8], t[8], u[8];
+    int i;
+
+    for (i = 0; i < 8; i++)
+    {
+        r[i] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(block[i] + offset)), bswap);
+    }
+    for (i = 0; i < 8; i += 2)
+    {
+        t[i] = _mm256_unpacklo_epi32(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_epi32(r[i], r[i + 1]);
+    }
+    for (i = 0; i < 8; i += 4)
+    {
+        u[i] = _mm256_unpacklo_epi64(t[i], t[i + 2]);
+        u[i + 1] = _mm256_unpackhi_epi64(t[i], t[i + 2]);
+        u[i + 2] = _mm256_unpacklo_epi64(t[i + 1], t[i + 3]);
+        u[i + 3] = _mm256_unpackhi_epi64(t[i + 1], t[i + 3]);
+    }
+    for (i = 0; i < 4; i++)
+    {
+        w[i] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x20);
+        w[i + 4] = _mm256_permute2x128_si256(u[i], u[i + 4], 0x31);
+    }
+}
+
+#define MB_ADD(x, y)        _mm256_add_epi32(x, y)
+#define MB_XOR(x, y)        _mm256_xor_si256(x, y)
+#define MB_AND(x, y)        _mm256_and_si256(x, y)
+#define MB_OR(x, y)         _mm256_or_si256(x, y)
+#define MB_ANDNOT(x, y)     _mm256_andnot_si256(x, y)
+#define MB_SRL(x, n)        _mm256_srli_epi32(x, n)
+#define MB_SLL(x, n)        _mm256_slli_epi32(x, n)
+#define MB_SET1(x)          _mm256_set1_epi32((int)(x))
+
+static SHAMB_AVX2_TARGET void sha256_mb_compress_avx2(uint32_t* state, const uint8_t* const* block)
+{
+    __m256i a, b, c, d, e, f, g, h, t1;
+    __m256i w[16];
+    int i;
+
+    sha256_mb_load_x8(block, 0, w);
+    sha256_mb_load_x8(block, 32, w + 8);
+
+    a = _mm256_loadu_si256((const __m256i*)(state + 0));
+    b = _mm256_loadu_si256((const __m256i*)(state + 8));
+    c = _mm256_loadu_si256((const __m256i*)(state + 16));
+    d = _mm256_loadu_si256((const __m256i*)(state + 24));
+    e = _mm256_loadu_si256((const __m256i*)(state + 32));
+    f = _mm256_loadu_si256((const __m256i*)(state + 40));
+    g = _mm256_loadu_si256((const __m256i*)(state + 48));
+    h = _mm256_loadu_si256((const __m256i*)(state + 56));
+
+    for (i = 0; i < 64; i += 8)
+    {
+        MB_ROUNDS8(i);
+    }
+
+    _mm256_storeu_si256((__m256i*)(state + 0), _mm256_add_epi32(a, _mm256_loadu_si256((const __m256i*)(state + 0))));
+    _mm256_storeu_si256((__m256i*)(state + 8), _mm256_add_epi32(b, _mm256_loadu_si256((const __m256i*)(state + 8))));
+    _mm256_storeu_si256((__m256i*)(state + 16), _mm256_add_epi32(c, _mm256_loadu_si256((const __m256i*)(state + 16))));
+    _mm256_storeu_si256((__m256i*)(state + 24), _mm256_add_epi32(d, _mm256_loadu_si256((const __m256i*)(state + 24))));
+    _mm256_storeu_si256((__m256i*)(state + 32), _mm256_add_epi32(e, _mm256_loadu_si256((const __m256i*)(state + 32))));
+    _mm256_storeu_si256((__m256i*)(state + 40), _mm256_add_epi32(f, _mm256_loadu_si256((const __m256i*)(state + 40))));
+    _mm256_storeu_si256((__m256i*)(state + 48), _mm256_add_epi32(g, _mm256_loadu_si256((const __m256i*)(state + 48))));
+    _mm256_storeu_si256((__m256i*)(state + 56), _mm256_add_epi32(h, _mm256_loadu_si256((const __m256i*)(state + 56))));
+}
+
+#undef MB_ADD
+#undef MB_XOR
+#undef MB_AND
+#undef MB_OR
+#undef MB_ANDNOT
+#undef MB_SRL
+#undef MB_SLL
+#undef MB_SET1
+
+#endif // SHA_HAVE_VEC
+
+/********************
+** MULTI-BUFFER API
+********************/
+
+// Lanes the transforms picked by sha_init() (see sha_set_impl()) hash at once; 1 means one
+// message after the other, which is also the SHA-NI choice
+uint32_t sha256_mb_lanes(void)
+{
+#if SHA_HAVE_VEC
+    switch (sha_get_impl()) {
+       case SHA_IMPL_AVX2: return 8;
+       case SHA_IMPL_SSSE3: return 4;
+       default: break;
+    }
+#endif
+    return 1;
+}
+
+// Hashes msg[i] (len[i] bytes) into digest[i] for i < n, any n
+void sha256_mb(const uint8_t* const* msg, const size_t* len, uint8_t* const* digest, uint32_t n)
+{
+    static const uint8_t idle[64] = { 0 };
+    struct sha256_mb_lane lane[SHA256_MB_MAX_LANES];
+    uint32_t state[8 * SHA256_MB_MAX_LANES];
+    const uint8_t* block[SHA256_MB_MAX_LANES];
+    int active[SHA256_MB_MAX_LANES];
+    sha256_mb_compress_fn compress = NULL;
+    struct sha_ctx iv;
+    uint32_t lanes = sha256_mb_lanes();
+    uint32_t next, busy, l, w;
+
+    // initial state and the best one-message transform
+    sha_init(&iv, METHOD_SHA256);
+
+#if SHA_HAVE_VEC
+    if (lanes == 8) compress = sha256_mb_compress_avx2;
+    else if (lanes == 4) compress = sha256_mb_compress_ssse3;
+#endif
+
+    if (compress == NULL)
+    {
+        for (next = 0; next < n; next++)
+        {
+            sha256_mb_lane_load(&lane[0], msg[next], len[next], digest[next]);
+            memcpy(state, iv.state, 32);
+            iv.transform(state, lane[0].msg, lane[0].full);
+            iv.transform(state, lane[0].tail, lane[0].tail_blocks);
+            sha256_mb_store_digest(state, 1, 0, digest[next]);
+        }
+        return;
+    }
+
+    for (next = 0, busy = 0, l = 0; l < lanes; l++)
+    {
+        active[l] = (next < n);
+        if (!active[l]) continue;
+        sha256_mb_lane_load(&lane[l], msg[next], len[next], digest[next]);
+        for (w = 0; w < 8; w++) state[(w * lanes) + l] = iv.state[w];
+        next++;
+        busy++;
+    }
+
+    while (busy > 0)
+    {
+        for (l = 0; l < lanes; l++) block[l] = active[l] ? sha256_mb_lane_block(&lane[l]) : idle;
+
+        compress(state, block);
+
+        for (l = 0; l < lanes; l++)
+        {
+            if (!active[l] || !sha256_mb_lane_advance(&lane[l])) continue;
+
+            sha256_mb_store_digest(state, lanes, l, lane[l].digest);
+            if (next < n)
+            {
+                sha256_mb_lane_load(&lane[l], msg[next], len[next], digest[next]);
+                for (w = 0; w < 8; w++) state[(w * lanes) + l] = iv.state[w];
+                next++;
+            }
+            else
+            {
+                active[l] = 0;
+                busy--;
+            }
+        }
+    }
+}
+
+/********************
+** JOB QUEUE
+********************/
+
+// Hashes the jobs "job[0..n)" and marks them done
+static void sha256_mb_run_jobs(struct sha256_mb_job* const* job, uint32_t n)
+{
+    const uint8_t* msg[SHA256_MB_MAX_LANES];
+    size_t len[SHA256_MB_MAX_LANES];
+    uint8_t* digest[SHA256_MB_MAX_LANES];
+    uint32_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        msg[i] = job[i]->msg;
+        len[i] = job[i]->len;
+        digest[i] = job[i]->digest;
+    }
+    sha256_mb(msg, len, digest, n);
+}
+
+int sha256_mb_queue_init(struct sha256_mb_queue* q, uint32_t deadline_us)
+{
+    q->count = 0;
+    q->lanes = sha256_mb_lanes();
+    q->deadline_us = deadline_us;
+    q->flush_at.tv_sec = 0;
+    q->flush_at.tv_nsec = 0;
+#if SHA256_MB_HAVE_THREADS
+    if (pthread_mutex_init(&q->lock, NULL) != 0) return -1;
+    if (pthread_cond_init(&q->cond, NULL) != 0)
+    {
+        pthread_mutex_destroy(&q->lock);
+        return -1;
+    }
+#endif
+    return 0;
+}
+
+void sha256_mb_queue_destroy(struct sha256_mb_queue* q)
+{
+    sha256_mb_queue_flush(q);
+#if SHA256_MB_HAVE_THREADS
+    pthread_cond_destroy(&q->cond);
+    pthread_mutex_destroy(&q->lock);
+#endif
+}
+
+#if SHA256_MB_HAVE_THREADS
+
+// Takes the pending jobs out of the queue, hashes them without holding the lock and wakes
+// their submitters. Called and returns with q->lock held.
+static void sha256_mb_queue_drain(struct sha256_mb_queue* q)
+{
+    struct sha256_mb_job* batch[SHA256_MB_MAX_LANES];
+    uint32_t i, n = q->count;
+
+    if (n == 0) return;
+    memcpy(batch, q->pending, n * sizeof(batch[0]));
+    q->count = 0;
+
+    pthread_mutex_unlock(&q->lock);
+    sha256_mb_run_jobs(batch, n);
+    pthread_mutex_lock(&q->lock);
+
+    for (i = 0; i < n; i++) batch[i]->done = 1;
+    pthread_cond_broadcast(&q->cond);
+}
+
+static int sha256_mb_deadline_passed(const struct timespec* at)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_REALTIME, &now);
+    return (now.tv_sec > at->tv_sec) || ((now.tv_sec == at->tv_sec) && (now.tv_nsec >= at->tv_nsec));
+}
+
+// Queues "job" and returns once its digest is written. The job is hashed by whichever
+// submitter fills the last lane, or by a waiting submitter once deadline_us has passed
+// since the oldest queued job arrived. Sessions that hash on their own thread simply call
+// this instead of SHA256().
+void sha256_mb_submit(struct sha256_mb_queue* q, struct sha256_mb_job* job)
+{
+    pthread_mutex_lock(&q->lock);
+
+    job->done = 0;
+    if (q->count == 0)
+    {
+        clock_gettime(CLOCK_REALTIME, &q->flush_at);
+        q->flush_at.tv_sec += q->deadline_us / 1000000;
+        q->flush_at.tv_nsec += (long)(q->deadline_us % 1000000) * 1000;
+        if (q->flush_at.tv_nsec >= 1000000000L)
+        {
+            q->flush_at.tv_sec++;
+            q->flush_at.tv_nsec -= 1000000000L;
+        }
+    }
+    q->pending[q->count++] = job;
+
+    while (!job->done)
+    {
+        if ((q->count >= q->lanes) || ((q->count > 0) && sha256_mb_deadline_passed(&q->flush_at)))
+        {
+            sha256_mb_queue_drain(q);
+            continue;
+        }
+        if (q->count > 0) pthread_cond_timedwait(&q->cond, &q->lock, &q->flush_at);
+        else pthread_cond_wait(&q->cond, &q->lock);
+    }
+
+    pthread_mutex_unlock(&q->lock);
+}
+
+// Hashes whatever is queued now instead of waiting for the deadline
+void sha256_mb_queue_flush(struct sha256_mb_queue* q)
+{
+    pthread_mutex_lock(&q->lock);
+    sha256_mb_queue_drain(q);
+    pthread_mutex_unlock(&q->lock);
+}
+
+#else
+
+// Without threads there is never a second session to share lanes with
+void sha256_mb_submit(struct sha256_mb_queue* q, struct sha256_mb_job* job)
+{
+    (void)q;
+    sha256_mb_run_jobs(&job, 1);
+    job->done = 1;
+}
+
+void sha256_mb_queue_flush(struct sha256_mb_queue* q)
+{
+    (void)q;
+}
+
+#endif // SHA256_MB_HAVE_THREADS
@@ -0,0 +1,153 @@
+/******************************************
+** SHA-256 / SHA-1 SHA extension transforms
+** Details: Use the x86 SHA instructions (sha256rnds2/sha256msg1/sha256msg2 and
+            sha1rnds4/sha1nexte/sha1msg1/sha1msg2). The state is kept in the packed
+            ABEF/CDGH (SHA-256) or ABCD/E (SHA-1) layout the instructions expect for
+            all blocks of a call, and the message words are byte-swapped with pshufb
+            as they are loaded. Only installed by sha_init() when cpuid reports them.
+******************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "sha_impl.h"
+
+#if SHA_HAVE_SHANI
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <smmintrin.h>
+#include <immintrin.h>
+
+#define SHANI_TARGET __attribute__((target("sha,sse4.1,ssse3")))
+
+// Four SHA-256 rounds on message words w (rounds i..i+3)
+#define SHA256NI_RNDS4(w, i) \
+    msg = _mm_add_epi32(w, _mm_loadu_si128((const __m128i*)(sha256_k + (i)))); \
+    state1 = _mm_sha256rnds2_epu32(state1, state0, msg); \
+    state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0E));
+
+// Schedule steps: the message words four rounds ahead of w are finished from the previous
+// group and w; those twelve rounds ahead start from the group behind w.
+#define SHA256NI_MSG2(next, w, prev) \
+    next = _mm_sha256msg2_epu32(_mm_add_epi32(next, _mm_alignr_epi8(w, prev, 4)), w);
+#define SHA256NI_MSG1(prev, w) \
+    prev = _mm_sha256msg1_epu32(prev, w);
+
+SHANI_TARGET void sha256_transform_shani(uint32_t* state, const uint8_t* data, size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1, save0, save1, msg, tmp;
+    __m128i w0, w1, w2, w3;
+
+    // state[0..7] = A..H into ABEF / CDGH
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)state), 0xB1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)(state + 4)), 0x1B);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    for (; blocks > 0; blocks--, data += 64)
+    {
+        save0 = state0;
+        save1 = state1;
+
+        w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), bswap);
+        w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16)), bswap);
+        w2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 32)), bswap);
+        w3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 48)), bswap);
+
+        SHA256NI_RNDS4(w0, 0);
+        SHA256NI_RNDS4(w1, 4);  SHA256NI_MSG1(w0, w1);
+        SHA256NI_RNDS4(w2, 8);  SHA256NI_MSG1(w1, w2);
+        SHA256NI_RNDS4(w3, 12); SHA256NI_MSG2(w0, w3, w2); SHA256NI_MSG1(w2, w3);
+        SHA256NI_RNDS4(w0, 16); SHA256NI_MSG2(w1, w0, w3); SHA256NI_MSG1(w3, w0);
+        SHA256NI_RNDS4(w1, 20); SHA256NI_MSG2(w2, w1, w0); SHA256NI_MSG1(w0, w1);
+        SHA256NI_RNDS4(w2, 24); SHA256NI_MSG2(w3, w2, w1); SHA256NI_MSG1(w1, w2);
+        SHA256NI_RNDS4(w3, 28); SHA256NI_MSG2(w0, w3, w2); SHA256NI_MSG1(w2, w3);
+        SHA256NI_RNDS4(w0, 32); SHA256NI_MSG2(w1, w0, w3); SHA256NI_MSG1(w3, w0);
+        SHA256NI_RNDS4(w1, 36); SHA256NI_MSG2(w2, w1, w0); SHA256NI_MSG1(w0, w1);
+        SHA256NI_RNDS4(w2, 40); SHA256NI_MSG2(w3, w2, w1); SHA256NI_MSG1(w1, w2);
+        SHA256NI_RNDS4(w3, 44); SHA256NI_MSG2(w0, w3, w2); SHA256NI_MSG1(w2, w3);
+        SHA256NI_RNDS4(w0, 48); SHA256NI_MSG2(w1, w0, w3); SHA256NI_MSG1(w3, w0);
+        SHA256NI_RNDS4(w1, 52); SHA256NI_MSG2(w2, w1, w0);
+        SHA256NI_RNDS4(w2, 56); SHA256NI_MSG2(w3, w2, w1);
+        SHA256NI_RNDS4(w3, 60);
+
+        state0 = _mm_add_epi32(state0, save0);
+        state1 = _mm_add_epi32(state1, save1);
+    }
+
+    // ABEF / CDGH back to A..H
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128((__m128i*)state, state0);
+    _mm_storeu_si128((__m128i*)(state + 4), state1);
+}
+
+// Four SHA-1 rounds on message words w with round function f. sha1rnds4 takes E already
+// added to the first word, so each group derives it (sha1nexte) from the A of the state
+// before the previous group, kept in e_prev, and saves the current A into e_next.
+#define SHA1NI_RNDS4(e_prev, e_next, w, f) \
+    e_prev = _mm_sha1nexte_epu32(e_prev, w); \
+    e_next = abcd; \
+    abcd = _mm_sha1rnds4_epu32(abcd, e_prev, f);
+
+// Schedule steps for the group three ahead (msg1), two ahead (xor) and one ahead (msg2)
+#define SHA1NI_MSG1(prev, w)    prev = _mm_sha1msg1_epu32(prev, w);
+#define SHA1NI_XOR(ahead2, w)   ahead2 = _mm_xor_si128(ahead2, w);
+#define SHA1NI_MSG2(next, w)    next = _mm_sha1msg2_epu32(next, w);
+
+SHANI_TARGET void sha1_transform_shani(uint32_t* state, const uint8_t* data, size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+    __m128i abcd, e0, e1, save_abcd, save_e;
+    __m128i w0, w1, w2, w3;
+
+    abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)state), 0x1B);
+    e0 = _mm_set_epi32((int)state[4], 0, 0, 0);
+
+    for (; blocks > 0; blocks--, data += 64)
+    {
+        save_abcd = abcd;
+        save_e = e0;
+
+        w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)data), bswap);
+        w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16)), bswap);
+        w2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 32)), bswap);
+        w3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 48)), bswap);
+
+        // rounds 0-3: E enters directly
+        e0 = _mm_add_epi32(e0, w0);
+        e1 = abcd;
+        abcd = _mm_sha1rnds4_epu32(abcd, e0, 0);
+
+        SHA1NI_RNDS4(e1, e0, w1, 0); SHA1NI_MSG1(w0, w1);
+        SHA1NI_RNDS4(e0, e1, w2, 0); SHA1NI_MSG1(w1, w2); SHA1NI_XOR(w0, w2);
+        SHA1NI_RNDS4(e1, e0, w3, 0); SHA1NI_MSG2(w0, w3); SHA1NI_MSG1(w2, w3); SHA1NI_XOR(w1, w3);
+        SHA1NI_RNDS4(e0, e1, w0, 0); SHA1NI_MSG2(w1, w0); SHA1NI_MSG1(w3, w0); SHA1NI_XOR(w2, w0);
+        SHA1NI_RNDS4(e1, e0, w1, 1); SHA1NI_MSG2(w2, w1); SHA1NI_MSG1(w0, w1); SHA1NI_XOR(w3, w1);
+        SHA1NI_RNDS4(e0, e1, w2, 1); SHA1NI_MSG2(w3, w2); SHA1NI_MSG1(w1, w2); SHA1NI_XOR(w0, w2);
+        SHA1NI_RNDS4(e1, e0, w3, 1); SHA1NI_MSG2(w0, w3); SHA1NI_MSG1(w2, w3); SHA1NI_XOR(w1, w3);
+        SHA1NI_RNDS4(e0, e1, w0, 1); SHA1NI_MSG2(w1, w0); SHA1NI_MSG1(w3, w0); SHA1NI_XOR(w2, w0);
+        SHA1NI_RNDS4(e1, e0, w1, 1); SHA1NI_MSG2(w2, w1); SHA1NI_MSG1(w0, w1); SHA1NI_XOR(w3, w1);
+        SHA1NI_RNDS4(e0, e1, w2, 2); SHA1NI_MSG2(w3, w2); SHA1NI_MSG1(w1, w2); SHA1NI_XOR(w0, w2);
+        SHA1NI_RNDS4(e1, e0, w3, 2); SHA1NI_MSG2(w0, w3); SHA1NI_MSG1(w2, w3); SHA1NI_XOR(w1, w3);
+        SHA1NI_RNDS4(e0, e1, w0, 2); SHA1NI_MSG2(w1, w0); SHA1NI_MSG1(w3, w0); SHA1NI_XOR(w2, w0);
+        SHA1NI_RNDS4(e1, e0, w1, 2); SHA1NI_MSG2(w2, w1); SHA1NI_MSG1(w0, w1); SHA1NI_XOR(w3, w1);
+        SHA1NI_RNDS4(e0, e1, w2, 2); SHA1NI_MSG2(w3, w2); SHA1NI_MSG1(w1, w2); SHA1NI_XOR(w0, w2);
+        SHA1NI_RNDS4(e1, e0, w3, 3); SHA1NI_MSG2(w0, w3); SHA1NI_MSG1(w2, w3); SHA1NI_XOR(w1, w3);
+        SHA1NI_RNDS4(e0, e1, w0, 3); SHA1NI_MSG2(w1, w0); SHA1NI_MSG1(w3, w0); SHA1NI_XOR(w2, w0);
+        SHA1NI_RNDS4(e1, e0, w1, 3); SHA1NI_MSG2(w2, w1); SHA1NI_XOR(w3, w1);
+        SHA1NI_RNDS4(e0, e1, w2, 3); SHA1NI_MSG2(w3, w2);
+        SHA1NI_RNDS4(e1, e0, w3, 3);
+
+        e0 = _mm_sha1nexte_epu32(e0, save_e);
+        abcd = _mm_add_epi32(abcd, save_abcd);
+    }
+
+    _mm_storeu_si128((__m128i*)state, _mm_shuffle_epi32(abcd, 0x1B));
+    state[4] = (uint32_t)_mm_extract_epi32(e0, 3);
+}
+
+#endif // SHA_HAVE_SHANI
@@ -0,0 +1,193 @@
+/******************************************
+** SHA-256 vector message schedule transforms
+** Details: For x86 hosts without the SHA extensions. The 64-word message schedule is
+            expanded four words at a time in SSE registers (SSSE3), or for two blocks at
+            once in the two halves of an AVX2 register, and stored with the round
+            constants already added, a few groups ahead of the scalar unrolled rounds
+            from sha_impl.h that consume them. Only installed by sha_init() when cpuid
+            reports the instruction set.
+******************************************/
+
+#include "stdint.h"
+#include "stddef.h"
+#include "sha_impl.h"
+
+#if SHA_HAVE_VEC
+
+#include <emmintrin.h>
+#include <tmmintrin.h>
+#include <immintrin.h>
+
+#define SHAVEC_SSSE3_TARGET __attribute__((target("ssse3")))
+#define SHAVEC_AVX2_TARGET __attribute__((target("avx2")))
+
+#define SHA256_WK_MEM(i) (wk[i])
+
+// Runs the 64 rounds of one block on "state" with the prepared K + W words
+static inline void sha256_rounds_wk(uint32_t* state, const uint32_t* wk)
+{
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+
+    SHA256_ROUNDS8(0, SHA256_WK_MEM);
+    SHA256_ROUNDS8(8, SHA256_WK_MEM);
+    SHA256_ROUNDS8(16, SHA256_WK_MEM);
+    SHA256_ROUNDS8(24, SHA256_WK_MEM);
+    SHA256_ROUNDS8(32, SHA256_WK_MEM);
+    SHA256_ROUNDS8(40, SHA256_WK_MEM);
+    SHA256_ROUNDS8(48, SHA256_WK_MEM);
+    SHA256_ROUNDS8(56, SHA256_WK_MEM);
+
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+/********************
+** SSSE3
+********************/
+
+static SHAVEC_SSSE3_TARGET inline __m128i sha256_ror_x4(__m128i x, int n)
+{
+    return _mm_or_si128(_mm_srli_epi32(x, n), _mm_slli_epi32(x, 32 - n));
+}
+
+// W[t..t+3] from x0..x3 = W[t-16..t-1]. The sigma1 terms of W[t+2] and W[t+3] depend on
+// W[t] and W[t+1], so they are added in a second half step.
+static SHAVEC_SSSE3_TARGET inline __m128i sha256_sched_x4(__m128i x0, __m128i x1, __m128i x2, __m128i x3)
+{
+    const __m128i lo = _mm_set_epi32(0, 0, -1, -1);
+    __m128i w15 = _mm_alignr_epi8(x1, x0, 4);
+    __m128i w7 = _mm_alignr_epi8(x3, x2, 4);
+    __m128i s, t;
+
+    s = _mm_xor_si128(_mm_xor_si128(sha256_ror_x4(w15, 7), sha256_ror_x4(w15, 18)), _mm_srli_epi32(w15, 3));
+    t = _mm_add_epi32(_mm_add_epi32(x0, w7), s);
+
+    s = _mm_shuffle_epi32(x3, 0x0E);
+    s = _mm_xor_si128(_mm_xor_si128(sha256_ror_x4(s, 17), sha256_ror_x4(s, 19)), _mm_srli_epi32(s, 10));
+    t = _mm_add_epi32(t, _mm_and_si128(s, lo));
+
+    s = _mm_shuffle_epi32(t, 0x40);
+    s = _mm_xor_si128(_mm_xor_si128(sha256_ror_x4(s, 17), sha256_ror_x4(s, 19)), _mm_srli_epi32(s, 10));
+    return _mm_add_epi32(t, _mm_andnot_si128(lo, s));
+}
+
+// Schedule group i (W[4i..4i+3]) plus the round constants into wk
+#define SHA256_SSSE3_GROUP(i) \
+    x[(i) & 3] = sha256_sched_x4(x[(i) & 3], x[((i) + 1) & 3], x[((i) + 2) & 3], x[((i) + 3) & 3]); \
+    _mm_storeu_si128((__m128i*)(wk + (4 * (i))), _mm_add_epi32(x[(i) & 3], _mm_loadu_si128((const __m128i*)(sha256_k + (4 * (i))))));
+
+// The schedule of the next eight words is computed in program order next to the rounds
+// that do not need them yet, so the vector and scalar units work side by side.
+SHAVEC_SSSE3_TARGET void sha256_transform_ssse3(uint32_t* state, const uint8_t* data, size_t blocks)
+{
+    const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    uint32_t wk[64];
+    uint32_t a, b, c, d, e, f, g, h;
+    __m128i x[4];
+    int i;
+
+    for (; blocks > 0; blocks--, data += 64)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            x[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + (16 * i))), bswap);
+            _mm_storeu_si128((__m128i*)(wk + (4 * i)), _mm_add_epi32(x[i], _mm_loadu_si128((const __m128i*)(sha256_k + (4 * i)))));
+        }
+
+        a = state[0]; b = state[1]; c = state[2]; d = state[3];
+        e = state[4]; f = state[5]; g = state[6]; h = state[7];
+
+        SHA256_SSSE3_GROUP(4);  SHA256_SSSE3_GROUP(5);  SHA256_ROUNDS8(0, SHA256_WK_MEM);
+        SHA256_SSSE3_GROUP(6);  SHA256_SSSE3_GROUP(7);  SHA256_ROUNDS8(8, SHA256_WK_MEM);
+        SHA256_SSSE3_GROUP(8);  SHA256_SSSE3_GROUP(9);  SHA256_ROUNDS8(16, SHA256_WK_MEM);
+        SHA256_SSSE3_GROUP(10); SHA256_SSSE3_GROUP(11); SHA256_ROUNDS8(24, SHA256_WK_MEM);
+        SHA256_SSSE3_GROUP(12); SHA256_SSSE3_GROUP(13); SHA256_ROUNDS8(32, SHA256_WK_MEM);
+        SHA256_SSSE3_GROUP(14); SHA256_SSSE3_GROUP(15); SHA256_ROUNDS8(40, SHA256_WK_MEM);
+        SHA256_ROUNDS8(48, SHA256_WK_MEM);
+        SHA256_ROUNDS8(56, SHA256_WK_MEM);
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+    }
+}
+
+/********************
+** AVX2
+********************/
+
+static SHAVEC_AVX2_TARGET inline __m256i sha256_ror_x8(__m256i x, int n)
+{
+    return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+}
+
+// sha256_sched_x4() on two blocks, one per 128-bit half
+static SHAVEC_AVX2_TARGET inline __m256i sha256_sched_x8(__m256i x0, __m256i x1, __m256i x2, __m256i x3)
+{
+    const __m256i lo = _mm256_set_epi32(0, 0, -1, -1, 0, 0, -1, -1);
+    __m256i w15 = _mm256_alignr_epi8(x1, x0, 4);
+    __m256i w7 = _mm256_alignr_epi8(x3, x2, 4);
+    __m256i s, t;
+
+    s = _mm256_xor_si256(_mm256_xor_si256(sha256_ror_x8(w15, 7), sha256_ror_x8(w15, 18)), _mm256_srli_epi32(w15, 3));
+    t = _mm256_add_epi32(_mm256_add_epi32(x0, w7), s);
+
+    s = _mm256_shuffle_epi32(x3, 0x0E);
+    s = _mm256_xor_si256(_mm256_xor_si256(sha256_ror_x8(s, 17), sha256_ror_x8(s, 19)), _mm256_srli_epi32(s, 10));
+    t = _mm256_add_epi32(t, _mm256_and_si256(s, lo));
+
+    s = _mm256_shuffle_epi32(t, 0x40);
+    s = _mm256_xor_si256(_mm256_xor_si256(sha256_ror_x8(s, 17), sha256_ror_x8(s, 19)), _mm256_srli_epi32(s, 10));
+    return _mm256_add_epi32(t, _mm256_andnot_si256(lo, s));
+}
+
+// Schedule group i of both blocks plus the round constants into wk0 / wk1
+#define SHA256_AVX2_GROUP(i) \
+    x[(i) & 3] = sha256_sched_x8(x[(i) & 3], x[((i) + 1) & 3], x[((i) + 2) & 3], x[((i) + 3) & 3]); \
+    y = _mm256_add_epi32(x[(i) & 3], _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(sha256_k + (4 * (i)))))); \
+    _mm_storeu_si128((__m128i*)(wk + (4 * (i))), _mm256_castsi256_si128(y)); \
+    _mm_storeu_si128((__m128i*)(wk1 + (4 * (i))), _mm256_extracti128_si256(y, 1));
+
+// Two blocks per pass: the second block's schedule comes for free in the upper halves
+// while the first block's rounds run, and its rounds then only read wk1.
+SHAVEC_AVX2_TARGET void sha256_transform_avx2(uint32_t* state, const uint8_t* data, size_t blocks)
+{
+    const __m256i bswap = _mm256_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL, 0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    uint32_t wk[64], wk1[64];
+    uint32_t a, b, c, d, e, f, g, h;
+    __m256i x[4], y;
+    int i;
+
+    for (; blocks >= 2; blocks -= 2, data += 128)
+    {
+        for (i = 0; i < 4; i++)
+        {
+            x[i] = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)(data + (16 * i)))),
+                                           _mm_loadu_si128((const __m128i*)(data + 64 + (16 * i))), 1);
+            x[i] = _mm256_shuffle_epi8(x[i], bswap);
+            y = _mm256_add_epi32(x[i], _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)(sha256_k + (4 * i)))));
+            _mm_storeu_si128((__m128i*)(wk + (4 * i)), _mm256_castsi256_si128(y));
+            _mm_storeu_si128((__m128i*)(wk1 + (4 * i)), _mm256_extracti128_si256(y, 1));
+        }
+
+        a = state[0]; b = state[1]; c = state[2]; d = state[3];
+        e = state[4]; f = state[5]; g = state[6]; h = state[7];
+
+        SHA256_AVX2_GROUP(4);  SHA256_AVX2_GROUP(5);  SHA256_ROUNDS8(0, SHA256_WK_MEM);
+        SHA256_AVX2_GROUP(6);  SHA256_AVX2_GROUP(7);  SHA256_ROUNDS8(8, SHA256_WK_MEM);
+        SHA256_AVX2_GROUP(8);  SHA256_AVX2_GROUP(9);  SHA256_ROUNDS8(16, SHA256_WK_MEM);
+        SHA256_AVX2_GROUP(10); SHA256_AVX2_GROUP(11); SHA256_ROUNDS8(24, SHA256_WK_MEM);
+        SHA256_AVX2_GROUP(12); SHA256_AVX2_GROUP(13); SHA256_ROUNDS8(32, SHA256_WK_MEM);
+        SHA256_AVX2_GROUP(14); SHA256_AVX2_GROUP(15); SHA256_ROUNDS8(40, SHA256_WK_MEM);
+        SHA256_ROUNDS8(48, SHA256_WK_MEM);
+        SHA256_ROUNDS8(56, SHA256_WK_MEM);
+
+        state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+        state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+
+        sha256_rounds_wk(state, wk1);
+    }
+    if (blocks > 0) sha256_transform_ssse3(state, data, 1);
+}
+
+#endif // SHA_HAVE_VEC
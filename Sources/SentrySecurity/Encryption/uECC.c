@@ -82,6 +82,21 @@
 #define REPEATM(N, macro) EVAL(REPEATM_SOME(N, macro))
 
 #include "platform-specific.h"
+#include "p256_mulx.h"
+
+/* secp256r1 field products go through the BMI2/ADX kernels when the CPU has them */
+#define uECC_P256_MULX (P256_HAVE_MULX && (uECC_WORD_SIZE == 8) && uECC_SUPPORTS_secp256r1 && \
+                        (uECC_OPTIMIZATION_LEVEL > 0))
+
+/* secp256r1 point multiplication runs on a Montgomery-form twin of the curve */
+#define uECC_P256_MONT (uECC_P256_MONTGOMERY && uECC_SUPPORTS_secp256r1 && \
+                        (uECC_OPTIMIZATION_LEVEL > 0) && ((uECC_WORD_SIZE == 4) || SUPPORTS_INT128))
+
+/* secp256r1 multiples of G come from a precomputed table instead of the ladder */
+#define uECC_P256_FIXED (uECC_P256_FIXED_BASE && uECC_SUPPORTS_secp256r1)
+
+/* Inversions run constant-time divsteps on signed 62-bit limbs when a 128-bit integer is around */
+#define uECC_SAFEGCD ((uECC_WORD_SIZE == 8) && SUPPORTS_INT128)
 
 #if (uECC_WORD_SIZE == 1)
     #if uECC_SUPPORTS_secp160r1
@@ -155,6 +170,13 @@ struct uECC_Curve_t {
 #if (uECC_OPTIMIZATION_LEVEL > 0)
     void (*mmod_fast)(uECC_word_t *result, uECC_word_t *product);
 #endif
+#if uECC_P256_MONT
+    /* Twin of this curve whose mmod_fast is a Montgomery reduction, so that its field
+       elements are x * R mod p; EccPoint_mult runs its ladder there when set. */
+    const struct uECC_Curve_t *mont;
+    /* On the twin: R^2 mod p, multiplied in to convert into it */
+    const uECC_word_t *mont_rr;
+#endif
 };
 
 #if uECC_VLI_NATIVE_LITTLE_ENDIAN
@@ -317,8 +339,6 @@ uECC_VLI_API void uECC_vli_rshift1(uECC_word_t *vli, wordcount_t num_words) {
 }
 #endif /* !asm_rshift1 */
 
-int cccc_add = 0;
-int cccc_sub = 0;
 /* Computes result = left + right, returning carry. Can modify in place. */
 #if !asm_add
 uECC_VLI_API uECC_word_t uECC_vli_add(uECC_word_t *result,
@@ -334,7 +354,6 @@ uECC_VLI_API uECC_word_t uECC_vli_add(uECC_word_t *result,
         }
         result[i] = sum;
     }
-    cccc_add++;
     return carry;
 }
 #endif /* !asm_add */
@@ -354,7 +373,6 @@ uECC_VLI_API uECC_word_t uECC_vli_sub(uECC_word_t *result,
         }
         result[i] = diff;
     }
-    cccc_sub++;
     return borrow;
 }
 #endif /* !asm_sub */
@@ -405,8 +423,6 @@ static void muladd(uECC_word_t a,
 
 #if !asm_mult
 
-uint8_t RRR_MULT[64];
-int cccc_mul = 0;
 uECC_VLI_API void uECC_vli_mult(uECC_word_t *result,
                                 const uECC_word_t *left,
                                 const uECC_word_t *right,
@@ -436,9 +452,6 @@ uECC_VLI_API void uECC_vli_mult(uECC_word_t *result,
         r2 = 0;
     }
     result[num_words * 2 - 1] = r0;
-    memcpy(RRR_MULT, result, 64);
-    cccc_mul++;
-    return;
 }
 #endif /* !asm_mult */
 
@@ -616,11 +629,53 @@ uECC_VLI_API void uECC_vli_modMult(uECC_word_t *result,
     uECC_vli_mmod(result, product, mod, num_words);
 }
 
+#if uECC_P256_MULX
+static void vli_mmod_fast_secp256r1(uECC_word_t *result, uECC_word_t *product);
+#if uECC_P256_MONT
+static void vli_mmod_mont_secp256r1(uECC_word_t *result, uECC_word_t *product);
+#endif
+
+/* Runs a secp256r1 field product (a square when left == right) on the BMI2/ADX kernels.
+   Returns 0 when the curve or the CPU has none. */
+static int vli_modMult_mulx(uECC_word_t *result,
+                            const uECC_word_t *left,
+                            const uECC_word_t *right,
+                            uECC_Curve curve) {
+    if ((cpu_features() & P256_MULX_FEATURES) != P256_MULX_FEATURES) {
+        return 0;
+    }
+    if (curve->mmod_fast == vli_mmod_fast_secp256r1) {
+        if (left == right) {
+            p256_sqr_mulx(result, left);
+        } else {
+            p256_mul_mulx(result, left, right);
+        }
+        return 1;
+    }
+#if uECC_P256_MONT
+    if (curve->mmod_fast == vli_mmod_mont_secp256r1) {
+        if (left == right) {
+            p256_mont_sqr_mulx(result, left);
+        } else {
+            p256_mont_mul_mulx(result, left, right);
+        }
+        return 1;
+    }
+#endif
+    return 0;
+}
+#endif
+
 uECC_VLI_API void uECC_vli_modMult_fast(uECC_word_t *result,
                                         const uECC_word_t *left,
                                         const uECC_word_t *right,
                                         uECC_Curve curve) {
     uECC_word_t product[2 * uECC_MAX_WORDS];
+#if uECC_P256_MULX
+    if (vli_modMult_mulx(result, left, right, curve)) {
+        return;
+    }
+#endif
     uECC_vli_mult(product, left, right, curve->num_words);
 #if (uECC_OPTIMIZATION_LEVEL > 0)
     curve->mmod_fast(result, product);
@@ -647,6 +702,11 @@ uECC_VLI_API void uECC_vli_modSquare_fast(uECC_word_t *result,
                                           const uECC_word_t *left,
                                           uECC_Curve curve) {
     uECC_word_t product[2 * uECC_MAX_WORDS];
+#if uECC_P256_MULX
+    if (vli_modMult_mulx(result, left, left, curve)) {
+        return;
+    }
+#endif
     uECC_vli_square(product, left, curve->num_words);
 #if (uECC_OPTIMIZATION_LEVEL > 0)
     curve->mmod_fast(result, product);
@@ -674,6 +734,235 @@ uECC_VLI_API void uECC_vli_modSquare_fast(uECC_word_t *result,
 
 #endif /* uECC_SQUARE_FUNC */
 
+#if uECC_SAFEGCD
+
+/* Modular inversion by Bernstein-Yang divsteps ("Fast constant-time gcd computation and modular
+   inversion"), in the delta = 1/2 form from libsecp256k1's safegcd. Every input runs the same
+   590 divsteps, which is enough for any odd modulus of up to 256 bits, so the timing does not
+   depend on the value being inverted. Numbers are held as five signed 62-bit limbs and the
+   divsteps are applied in batches of 59 as a single 2x2 transition matrix scaled by 2^62. */
+typedef __int128 uECC_sdword_t;
+
+typedef struct {
+    int64_t v[5];
+} vli_signed62_t;
+
+typedef struct {
+    int64_t u, v, q, r;
+} vli_trans2x2_t;
+
+#define SIGNED62_MASK (UINT64_MAX >> 2)
+
+static void vli_to_signed62(vli_signed62_t *r, const uECC_word_t *a) {
+    r->v[0] = (int64_t)(a[0] & SIGNED62_MASK);
+    r->v[1] = (int64_t)(((a[0] >> 62) | (a[1] << 2)) & SIGNED62_MASK);
+    r->v[2] = (int64_t)(((a[1] >> 60) | (a[2] << 4)) & SIGNED62_MASK);
+    r->v[3] = (int64_t)(((a[2] >> 58) | (a[3] << 6)) & SIGNED62_MASK);
+    r->v[4] = (int64_t)(a[3] >> 56);
+}
+
+/* 'a' must be normalized to [0, 2^256) */
+static void vli_from_signed62(uECC_word_t *r, const vli_signed62_t *a) {
+    const uint64_t a0 = a->v[0], a1 = a->v[1], a2 = a->v[2], a3 = a->v[3], a4 = a->v[4];
+
+    r[0] = a0 | (a1 << 62);
+    r[1] = (a1 >> 2) | (a2 << 60);
+    r[2] = (a2 >> 4) | (a3 << 58);
+    r[3] = (a3 >> 6) | (a4 << 56);
+}
+
+/* Runs 59 divsteps on the low bits of f and g, returning the updated zeta = -(delta + 1/2) and
+   the matrix that maps the full (f, g) to (f, g) * 2^3 after those steps. The loop starts from
+   8 * identity, so the matrix comes out scaled by 2^62 with every entry inside [-2^62, 2^62].
+   Both branches of a divstep are computed and blended with masks. */
+static int64_t vli_divsteps_59(int64_t zeta, uint64_t f0, uint64_t g0, vli_trans2x2_t *t) {
+    uint64_t u = 8, v = 0, q = 0, r = 8;
+    uint64_t f = f0, g = g0, x, y, z;
+    volatile uint64_t c1, c2;
+    uint64_t mask1, mask2;
+    int i;
+
+    for (i = 3; i < 62; ++i) {
+        /* mask1 = (zeta < 0), mask2 = g odd */
+        c1 = (uint64_t)(zeta >> 63);
+        mask1 = c1;
+        c2 = g & 1;
+        mask2 = -c2;
+        /* g += +-f, and the same on the matrix rows, when g is odd */
+        x = (f ^ mask1) - mask1;
+        y = (u ^ mask1) - mask1;
+        z = (v ^ mask1) - mask1;
+        g += x & mask2;
+        q += y & mask2;
+        r += z & mask2;
+        /* Swap case: zeta becomes -zeta - 2 and f takes the old g, otherwise zeta - 1 */
+        mask1 &= mask2;
+        zeta = (zeta ^ (int64_t)mask1) - 1;
+        f += g & mask1;
+        u += q & mask1;
+        v += r & mask1;
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+    t->u = (int64_t)u;
+    t->v = (int64_t)v;
+    t->q = (int64_t)q;
+    t->r = (int64_t)r;
+    return zeta;
+}
+
+/* (d, e) = (t * (d, e) + mod * (md, me)) / 2^62 mod 'mod', with md and me picked to make the
+   division exact. Inputs and outputs stay in (-2 * mod, mod). */
+static void vli_update_de_62(vli_signed62_t *d,
+                             vli_signed62_t *e,
+                             const vli_trans2x2_t *t,
+                             const vli_signed62_t *mod,
+                             uint64_t mod_inv62) {
+    const int64_t d0 = d->v[0], d1 = d->v[1], d2 = d->v[2], d3 = d->v[3], d4 = d->v[4];
+    const int64_t e0 = e->v[0], e1 = e->v[1], e2 = e->v[2], e3 = e->v[3], e4 = e->v[4];
+    const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+    int64_t md, me, sd, se;
+    uECC_sdword_t cd, ce;
+
+    /* Start md, me at the multiples that make the results non-negative for negative d, e */
+    sd = d4 >> 63;
+    se = e4 >> 63;
+    md = (u & sd) + (v & se);
+    me = (q & sd) + (r & se);
+    cd = (uECC_sdword_t)u * d0 + (uECC_sdword_t)v * e0;
+    ce = (uECC_sdword_t)q * d0 + (uECC_sdword_t)r * e0;
+    /* ... and correct them so the bottom 62 bits of the sums cancel */
+    md -= (int64_t)((mod_inv62 * (uint64_t)cd + (uint64_t)md) & SIGNED62_MASK);
+    me -= (int64_t)((mod_inv62 * (uint64_t)ce + (uint64_t)me) & SIGNED62_MASK);
+    cd += (uECC_sdword_t)mod->v[0] * md;
+    ce += (uECC_sdword_t)mod->v[0] * me;
+    cd >>= 62;
+    ce >>= 62;
+
+    cd += (uECC_sdword_t)u * d1 + (uECC_sdword_t)v * e1 + (uECC_sdword_t)mod->v[1] * md;
+    ce += (uECC_sdword_t)q * d1 + (uECC_sdword_t)r * e1 + (uECC_sdword_t)mod->v[1] * me;
+    d->v[0] = (int64_t)((uint64_t)cd & SIGNED62_MASK);
+    e->v[0] = (int64_t)((uint64_t)ce & SIGNED62_MASK);
+    cd >>= 62;
+    ce >>= 62;
+
+    cd += (uECC_sdword_t)u * d2 + (uECC_sdword_t)v * e2 + (uECC_sdword_t)mod->v[2] * md;
+    ce += (uECC_sdword_t)q * d2 + (uECC_sdword_t)r * e2 + (uECC_sdword_t)mod->v[2] * me;
+    d->v[1] = (int64_t)((uint64_t)cd & SIGNED62_MASK);
+    e->v[1] = (int64_t)((uint64_t)ce & SIGNED62_MASK);
+    cd >>= 62;
+    ce >>= 62;
+
+    cd += (uECC_sdword_t)u * d3 + (uECC_sdword_t)v * e3 + (uECC_sdword_t)mod->v[3] * md;
+    ce += (uECC_sdword_t)q * d3 + (uECC_sdword_t)r * e3 + (uECC_sdword_t)mod->v[3] * me;
+    d->v[2] = (int64_t)((uint64_t)cd & SIGNED62_MASK);
+    e->v[2] = (int64_t)((uint64_t)ce & SIGNED62_MASK);
+    cd >>= 62;
+    ce >>= 62;
+
+    cd += (uECC_sdword_t)u * d4 + (uECC_sdword_t)v * e4 + (uECC_sdword_t)mod->v[4] * md;
+    ce += (uECC_sdword_t)q * d4 + (uECC_sdword_t)r * e4 + (uECC_sdword_t)mod->v[4] * me;
+    d->v[3] = (int64_t)((uint64_t)cd & SIGNED62_MASK);
+    e->v[3] = (int64_t)((uint64_t)ce & SIGNED62_MASK);
+    cd >>= 62;
+    ce >>= 62;
+
+    d->v[4] = (int64_t)cd;
+    e->v[4] = (int64_t)ce;
+}
+
+/* (f, g) = t * (f, g) / 2^62. The low 62 bits of both products are zero by construction. */
+static void vli_update_fg_62(vli_signed62_t *f, vli_signed62_t *g, const vli_trans2x2_t *t) {
+    const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+    uECC_sdword_t cf, cg;
+    int i;
+
+    cf = (uECC_sdword_t)u * f->v[0] + (uECC_sdword_t)v * g->v[0];
+    cg = (uECC_sdword_t)q * f->v[0] + (uECC_sdword_t)r * g->v[0];
+    cf >>= 62;
+    cg >>= 62;
+    for (i = 1; i < 5; ++i) {
+        const int64_t fi = f->v[i], gi = g->v[i];
+        cf += (uECC_sdword_t)u * fi + (uECC_sdword_t)v * gi;
+        cg += (uECC_sdword_t)q * fi + (uECC_sdword_t)r * gi;
+        f->v[i - 1] = (int64_t)((uint64_t)cf & SIGNED62_MASK);
+        g->v[i - 1] = (int64_t)((uint64_t)cg & SIGNED62_MASK);
+        cf >>= 62;
+        cg >>= 62;
+    }
+    f->v[4] = (int64_t)cf;
+    g->v[4] = (int64_t)cg;
+}
+
+/* Brings r from (-2 * mod, mod) to [0, mod), negating it first if 'sign' is negative */
+static void vli_normalize_62(vli_signed62_t *r, int64_t sign, const vli_signed62_t *mod) {
+    volatile int64_t cond_add, cond_negate;
+    int64_t a[5];
+    int i;
+
+    cond_add = r->v[4] >> 63;
+    cond_negate = sign >> 63;
+    for (i = 0; i < 5; ++i) {
+        a[i] = r->v[i] + (mod->v[i] & cond_add);
+        a[i] = (a[i] ^ cond_negate) - cond_negate;
+    }
+    for (i = 0; i < 4; ++i) {
+        a[i + 1] += a[i] >> 62;
+        a[i] &= (int64_t)SIGNED62_MASK;
+    }
+
+    cond_add = a[4] >> 63;
+    for (i = 0; i < 5; ++i) {
+        a[i] += mod->v[i] & cond_add;
+    }
+    for (i = 0; i < 4; ++i) {
+        a[i + 1] += a[i] >> 62;
+        r->v[i] = a[i] & (int64_t)SIGNED62_MASK;
+    }
+    r->v[4] = a[4];
+}
+
+/* Computes result = (1 / input) % mod for an odd mod, in constant time. All VLIs are the same
+   size; input must be below mod, and an input of zero gives zero. */
+uECC_VLI_API void uECC_vli_modInv(uECC_word_t *result,
+                                  const uECC_word_t *input,
+                                  const uECC_word_t *mod,
+                                  wordcount_t num_words) {
+    uECC_word_t tmp[4];
+    vli_signed62_t m, d = {{0, 0, 0, 0, 0}}, e = {{1, 0, 0, 0, 0}}, f, g;
+    vli_trans2x2_t t;
+    uint64_t mod_inv62 = mod[0];
+    int64_t zeta = -1; /* delta = 1/2 */
+    int i;
+
+    uECC_vli_clear(tmp, 4);
+    uECC_vli_set(tmp, mod, num_words);
+    vli_to_signed62(&m, tmp);
+    uECC_vli_set(tmp, input, num_words);
+    vli_to_signed62(&g, tmp);
+    f = m;
+
+    /* mod^-1 mod 2^64 by Newton iteration; an odd number is its own inverse mod 2^3 */
+    for (i = 0; i < 5; ++i) {
+        mod_inv62 *= 2 - mod[0] * mod_inv62;
+    }
+    mod_inv62 &= SIGNED62_MASK;
+
+    for (i = 0; i < 10; ++i) {
+        zeta = vli_divsteps_59(zeta, (uint64_t)f.v[0], (uint64_t)g.v[0], &t);
+        vli_update_de_62(&d, &e, &t, &m, mod_inv62);
+        vli_update_fg_62(&f, &g, &t);
+    }
+
+    /* g is now zero and f is +-gcd = +-1, so d is +-(1 / input) */
+    vli_normalize_62(&d, f.v[4], &m);
+    vli_from_signed62(tmp, &d);
+    uECC_vli_set(result, tmp, num_words);
+}
+
+#else
+
 #define EVEN(vli) (!(vli[0] & 1))
 static void vli_modInv_update(uECC_word_t *uv,
                               const uECC_word_t *mod,
@@ -735,6 +1024,8 @@ uECC_VLI_API void uECC_vli_modInv(uECC_word_t *result,
     uECC_vli_set(result, u, num_words);
 }
 
+#endif /* uECC_SAFEGCD */
+
 /* ------ Point operations ------ */
 
 #include "curve-specific.h"
@@ -869,6 +1160,18 @@ static void EccPoint_mult(uECC_word_t * result,
     bitcount_t i;
     uECC_word_t nb;
     wordcount_t num_words = curve->num_words;
+#if uECC_P256_MONT
+    uECC_word_t mont_point[uECC_MAX_WORDS * 2];
+
+    /* Any nonzero initial_Z is as good a randomizer in Montgomery form, so only the point
+       is converted. */
+    if (curve->mont) {
+        curve = curve->mont;
+        uECC_vli_modMult_fast(mont_point, point, curve->mont_rr, curve);
+        uECC_vli_modMult_fast(mont_point + num_words, point + num_words, curve->mont_rr, curve);
+        point = mont_point;
+    }
+#endif
 
     uECC_vli_set(Rx[1], point, num_words);
     uECC_vli_set(Ry[1], point + num_words, num_words);
@@ -889,6 +1192,13 @@ static void EccPoint_mult(uECC_word_t * result,
     uECC_vli_modMult_fast(z, z, Ry[1 - nb], curve);               /* Yb * (X1 - X0) */
     uECC_vli_modMult_fast(z, z, point, curve);                    /* xP * Yb * (X1 - X0) */
     uECC_vli_modInv(z, z, curve->p, num_words);            /* 1 / (xP * Yb * (X1 - X0)) */
+#if uECC_P256_MONT
+    /* The inverse of a * R is 1 / (a * R); each product with R^2 multiplies by R */
+    if (curve->mont_rr) {
+        uECC_vli_modMult_fast(z, z, curve->mont_rr, curve);
+        uECC_vli_modMult_fast(z, z, curve->mont_rr, curve);
+    }
+#endif
     /* yP / (xP * Yb * (X1 - X0)) */
     uECC_vli_modMult_fast(z, z, point + num_words, curve);
     uECC_vli_modMult_fast(z, z, Rx[1 - nb], curve); /* Xb * yP / (xP * Yb * (X1 - X0)) */
@@ -897,6 +1207,16 @@ static void EccPoint_mult(uECC_word_t * result,
     XYcZ_add(Rx[nb], Ry[nb], Rx[1 - nb], Ry[1 - nb], curve);
     apply_z(Rx[0], Ry[0], z, curve);
 
+#if uECC_P256_MONT
+    /* A product with 1 takes the R back out */
+    if (curve->mont_rr) {
+        uECC_vli_clear(z, num_words);
+        z[0] = 1;
+        uECC_vli_modMult_fast(Rx[0], Rx[0], z, curve);
+        uECC_vli_modMult_fast(Ry[0], Ry[0], z, curve);
+    }
+#endif
+
     uECC_vli_set(result, Rx[0], num_words);
     uECC_vli_set(result + num_words, Ry[0], num_words);
 }
@@ -914,19 +1234,204 @@ static uECC_word_t regularize_k(const uECC_word_t * const k,
     return carry;
 }
 
-static uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
-                                               uECC_word_t *private_key,
-                                               uECC_Curve curve) {
+/* Sets dest = src where mask is all ones, leaves it where mask is zero */
+static void vli_cmov(uECC_word_t *dest,
+                     const uECC_word_t *src,
+                     uECC_word_t mask,
+                     wordcount_t num_words) {
+    wordcount_t i;
+    for (i = 0; i < num_words; ++i) {
+        dest[i] ^= (dest[i] ^ src[i]) & mask;
+    }
+}
+
+/* result = k * point, for 0 < k < n. result may overlap point.
+   The ladder in EccPoint_mult() meets the point at infinity, or adds a point to its own
+   negative, exactly when k is 1, n - 1 or n - 2: the regularized scalar is then within two
+   of 2n, so one of the multiples it passes through is 0 or -1 times the point. Those three
+   results are selected afterwards from point, -point and -2 * point, in constant time. */
+static void EccPoint_mult_scalar(uECC_word_t *result,
+                                 const uECC_word_t *point,
+                                 const uECC_word_t *k,
+                                 const uECC_word_t *initial_Z,
+                                 uECC_Curve curve) {
     uECC_word_t tmp1[uECC_MAX_WORDS];
     uECC_word_t tmp2[uECC_MAX_WORDS];
     uECC_word_t *p2[2] = {tmp1, tmp2};
+    uECC_word_t edge[3][uECC_MAX_WORDS * 2];
+    uECC_word_t z[uECC_MAX_WORDS];
     uECC_word_t carry;
+    wordcount_t num_words = curve->num_words;
+    wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+    /* point, -point, and -2 * point doubled from Z = 1 */
+    uECC_vli_set(edge[0], point, num_words * 2);
+    uECC_vli_set(edge[1], point, num_words);
+    uECC_vli_sub(edge[1] + num_words, curve->p, point + num_words, num_words);
+    uECC_vli_set(edge[2], edge[1], num_words * 2);
+    uECC_vli_clear(z, num_words);
+    z[0] = 1;
+    curve->double_jacobian(edge[2], edge[2] + num_words, z, curve);
+    uECC_vli_modInv(z, z, curve->p, num_words);
+    apply_z(edge[2], edge[2] + num_words, z, curve);
 
-    /* Regularize the bitcount for the private key so that attackers cannot use a side channel
+    /* Regularize the bitcount for the scalar so that attackers cannot use a side channel
        attack to learn the number of leading zeros. */
-    carry = regularize_k(private_key, tmp1, tmp2, curve);
+    carry = regularize_k(k, tmp1, tmp2, curve);
+
+    EccPoint_mult(result, point, p2[!carry], initial_Z, curve->num_n_bits + 1, curve);
+
+    uECC_vli_clear(tmp1, num_n_words);
+    tmp1[0] = 1;
+    vli_cmov(result, edge[0], 0 - uECC_vli_equal(k, tmp1, num_n_words), num_words * 2);
+    uECC_vli_sub(tmp2, curve->n, tmp1, num_n_words);
+    vli_cmov(result, edge[1], 0 - uECC_vli_equal(k, tmp2, num_n_words), num_words * 2);
+    uECC_vli_sub(tmp2, tmp2, tmp1, num_n_words);
+    vli_cmov(result, edge[2], 0 - uECC_vli_equal(k, tmp2, num_n_words), num_words * 2);
+}
+
+#if uECC_P256_FIXED
+
+#include "p256_table.h"
+
+/* result = scalar * G on secp256r1, for 0 < scalar < n.
+   The scalar is split into 64 signed base-16 digits d_i in [-8, 8] and the result is the sum
+   of the table entries d_i * 16^i * G, with no doublings at all. Each table row is scanned in
+   full and the mixed addition runs for every digit, so neither timing nor memory accesses
+   depend on the scalar. The sum of the digits below i is smaller than 16^i in absolute value
+   and the next term is at least that, so the addition never meets a doubling or a point plus
+   its inverse; the only special cases are a zero digit and a still empty sum, and both are
+   handled by selecting the result afterwards. */
+static void EccPoint_mult_G_secp256r1(uECC_word_t *result,
+                                      const uECC_word_t *scalar,
+                                      uECC_Curve curve) {
+    uECC_word_t k[uECC_MAX_WORDS];
+    uECC_word_t R[uECC_MAX_WORDS * 3];   /* X, Y, Z of the running sum */
+    uECC_word_t sum[uECC_MAX_WORDS * 3]; /* R + the table point */
+    uECC_word_t point[uECC_MAX_WORDS * 2];
+    uECC_word_t one[uECC_MAX_WORDS];
+    uECC_word_t t1[uECC_MAX_WORDS];
+    uECC_word_t t2[uECC_MAX_WORDS];
+    uECC_word_t t3[uECC_MAX_WORDS];
+    uECC_word_t negate, empty, nonzero, sign, digit, carry, mask;
+    wordcount_t num_words = curve->num_words;
+    uECC_word_t *X = R, *Y = R + num_words, *Z = R + num_words * 2;
+    int i, j;
+
+    /* With the top bit clear the top digit cannot carry out; n - scalar always has it clear
+       when scalar does not, and (n - scalar) * G is the negation of the wanted point. */
+    negate = (uECC_word_t)0 - (scalar[num_words - 1] >> (uECC_WORD_BITS - 1));
+    uECC_vli_set(k, scalar, num_words);
+    uECC_vli_sub(t1, curve->n, scalar, num_words);
+    vli_cmov(k, t1, negate, num_words);
+
+    uECC_vli_clear(one, num_words);
+    one[0] = 1;
+#if uECC_P256_MONT
+    if (curve->mont) {
+        curve = curve->mont;
+        uECC_vli_modMult_fast(one, one, curve->mont_rr, curve);
+    }
+#endif
+
+    uECC_vli_clear(R, num_words * 3);
+    empty = ~(uECC_word_t)0;
+    carry = 0;
+    for (i = 0; i < 64; ++i) {
+        /* Digit i from nibble i plus the carry from below, moved into [-8, 8] */
+        digit = ((k[(i * 4) >> uECC_WORD_BITS_SHIFT] >> ((i * 4) & uECC_WORD_BITS_MASK)) & 0xF) +
+            carry;
+        carry = (digit + 7) >> 4;
+        digit -= carry << 4;
+        sign = (uECC_word_t)0 - (digit >> (uECC_WORD_BITS - 1));
+        digit = (digit ^ sign) - sign;
+        nonzero = (uECC_word_t)0 - ((digit + 15) >> 4);
+
+        uECC_vli_clear(point, num_words * 2);
+        for (j = 0; j < 8; ++j) {
+            mask = (((uECC_word_t)j + 1) ^ digit) - 1;
+            mask = (uECC_word_t)0 - (mask >> (uECC_WORD_BITS - 1));
+            vli_cmov(point, p256_g_table[i][j], mask, num_words * 2);
+        }
+        uECC_vli_sub(t1, curve->p, point + num_words, num_words);
+        vli_cmov(point + num_words, t1, sign, num_words);
+#if uECC_P256_MONT
+        if (curve->mont_rr) {
+            uECC_vli_modMult_fast(point, point, curve->mont_rr, curve);
+            uECC_vli_modMult_fast(point + num_words, point + num_words, curve->mont_rr, curve);
+        }
+#endif
+
+        /* Mixed Jacobian + affine addition */
+        uECC_vli_modSquare_fast(t1, Z, curve);                    /* t1 = Z^2 */
+        uECC_vli_modMult_fast(t2, t1, Z, curve);                  /* t2 = Z^3 */
+        uECC_vli_modMult_fast(t1, t1, point, curve);              /* t1 = x2 * Z^2 */
+        uECC_vli_modMult_fast(t2, t2, point + num_words, curve);  /* t2 = y2 * Z^3 */
+        uECC_vli_modSub(t1, t1, X, curve->p, num_words);          /* t1 = H */
+        uECC_vli_modSub(t2, t2, Y, curve->p, num_words);          /* t2 = r */
+        uECC_vli_modMult_fast(sum + num_words * 2, Z, t1, curve); /* Z3 = Z * H */
+        uECC_vli_modSquare_fast(t3, t1, curve);                   /* t3 = H^2 */
+        uECC_vli_modMult_fast(t1, t1, t3, curve);                 /* t1 = H^3 */
+        uECC_vli_modMult_fast(t3, t3, X, curve);                  /* t3 = X * H^2 = V */
+        uECC_vli_modSquare_fast(sum, t2, curve);                  /* r^2 */
+        uECC_vli_modSub(sum, sum, t1, curve->p, num_words);       /* r^2 - H^3 */
+        uECC_vli_modSub(sum, sum, t3, curve->p, num_words);
+        uECC_vli_modSub(sum, sum, t3, curve->p, num_words);       /* X3 = r^2 - H^3 - 2V */
+        uECC_vli_modSub(t3, t3, sum, curve->p, num_words);        /* t3 = V - X3 */
+        uECC_vli_modMult_fast(t3, t3, t2, curve);                 /* t3 = r * (V - X3) */
+        uECC_vli_modMult_fast(t1, t1, Y, curve);                  /* t1 = Y * H^3 */
+        uECC_vli_modSub(sum + num_words, t3, t1, curve->p, num_words); /* Y3 */
+
+        /* An empty sum becomes the table point itself; a zero digit keeps the sum */
+        vli_cmov(sum, point, empty, num_words * 2);
+        vli_cmov(sum + num_words * 2, one, empty, num_words);
+        vli_cmov(R, sum, nonzero, num_words * 3);
+        empty &= ~nonzero;
+    }
+
+    uECC_vli_modInv(t1, Z, curve->p, num_words);
+#if uECC_P256_MONT
+    /* The inverse of a * R is 1 / (a * R); each product with R^2 multiplies by R */
+    if (curve->mont_rr) {
+        uECC_vli_modMult_fast(t1, t1, curve->mont_rr, curve);
+        uECC_vli_modMult_fast(t1, t1, curve->mont_rr, curve);
+    }
+#endif
+    apply_z(X, Y, t1, curve);
+#if uECC_P256_MONT
+    /* A product with 1 takes the R back out */
+    if (curve->mont_rr) {
+        uECC_vli_clear(t1, num_words);
+        t1[0] = 1;
+        uECC_vli_modMult_fast(X, X, t1, curve);
+        uECC_vli_modMult_fast(Y, Y, t1, curve);
+    }
+#endif
+
+    uECC_vli_sub(t1, curve->p, Y, num_words);
+    vli_cmov(Y, t1, negate, num_words);
+    uECC_vli_set(result, X, num_words);
+    uECC_vli_set(result + num_words, Y, num_words);
+}
+
+#endif /* uECC_P256_FIXED */
+
+/* result = scalar * G, for 0 < scalar < n */
+static void EccPoint_mult_G(uECC_word_t *result, const uECC_word_t *scalar, uECC_Curve curve) {
+#if uECC_P256_FIXED
+    if (curve == &curve_secp256r1) {
+        EccPoint_mult_G_secp256r1(result, scalar, curve);
+        return;
+    }
+#endif
 
-    EccPoint_mult(result, curve->G, p2[!carry], 0, curve->num_n_bits + 1, curve);
+    EccPoint_mult_scalar(result, curve->G, scalar, 0, curve);
+}
+
+static uECC_word_t EccPoint_compute_public_key(uECC_word_t *result,
+                                               uECC_word_t *private_key,
+                                               uECC_Curve curve) {
+    EccPoint_mult_G(result, private_key, curve);
 
     if (EccPoint_isZero(result, curve)) {
         return 0;
@@ -1041,9 +1546,7 @@ int uECC_shared_secret(const uint8_t *public_key,
     uECC_word_t _private[uECC_MAX_WORDS];
 
     uECC_word_t tmp[uECC_MAX_WORDS];
-    uECC_word_t *p2[2] = {_private, tmp};
     uECC_word_t *initial_Z = 0;
-    uECC_word_t carry;
     wordcount_t num_words = curve->num_words;
     wordcount_t num_bytes = curve->num_bytes;
 
@@ -1056,20 +1559,16 @@ int uECC_shared_secret(const uint8_t *public_key,
     uECC_vli_bytesToNative(_public + num_words, public_key + num_bytes, num_bytes);
 #endif
 
-    /* Regularize the bitcount for the private key so that attackers cannot use a side channel
-       attack to learn the number of leading zeros. */
-    carry = regularize_k(_private, _private, tmp, curve);
-
     /* If an RNG function was specified, try to get a random initial Z value to improve
        protection against side-channel attacks. */
     if (g_rng_function) {
-        if (!uECC_generate_random_int(p2[carry], curve->p, num_words)) {
+        if (!uECC_generate_random_int(tmp, curve->p, num_words)) {
             return 0;
         }
-        initial_Z = p2[carry];
+        initial_Z = tmp;
     }
 
-    EccPoint_mult(_public, _public, p2[!carry], initial_Z, curve->num_n_bits + 1, curve);
+    EccPoint_mult_scalar(_public, _public, _private, initial_Z, curve);
 #if uECC_VLI_NATIVE_LITTLE_ENDIAN
     bcopy((uint8_t *) secret, (uint8_t *) _public, num_bytes);
 #else
@@ -1193,10 +1692,11 @@ int uECC_compute_public_key(const uint8_t *private_key, uint8_t *public_key, uEC
 
 /* -------- ECDSA code -------- */
 
-static void bits2int(uECC_word_t *native,
-                     const uint8_t *bits,
-                     unsigned bits_size,
-                     uECC_Curve curve) {
+/* Leftmost num_n_bits of bits, as RFC 6979 bits2int(), without reducing mod curve_n */
+static void bits2int_unreduced(uECC_word_t *native,
+                               const uint8_t *bits,
+                               unsigned bits_size,
+                               uECC_Curve curve) {
     unsigned num_n_bytes = BITS_TO_BYTES(curve->num_n_bits);
     unsigned num_n_words = BITS_TO_WORDS(curve->num_n_bits);
     int shift;
@@ -1224,6 +1724,15 @@ static void bits2int(uECC_word_t *native,
         *ptr = (temp >> shift) | carry;
         carry = temp << (uECC_WORD_BITS - shift);
     }
+}
+
+static void bits2int(uECC_word_t *native,
+                     const uint8_t *bits,
+                     unsigned bits_size,
+                     uECC_Curve curve) {
+    unsigned num_n_words = BITS_TO_WORDS(curve->num_n_bits);
+
+    bits2int_unreduced(native, bits, bits_size, curve);
 
     /* Reduce mod curve_n */
     if (uECC_vli_cmp_unsafe(curve->n, native, num_n_words) != 1) {
@@ -1240,24 +1749,20 @@ static uint16_t uECC_sign_with_k(const uint8_t *private_key,
 
     uECC_word_t tmp[uECC_MAX_WORDS];
     uECC_word_t s[uECC_MAX_WORDS];
-    uECC_word_t *k2[2] = {tmp, s};
 #if uECC_VLI_NATIVE_LITTLE_ENDIAN
     uECC_word_t *p = (uECC_word_t *)signature;
 #else
     uECC_word_t p[uECC_MAX_WORDS * 2];
 #endif
-    uECC_word_t carry;
     wordcount_t num_words = curve->num_words;
     wordcount_t num_n_words = BITS_TO_WORDS(curve->num_n_bits);
-    bitcount_t num_n_bits = curve->num_n_bits;
 
     /* Make sure 0 < k < curve_n */
     if (uECC_vli_isZero(k, num_words) || uECC_vli_cmp(curve->n, k, num_n_words) != 1) {
         return 0;
     }
 
-    carry = regularize_k(k, tmp, s, curve);
-    EccPoint_mult(p, curve->G, k2[!carry], 0, num_n_bits + 1, curve);
+    EccPoint_mult_G(p, k, curve);
     if (uECC_vli_isZero(p, num_words)) {
         return 0;
     }
@@ -1303,7 +1808,8 @@ static uint16_t uECC_sign_with_k(const uint8_t *private_key,
     uECC_vli_nativeToBytes(signature + curve->num_bytes, curve->num_bytes, s);
 #endif
 
-    return 27+(p[8] % 2);
+    /* recovery id from the parity of R.y, the word after R.x */
+    return 27+(p[num_words] % 2);
 }
 uint16_t uECC_sign(const uint8_t *private_key,
               const uint8_t *message_hash,
@@ -1325,6 +1831,148 @@ uint16_t uECC_sign(const uint8_t *private_key,
     return 0;
 }
 
+/* Compute an HMAC using K as key (as in RFC 6979). Note that K is always
+   the same size as the hash result size. */
+static void HMAC_init(uECC_HashContext *hash_context, const uint8_t *K) {
+    uint8_t *pad = hash_context->tmp + 2 * hash_context->result_size;
+    unsigned i;
+    for (i = 0; i < hash_context->result_size; ++i)
+        pad[i] = K[i] ^ 0x36;
+    for (; i < hash_context->block_size; ++i)
+        pad[i] = 0x36;
+
+    hash_context->init_hash(&hash_context->ctx,
+        hash_context->result_size == 20 ? METHOD_SHA1 : METHOD_SHA256);
+    hash_context->update_hash(&hash_context->ctx, pad, hash_context->block_size);
+}
+
+static void HMAC_update(uECC_HashContext *hash_context,
+                        uint8_t *message,
+                        unsigned message_size) {
+    hash_context->update_hash(&hash_context->ctx, message, message_size);
+}
+
+static void HMAC_finish(uECC_HashContext *hash_context,
+                        const uint8_t *K,
+                        uint8_t *result) {
+    uint8_t *pad = hash_context->tmp + 2 * hash_context->result_size;
+    unsigned i;
+    for (i = 0; i < hash_context->result_size; ++i)
+        pad[i] = K[i] ^ 0x5c;
+    for (; i < hash_context->block_size; ++i)
+        pad[i] = 0x5c;
+
+    hash_context->finish_hash(&hash_context->ctx, result);
+
+    hash_context->init_hash(&hash_context->ctx,
+        hash_context->result_size == 20 ? METHOD_SHA1 : METHOD_SHA256);
+    hash_context->update_hash(&hash_context->ctx, pad, hash_context->block_size);
+    hash_context->update_hash(&hash_context->ctx, result, hash_context->result_size);
+    hash_context->finish_hash(&hash_context->ctx, result);
+}
+
+/* V = HMAC_K(V) */
+static void update_V(uECC_HashContext *hash_context, uint8_t *K, uint8_t *V) {
+    HMAC_init(hash_context, K);
+    HMAC_update(hash_context, V, hash_context->result_size);
+    HMAC_finish(hash_context, K, V);
+}
+
+/* K = HMAC_K(V || separator || int2octets(x) || bits2octets(h)), then V = HMAC_K(V) */
+static void update_K(uECC_HashContext *hash_context,
+                     uint8_t *K,
+                     uint8_t *V,
+                     uint8_t separator,
+                     uint8_t *x,
+                     uint8_t *h,
+                     unsigned num_n_bytes) {
+    HMAC_init(hash_context, K);
+    V[hash_context->result_size] = separator;
+    HMAC_update(hash_context, V, hash_context->result_size + 1);
+    if (x) {
+        HMAC_update(hash_context, x, num_n_bytes);
+        HMAC_update(hash_context, h, num_n_bytes);
+    }
+    HMAC_finish(hash_context, K, K);
+    update_V(hash_context, K, V);
+}
+
+/* Deterministic signing, as RFC 6979 section 3.2. The private key is already
+   int2octets(x); the hash is reduced mod curve_n to give bits2octets(h). */
+uint16_t uECC_sign_deterministic(const uint8_t *private_key,
+                            const uint8_t *message_hash,
+                            unsigned hash_size,
+                            uECC_HashContext *hash_context,
+                            uint8_t *signature,
+                            uECC_Curve curve) {
+    uint8_t *K = hash_context->tmp;
+    uint8_t *V = K + hash_context->result_size;
+    uint8_t x[uECC_MAX_WORDS * uECC_WORD_SIZE];
+    uint8_t h[uECC_MAX_WORDS * uECC_WORD_SIZE];
+    uint8_t T[uECC_MAX_WORDS * uECC_WORD_SIZE];
+    uECC_word_t k[uECC_MAX_WORDS];
+    unsigned num_n_bytes = BITS_TO_BYTES(curve->num_n_bits);
+    unsigned result_size = hash_context->result_size;
+    unsigned i;
+    uECC_word_t tries;
+    uint16_t resp = 0;
+
+    if (2 * result_size + hash_context->block_size > sizeof(hash_context->tmp)) {
+        return 0;
+    }
+
+    memcpy(x, private_key, num_n_bytes);
+    bits2int(k, message_hash, hash_size, curve);
+    uECC_vli_nativeToBytes(h, num_n_bytes, k);
+
+    for (i = 0; i < result_size; ++i) {
+        V[i] = 0x01;
+        K[i] = 0;
+    }
+
+    update_K(hash_context, K, V, 0x00, x, h, num_n_bytes);
+    update_K(hash_context, K, V, 0x01, x, h, num_n_bytes);
+
+    for (tries = 0; tries < uECC_RNG_MAX_TRIES; ++tries) {
+        unsigned T_bytes = 0;
+
+        for (;;) {
+            update_V(hash_context, K, V);
+            for (i = 0; i < result_size && T_bytes < num_n_bytes; ++i, ++T_bytes) {
+                T[T_bytes] = V[i];
+            }
+            if (T_bytes >= num_n_bytes) {
+                break;
+            }
+        }
+
+        bits2int_unreduced(k, T, num_n_bytes, curve);
+        resp = uECC_sign_with_k(private_key, message_hash, hash_size, k, signature, curve);
+        if (resp > 0) {
+            break;
+        }
+
+        update_K(hash_context, K, V, 0x00, 0, 0, num_n_bytes);
+    }
+
+    memset(x, 0, sizeof(x));
+    memset(k, 0, sizeof(k));
+    memset(hash_context->tmp, 0, sizeof(hash_context->tmp));
+    return resp;
+}
+
+static void hash_context_sha256_update(struct sha_ctx *ctx, uint8_t *data, uint16_t len) {
+    sha_update(ctx, data, len);
+}
+
+void uECC_hash_context_sha256(uECC_HashContext *hash_context) {
+    hash_context->init_hash = sha_init;
+    hash_context->update_hash = hash_context_sha256_update;
+    hash_context->finish_hash = sha_final;
+    hash_context->block_size = 64;
+    hash_context->result_size = 32;
+}
+
 
 static bitcount_t smax(bitcount_t a, bitcount_t b) {
     return (a > b ? a : b);
@@ -1502,12 +2150,7 @@ void uECC_point_mult(uECC_word_t *result,
                      const uECC_word_t *point,
                      const uECC_word_t *scalar,
                      uECC_Curve curve) {
-    uECC_word_t tmp1[uECC_MAX_WORDS];
-    uECC_word_t tmp2[uECC_MAX_WORDS];
-    uECC_word_t *p2[2] = {tmp1, tmp2};
-    uECC_word_t carry = regularize_k(scalar, tmp1, tmp2, curve);
-
-    EccPoint_mult(result, point, p2[!carry], 0, curve->num_n_bits + 1, curve);
+    EccPoint_mult_scalar(result, point, scalar, 0, curve);
 }
 
 #endif /* uECC_ENABLE_VLI_API */
@@ -5,6 +5,7 @@
 //#include "sha3.h"
 #include "aes.h"
 #include "wrapper.h"
+#include "kdf.h"
 #include "constants.h"
 
 #include "stdio.h"
@@ -93,10 +94,10 @@ int lib_auth_init(uint8_t* o_ApduInternal, int *o_len, uint8_t* o_private_key, u
 // this is taking the 'public key' as returned from the card by the auth_init command and extracting various keys. needs the private key and secret_shses generated by lib_auth_init
 int lib_auth_ecdh_kdf(uint8_t* apduResponse, uint8_t* secret_shses, uint8_t* privateKey, uint8_t* o_KeyRespt, uint8_t* o_KeyENC, uint8_t* o_KeyCMAC, uint8_t* o_KeyRMAC, uint8_t* o_chaining_value)
 {
+    static const uint8_t shared_info[3] = { 0x3C, 0x88, 0x10 };
     int ret;
-    uint8_t SecretKeys[250];
-    uint8_t shared_secret[256];
-    uint8_t secret_shsee[32];
+    uint8_t shared_secret[64];
+    struct kdf_span keys[4];
     
     uint8_t pub[64];
     
@@ -132,56 +133,26 @@ int lib_auth_ecdh_kdf(uint8_t* apduResponse, uint8_t* secret_shses, uint8_t* pri
         
     uECC_Curve curve = uECC_secp256r1();
     //ret = uECC_shared_secret(pub, private_key, secret_shsee, curve);
-    ret = uECC_shared_secret(pub, privateKey, secret_shsee, curve);
+    ret = uECC_shared_secret(pub, privateKey, shared_secret, curve);
     //if (ret != 1) return -102;
     if (ret != 1) return ERROR_SHAREDSECRETEXTRACTION;
     
-    memcpy(shared_secret + 0, secret_shsee, 32);
+    // Z = ShSee | ShSes; the X9.63 KDF output runs KeyRespt | KeyENC | KeyCMAC | KeyRMAC
     memcpy(shared_secret + 32, secret_shses, 32);
 
-    shared_secret[64] = 0x00;
-    shared_secret[65] = 0x00;
-    shared_secret[66] = 0x00;
-    shared_secret[67] = 0x01;
-
-    shared_secret[68] = 0x3C;
-    shared_secret[69] = 0x88;
-    shared_secret[70] = 0x10;
-
-    SHA256(shared_secret, 71, SecretKeys);
-    shared_secret[67] = 0x02;
-    SHA256(shared_secret, 71, SecretKeys + 32);
-    shared_secret[67] = 0x03;
-    SHA256(shared_secret, 71, SecretKeys + 64);
-
-//    int i;
-//    
-//    printf("\nKey ENC Before:\n");
-//    for (i = 0; i < 16; i++)
-//    {
-//        if (i > 0) printf(", ");
-//        printf("0x%02X", o_KeyENC[i]);
-//    }
-//    printf("\n");
- 
-    memcpy(o_KeyRespt, SecretKeys + 0, 16);
-    memcpy(o_KeyENC, SecretKeys + 16, 16);
-    
-//    printf("\nKey ENC After:\n");
-//    for (i = 0; i < 16; i++)
-//    {
-//        if (i > 0) printf(", ");
-//        printf("0x%02X", o_KeyENC[i]);
-//    }
-//    printf("\n");
+    keys[0].out = o_KeyRespt;
+    keys[1].out = o_KeyENC;
+    keys[2].out = o_KeyCMAC;
+    keys[3].out = o_KeyRMAC;
+    for (i = 0; i < 4; i++) keys[i].len = 16;
 
-    memcpy(o_KeyCMAC, SecretKeys + 32, 16);
-    memcpy(o_KeyRMAC, SecretKeys + 48, 16);
+    x963_kdf_scatter(METHOD_SHA256, shared_secret, sizeof(shared_secret), shared_info, sizeof(shared_info), keys, 4);
+    memset(shared_secret, 0, sizeof(shared_secret));
     
     return SUCCESS;
 }
 
-int lib_auth_wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, uint8_t* keyENC, uint8_t* keyCMAC, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter)
+static int auth_wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, const struct aes128_ctx* enc_ctx, const struct cmac_ctx* cmac_ctx, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter)
 {
     //int Ret = 0;
     uint32_t wrap_out_len = 0;
@@ -195,7 +166,7 @@ int lib_auth_wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t
     // lib_auth_wrap(DataIn, DataInLen, wrap_apdu_out, &wrap_out_len);
     if (in_len < 5) return ERROR_INVALIDPARAMETER;
     
-    wrap(apdu_in, in_len, wrap_apdu_out, &wrap_out_len, keyENC, keyCMAC, inout_chaining_value, inout_encryption_counter);
+    wrap(apdu_in, in_len, wrap_apdu_out, &wrap_out_len, enc_ctx, cmac_ctx, inout_chaining_value, inout_encryption_counter);
     
     memcpy(apdu_out, wrap_apdu_out, wrap_out_len);
     out_len[0] = wrap_out_len;
@@ -203,7 +174,7 @@ int lib_auth_wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t
     return SUCCESS;
 }
 
-int lib_auth_unwrap(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrapped_apdu_out, uint32_t* out_len, uint8_t* keyENC, uint8_t* keyRMAC, uint8_t* chaining_value, uint8_t* encryption_counter)
+static int auth_unwrap(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrapped_apdu_out, uint32_t* out_len, const struct aes128_ctx* enc_ctx, const struct cmac_ctx* rmac_ctx, uint8_t* chaining_value, uint8_t* encryption_counter)
 {
     int ret = 0;
     
@@ -212,7 +183,7 @@ int lib_auth_unwrap(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrappe
     
     if (in_len != 2)
     {
-        ret = unwrap(wrapped_apdu_in, in_len, unwrapped_apdu_out, out_len, keyENC, keyRMAC, chaining_value, encryption_counter);
+        ret = unwrap(wrapped_apdu_in, in_len, unwrapped_apdu_out, out_len, enc_ctx, rmac_ctx, chaining_value, encryption_counter);
     }
     else
     {
@@ -223,6 +194,133 @@ int lib_auth_unwrap(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrappe
     return ret;
 }
 
+// One-shot forms: the keys are expanded for this APDU only and wiped again before returning
+int lib_auth_wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, uint8_t* keyENC, uint8_t* keyCMAC, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter)
+{
+    struct aes128_ctx enc_ctx;
+    struct cmac_ctx cmac_ctx;
+    int ret;
+
+    aes128_init_encrypt(&enc_ctx, keyENC);
+    cmac_init(&cmac_ctx, keyCMAC);
+    ret = auth_wrap(apdu_in, in_len, apdu_out, out_len, &enc_ctx, &cmac_ctx, inout_chaining_value, inout_encryption_counter);
+    secure_wipe(&enc_ctx, sizeof(enc_ctx));
+    secure_wipe(&cmac_ctx, sizeof(cmac_ctx));
+    return ret;
+}
+
+int lib_auth_unwrap(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrapped_apdu_out, uint32_t* out_len, uint8_t* keyENC, uint8_t* keyRMAC, uint8_t* chaining_value, uint8_t* encryption_counter)
+{
+    struct aes128_ctx enc_ctx;
+    struct cmac_ctx rmac_ctx;
+    int ret;
+
+    aes128_init(&enc_ctx, keyENC);
+    cmac_init(&rmac_ctx, keyRMAC);
+    ret = auth_unwrap(wrapped_apdu_in, in_len, unwrapped_apdu_out, out_len, &enc_ctx, &rmac_ctx, chaining_value, encryption_counter);
+    secure_wipe(&enc_ctx, sizeof(enc_ctx));
+    secure_wipe(&rmac_ctx, sizeof(rmac_ctx));
+    return ret;
+}
+
+// Session forms: the caller keeps the keys expanded in "session" from
+// lib_auth_session_open() to lib_auth_session_close()
+void lib_auth_session_open(struct secure_session* session, uint8_t* keyENC, uint8_t* keyCMAC, uint8_t* keyRMAC)
+{
+    secure_session_open(session, keyENC, keyCMAC, keyRMAC);
+}
+
+void lib_auth_session_close(struct secure_session* session)
+{
+    secure_session_close(session);
+}
+
+int lib_auth_wrap_session(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, const struct secure_session* session, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter)
+{
+    return auth_wrap(apdu_in, in_len, apdu_out, out_len, &session->enc, &session->cmac, inout_chaining_value, inout_encryption_counter);
+}
+
+int lib_auth_unwrap_session(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrapped_apdu_out, uint32_t* out_len, const struct secure_session* session, uint8_t* chaining_value, uint8_t* encryption_counter)
+{
+    return auth_unwrap(wrapped_apdu_in, in_len, unwrapped_apdu_out, out_len, &session->enc, &session->rmac, chaining_value, encryption_counter);
+}
+
+// Wraps "count" APDUs of independent sessions, WRAP_BATCH_LANES at a time. Each job gets
+// the result lib_auth_wrap() would have returned; the return value is SUCCESS or the
+// first failing job's result.
+int lib_auth_wrap_batch(struct secure_apdu_job* jobs, uint32_t count)
+{
+    struct secure_apdu_job* lane[WRAP_BATCH_LANES];
+    uint32_t i, n = 0;
+    int ret = SUCCESS;
+
+    for (i = 0; i < count; i++)
+    {
+        struct secure_apdu_job* job = &jobs[i];
+
+        job->out_len = 0;
+        if ((job->apdu_in[0] & 0xF0) == 0x80)
+        {
+            job->apdu_in[0] |= 0x04;
+        }
+        if (job->in_len < 5)
+        {
+            job->result = ERROR_INVALIDPARAMETER;
+            continue;
+        }
+
+        lane[n++] = job;
+        if (n == WRAP_BATCH_LANES)
+        {
+            wrap_batch(lane, n);
+            n = 0;
+        }
+    }
+    if (n > 0) wrap_batch(lane, n);
+
+    for (i = 0; i < count; i++)
+    {
+        if ((ret == SUCCESS) && (jobs[i].result != SUCCESS)) ret = jobs[i].result;
+    }
+    return ret;
+}
+
+// Unwraps "count" responses of independent sessions, WRAP_BATCH_LANES at a time, with the
+// same per-job results as lib_auth_unwrap().
+int lib_auth_unwrap_batch(struct secure_apdu_job* jobs, uint32_t count)
+{
+    struct secure_apdu_job* lane[WRAP_BATCH_LANES];
+    uint32_t i, n = 0;
+    int ret = SUCCESS;
+
+    for (i = 0; i < count; i++)
+    {
+        struct secure_apdu_job* job = &jobs[i];
+
+        if (job->in_len == 2)
+        {
+            memcpy(job->apdu_out, job->apdu_in, job->in_len);
+            job->out_len = job->in_len;
+            job->result = SUCCESS;
+            continue;
+        }
+
+        lane[n++] = job;
+        if (n == WRAP_BATCH_LANES)
+        {
+            unwrap_batch(lane, n);
+            n = 0;
+        }
+    }
+    if (n > 0) unwrap_batch(lane, n);
+
+    for (i = 0; i < count; i++)
+    {
+        if ((ret == SUCCESS) && (jobs[i].result != SUCCESS)) ret = jobs[i].result;
+    }
+    return ret;
+}
+
 ////--------------------------------------------------------------------------------------------------------------------------------------------------------
 //int lib_auth_wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len)
 //{
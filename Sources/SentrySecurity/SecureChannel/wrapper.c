@@ -94,7 +94,46 @@ void buffer_increment(uint8_t* encryption_counter)
 }
 
 //-----------------------------------------------------------------------------------------------------------
-void wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t*out_len, uint8_t *key_enc, uint8_t* key_cmac, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter)
+// Expands the session keys once; every wrap() / unwrap() of the session then only runs its
+// data blocks through AES.
+void secure_session_open(struct secure_session* session, const uint8_t* key_enc, const uint8_t* key_cmac, const uint8_t* key_rmac)
+{
+    aes128_init(&session->enc, key_enc);
+    cmac_init(&session->cmac, key_cmac);
+    cmac_init(&session->rmac, key_rmac);
+}
+
+void secure_session_close(struct secure_session* session)
+{
+    secure_wipe(session, sizeof(*session));
+}
+
+// Clears key material through a volatile pointer so the stores are not dropped as dead
+void secure_wipe(void* data, size_t len)
+{
+    volatile uint8_t* p = (volatile uint8_t*)data;
+
+    while (len-- > 0) *p++ = 0;
+}
+
+// Length of the data in a decrypted response, or -1 when the ISO/IEC 9797-1 method 2
+// padding is malformed. The padding (0x80 and up to 15 zero bytes) always lies in the
+// final block, so only that block is scanned.
+static int unpadded_length(const uint8_t* data, int len)
+{
+    int p;
+
+    for (p = len - 1; p >= len - 16; p--)
+    {
+        if (data[p] == 0x00) continue;
+        if (data[p] == 0x80) return p;
+        return -1;
+    }
+    return -1;
+}
+
+//-----------------------------------------------------------------------------------------------------------
+void wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t*out_len, const struct aes128_ctx* enc_ctx, const struct cmac_ctx* cmac_ctx, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter)
 {
     uint8_t cla = apdu_in[0];
     uint8_t ins = apdu_in[1];
@@ -104,9 +143,9 @@ void wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t*out_len
     uint8_t lcenc = 0;
     
     uint8_t aes_buf[300];
-    uint8_t cmac_buf[300];
+    uint8_t header[5];
+    struct cmac_state mac;
     
-    int p = 0;
     int pw = 0;
     
     int le = -1;
@@ -126,36 +165,35 @@ void wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t*out_len
     
     if (lc > 0)
     {
-        uint8_t iv[16];
-        
         memset(aes_buf, 0, 300);
         //pad
         int total = ((lc / 16) + 1) * 16;
         memcpy(aes_buf, apdu_in + 5, lc);
         aes_buf[lc] = 0x80;
-        AES_128(key_enc, inout_encryption_counter, iv);
-        AES_128_CBC_Encrypt(key_enc, aes_buf, aes_buf, total, iv);
         lcenc = (uint8_t)total;
     }
     else
         if (lc == 0) lcenc = lc;
     
-    memset(cmac_buf, 0, 300);
-    
-    p = 0;
-    memcpy(cmac_buf, inout_chaining_value, 16); p += 16;
-    cmac_buf[p] = cla; p++;
-    cmac_buf[p] = ins; p++;
-    cmac_buf[p] = p1; p++;
-    cmac_buf[p] = p2; p++;
-    cmac_buf[p] = lcenc + 8; p++;
-    if (lc > 0) 
+    header[0] = cla;
+    header[1] = ins;
+    header[2] = p1;
+    header[3] = p2;
+    header[4] = lcenc + 8;
+
+    // C-MAC over chaining value | header | encrypted data, straight from where they are
+    cmac_start(&mac, cmac_ctx);
+    cmac_update(&mac, inout_chaining_value, 16);
+    cmac_update(&mac, header, 5);
+    if (lc > 0)
     {
-        memcpy(cmac_buf + p, aes_buf, lcenc);
-        p += lcenc;
+        uint8_t iv[16];
+
+        // each ciphertext block goes into the C-MAC chain as soon as it is produced
+        aes128_encrypt(enc_ctx, inout_encryption_counter, iv);
+        cmac_update_cbc_encrypt(&mac, enc_ctx, aes_buf, aes_buf, lcenc, iv);
     }
-    
-    AES_CMAC(key_cmac, cmac_buf, p, inout_chaining_value);
+    cmac_final(&mac, inout_chaining_value);
     
     pw = 0;
     apdu_out[pw] = cla; pw++;
@@ -174,12 +212,12 @@ void wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t*out_len
 
 //-----------------------------------------------------------------------------------------------------------
 // encryption counter most likely has to match the values sent to wrap()
-int unwrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, uint8_t* key_enc, uint8_t* key_rmac, uint8_t* chaining_value, uint8_t* encryption_counter)
+// apdu_out must hold in_len - 8 bytes: the response data is decrypted straight into it
+// before the padding is stripped.
+int unwrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, const struct aes128_ctx* enc_ctx, const struct cmac_ctx* rmac_ctx, uint8_t* chaining_value, uint8_t* encryption_counter)
 {
-    uint8_t aes_buf[300];
-    uint8_t cmac_buf[300];
+    struct cmac_state mac;
     uint8_t tmp_chaining_value[16];
-    int p = 0;
     int pw = 0;
     uint8_t sw1 = apdu_in[in_len - 2];
     uint8_t sw2 = apdu_in[in_len - 1];
@@ -189,41 +227,45 @@ int unwrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_l
     if (in_len < 10) return -1; //not RMAC
 
     lcmac = in_len - 10;
-    memset(cmac_buf, 0, 300);
+    if (in_len > 16 + 8 + 1) lcenc = lcmac;
 
-    p = 0;
-    memcpy(cmac_buf, chaining_value, 16); p += 16;
-    if (lcmac > 0) { memcpy(cmac_buf + p, apdu_in, lcmac); p += lcmac; }
-    cmac_buf[p] = sw1; p++;
-    cmac_buf[p] = sw2; p++;
+    // R-MAC over chaining value | response data | SW1 SW2, read in place from the response.
+    // The chaining value is one block, so encrypted response data starts on a block
+    // boundary of the R-MAC input and each ciphertext block is MACed and decrypted into
+    // apdu_out in the same pass.
+    cmac_start(&mac, rmac_ctx);
+    cmac_update(&mac, chaining_value, 16);
+    if ((lcenc > 0) && ((lcenc % 16) == 0))
+    {
+        uint8_t iv[16];
+        uint8_t ecn_cnt[16];
 
-    AES_CMAC(key_rmac, cmac_buf, p, tmp_chaining_value);
-    if (memcmp(tmp_chaining_value, apdu_in + lcmac, 8) != 0) return -3;
+        memcpy(ecn_cnt, encryption_counter, 16);
+        ecn_cnt[0] = 0x80;
+        aes128_encrypt(enc_ctx, ecn_cnt, iv);
+        cmac_update_cbc_decrypt(&mac, enc_ctx, apdu_in, apdu_out, lcenc, iv);
+    }
+    else
+    {
+        cmac_update(&mac, apdu_in, lcmac);
+    }
+    cmac_update(&mac, apdu_in + in_len - 2, 2);
+    cmac_final(&mac, tmp_chaining_value);
+    if (memcmp(tmp_chaining_value, apdu_in + lcmac, 8) != 0)
+    {
+        // do not hand out plaintext of a response that failed authentication
+        if ((lcenc % 16) == 0) memset(apdu_out, 0, lcenc);
+        return -3;
+    }
 
     out_len[0] = 0;
 
-    if (in_len > 16 + 8 + 1)
+    if (lcenc > 0)
     {
-        uint8_t iv[16];
-        uint8_t ecn_cnt[16];
-
-        lcenc = in_len - 10;
         if ((lcenc % 16) > 0) return -2;
 
-        
-        memcpy(ecn_cnt, encryption_counter, 16);
-        ecn_cnt[0] = 0x80;
-        memset(aes_buf, 0x88, 300);
-        memcpy(aes_buf, apdu_in, lcenc);
-        AES_128(key_enc, ecn_cnt, iv);
-        AES_128_CBC_Decrypt(key_enc, aes_buf, aes_buf, lcenc, iv);
-        for (p = lcenc - 1; p > 0; p--)
-        {
-            if (aes_buf[p] == 0x00) continue;
-            if (aes_buf[p] == 0x80) break;
-            return -3;
-        }
-        memcpy(apdu_out, aes_buf, p); pw = p;
+        pw = unpadded_length(apdu_out, lcenc);
+        if (pw < 0) return -3;
     }
 
     apdu_out[pw++] = sw1;
@@ -233,3 +275,188 @@ int unwrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_l
 
 }
 //-----------------------------------------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------------------------------------
+// Same as wrap() for up to WRAP_BATCH_LANES APDUs of independent sessions. The counter IVs,
+// the CBC encryptions and the C-MAC chains of all APDUs go through the AES engine side by
+// side, one block per session per step. Ciphertext is produced in place in apdu_out.
+void wrap_batch(struct secure_apdu_job* const* job, uint32_t n)
+{
+    struct aes128_ctx enc_ctx[WRAP_BATCH_LANES];
+    struct cmac_ctx mac_ctx[WRAP_BATCH_LANES];
+    const struct aes128_ctx* enc[WRAP_BATCH_LANES];
+    struct cmac_ctx* mac_init[WRAP_BATCH_LANES];
+    const struct cmac_ctx* mac[WRAP_BATCH_LANES];
+    const unsigned char* mac_key[WRAP_BATCH_LANES];
+    const uint8_t* pt[WRAP_BATCH_LANES];
+    uint8_t* ct[WRAP_BATCH_LANES];
+    uint32_t ct_len[WRAP_BATCH_LANES];
+    struct cmac_parts msg[WRAP_BATCH_LANES];
+    uint8_t iv[WRAP_BATCH_LANES * 16];
+    uint8_t tag[WRAP_BATCH_LANES * 16];
+    uint8_t lcenc[WRAP_BATCH_LANES];
+    int le[WRAP_BATCH_LANES];
+    uint32_t i;
+
+    if (n == 0) return;
+
+    for (i = 0; i < n; i++)
+    {
+        uint8_t* in = job[i]->apdu_in;
+        uint8_t* out = job[i]->apdu_out;
+        uint8_t lc = in[4];
+
+        le[i] = -1;
+        if (job[i]->in_len > (uint32_t)(lc + 5)) le[i] = in[job[i]->in_len - 1];
+
+        buffer_increment(job[i]->encryption_counter);
+        memcpy(iv + (i * 16), job[i]->encryption_counter, 16);
+
+        aes128_init_encrypt(&enc_ctx[i], job[i]->key_enc);
+        enc[i] = &enc_ctx[i];
+        mac_init[i] = &mac_ctx[i];
+        mac[i] = &mac_ctx[i];
+        mac_key[i] = job[i]->key_mac;
+
+        // pad straight into the output, behind the header
+        ct_len[i] = 0;
+        lcenc[i] = 0;
+        if (lc > 0)
+        {
+            int total = ((lc / 16) + 1) * 16;
+            memcpy(out + 5, in + 5, lc);
+            out[5 + lc] = 0x80;
+            memset(out + 5 + lc + 1, 0, total - lc - 1);
+            ct_len[i] = total;
+            lcenc[i] = (uint8_t)total;
+        }
+        pt[i] = out + 5;
+        ct[i] = out + 5;
+
+        out[0] = in[0];
+        out[1] = in[1];
+        out[2] = in[2];
+        out[3] = in[3];
+        out[4] = lcenc[i] + 8;
+
+        msg[i].data[0] = job[i]->chaining_value;
+        msg[i].length[0] = 16;
+        msg[i].data[1] = out;
+        msg[i].length[1] = 5 + lcenc[i];
+        msg[i].data[2] = NULL;
+        msg[i].length[2] = 0;
+    }
+
+    aes128_encrypt_lanes(enc, iv, iv, n);
+    aes128_cbc_encrypt_lanes(enc, pt, ct, ct_len, iv, n);
+    cmac_init_lanes(mac_init, mac_key, n);
+    AES_CMAC_lanes(mac, msg, tag, n);
+
+    for (i = 0; i < n; i++)
+    {
+        uint8_t* out = job[i]->apdu_out;
+        uint32_t pw = 5 + lcenc[i];
+
+        memcpy(job[i]->chaining_value, tag + (i * 16), 16);
+        memcpy(out + pw, job[i]->chaining_value, 8);  pw += 8;
+        if (le[i] != -1) out[pw++] = (uint8_t)le[i];
+
+        job[i]->out_len = pw;
+        job[i]->result = 0;
+    }
+}
+
+//-----------------------------------------------------------------------------------------------------------
+// Same as unwrap() for up to WRAP_BATCH_LANES responses of independent sessions. The R-MAC
+// chains run side by side; each verified response is then CBC-decrypted on its own, which
+// the engines already pipeline within a buffer.
+void unwrap_batch(struct secure_apdu_job* const* job, uint32_t n)
+{
+    struct aes128_ctx enc_ctx[WRAP_BATCH_LANES];
+    struct cmac_ctx mac_ctx[WRAP_BATCH_LANES];
+    const struct aes128_ctx* enc[WRAP_BATCH_LANES];
+    struct cmac_ctx* mac_init[WRAP_BATCH_LANES];
+    const struct cmac_ctx* mac[WRAP_BATCH_LANES];
+    const unsigned char* mac_key[WRAP_BATCH_LANES];
+    struct secure_apdu_job* lane_job[WRAP_BATCH_LANES];
+    struct secure_apdu_job* enc_job[WRAP_BATCH_LANES];
+    struct cmac_parts msg[WRAP_BATCH_LANES];
+    uint8_t iv[WRAP_BATCH_LANES * 16];
+    uint8_t tag[WRAP_BATCH_LANES * 16];
+    uint32_t i, m = 0, e = 0;
+
+    for (i = 0; i < n; i++)
+    {
+        uint8_t* in = job[i]->apdu_in;
+        uint32_t in_len = job[i]->in_len;
+
+        job[i]->out_len = 0;
+        if (in_len < 10)
+        {
+            job[i]->result = -1; //not RMAC
+            continue;
+        }
+
+        mac_init[m] = &mac_ctx[m];
+        mac[m] = &mac_ctx[m];
+        mac_key[m] = job[i]->key_mac;
+        msg[m].data[0] = job[i]->chaining_value;
+        msg[m].length[0] = 16;
+        msg[m].data[1] = in;
+        msg[m].length[1] = in_len - 10;
+        msg[m].data[2] = in + in_len - 2;
+        msg[m].length[2] = 2;
+        lane_job[m] = job[i];
+        m++;
+
+        if (in_len > 16 + 8 + 1)
+        {
+            aes128_init(&enc_ctx[e], job[i]->key_enc);
+            enc[e] = &enc_ctx[e];
+            memcpy(iv + (e * 16), job[i]->encryption_counter, 16);
+            iv[e * 16] = 0x80;
+            enc_job[e] = job[i];
+            e++;
+        }
+    }
+
+    if (m == 0) return;
+
+    cmac_init_lanes(mac_init, mac_key, m);
+    AES_CMAC_lanes(mac, msg, tag, m);
+    if (e > 0) aes128_encrypt_lanes(enc, iv, iv, e);
+
+    for (i = 0; i < m; i++)
+    {
+        struct secure_apdu_job* j = lane_job[i];
+        j->result = (memcmp(tag + (i * 16), j->apdu_in + j->in_len - 10, 8) != 0) ? -3 : 0;
+    }
+
+    for (i = 0; i < e; i++)
+    {
+        struct secure_apdu_job* j = enc_job[i];
+        int lcenc = j->in_len - 10;
+        int p;
+
+        if (j->result != 0) continue;
+        if ((lcenc % 16) > 0)
+        {
+            j->result = -2;
+            continue;
+        }
+
+        aes128_cbc_decrypt(enc[i], j->apdu_in, j->apdu_out, lcenc, iv + (i * 16));
+        p = unpadded_length(j->apdu_out, lcenc);
+        if (p < 0) j->result = -3;
+        else j->out_len = p;
+    }
+
+    for (i = 0; i < m; i++)
+    {
+        struct secure_apdu_job* j = lane_job[i];
+
+        if (j->result != 0) continue;
+        j->apdu_out[j->out_len++] = j->apdu_in[j->in_len - 2];
+        j->apdu_out[j->out_len++] = j->apdu_in[j->in_len - 1];
+    }
+}
@@ -1,11 +1,60 @@
 #ifndef __AES_C__
+#define __AES_C__
 
 #include "stdint.h"
 
+// AES engines selectable with aes_set_impl()
+#define AES_IMPL_REFERENCE  1   // byte-matrix FIPS-197 rounds
+#define AES_IMPL_TTABLE     2   // 32-bit combined SubBytes/ShiftRows/MixColumns tables
+#define AES_IMPL_AESNI      3   // x86 AES instructions, only when the CPU reports them
+#define AES_IMPL_BITSLICE   4   // constant-time bitsliced rounds, four blocks per pass
+#define AES_IMPL_VPERM      5   // constant-time SSSE3 vector-permute rounds, one block per pass
+#define AES_IMPL_ARMV8      6   // arm64 AES instructions, only when the CPU reports them
+
+// Until aes_set_impl() is called the engine is picked at first use: AES-NI or the ARMv8
+// AES instructions when the CPU has them, else the vector-permute engine when it has
+// SSSE3, else the bitsliced engine.
+// The table-based engines stay available through aes_set_impl() but leak key bits
+// through cache timing. aes_set_impl() is for tests and benchmarks; it is thread safe,
+// but it changes the engine for every context initialised afterwards in the process.
+
+// Most independent blocks one aes128_encrypt_lanes() call keeps in flight
+#define AES128_MAX_LANES    8
+
+struct aes128_impl;
+
+// Expanded AES-128 key. Build it once per key with aes128_init() (or aes128_init_encrypt()
+// when the key is only used in the forward direction) and reuse it for every block.
+struct aes128_ctx
+{
+    union
+    {
+        uint32_t ek[44];    // encryption round keys, FIPS-197 w[0..43]
+        uint64_t bs[22];    // bitsliced engine: compressed round keys
+    };
+    uint32_t dk[44];    // equivalent inverse cipher round keys, in decryption order
+    const struct aes128_impl* impl;     // engine that expanded the key
+};
+
+int aes_set_impl(uint16_t method);
+uint16_t aes_get_impl(void);
+
+void aes128_init(struct aes128_ctx* ctx, const uint8_t* key);
+void aes128_init_encrypt(struct aes128_ctx* ctx, const uint8_t* key);
+void aes128_encrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out);
+void aes128_decrypt(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out);
+void aes128_cbc_encrypt(const struct aes128_ctx* ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv);
+void aes128_cbc_decrypt(const struct aes128_ctx* ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv);
+
+void aes128_cbc_encrypt_mac(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv, uint8_t* mac, uint8_t* lead, uint32_t lead_len);
+void aes128_cbc_decrypt_mac(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv, uint8_t* mac);
+
+void aes128_encrypt_lanes(const struct aes128_ctx* const* ctx, const uint8_t* in, uint8_t* out, uint32_t n);
+void aes128_cbc_encrypt_lanes(const struct aes128_ctx* const* ctx, const uint8_t* const* plaintext, uint8_t* const* ciphertext, const uint32_t* len, uint8_t* iv, uint32_t n);
+
 void AES_128(uint8_t* key, uint8_t* plaintext, uint8_t* ciphertext);
 void AES_128_CBC_Encrypt(uint8_t* key, uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv);
 void AES_128_CBC_Decrypt(uint8_t* key, uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv);
 
 
 #endif // !__AES_C__
-
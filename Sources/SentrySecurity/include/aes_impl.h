@@ -0,0 +1,51 @@
+#ifndef __AES_IMPL_H__
+#define __AES_IMPL_H__
+
+#include "stdint.h"
+#include "aes.h"
+#include "cpu_features.h"
+
+#define AES_HAVE_AESNI CPU_X86_TARGET_ATTRIBUTES
+#define AES_HAVE_VPERM CPU_X86_TARGET_ATTRIBUTES
+#define AES_HAVE_ARMV8 CPU_ARM64_AES
+
+// Interface every AES-128 engine implements. An engine owns the layout of the round keys
+// it stores in aes128_ctx, so a context must always be used with the engine that expanded
+// it (aes128_init() records it in ctx->impl).
+struct aes128_impl
+{
+    uint16_t method;
+    void (*setkey)(struct aes128_ctx* ctx, const uint8_t* key, int with_decrypt);
+    void (*encrypt)(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out);
+    void (*decrypt)(const struct aes128_ctx* ctx, const uint8_t* in, uint8_t* out);
+    // Optional whole-buffer CBC; NULL falls back to the block loop in aes.c.
+    void (*cbc_encrypt)(const struct aes128_ctx* ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv);
+    void (*cbc_decrypt)(const struct aes128_ctx* ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv);
+    // Optional: one block per lane, each lane with its own key (see aes128_encrypt_lanes()).
+    void (*encrypt_lanes)(const struct aes128_ctx* const* ctx, const uint8_t* in, uint8_t* out, uint32_t n);
+    // Optional CBC encryption interleaved with a CBC-MAC over the ciphertext (see
+    // aes128_cbc_encrypt_mac()); only used when both keys were expanded by this engine.
+    void (*cbc_encrypt_mac)(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* plaintext, uint8_t* ciphertext, uint32_t len, uint8_t* iv, uint8_t* mac, uint8_t* lead, uint32_t lead_len);
+    // Optional CBC decryption interleaved with a CBC-MAC over the ciphertext (see
+    // aes128_cbc_decrypt_mac()); same restriction as cbc_encrypt_mac.
+    void (*cbc_decrypt_mac)(const struct aes128_ctx* ctx, const struct aes128_ctx* mac_ctx, const uint8_t* ciphertext, uint8_t* plaintext, uint32_t len, uint8_t* iv, uint8_t* mac);
+};
+
+// FIPS-197 word schedule shared by the portable engines: ek holds w[0..43], dk the
+// equivalent inverse cipher schedule.
+void aes128_setkey_fips(struct aes128_ctx* ctx, const uint8_t* key, int with_decrypt);
+
+extern const struct aes128_impl aes128_impl_reference;
+extern const struct aes128_impl aes128_impl_ttable;
+extern const struct aes128_impl aes128_impl_bitslice;
+#if AES_HAVE_AESNI
+extern const struct aes128_impl aes128_impl_aesni;
+#endif
+#if AES_HAVE_VPERM
+extern const struct aes128_impl aes128_impl_vperm;
+#endif
+#if AES_HAVE_ARMV8
+extern const struct aes128_impl aes128_impl_armv8;
+#endif
+
+#endif // !__AES_IMPL_H__
@@ -1,8 +1,51 @@
-
 #ifndef __CMAC__
+#define __CMAC__
+
+#include "stdint.h"
+#include "aes.h"
+
+#define CMAC_MAX_PARTS  3
+
+// Message handed to AES_CMAC_lanes() as up to three pieces that are MACed as if they were
+// concatenated, so callers do not need to assemble it in a scratch buffer. Unused pieces
+// have length 0.
+struct cmac_parts
+{
+    const unsigned char* data[CMAC_MAX_PARTS];
+    int length[CMAC_MAX_PARTS];
+};
+
+// AES-CMAC key state: the expanded key and the K1/K2 subkeys. Build it once per key with
+// cmac_init() and reuse it for every message MACed under that key.
+struct cmac_ctx
+{
+    struct aes128_ctx aes;
+    unsigned char K1[16];
+    unsigned char K2[16];
+};
+
+// One message being MACed piece by piece: cmac_start(), any number of cmac_update() calls
+// with arbitrarily sized pieces, then cmac_final(). The result equals AES_CMAC_ctx() over
+// the concatenated pieces.
+struct cmac_state
+{
+    const struct cmac_ctx* ctx;
+    unsigned char X[16];
+    unsigned char buffer[16];
+    int buffered;
+};
 
 //int cmac_test();
+void cmac_init(struct cmac_ctx* ctx, const unsigned char* key);
+void cmac_init_lanes(struct cmac_ctx* const* ctx, const unsigned char* const* key, uint32_t n);
+void cmac_start(struct cmac_state* st, const struct cmac_ctx* ctx);
+void cmac_update(struct cmac_state* st, const unsigned char* data, int length);
+void cmac_final(struct cmac_state* st, unsigned char* mac);
+void cmac_update_cbc_encrypt(struct cmac_state* st, const struct aes128_ctx* enc, const unsigned char* plaintext, unsigned char* ciphertext, uint32_t len, unsigned char* iv);
+void cmac_update_cbc_decrypt(struct cmac_state* st, const struct aes128_ctx* dec, const unsigned char* ciphertext, unsigned char* plaintext, uint32_t len, unsigned char* iv);
+void AES_CMAC_ctx(const struct cmac_ctx* ctx, const unsigned char* input, int length, unsigned char* mac);
 void AES_CMAC(unsigned char* key, unsigned char* input, int length, unsigned char* mac);
+void AES_CMAC_lanes(const struct cmac_ctx* const* ctx, const struct cmac_parts* msg, unsigned char* mac, uint32_t n);
+void AES_CMAC_lanes_chained(const struct cmac_ctx* const* ctx, const struct cmac_parts* msg, unsigned char* mac, uint32_t n);
 
 #endif // !__CMAC__
-
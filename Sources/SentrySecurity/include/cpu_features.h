@@ -0,0 +1,34 @@
+#ifndef __CPU_FEATURES_H__
+#define __CPU_FEATURES_H__
+
+#include "stdint.h"
+
+// Runtime-detected instruction set extensions used to pick accelerated code paths.
+// Probed once on first use; always 0 on targets without a detection routine.
+#define CPU_FEATURE_AESNI   0x00000001      // x86 AES-NI (aesenc/aesdec/aeskeygenassist)
+#define CPU_FEATURE_SSSE3   0x00000002      // x86 SSSE3 (pshufb)
+#define CPU_FEATURE_SHA     0x00000004      // x86 SHA extensions (sha256rnds2/sha1rnds4)
+#define CPU_FEATURE_AVX2    0x00000008      // x86 AVX2, with the OS saving the YMM registers
+#define CPU_FEATURE_BMI2    0x00000010      // x86 BMI2 (mulx)
+#define CPU_FEATURE_ADX     0x00000020      // x86 ADX (adcx/adox)
+#define CPU_FEATURE_ARMV8_AES 0x00000040    // arm64 AES instructions (aese/aesd/aesmc/aesimc)
+
+// Set when the compiler can emit x86 extension code through target attributes, so the
+// accelerated paths are built even if the translation unit is compiled for baseline x86.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define CPU_X86_TARGET_ATTRIBUTES 1
+#else
+#define CPU_X86_TARGET_ATTRIBUTES 0
+#endif
+
+// Set when the compiler targets little-endian arm64 with the AES extension, as it always
+// does for Apple arm64, so the ARMv8 AES paths can be built with the plain NEON intrinsics.
+#if defined(__aarch64__) && !defined(__AARCH64EB__) && (defined(__ARM_FEATURE_AES) || defined(__ARM_FEATURE_CRYPTO))
+#define CPU_ARM64_AES 1
+#else
+#define CPU_ARM64_AES 0
+#endif
+
+uint32_t cpu_features(void);
+
+#endif // !__CPU_FEATURES_H__
@@ -162,7 +162,11 @@ static const struct uECC_Curve_t curve_secp160r1 = {
 #endif
     &x_side_default,
 #if (uECC_OPTIMIZATION_LEVEL > 0)
-    &vli_mmod_fast_secp160r1
+    &vli_mmod_fast_secp160r1,
+#endif
+#if uECC_P256_MONT
+    0,
+    0
 #endif
 };
 
@@ -307,7 +311,11 @@ static const struct uECC_Curve_t curve_secp192r1 = {
 #endif
     &x_side_default,
 #if (uECC_OPTIMIZATION_LEVEL > 0)
-    &vli_mmod_fast_secp192r1
+    &vli_mmod_fast_secp192r1,
+#endif
+#if uECC_P256_MONT
+    0,
+    0
 #endif
 };
 
@@ -442,7 +450,11 @@ static const struct uECC_Curve_t curve_secp224r1 = {
 #endif
     &x_side_default,
 #if (uECC_OPTIMIZATION_LEVEL > 0)
-    &vli_mmod_fast_secp224r1
+    &vli_mmod_fast_secp224r1,
+#endif
+#if uECC_P256_MONT
+    0,
+    0
 #endif
 };
 
@@ -733,6 +745,55 @@ static void vli_mmod_fast_secp224r1(uint64_t *result, uint64_t *product)
 static void vli_mmod_fast_secp256r1(uECC_word_t *result, uECC_word_t *product);
 #endif
 
+#if uECC_P256_MONT
+static void vli_mmod_mont_secp256r1(uECC_word_t *result, uECC_word_t *product);
+
+static const uECC_word_t rr_secp256r1[num_words_secp256r1] = {
+    BYTES_TO_WORDS_8(03, 00, 00, 00, 00, 00, 00, 00),
+    BYTES_TO_WORDS_8(FF, FF, FF, FF, FB, FF, FF, FF),
+    BYTES_TO_WORDS_8(FE, FF, FF, FF, FF, FF, FF, FF),
+    BYTES_TO_WORDS_8(FD, FF, FF, FF, 04, 00, 00, 00)
+};
+
+/* secp256r1 on Montgomery residues x * R mod p (R = 2^256), with G and b in that form.
+   Only EccPoint_mult computes on it; x_side and mod_sqrt work on plain values and are
+   only here to fill the layout. */
+static const struct uECC_Curve_t curve_secp256r1_mont = {
+    num_words_secp256r1,
+    num_bytes_secp256r1,
+    256, /* num_n_bits */
+    { BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF),
+        BYTES_TO_WORDS_8(FF, FF, FF, FF, 00, 00, 00, 00),
+        BYTES_TO_WORDS_8(00, 00, 00, 00, 00, 00, 00, 00),
+        BYTES_TO_WORDS_8(01, 00, 00, 00, FF, FF, FF, FF) },
+    { BYTES_TO_WORDS_8(51, 25, 63, FC, C2, CA, B9, F3),
+        BYTES_TO_WORDS_8(84, 9E, 17, A7, AD, FA, E6, BC),
+        BYTES_TO_WORDS_8(FF, FF, FF, FF, FF, FF, FF, FF),
+        BYTES_TO_WORDS_8(00, 00, 00, 00, FF, FF, FF, FF) },
+    { BYTES_TO_WORDS_8(3C, 14, A9, 18, D4, 30, E7, 79),
+        BYTES_TO_WORDS_8(01, B6, ED, 5F, FC, 95, BA, 75),
+        BYTES_TO_WORDS_8(10, 25, 62, 77, 2B, 73, FB, 79),
+        BYTES_TO_WORDS_8(C6, 55, 37, A5, 76, 5F, 90, 18),
+
+        BYTES_TO_WORDS_8(0A, 56, 95, CE, 57, 53, F2, DD),
+        BYTES_TO_WORDS_8(5C, E4, 19, BA, E4, B8, 4A, 8B),
+        BYTES_TO_WORDS_8(25, F3, 21, DD, 88, 86, E8, D2),
+        BYTES_TO_WORDS_8(85, 5D, 88, 25, 18, FF, 71, 85) },
+    { BYTES_TO_WORDS_8(DF, BD, C4, 29, 62, DF, 9C, D8),
+        BYTES_TO_WORDS_8(90, 30, 84, 78, CD, 05, F0, AC),
+        BYTES_TO_WORDS_8(D6, 2E, 21, F7, AB, 20, A2, E5),
+        BYTES_TO_WORDS_8(34, 48, 87, 04, 1D, 06, 30, DC) },
+    &double_jacobian_default,
+#if uECC_SUPPORT_COMPRESSED_POINT
+    &mod_sqrt_default,
+#endif
+    &x_side_default,
+    &vli_mmod_mont_secp256r1,
+    0,
+    rr_secp256r1
+};
+#endif /* uECC_P256_MONT */
+
 static const struct uECC_Curve_t curve_secp256r1 = {
     num_words_secp256r1,
     num_bytes_secp256r1,
@@ -764,7 +825,11 @@ static const struct uECC_Curve_t curve_secp256r1 = {
 #endif
     &x_side_default,
 #if (uECC_OPTIMIZATION_LEVEL > 0)
-    &vli_mmod_fast_secp256r1
+    &vli_mmod_fast_secp256r1,
+#endif
+#if uECC_P256_MONT
+    &curve_secp256r1_mont,
+    0
 #endif
 };
 
@@ -1055,6 +1120,70 @@ static void vli_mmod_fast_secp256r1(uint64_t *result, uint64_t *product) {
 #endif /* uECC_WORD_SIZE */
 #endif /* (uECC_OPTIMIZATION_LEVEL > 0 && !asm_mmod_fast_secp256r1) */
 
+#if uECC_P256_MONT
+/* Computes result = product / R % curve_p for product < curve_p^2, one word at a time.
+   -1 / curve_p is 1 modulo the word size, so each step adds m * curve_p with m the current
+   low word. Of curve_p = 2^256 - 2^224 + 2^192 + 2^96 - 1 the -1 cancels that word and the
+   rest is a few shifted copies of m, with one real product on 64-bit words. The carry out
+   of the top word is held back a step and added with the next one. */
+#if uECC_WORD_SIZE == 4
+static void vli_mmod_mont_secp256r1(uint32_t *result, uint32_t *product) {
+    uint32_t m;
+    uint32_t carry = 0;
+    uint64_t acc;
+    wordcount_t i;
+
+    for (i = 0; i < num_words_secp256r1; ++i) {
+        m = product[i];
+        /* m * 2^96 - m leaves words i + 1 and i + 2 alone */
+        acc = (uint64_t)product[i + 3] + m;
+        product[i + 3] = (uint32_t)acc;
+        acc = (acc >> 32) + product[i + 4];
+        product[i + 4] = (uint32_t)acc;
+        acc = (acc >> 32) + product[i + 5];
+        product[i + 5] = (uint32_t)acc;
+        acc = (acc >> 32) + product[i + 6] + m;                  /* m * 2^192 */
+        product[i + 6] = (uint32_t)acc;
+        acc = (acc >> 32) + product[i + 7] + (((uint64_t)m << 32) - m); /* m * (2^256 - 2^224) */
+        product[i + 7] = (uint32_t)acc;
+        acc = (acc >> 32) + product[i + 8] + carry;
+        product[i + 8] = (uint32_t)acc;
+        carry = (uint32_t)(acc >> 32);
+    }
+
+    uECC_vli_set(result, product + num_words_secp256r1, num_words_secp256r1);
+    if (carry || uECC_vli_cmp_unsafe(curve_secp256r1.p, result, num_words_secp256r1) != 1) {
+        uECC_vli_sub(result, result, curve_secp256r1.p, num_words_secp256r1);
+    }
+}
+#else
+static void vli_mmod_mont_secp256r1(uint64_t *result, uint64_t *product) {
+    uint64_t m;
+    uint64_t carry = 0;
+    uECC_dword_t acc;
+    wordcount_t i;
+
+    for (i = 0; i < num_words_secp256r1; ++i) {
+        m = product[i];
+        acc = ((uECC_dword_t)m << 32) + product[i + 1];          /* m * 2^96 - m */
+        product[i + 1] = (uint64_t)acc;
+        acc = (acc >> 64) + product[i + 2];
+        product[i + 2] = (uint64_t)acc;
+        acc = (acc >> 64) + (uECC_dword_t)m * 0xffffffff00000001ull + product[i + 3];
+        product[i + 3] = (uint64_t)acc;
+        acc = (acc >> 64) + product[i + 4] + carry;
+        product[i + 4] = (uint64_t)acc;
+        carry = (uint64_t)(acc >> 64);
+    }
+
+    uECC_vli_set(result, product + num_words_secp256r1, num_words_secp256r1);
+    if (carry || uECC_vli_cmp_unsafe(curve_secp256r1.p, result, num_words_secp256r1) != 1) {
+        uECC_vli_sub(result, result, curve_secp256r1.p, num_words_secp256r1);
+    }
+}
+#endif /* uECC_WORD_SIZE */
+#endif /* uECC_P256_MONT */
+
 #endif /* uECC_SUPPORTS_secp256r1 */
 
 #if uECC_SUPPORTS_secp256k1
@@ -1099,7 +1228,11 @@ static const struct uECC_Curve_t curve_secp256k1 = {
 #endif
     &x_side_secp256k1,
 #if (uECC_OPTIMIZATION_LEVEL > 0)
-    &vli_mmod_fast_secp256k1
+    &vli_mmod_fast_secp256k1,
+#endif
+#if uECC_P256_MONT
+    0,
+    0
 #endif
 };
 
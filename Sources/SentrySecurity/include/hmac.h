@@ -0,0 +1,34 @@
+#ifndef __HMAC_H__
+#define __HMAC_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "sha.h"
+
+#define HMAC_SHA256_SIZE    32
+
+// HMAC-SHA256 key state: the SHA-256 states after the key XOR ipad and key XOR opad blocks.
+// Build it once per key with hmac_sha256_init(); every message MACed under the key then
+// starts from copies of them instead of hashing the pads again.
+struct hmac_sha256_ctx
+{
+    struct sha_ctx inner;
+    struct sha_ctx outer;
+};
+
+// One message being MACed piece by piece: hmac_sha256_start(), any number of
+// hmac_sha256_update() calls, then hmac_sha256_final().
+struct hmac_sha256_state
+{
+    const struct hmac_sha256_ctx* ctx;
+    struct sha_ctx inner;
+};
+
+void hmac_sha256_init(struct hmac_sha256_ctx* ctx, const uint8_t* key, size_t key_len);
+void hmac_sha256_start(struct hmac_sha256_state* st, const struct hmac_sha256_ctx* ctx);
+void hmac_sha256_update(struct hmac_sha256_state* st, const uint8_t* data, size_t len);
+void hmac_sha256_final(struct hmac_sha256_state* st, uint8_t* mac);
+void HMAC_SHA256_ctx(const struct hmac_sha256_ctx* ctx, const uint8_t* input, size_t len, uint8_t* mac);
+void HMAC_SHA256(const uint8_t* key, size_t key_len, const uint8_t* input, size_t len, uint8_t* mac);
+
+#endif // !__HMAC_H__
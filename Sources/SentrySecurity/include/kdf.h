@@ -0,0 +1,53 @@
+#ifndef __KDF_H__
+#define __KDF_H__
+
+#include "stdint.h"
+#include "stddef.h"
+#include "cmac.h"
+#include "sha.h"
+#include "hmac.h"
+
+// SCP03 derivation constants (GlobalPlatform Card Specification Amendment D, 4.1.5)
+#define SCP03_DERIVE_CARD_CRYPTOGRAM    0x00
+#define SCP03_DERIVE_HOST_CRYPTOGRAM    0x01
+#define SCP03_DERIVE_CARD_CHALLENGE     0x02
+#define SCP03_DERIVE_S_ENC              0x04
+#define SCP03_DERIVE_S_MAC              0x06
+#define SCP03_DERIVE_S_RMAC             0x07
+
+// Longest output one SCP03 derivation produces (two CMAC blocks, an AES-256 key)
+#define SCP03_KDF_MAX_BITS      256
+
+// Longest output hkdf_expand() can produce (255 HMAC-SHA256 blocks, RFC 5869)
+#define HKDF_SHA256_MAX_LEN     (255 * HMAC_SHA256_SIZE)
+
+// Upper bound on the worker threads scp03_kdf_bulk() starts
+#define KDF_BULK_MAX_THREADS    64
+
+// Throughput of one scp03_kdf_bulk() call
+struct kdf_bulk_stats
+{
+    uint32_t derivations;
+    uint32_t threads;
+    double seconds;
+    double per_second;
+};
+
+// One destination of a KDF output that is split over several buffers
+struct kdf_span
+{
+    uint8_t* out;
+    size_t len;
+};
+
+int scp03_kdf(const struct cmac_ctx* ctx, uint8_t constant, const uint8_t* context, uint32_t context_len, uint8_t* out, uint32_t out_bits);
+int scp03_kdf_bulk(const struct cmac_ctx* ctx, uint8_t constant, const uint8_t* serials, uint32_t serial_len, uint32_t count, uint8_t* keys, uint32_t key_bits, uint32_t threads, struct kdf_bulk_stats* stats);
+
+int x963_kdf(uint16_t method, const uint8_t* z, size_t z_len, const uint8_t* shared_info, size_t info_len, uint8_t* out, size_t out_len);
+int x963_kdf_scatter(uint16_t method, const uint8_t* z, size_t z_len, const uint8_t* shared_info, size_t info_len, const struct kdf_span* out, uint32_t count);
+
+void hkdf_extract(const uint8_t* salt, size_t salt_len, const uint8_t* ikm, size_t ikm_len, uint8_t* prk);
+int hkdf_expand(const uint8_t* prk, size_t prk_len, const uint8_t* info, size_t info_len, uint8_t* okm, size_t okm_len);
+int hkdf(const uint8_t* salt, size_t salt_len, const uint8_t* ikm, size_t ikm_len, const uint8_t* info, size_t info_len, uint8_t* okm, size_t okm_len);
+
+#endif // !__KDF_H__
@@ -1,6 +1,7 @@
 #ifndef __lib_main_header__
 
 #include "stdint.h"
+#include "wrapper.h"
 
 #ifdef _WINDOWS
 #define DllExport   __declspec( dllexport )
@@ -21,8 +22,30 @@ _Export_ int LibCalcSecretKeys(uint8_t* pubKey, uint8_t* shses, uint8_t* private
 
 _Export_ int LibAuthWrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, uint8_t* keyENC, uint8_t* keyCMAC, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter);
 
+// unwrapped_apdu_out must hold at least in_len - 8 bytes (2 for a bare status word): the
+// response data is decrypted into it before the padding is stripped, so it needs room for
+// the padded data plus SW1 SW2 even though out_len ends up smaller. The same applies to
+// LibAuthUnwrapSession and to apdu_out of the LibAuthUnwrapBatch jobs.
 _Export_ int LibAuthUnwrap(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrapped_apdu_out, uint32_t* out_len, uint8_t* keyENC, uint8_t* keyRMAC, uint8_t* chaining_value, uint8_t* encryption_counter);
 
+// Same as LibAuthWrap / LibAuthUnwrap with the session keys expanded once into a
+// caller-owned session by LibAuthSessionOpen; LibAuthSessionClose wipes it when the
+// secure channel ends.
+_Export_ void LibAuthSessionOpen(struct secure_session* session, uint8_t* keyENC, uint8_t* keyCMAC, uint8_t* keyRMAC);
+
+_Export_ void LibAuthSessionClose(struct secure_session* session);
+
+_Export_ int LibAuthWrapSession(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, const struct secure_session* session, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter);
+
+_Export_ int LibAuthUnwrapSession(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrapped_apdu_out, uint32_t* out_len, const struct secure_session* session, uint8_t* chaining_value, uint8_t* encryption_counter);
+
+// Batch forms of LibAuthWrap / LibAuthUnwrap for many independent sessions at once. Every
+// job carries its own APDU, keys (key_mac = C-MAC key for wrap, R-MAC key for unwrap),
+// chaining value and encryption counter; per-job status is returned in job.result.
+_Export_ int LibAuthWrapBatch(struct secure_apdu_job* jobs, uint32_t count);
+
+_Export_ int LibAuthUnwrapBatch(struct secure_apdu_job* jobs, uint32_t count);
+
 #endif // !__lib_main_header__
 
 
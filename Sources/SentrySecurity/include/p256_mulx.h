@@ -0,0 +1,29 @@
+#ifndef _P256_MULX_H_
+#define _P256_MULX_H_
+
+#include "stdint.h"
+#include "cpu_features.h"
+
+// The kernels keep the whole 512-bit product in r8-r15, so they are x86-64 only
+#if CPU_X86_TARGET_ATTRIBUTES && defined(__x86_64__)
+#define P256_HAVE_MULX 1
+#else
+#define P256_HAVE_MULX 0
+#endif
+
+#define P256_MULX_FEATURES (CPU_FEATURE_BMI2 | CPU_FEATURE_ADX)
+
+// P-256 field products on four 64-bit little-endian limbs: result = left * right mod p and
+// result = left^2 mod p, fully reduced. result may alias either input. Only called when
+// cpu_features() reports both BMI2 and ADX.
+#if P256_HAVE_MULX
+void p256_mul_mulx(uint64_t* result, const uint64_t* left, const uint64_t* right);
+void p256_sqr_mulx(uint64_t* result, const uint64_t* left);
+
+// The same on Montgomery residues: result = left * right / 2^256 mod p and left^2 / 2^256
+// mod p, for inputs below p
+void p256_mont_mul_mulx(uint64_t* result, const uint64_t* left, const uint64_t* right);
+void p256_mont_sqr_mulx(uint64_t* result, const uint64_t* left);
+#endif
+
+#endif // !_P256_MULX_H_
@@ -2,24 +2,38 @@
 #define _SHA_H_
 
 #include "stdint.h"
+#include "stddef.h"
 
 
 #define METHOD_SHA1   1
 #define METHOD_SHA256 2
 
+// Block transforms selectable with sha_set_impl(). Until it is called sha_init() picks the
+// fastest one the CPU supports. The vector transforms only exist for SHA-256; SHA-1
+// contexts use the portable transform while one of them is selected.
+#define SHA_IMPL_PORTABLE   1   // C transforms
+#define SHA_IMPL_SHANI      2   // x86 SHA extensions, only when the CPU reports them
+#define SHA_IMPL_AVX2       3   // SHA-256 message schedule in AVX2 registers
+#define SHA_IMPL_SSSE3      4   // SHA-256 message schedule in SSSE3 registers
+
 struct sha_ctx
 {
     uint16_t hashsize;
-    void (*transform)(struct sha_ctx*, uint32_t[]);
+    void (*transform)(uint32_t* state, const uint8_t* data, size_t blocks);
     uint32_t state[8];
     uint8_t data[64];
-    uint32_t datalen;
+    uint64_t datalen;   // bytes hashed so far; the last datalen % 64 of them wait in data
 };
-void SHA256(uint8_t* msg, uint16_t msg_len, uint8_t* digest);
-void SHA1(uint8_t* msg, uint16_t msg_len, uint8_t* digest);
+void SHA256(const uint8_t* msg, size_t msg_len, uint8_t* digest);
+void SHA1(const uint8_t* msg, size_t msg_len, uint8_t* digest);
+
+// sha_set_impl() is for tests and benchmarks; it is thread safe, but it changes the
+// transform of every context initialised afterwards in the process.
+int sha_set_impl(uint16_t method);
+uint16_t sha_get_impl(void);
 
 int  sha_init(struct sha_ctx* ctx, uint16_t method);
-void sha_update(struct sha_ctx* ctx, uint8_t* data, uint16_t len);
+void sha_update(struct sha_ctx* ctx, const uint8_t* data, size_t len);
 void sha_final(struct sha_ctx* ctx, uint8_t* digest);
 
 
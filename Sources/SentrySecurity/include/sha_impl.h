@@ -0,0 +1,58 @@
+#ifndef _SHA_IMPL_H_
+#define _SHA_IMPL_H_
+
+#include "stdint.h"
+#include "stddef.h"
+#include "cpu_features.h"
+
+#define SHA_HAVE_SHANI CPU_X86_TARGET_ATTRIBUTES
+#define SHA_HAVE_VEC CPU_X86_TARGET_ATTRIBUTES
+
+// SHA-256 round constants, shared by every SHA-256 transform
+extern const uint32_t sha256_k[64];
+
+#define SHA_LOAD_BE32(p) (((uint32_t)(p)[0] << 24) | ((uint32_t)(p)[1] << 16) | ((uint32_t)(p)[2] << 8) | (uint32_t)(p)[3])
+
+#define ROTRIGHT(a,b) (((a) >> (b)) | ((a) << (32-(b))))
+
+#define CH(x,y,z) (((x) & (y)) ^ (~(x) & (z)))
+#define MAJ(x,y,z) (((x) & (y)) ^ ((x) & (z)) ^ ((y) & (z)))
+#define EP0(x) (ROTRIGHT(x,2) ^ ROTRIGHT(x,13) ^ ROTRIGHT(x,22))
+#define EP1(x) (ROTRIGHT(x,6) ^ ROTRIGHT(x,11) ^ ROTRIGHT(x,25))
+#define SIG0(x) (ROTRIGHT(x,7) ^ ROTRIGHT(x,18) ^ ((x) >> 3))
+#define SIG1(x) (ROTRIGHT(x,17) ^ ROTRIGHT(x,19) ^ ((x) >> 10))
+
+// One SHA-256 round with wk = K[i] + W[i]. Instead of shifting the eight working variables
+// down every round, the caller rotates the names it passes: after the round h holds the
+// new A and d the new E.
+#define SHA256_ROUND(a,b,c,d,e,f,g,h,wk) do { \
+        uint32_t t1_ = (h) + EP1(e) + CH(e,f,g) + (wk); \
+        (d) += t1_; \
+        (h) = t1_ + EP0(a) + MAJ(a,b,c); \
+    } while (0)
+
+// Rounds i..i+7 on the working variables a..h, which are back in their places afterwards.
+// WK(n) must expand to K[n] + W[n].
+#define SHA256_ROUNDS8(i, WK) \
+    SHA256_ROUND(a,b,c,d,e,f,g,h, WK((i) + 0)); \
+    SHA256_ROUND(h,a,b,c,d,e,f,g, WK((i) + 1)); \
+    SHA256_ROUND(g,h,a,b,c,d,e,f, WK((i) + 2)); \
+    SHA256_ROUND(f,g,h,a,b,c,d,e, WK((i) + 3)); \
+    SHA256_ROUND(e,f,g,h,a,b,c,d, WK((i) + 4)); \
+    SHA256_ROUND(d,e,f,g,h,a,b,c, WK((i) + 5)); \
+    SHA256_ROUND(c,d,e,f,g,h,a,b, WK((i) + 6)); \
+    SHA256_ROUND(b,c,d,e,f,g,h,a, WK((i) + 7))
+
+// Block transforms as stored in sha_ctx.transform: run "blocks" consecutive 64-byte message
+// blocks from "data" (big-endian words, as they appear in the message) through the
+// compression function and add the result into "state".
+#if SHA_HAVE_SHANI
+void sha256_transform_shani(uint32_t* state, const uint8_t* data, size_t blocks);
+void sha1_transform_shani(uint32_t* state, const uint8_t* data, size_t blocks);
+#endif
+#if SHA_HAVE_VEC
+void sha256_transform_ssse3(uint32_t* state, const uint8_t* data, size_t blocks);
+void sha256_transform_avx2(uint32_t* state, const uint8_t* data, size_t blocks);
+#endif
+
+#endif // !_SHA_IMPL_H_
@@ -0,0 +1,52 @@
+#ifndef _SHA_MB_H_
+#define _SHA_MB_H_
+
+#include "stdint.h"
+#include "stddef.h"
+#include "time.h"
+
+#if defined(__APPLE__) || defined(__unix__)
+#include <pthread.h>
+#define SHA256_MB_HAVE_THREADS 1
+#else
+#define SHA256_MB_HAVE_THREADS 0
+#endif
+
+// Most messages one multi-buffer pass hashes side by side
+#define SHA256_MB_MAX_LANES 8
+
+// One message handed to a sha256_mb_queue. "done" is set (under the queue lock) once the
+// digest has been written.
+struct sha256_mb_job
+{
+    const uint8_t* msg;
+    size_t len;
+    uint8_t* digest;
+    int done;
+};
+
+// Collects jobs from concurrent sessions until every lane is filled or the oldest job has
+// waited deadline_us, then hashes them in one multi-buffer pass. Set up with
+// sha256_mb_queue_init(); the fields are private to sha_mb.c.
+struct sha256_mb_queue
+{
+#if SHA256_MB_HAVE_THREADS
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+#endif
+    struct sha256_mb_job* pending[SHA256_MB_MAX_LANES];
+    uint32_t count;
+    uint32_t lanes;
+    uint32_t deadline_us;
+    struct timespec flush_at;
+};
+
+uint32_t sha256_mb_lanes(void);
+void sha256_mb(const uint8_t* const* msg, const size_t* len, uint8_t* const* digest, uint32_t n);
+
+int sha256_mb_queue_init(struct sha256_mb_queue* q, uint32_t deadline_us);
+void sha256_mb_queue_destroy(struct sha256_mb_queue* q);
+void sha256_mb_submit(struct sha256_mb_queue* q, struct sha256_mb_job* job);
+void sha256_mb_queue_flush(struct sha256_mb_queue* q);
+
+#endif // !_SHA_MB_H_
@@ -40,6 +40,23 @@ faster somewhat faster, but increases the code size. */
     #define uECC_SQUARE_FUNC 0
 #endif
 
+/* uECC_P256_MONTGOMERY - If enabled (defined as nonzero), the scalar multiplication ladder for
+secp256r1 keeps its coordinates in Montgomery form and reduces each product word by word,
+converting only when it starts and finishes. Otherwise every product is reduced with the NIST
+fast reduction. Both give the same results; the Montgomery form is faster on the platforms
+measured so far. Only has an effect with uECC_OPTIMIZATION_LEVEL > 0. */
+#ifndef uECC_P256_MONTGOMERY
+    #define uECC_P256_MONTGOMERY 1
+#endif
+
+/* uECC_P256_FIXED_BASE - If enabled (defined as nonzero), key generation and signing on
+secp256r1 multiply the generator with a table of its precomputed multiples instead of the
+scalar multiplication ladder, which is several times faster. The table adds 32 KB of constant
+data (with 64-bit words). */
+#ifndef uECC_P256_FIXED_BASE
+    #define uECC_P256_FIXED_BASE 1
+#endif
+
 /* uECC_VLI_NATIVE_LITTLE_ENDIAN - If enabled (defined as nonzero), this will switch to native
 little-endian format for *all* arrays passed in and out of the public API. This includes public
 and private keys, shared secrets, signatures and message hashes.
@@ -265,41 +282,18 @@ uint16_t uECC_sign(const uint8_t *private_key,
               uECC_Curve curve);
 
 /* uECC_HashContext structure.
-This is used to pass in an arbitrary hash function to uECC_sign_deterministic().
-The structure will be used for multiple hash computations; each time a new hash
-is computed, init_hash() will be called, followed by one or more calls to
+This is used to pass in the hash function for uECC_sign_deterministic(), which runs it as
+HMAC. The structure will be used for multiple hash computations; each time a new hash is
+computed, init_hash() will be called on ctx, followed by one or more calls to
 update_hash(), and finally a call to finish_hash() to produce the resulting hash.
+init_hash() is passed METHOD_SHA1 when result_size is 20 and METHOD_SHA256 otherwise.
 
-The intention is that you will create a structure that includes uECC_HashContext
-followed by any hash-specific data. For example:
-
-typedef struct SHA256_HashContext {
-    uECC_HashContext uECC;
-    SHA256_CTX ctx;
-} SHA256_HashContext;
-
-void init_SHA256(uECC_HashContext *base) {
-    SHA256_HashContext *context = (SHA256_HashContext *)base;
-    SHA256_Init(&context->ctx);
-}
-
-void update_SHA256(uECC_HashContext *base,
-                   const uint8_t *message,
-                   unsigned message_size) {
-    SHA256_HashContext *context = (SHA256_HashContext *)base;
-    SHA256_Update(&context->ctx, message, message_size);
-}
-
-void finish_SHA256(uECC_HashContext *base, uint8_t *hash_result) {
-    SHA256_HashContext *context = (SHA256_HashContext *)base;
-    SHA256_Final(hash_result, &context->ctx);
-}
+uECC_hash_context_sha256() fills the structure in for SHA-256 with sha.h:
 
-... when signing ...
 {
-    uint8_t tmp[32 + 32 + 64];
-    SHA256_HashContext ctx = {{&init_SHA256, &update_SHA256, &finish_SHA256, 64, 32, tmp}};
-    uECC_sign_deterministic(key, message_hash, &ctx.uECC, signature);
+    uECC_HashContext ctx;
+    uECC_hash_context_sha256(&ctx);
+    uECC_sign_deterministic(key, message_hash, 32, &ctx, signature, uECC_secp256r1());
 }
 */
 typedef struct uECC_HashContext {
@@ -331,9 +325,19 @@ Inputs:
 Outputs:
     signature - Will be filled in with the signature value.
 
-Returns 1 if the signature generated successfully, 0 if an error occurred.
+Returns the same as uECC_sign(): 0 if an error occurred.
 */
-
+uint16_t uECC_sign_deterministic(const uint8_t *private_key,
+                            const uint8_t *message_hash,
+                            unsigned hash_size,
+                            uECC_HashContext *hash_context,
+                            uint8_t *signature,
+                            uECC_Curve curve);
+
+/* uECC_hash_context_sha256() function.
+Sets up hash_context for uECC_sign_deterministic() with SHA-256 from sha.h.
+*/
+void uECC_hash_context_sha256(uECC_HashContext *hash_context);
 
 /* uECC_verify() function.
 Verify an ECDSA signature.
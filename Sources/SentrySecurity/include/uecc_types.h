@@ -3,16 +3,53 @@
 #ifndef _UECC_TYPES_H_
 #define _UECC_TYPES_H_
 
+#include "uECC.h"
+
+#ifndef uECC_PLATFORM
+    #if defined(__aarch64__) || defined(_M_ARM64)
+        #define uECC_PLATFORM uECC_arm64
+    #elif defined(__amd64__) || defined(__x86_64__) || defined(_M_X64)
+        #define uECC_PLATFORM uECC_x86_64
+    #elif defined(__i386__) || defined(_M_IX86) || defined(_X86_) || defined(__I86__)
+        #define uECC_PLATFORM uECC_x86
+    #elif defined(__thumb2__) || defined(_M_ARMT)
+        #define uECC_PLATFORM uECC_arm_thumb2
+    #elif defined(__thumb__)
+        #define uECC_PLATFORM uECC_arm_thumb
+    #elif defined(__arm__) || defined(_M_ARM)
+        #define uECC_PLATFORM uECC_arm
+    #else
+        #define uECC_PLATFORM uECC_arch_other
+    #endif
+#endif
 
         #define uECC_ARM_USE_UMAAL 0
-        #define uECC_WORD_SIZE 4
 
+#if defined(__SIZEOF_INT128__)
+        #define SUPPORTS_INT128 1
+#else
         #define SUPPORTS_INT128 0
+#endif
+
+/* 64-bit hosts get 64-bit words when the compiler has a 128-bit integer for the double word
+   products; everything else (and an explicit -DuECC_WORD_SIZE=4) keeps 32-bit words. */
+#ifndef uECC_WORD_SIZE
+    #if ((uECC_PLATFORM == uECC_x86_64) || (uECC_PLATFORM == uECC_arm64)) && SUPPORTS_INT128
+        #define uECC_WORD_SIZE 8
+    #else
+        #define uECC_WORD_SIZE 4
+    #endif
+#endif
+
+#if (uECC_WORD_SIZE != 4) && (uECC_WORD_SIZE != 8)
+    #error "Unsupported value for uECC_WORD_SIZE"
+#endif
 
         typedef int8_t wordcount_t;
         typedef int16_t bitcount_t;
         typedef int8_t cmpresult_t;
 
+#if (uECC_WORD_SIZE == 4)
 
         typedef uint32_t uECC_word_t;
         typedef uint64_t uECC_dword_t;
@@ -22,5 +59,18 @@
         #define uECC_WORD_BITS_SHIFT 5
         #define uECC_WORD_BITS_MASK 0x01F
 
+#else
+
+        typedef uint64_t uECC_word_t;
+#if SUPPORTS_INT128
+        typedef unsigned __int128 uECC_dword_t;
+#endif
+
+        #define HIGH_BIT_SET 0x8000000000000000ull
+        #define uECC_WORD_BITS 64
+        #define uECC_WORD_BITS_SHIFT 6
+        #define uECC_WORD_BITS_MASK 0x03F
+
+#endif /* uECC_WORD_SIZE */
 
 #endif /* _UECC_TYPES_H_ */
@@ -1,9 +1,51 @@
 #ifndef __WRAPPER_C__
+#define __WRAPPER_C__
 #include "stdint.h"
+#include "stddef.h"
+#include "aes.h"
+#include "cmac.h"
 
+// Maximum number of APDUs wrap_batch() / unwrap_batch() process in one call
+#define WRAP_BATCH_LANES    AES128_MAX_LANES
 
-void wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, uint8_t* key_enc, uint8_t* key_cmac, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter);
-int unwrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, uint8_t* key_enc, uint8_t* key_rmac, uint8_t* chaining_value, uint8_t* encryption_counter);
+// One APDU of a batch together with the secure channel state of the session it belongs
+// to. key_mac is the C-MAC key for wrapping and the R-MAC key for unwrapping. out_len and
+// result are filled in by the batch call; apdu_out must not overlap apdu_in.
+struct secure_apdu_job
+{
+    uint8_t* apdu_in;
+    uint32_t in_len;
+    uint8_t* apdu_out;
+    uint32_t out_len;
+    uint8_t* key_enc;
+    uint8_t* key_mac;
+    uint8_t* chaining_value;
+    uint8_t* encryption_counter;
+    int result;
+};
+
+// Expanded keys of one secure channel session. The caller owns it: secure_session_open()
+// once the session keys are derived, secure_session_close() to wipe it when the session
+// ends. Sessions share no state, so any number can run on different threads.
+struct secure_session
+{
+    struct aes128_ctx enc;      // S-ENC, both directions
+    struct cmac_ctx cmac;       // C-MAC key and subkeys
+    struct cmac_ctx rmac;       // R-MAC key and subkeys
+};
+
+void secure_session_open(struct secure_session* session, const uint8_t* key_enc, const uint8_t* key_cmac, const uint8_t* key_rmac);
+void secure_session_close(struct secure_session* session);
+void secure_wipe(void* data, size_t len);
+
+// enc_ctx only needs the encryption schedule for wrap(); unwrap() decrypts with it
+void wrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, const struct aes128_ctx* enc_ctx, const struct cmac_ctx* cmac_ctx, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter);
+// unwrap(): apdu_out must hold at least in_len - 8 bytes. The response data is decrypted
+// into it in place before the padding is stripped; the same holds for unwrap_batch().
+int unwrap(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, const struct aes128_ctx* enc_ctx, const struct cmac_ctx* rmac_ctx, uint8_t* chaining_value, uint8_t* encryption_counter);
+
+void wrap_batch(struct secure_apdu_job* const* job, uint32_t n);
+void unwrap_batch(struct secure_apdu_job* const* job, uint32_t n);
 
 
 #endif // !__WRAPPER_C__
@@ -29,3 +29,37 @@ _Export_ int LibAuthUnwrap(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* u
     int ret = lib_auth_unwrap(wrapped_apdu_in, in_len, unwrapped_apdu_out, out_len, keyENC, keyRMAC, chaining_value, encryption_counter);
     return ret;
 }
+
+_Export_ void LibAuthSessionOpen(struct secure_session* session, uint8_t* keyENC, uint8_t* keyCMAC, uint8_t* keyRMAC)
+{
+    lib_auth_session_open(session, keyENC, keyCMAC, keyRMAC);
+}
+
+_Export_ void LibAuthSessionClose(struct secure_session* session)
+{
+    lib_auth_session_close(session);
+}
+
+_Export_ int LibAuthWrapSession(uint8_t* apdu_in, uint32_t in_len, uint8_t* apdu_out, uint32_t* out_len, const struct secure_session* session, uint8_t* inout_chaining_value, uint8_t* inout_encryption_counter)
+{
+    int ret = lib_auth_wrap_session(apdu_in, in_len, apdu_out, out_len, session, inout_chaining_value, inout_encryption_counter);
+    return ret;
+}
+
+_Export_ int LibAuthUnwrapSession(uint8_t* wrapped_apdu_in, uint32_t in_len, uint8_t* unwrapped_apdu_out, uint32_t* out_len, const struct secure_session* session, uint8_t* chaining_value, uint8_t* encryption_counter)
+{
+    int ret = lib_auth_unwrap_session(wrapped_apdu_in, in_len, unwrapped_apdu_out, out_len, session, chaining_value, encryption_counter);
+    return ret;
+}
+
+_Export_ int LibAuthWrapBatch(struct secure_apdu_job* jobs, uint32_t count)
+{
+    int ret = lib_auth_wrap_batch(jobs, count);
+    return ret;
+}
+
+_Export_ int LibAuthUnwrapBatch(struct secure_apdu_job* jobs, uint32_t count)
+{
+    int ret = lib_auth_unwrap_batch(jobs, count);
+    return ret;
+}
@@ -0,0 +1,227 @@
+//
+//  AESTests.swift
+//  SentrySDKTests
+//
+//  Copyright © 2024 Sentry Enterprises
+//
+
+import XCTest
+import SentrySecurity
+
+/**
+ Known-answer tests for every AES engine the host supports, each selected with `aes_set_impl()`.
+ */
+final class AESTests: XCTestCase {
+    private let engines = [AES_IMPL_REFERENCE, AES_IMPL_TTABLE, AES_IMPL_AESNI, AES_IMPL_BITSLICE, AES_IMPL_VPERM, AES_IMPL_ARMV8].map { UInt16($0) }
+    private var savedEngine: UInt16 = 0
+
+    // SP 800-38A F.1 / F.2
+    private let sp800Key = bytes("2b7e151628aed2a6abf7158809cf4f3c")
+    private let sp800IV = bytes("000102030405060708090a0b0c0d0e0f")
+    private let sp800Plaintext = bytes("""
+        6bc1bee22e409f96e93d7e117393172a ae2d8a571e03ac9c9eb76fac45af8e51
+        30c81c46a35ce411e5fbc1191a0a52ef f69f2445df4f9b17ad2b417be66c3710
+        """)
+
+    override func setUp() {
+        super.setUp()
+        savedEngine = aes_get_impl()
+    }
+
+    override func tearDown() {
+        _ = aes_set_impl(savedEngine)
+        super.tearDown()
+    }
+
+    /**
+     Runs `body` once for every engine the host supports, with that engine selected. The reference and T-table engines run everywhere.
+     */
+    private func forEachEngine(_ body: (UInt16) -> Void) {
+        var tested = 0
+
+        for engine in engines where aes_set_impl(engine) == 1 {
+            body(engine)
+            tested += 1
+        }
+        XCTAssertGreaterThanOrEqual(tested, 2)
+    }
+
+    func testDefaultEngineUsesAESInstructions() {
+        #if arch(arm64)
+        // every arm64 device the package supports has the ARMv8 AES instructions
+        XCTAssertEqual(savedEngine, UInt16(AES_IMPL_ARMV8))
+        #endif
+    }
+
+    func testFIPS197AppendixC1() {
+        let key = bytes("000102030405060708090a0b0c0d0e0f")
+        let plaintext = bytes("00112233445566778899aabbccddeeff")
+        let ciphertext = bytes("69c4e0d86a7b0430d8cdb78070b4c55a")
+
+        forEachEngine { engine in
+            var ctx = aes128_ctx()
+            var out = [UInt8](repeating: 0, count: 16)
+
+            aes128_init(&ctx, key)
+            aes128_encrypt(&ctx, plaintext, &out)
+            XCTAssertEqual(out, ciphertext, "engine \(engine)")
+            aes128_decrypt(&ctx, ciphertext, &out)
+            XCTAssertEqual(out, plaintext, "engine \(engine)")
+
+            var encryptOnly = aes128_ctx()
+            aes128_init_encrypt(&encryptOnly, key)
+            aes128_encrypt(&encryptOnly, plaintext, &out)
+            XCTAssertEqual(out, ciphertext, "engine \(engine)")
+        }
+    }
+
+    func testSP800_38A_ECB() {
+        let ciphertext = bytes("""
+            3ad77bb40d7a3660a89ecaf32466ef97 f5d3d58503b9699de785895a96fdbaaf
+            43b1cd7f598ece23881b00e3ed030688 7b0c785e27e8ad3f8223207104725dd4
+            """)
+
+        forEachEngine { engine in
+            var ctx = aes128_ctx()
+            var block = [UInt8](repeating: 0, count: 16)
+
+            aes128_init(&ctx, sp800Key)
+            for offset in stride(from: 0, to: 64, by: 16) {
+                aes128_encrypt(&ctx, Array(sp800Plaintext[offset..<offset + 16]), &block)
+                XCTAssertEqual(block, Array(ciphertext[offset..<offset + 16]), "engine \(engine) block \(offset / 16)")
+                aes128_decrypt(&ctx, Array(ciphertext[offset..<offset + 16]), &block)
+                XCTAssertEqual(block, Array(sp800Plaintext[offset..<offset + 16]), "engine \(engine) block \(offset / 16)")
+            }
+        }
+    }
+
+    func testSP800_38A_CBC() {
+        let ciphertext = bytes("""
+            7649abac8119b246cee98e9b12e9197d 5086cb9b507219ee95db113a917678b2
+            73bed6b8e3c1743b7116e69e22229516 3ff1caa1681fac09120eca307586e1a7
+            """)
+        let lastBlock = Array(ciphertext[48..<64])
+
+        forEachEngine { engine in
+            var ctx = aes128_ctx()
+            var out = [UInt8](repeating: 0, count: 64)
+            var iv = sp800IV
+
+            aes128_init(&ctx, sp800Key)
+            aes128_cbc_encrypt(&ctx, sp800Plaintext, &out, 64, &iv)
+            XCTAssertEqual(out, ciphertext, "engine \(engine)")
+            XCTAssertEqual(iv, lastBlock, "engine \(engine)")
+
+            iv = sp800IV
+            aes128_cbc_decrypt(&ctx, ciphertext, &out, 64, &iv)
+            XCTAssertEqual(out, sp800Plaintext, "engine \(engine)")
+            XCTAssertEqual(iv, lastBlock, "engine \(engine)")
+        }
+    }
+
+    /**
+     Single-block and multi-block results of the selected engine: ECB encrypt and decrypt block by block, CBC encrypt with the returned IV, and CBC decrypt both out of place and in place.
+     */
+    private func transcript(key: [UInt8], iv: [UInt8], message: [UInt8]) -> [[UInt8]] {
+        var ctx = aes128_ctx()
+        var block = [UInt8](repeating: 0, count: 16)
+        var ecbEncrypted: [UInt8] = []
+        var ecbDecrypted: [UInt8] = []
+
+        aes128_init(&ctx, key)
+        for offset in stride(from: 0, to: message.count, by: 16) {
+            let input = Array(message[offset..<offset + 16])
+            aes128_encrypt(&ctx, input, &block)
+            ecbEncrypted += block
+            aes128_decrypt(&ctx, input, &block)
+            ecbDecrypted += block
+        }
+
+        var cbcIV = iv
+        var cbcEncrypted = [UInt8](repeating: 0, count: message.count)
+        aes128_cbc_encrypt(&ctx, message, &cbcEncrypted, UInt32(message.count), &cbcIV)
+
+        var decryptIV = iv
+        var cbcDecrypted = [UInt8](repeating: 0, count: message.count)
+        aes128_cbc_decrypt(&ctx, message, &cbcDecrypted, UInt32(message.count), &decryptIV)
+
+        var inPlaceIV = iv
+        var inPlace = message
+        inPlace.withUnsafeMutableBufferPointer { buffer in
+            aes128_cbc_decrypt(&ctx, buffer.baseAddress, buffer.baseAddress, UInt32(buffer.count), &inPlaceIV)
+        }
+
+        return [ecbEncrypted, ecbDecrypted, cbcEncrypted, cbcIV, cbcDecrypted, decryptIV, inPlace, inPlaceIV]
+    }
+
+    func testEnginesMatchReference() {
+        var source = TestBytes(seed: 197)
+
+        // 1 to 17 blocks covers every remainder of the four-block bitsliced batches
+        for blocks in 1...17 {
+            let key = source.next(16)
+            let iv = source.next(16)
+            let message = source.next(16 * blocks)
+
+            XCTAssertEqual(aes_set_impl(UInt16(AES_IMPL_REFERENCE)), 1)
+            let expected = transcript(key: key, iv: iv, message: message)
+
+            forEachEngine { engine in
+                XCTAssertEqual(transcript(key: key, iv: iv, message: message), expected, "engine \(engine), \(blocks) blocks")
+            }
+        }
+    }
+
+    func testLanesMatchSingleBlock() {
+        // more lanes than one engine call takes, so the last group is partial
+        let count = 2 * Int(AES128_MAX_LANES) + 3
+        var source = TestBytes(seed: 38)
+        let keys = source.next(16 * count)
+        let blocks = source.next(16 * count)
+        let ivs = source.next(16 * count)
+        // lane i is i blocks long, so lanes drop out one by one
+        let lengths = (0..<count).map { UInt32(16 * $0) }
+        let message = source.next(16 * count * count)
+
+        forEachEngine { engine in
+            let contexts = UnsafeMutablePointer<aes128_ctx>.allocate(capacity: count)
+            contexts.initialize(repeating: aes128_ctx(), count: count)
+            defer { contexts.deallocate() }
+            let lanes: [UnsafePointer<aes128_ctx>?] = (0..<count).map { UnsafePointer(contexts + $0) }
+            var expected = [UInt8](repeating: 0, count: 16 * count)
+            var out = [UInt8](repeating: 0, count: 16 * count)
+
+            for lane in 0..<count {
+                aes128_init(contexts + lane, Array(keys[(16 * lane)..<(16 * lane + 16)]))
+                var block = [UInt8](repeating: 0, count: 16)
+                aes128_encrypt(contexts + lane, Array(blocks[(16 * lane)..<(16 * lane + 16)]), &block)
+                expected.replaceSubrange((16 * lane)..<(16 * lane + 16), with: block)
+            }
+            aes128_encrypt_lanes(lanes, blocks, &out, UInt32(count))
+            XCTAssertEqual(out, expected, "engine \(engine), encrypt lanes")
+
+            var expectedCiphertext: [UInt8] = []
+            var expectedIVs: [UInt8] = []
+            for lane in 0..<count {
+                let plaintext = Array(message[(16 * count * lane)..<(16 * count * lane + Int(lengths[lane]))])
+                var ciphertext = [UInt8](repeating: 0, count: plaintext.count)
+                var iv = Array(ivs[(16 * lane)..<(16 * lane + 16)])
+                aes128_cbc_encrypt(contexts + lane, plaintext, &ciphertext, UInt32(plaintext.count), &iv)
+                expectedCiphertext += ciphertext + [UInt8](repeating: 0, count: 16 * count - plaintext.count)
+                expectedIVs += iv
+            }
+
+            var ciphertext = [UInt8](repeating: 0, count: 16 * count * count)
+            var iv = ivs
+            message.withUnsafeBufferPointer { plaintextBuffer in
+                ciphertext.withUnsafeMutableBufferPointer { ciphertextBuffer in
+                    let plaintexts: [UnsafePointer<UInt8>?] = (0..<count).map { plaintextBuffer.baseAddress! + 16 * count * $0 }
+                    let ciphertexts: [UnsafeMutablePointer<UInt8>?] = (0..<count).map { ciphertextBuffer.baseAddress! + 16 * count * $0 }
+                    aes128_cbc_encrypt_lanes(lanes, plaintexts, ciphertexts, lengths, &iv, UInt32(count))
+                }
+            }
+            XCTAssertEqual(ciphertext, expectedCiphertext, "engine \(engine), CBC lanes")
+            XCTAssertEqual(iv, expectedIVs, "engine \(engine), CBC lanes IV")
+        }
+    }
+}
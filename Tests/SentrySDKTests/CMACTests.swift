@@ -0,0 +1,164 @@
+//
+//  CMACTests.swift
+//  SentrySDKTests
+//
+//  Copyright © 2024 Sentry Enterprises
+//
+
+import XCTest
+import SentrySecurity
+
+/**
+ AES-CMAC and the SCP03 key derivation built on it.
+ */
+final class CMACTests: XCTestCase {
+    // RFC 4493 section 4
+    private let rfcKey = bytes("2b7e151628aed2a6abf7158809cf4f3c")
+    private let rfcMessage = bytes("""
+        6bc1bee22e409f96e93d7e117393172a ae2d8a571e03ac9c9eb76fac45af8e51
+        30c81c46a35ce411e5fbc1191a0a52ef f69f2445df4f9b17ad2b417be66c3710
+        """)
+    private let rfcMACs: [(length: Int, mac: [UInt8])] = [
+        (0, bytes("bb1d6929e95937287fa37d129b756746")),
+        (16, bytes("070a16b46b4d4144f79bdd9dd04a287c")),
+        (40, bytes("dfa66747de9ae63030ca32611497c827")),
+        (64, bytes("51f0bebf7e3b9d92fc49741779363cfe")),
+    ]
+
+    // SCP03 derivation under a fixed master key, with a 24-byte context (host | card challenge)
+    private let masterKey = bytes("404142434445464748494a4b4c4d4e4f")
+    private let derivationContext = bytes("8a9b0c1d2e3f4051 01020304050607080910111213141516")
+
+    func testRFC4493() {
+        var key = rfcKey
+        var message = rfcMessage
+        var ctx = cmac_ctx()
+        var mac = [UInt8](repeating: 0, count: 16)
+
+        cmac_init(&ctx, rfcKey)
+        for vector in rfcMACs {
+            AES_CMAC(&key, &message, Int32(vector.length), &mac)
+            XCTAssertEqual(mac, vector.mac, "AES_CMAC, \(vector.length) bytes")
+
+            AES_CMAC_ctx(&ctx, rfcMessage, Int32(vector.length), &mac)
+            XCTAssertEqual(mac, vector.mac, "AES_CMAC_ctx, \(vector.length) bytes")
+        }
+    }
+
+    func testIncrementalMatchesOneShot() {
+        var ctx = cmac_ctx()
+        var state = cmac_state()
+        var mac = [UInt8](repeating: 0, count: 16)
+
+        cmac_init(&ctx, rfcKey)
+        for vector in rfcMACs {
+            // every split point, so pieces straddle and end on block boundaries
+            for split in 0...vector.length {
+                cmac_start(&state, &ctx)
+                cmac_update(&state, Array(rfcMessage[0..<split]), Int32(split))
+                cmac_update(&state, Array(rfcMessage[split..<vector.length]), Int32(vector.length - split))
+                cmac_final(&state, &mac)
+                XCTAssertEqual(mac, vector.mac, "\(vector.length) bytes split at \(split)")
+            }
+        }
+    }
+
+    func testSCP03Derivation() {
+        let vectors: [(constant: Int32, bits: UInt32, key: [UInt8])] = [
+            (SCP03_DERIVE_S_ENC, 128, bytes("b44cfca456561ad371c090eb37eab441")),
+            (SCP03_DERIVE_S_MAC, 128, bytes("fe0c0ef6aa859d0e6a0a8346bcc53917")),
+            (SCP03_DERIVE_S_RMAC, 128, bytes("30e5e816e9ec319fc67870af4549e613")),
+            (SCP03_DERIVE_S_ENC, 256, bytes("2c4dd71573a7cee4e227187d1d3ab852 1bd5e4e3d30056dc7df701af0b49412c")),
+            (SCP03_DERIVE_CARD_CRYPTOGRAM, 64, bytes("5c4c5840b5339a80")),
+        ]
+        var ctx = cmac_ctx()
+
+        cmac_init(&ctx, masterKey)
+        for vector in vectors {
+            var out = [UInt8](repeating: 0, count: Int(vector.bits / 8))
+            XCTAssertEqual(scp03_kdf(&ctx, UInt8(vector.constant), derivationContext, UInt32(derivationContext.count), &out, vector.bits), 0)
+            XCTAssertEqual(out, vector.key, "constant \(vector.constant), \(vector.bits) bits")
+        }
+
+        var out = [UInt8](repeating: 0, count: 64)
+        XCTAssertEqual(scp03_kdf(&ctx, UInt8(SCP03_DERIVE_S_ENC), derivationContext, UInt32(derivationContext.count), &out, 0), -1)
+        XCTAssertEqual(scp03_kdf(&ctx, UInt8(SCP03_DERIVE_S_ENC), derivationContext, UInt32(derivationContext.count), &out, 260), -1)
+        XCTAssertEqual(scp03_kdf(&ctx, UInt8(SCP03_DERIVE_S_ENC), derivationContext, UInt32(derivationContext.count), &out, 12), -1)
+    }
+
+    func testBulkMatchesSingleDerivation() {
+        let serialLength = 10
+        // enough serials for three worker threads (scp03_kdf_bulk() gives each at least 1024)
+        let count = 3 * 1024 + 37
+        var source = TestBytes(seed: 108)
+        let serials = source.next(serialLength * count)
+        var ctx = cmac_ctx()
+
+        cmac_init(&ctx, masterKey)
+        for bits: UInt32 in [128, 256] {
+            let keyLength = Int(bits / 8)
+            var expected: [UInt8] = []
+            var key = [UInt8](repeating: 0, count: keyLength)
+
+            for index in 0..<count {
+                let serial = Array(serials[(index * serialLength)..<((index + 1) * serialLength)])
+                XCTAssertEqual(scp03_kdf(&ctx, UInt8(SCP03_DERIVE_S_MAC), serial, UInt32(serialLength), &key, bits), 0)
+                expected += key
+            }
+
+            // 0 starts one thread per core; 3 splits the serials into uneven slices
+            for threads: UInt32 in [0, 1, 3] {
+                var keys = [UInt8](repeating: 0, count: keyLength * count)
+                var stats = kdf_bulk_stats()
+                XCTAssertEqual(scp03_kdf_bulk(&ctx, UInt8(SCP03_DERIVE_S_MAC), serials, UInt32(serialLength), UInt32(count), &keys, bits, threads, &stats), 0)
+                XCTAssertEqual(keys, expected, "\(bits) bits, \(threads) threads")
+                XCTAssertEqual(stats.derivations, UInt32(count))
+                if threads == 3 {
+                    XCTAssertEqual(stats.threads, 3)
+                }
+            }
+        }
+    }
+
+    func testLanesMatchSingleMessage() {
+        // more lanes than one engine call takes, so the last group is partial
+        let count = 2 * Int(AES128_MAX_LANES) + 3
+        var source = TestBytes(seed: 4493)
+        let keys = source.next(16 * count)
+        // lane i is 5 * i bytes long: empty, partial and complete last blocks, lanes ending at different steps
+        let lengths = (0..<count).map { 5 * $0 }
+        let message = source.next(lengths.reduce(0, +))
+        let offsets = lengths.indices.map { lengths[0..<$0].reduce(0, +) }
+
+        var expected: [UInt8] = []
+        var ctx = cmac_ctx()
+        var mac = [UInt8](repeating: 0, count: 16)
+        for lane in 0..<count {
+            cmac_init(&ctx, Array(keys[(16 * lane)..<(16 * lane + 16)]))
+            AES_CMAC_ctx(&ctx, Array(message[offsets[lane]..<(offsets[lane] + lengths[lane])]), Int32(lengths[lane]), &mac)
+            expected += mac
+        }
+
+        let contexts = UnsafeMutablePointer<cmac_ctx>.allocate(capacity: count)
+        contexts.initialize(repeating: cmac_ctx(), count: count)
+        defer { contexts.deallocate() }
+        var macs = [UInt8](repeating: 0, count: 16 * count)
+
+        keys.withUnsafeBufferPointer { keyBuffer in
+            let keyPointers: [UnsafePointer<UInt8>?] = (0..<count).map { keyBuffer.baseAddress! + 16 * $0 }
+            let initContexts: [UnsafeMutablePointer<cmac_ctx>?] = (0..<count).map { contexts + $0 }
+            cmac_init_lanes(initContexts, keyPointers, UInt32(count))
+        }
+        message.withUnsafeBufferPointer { messageBuffer in
+            let lanes: [UnsafePointer<cmac_ctx>?] = (0..<count).map { UnsafePointer(contexts + $0) }
+            // each message in two pieces, split in the middle
+            let parts: [cmac_parts] = (0..<count).map { lane in
+                let start = messageBuffer.baseAddress! + offsets[lane]
+                let half = lengths[lane] / 2
+                return cmac_parts(data: (start, start + half, nil), length: (Int32(half), Int32(lengths[lane] - half), 0))
+            }
+            AES_CMAC_lanes(lanes, parts, &macs, UInt32(count))
+        }
+        XCTAssertEqual(macs, expected)
+    }
+}
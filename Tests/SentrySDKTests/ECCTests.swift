@@ -0,0 +1,322 @@
+//
+//  ECCTests.swift
+//  SentrySDKTests
+//
+//  Copyright © 2024 Sentry Enterprises
+//
+
+import XCTest
+import SentrySecurity
+
+// uECC takes a plain C function pointer, so the fixed RNG reads its bytes from here
+private var fixedSource = TestBytes(seed: 21)
+
+private let fixedRNG: uECC_RNG_Function = { dest, size in
+    let values = fixedSource.next(Int(size))
+
+    for (index, value) in values.enumerated() {
+        dest![index] = value
+    }
+    return 1
+}
+
+/**
+ P-256 key generation, ECDH and ECDSA, and the modular inverse and point multiplication under them, all through the public API. The expected values were produced by both the 64-bit and the `uECC_WORD_SIZE=4` builds, and checked against an independent implementation.
+ */
+final class ECCTests: XCTestCase {
+    private var savedRNG: uECC_RNG_Function?
+
+    // RFC 6979 appendix A.2.5
+    private let rfcPrivateKey = bytes("c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721")
+    private let rfcPublicKey = bytes("""
+        60fed4ba255a9d31c961eb74c6356d68c049b8923b61fa6ce669622e60f29fb6
+        7903fe1008b8bc99a41ae9e95628bc64f2f1b20c2d7e9f5177a3c294d4462299
+        """)
+    private let rfcSignatures: [(message: String, signature: [UInt8])] = [
+        ("sample", bytes("""
+            efd48b2aacb6a8fd1140dd9cd45e81d69d2c877b56aaf991c34d0ea84eaf3716
+            f7cb1c942d657c41d436c7a1b6e29f65f3e900dbb9aff4064dc4ab2f843acda8
+            """)),
+        ("test", bytes("""
+            f1abb023518351cd71d881567b1ea663ed3efcf6c5132b354f28d3b0b7d38367
+            019f4113742a2b14bd25926b49c649155f267e60d3814b4c0cc84250e46f0083
+            """)),
+    ]
+
+    // the first two key pairs drawn from TestBytes(seed: 21), and the secret they share
+    private let firstPrivateKey = bytes("f3bad9d6cbbe26e72f536ad47092425ba20af905df9d2edd510d32e5ed543244")
+    private let firstPublicKey = bytes("""
+        ede11f97e541f9323b76b42fd25d00593f71fc63c5370b274495cb8196e3d00a
+        ab6c0ebd38987ed5aa33ce9d4b7934a67127980d9e6880e8a1410686aec5783a
+        """)
+    private let secondPrivateKey = bytes("3ebed349e4288c3abbd15e0486c8884faafad7ee75014b9821b979569697aeba")
+    private let secondPublicKey = bytes("""
+        37e17f0e63964502353937305f164d72d2fa43d32cf81733cc0f3ad57a140773
+        5b51e4cf67ccbda1ef50fe50e5d97895c2113e5db85158fd4ad3cc742f59763a
+        """)
+    private let sharedSecret = bytes("dab2cce5fba38656a5a72bbb8071d8f248924b4ea5ed232bc0fa25e27e3848a7")
+
+    // Signatures by the RFC 6979 key whose s is 1, 2, n - 1, n - 2, 2^255, n - 2^64 and an arbitrary high-bit
+    // value, each with the hash that makes it valid. uECC_verify() inverts s mod n, so these reach the edge inputs
+    // of uECC_vli_modInv(); the binary GCD that 32-bit builds still use accepts the same signatures.
+    private let edgeSignatures: [(hash: [UInt8], signature: [UInt8])] = [
+        (bytes("b35d50b76f8234c8a45932b39615bd3799a3b3b0fda0c4335140f1555dd69b09"),
+         bytes("""
+            eee5c265483e164c9142c3b5512af0d5228c08010fa58f7cd500f0d838ba970b
+            0000000000000000000000000000000000000000000000000000000000000001
+            """)),
+        (bytes("c094ff19a177af14e6212f2de3544dfe4e2877c274165fdeb3ed53b5c145905a"),
+         bytes("""
+            be9ee19f365fee9d27ac8858a18d4f7527419062e2324938af15e7d234fa23f6
+            0000000000000000000000000000000000000000000000000000000000000002
+            """)),
+        (bytes("17be64afa3002c0cf1a95d979f4e0829e6cd9b848ef7bf0c8c1ba5e558ebc4e2"),
+         bytes("""
+            c0e7d9113804af675d9141ab1d6c3b0fba10423c76a2e01e99916bca4d7e3431
+            ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632550
+            """)),
+        (bytes("bd4773568ef65763bb1148ba8df7d34fcfe77ff025b6ce793b57497492e2de3c"),
+         bytes("""
+            090c48c1c959a8469b912b89f0e3bd36fa559e1574d93051341caf4200294caf
+            ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc63254f
+            """)),
+        (bytes("f2303e1952db0d0c850390c3059b075b844865ea18b584340f6dc302a83f7f62"),
+         bytes("""
+            3a4c5ebf3d13b430708529b408a177fc2f9107d070b8a84a46f71c93994f92dd
+            8000000000000000000000000000000000000000000000000000000000000000
+            """)),
+        (bytes("4ec35b7ac28014fd580862aac7aae335afecd9375c16d4cbdf55a826c45522d3"),
+         bytes("""
+            b3b63b692a8b23041be948fa25ac6f7d8e8d9b8c344de63ca7620faf77591192
+            ffffffff00000000ffffffffffffffffbce6faada7179e83f3b9cac2fc632551
+            """)),
+        (bytes("83c929cc7ae080c92993bb63523dd0d5ce4327c860ba573d02b1cf5a05927dc3"),
+         bytes("""
+            a5d9f99501d53e7899a1b62092d08f34376f63a900b4d3cce24956c2b50ff8d3
+            c0ffee0123456789abcdef0011223344556677889900aabbccddeeff13579bdf
+            """)),
+    ]
+
+    override func setUp() {
+        super.setUp()
+        savedRNG = uECC_get_rng()
+    }
+
+    override func tearDown() {
+        uECC_set_rng(savedRNG)
+        super.tearDown()
+    }
+
+    private func sha256(_ message: String) -> [UInt8] {
+        let data = Array(message.utf8)
+        var digest = [UInt8](repeating: 0, count: 32)
+
+        SHA256(data, data.count, &digest)
+        return digest
+    }
+
+    func testKeyGenerationFromFixedRNG() {
+        var privateKey = [UInt8](repeating: 0, count: 32)
+        var publicKey = [UInt8](repeating: 0, count: 64)
+
+        fixedSource = TestBytes(seed: 21)
+        uECC_set_rng(fixedRNG)
+
+        XCTAssertEqual(uECC_make_key(&publicKey, &privateKey, uECC_secp256r1()), 1)
+        XCTAssertEqual(privateKey, firstPrivateKey)
+        XCTAssertEqual(publicKey, firstPublicKey)
+
+        XCTAssertEqual(uECC_make_key(&publicKey, &privateKey, uECC_secp256r1()), 1)
+        XCTAssertEqual(privateKey, secondPrivateKey)
+        XCTAssertEqual(publicKey, secondPublicKey)
+    }
+
+    func testComputePublicKey() {
+        var publicKey = [UInt8](repeating: 0, count: 64)
+
+        XCTAssertEqual(uECC_compute_public_key(rfcPrivateKey, &publicKey, uECC_secp256r1()), 1)
+        XCTAssertEqual(publicKey, rfcPublicKey)
+        XCTAssertEqual(uECC_valid_public_key(publicKey, uECC_secp256r1()), 1)
+    }
+
+    func testSharedSecret() {
+        var first = [UInt8](repeating: 0, count: 32)
+        var second = [UInt8](repeating: 0, count: 32)
+
+        XCTAssertEqual(uECC_shared_secret(secondPublicKey, firstPrivateKey, &first, uECC_secp256r1()), 1)
+        XCTAssertEqual(uECC_shared_secret(firstPublicKey, secondPrivateKey, &second, uECC_secp256r1()), 1)
+        XCTAssertEqual(first, sharedSecret)
+        XCTAssertEqual(second, sharedSecret)
+    }
+
+    func testSignDeterministic() {
+        var context = uECC_HashContext()
+        uECC_hash_context_sha256(&context)
+
+        for vector in rfcSignatures {
+            let hash = sha256(vector.message)
+            var signature = [UInt8](repeating: 0, count: 64)
+
+            // the recovery id is 27 or 28, from the parity of R.y
+            let recovery = uECC_sign_deterministic(rfcPrivateKey, hash, UInt32(hash.count), &context, &signature, uECC_secp256r1())
+            XCTAssertTrue(recovery == 27 || recovery == 28, "\"\(vector.message)\"")
+            XCTAssertEqual(signature, vector.signature, "\"\(vector.message)\"")
+            XCTAssertEqual(uECC_verify(rfcPublicKey, hash, UInt32(hash.count), signature, uECC_secp256r1()), 1, "\"\(vector.message)\"")
+        }
+    }
+
+    func testVerify() {
+        let hash = sha256("sample")
+        var signature = rfcSignatures[0].signature
+
+        XCTAssertEqual(uECC_verify(rfcPublicKey, hash, UInt32(hash.count), signature, uECC_secp256r1()), 1)
+
+        // another message, another key, and a flipped bit in r and in s
+        let otherHash = sha256("test")
+        XCTAssertEqual(uECC_verify(rfcPublicKey, otherHash, UInt32(otherHash.count), signature, uECC_secp256r1()), 0)
+        XCTAssertEqual(uECC_verify(firstPublicKey, hash, UInt32(hash.count), signature, uECC_secp256r1()), 0)
+
+        signature[5] ^= 0x01
+        XCTAssertEqual(uECC_verify(rfcPublicKey, hash, UInt32(hash.count), signature, uECC_secp256r1()), 0)
+        signature[5] ^= 0x01
+        signature[40] ^= 0x01
+        XCTAssertEqual(uECC_verify(rfcPublicKey, hash, UInt32(hash.count), signature, uECC_secp256r1()), 0)
+    }
+
+    func testSignWithRNGVerifies() {
+        let hash = sha256("sample")
+        var signature = [UInt8](repeating: 0, count: 64)
+
+        fixedSource = TestBytes(seed: 6979)
+        uECC_set_rng(fixedRNG)
+
+        let recovery = uECC_sign(rfcPrivateKey, hash, UInt32(hash.count), &signature, uECC_secp256r1())
+        XCTAssertTrue(recovery == 27 || recovery == 28)
+        XCTAssertEqual(uECC_verify(rfcPublicKey, hash, UInt32(hash.count), signature, uECC_secp256r1()), 1)
+    }
+
+    func testVerifyInvertsEdgeValues() {
+        for vector in edgeSignatures {
+            var hash = vector.hash
+
+            XCTAssertEqual(uECC_verify(rfcPublicKey, hash, UInt32(hash.count), vector.signature, uECC_secp256r1()), 1, "\(vector.signature)")
+            hash[31] ^= 0x01
+            XCTAssertEqual(uECC_verify(rfcPublicKey, hash, UInt32(hash.count), vector.signature, uECC_secp256r1()), 0, "\(vector.signature)")
+        }
+    }
+
+    // generators and group orders from SEC 2
+    private let p256Generator = bytes("""
+        6b17d1f2e12c4247f8bce6e563a440f277037d812deb33a0f4a13945d898c296
+        4fe342e2fe1a7f9b8ee7eb4a7c0f9e162bce33576b315ececbb6406837bf51f5
+        """)
+    private let p256Prime = bytes("ffffffff00000001000000000000000000000000ffffffffffffffffffffffff")
+    private let p256Order = bytes("ffffffff00000000ffffffffffffffffbce6faada7179e84f3b9cac2fc632551")
+    private let k1Generator = bytes("""
+        79be667ef9dcbbac55a06295ce870b07029bfcdb2dce28d959f2815b16f81798
+        483ada7726a3c4655da4fbfc0e1108a8fd17b448a68554199c47d08ffb10d4b8
+        """)
+    private let k1Prime = bytes("fffffffffffffffffffffffffffffffffffffffffffffffffffffffefffffc2f")
+    private let k1Order = bytes("fffffffffffffffffffffffffffffffebaaedce6af48a03bbfd25e8cd0364141")
+
+    /**
+     `value - small` for a big-endian `value` at least as large as `small`.
+     */
+    private func minus(_ value: [UInt8], _ small: UInt8) -> [UInt8] {
+        var result = value
+        var borrow = Int(small)
+
+        for index in result.indices.reversed() where borrow != 0 {
+            let difference = Int(result[index]) - borrow
+            result[index] = UInt8(truncatingIfNeeded: difference)
+            borrow = difference < 0 ? 1 : 0
+        }
+        return result
+    }
+
+    /**
+     The public key of the inverse point: the same x, and y replaced by `prime - y`.
+     */
+    private func negated(_ publicKey: [UInt8], prime: [UInt8]) -> [UInt8] {
+        var y = [UInt8](repeating: 0, count: 32)
+        var borrow = 0
+
+        for index in (0..<32).reversed() {
+            let difference = Int(prime[index]) - Int(publicKey[32 + index]) - borrow
+            y[index] = UInt8(truncatingIfNeeded: difference)
+            borrow = difference < 0 ? 1 : 0
+        }
+        return Array(publicKey[0..<32]) + y
+    }
+
+    private func publicKey(_ scalar: [UInt8], _ curve: uECC_Curve) -> [UInt8] {
+        var publicKey = [UInt8](repeating: 0, count: 64)
+
+        XCTAssertEqual(uECC_compute_public_key(scalar, &publicKey, curve), 1, "\(scalar)")
+        return publicKey
+    }
+
+    private func sharedX(_ publicKey: [UInt8], _ scalar: [UInt8], _ curve: uECC_Curve) -> [UInt8] {
+        var secret = [UInt8](repeating: 0, count: 32)
+
+        XCTAssertEqual(uECC_shared_secret(publicKey, scalar, &secret, curve), 1, "\(scalar)")
+        return secret
+    }
+
+    /**
+     On P-256 `uECC_compute_public_key()` takes the fixed-base table and `uECC_shared_secret()` the generic co-Z ladder,
+     so the x coordinates of the two must agree for every scalar.
+     */
+    func testLadderMatchesTable() {
+        var one = [UInt8](repeating: 0, count: 32)
+        one[31] = 1
+        var two = one
+        two[31] = 2
+        let minusOne = minus(p256Order, 1)
+        let minusTwo = minus(p256Order, 2)
+
+        // 1, n - 1 and n - 2 are where the ladder would meet the point at infinity
+        XCTAssertEqual(publicKey(one, uECC_secp256r1()), p256Generator)
+        XCTAssertEqual(publicKey(minusOne, uECC_secp256r1()), negated(p256Generator, prime: p256Prime))
+        XCTAssertEqual(publicKey(minusTwo, uECC_secp256r1()), negated(publicKey(two, uECC_secp256r1()), prime: p256Prime))
+
+        var source = TestBytes(seed: 256)
+        var scalars = [one, two, minusOne, minusTwo]
+        for _ in 0..<50 {
+            // below 2^255, so below n
+            var scalar = source.next(32)
+            scalar[0] &= 0x7f
+            scalars.append(scalar)
+        }
+
+        for scalar in scalars {
+            XCTAssertEqual(sharedX(p256Generator, scalar, uECC_secp256r1()), Array(publicKey(scalar, uECC_secp256r1())[0..<32]), "\(scalar)")
+        }
+    }
+
+    /**
+     secp256k1 has no table, so key generation goes through the ladder itself.
+     */
+    func testLadderEdgeScalars() {
+        var one = [UInt8](repeating: 0, count: 32)
+        one[31] = 1
+        var two = one
+        two[31] = 2
+
+        let generator = publicKey(one, uECC_secp256k1())
+        XCTAssertEqual(generator, k1Generator)
+        XCTAssertEqual(publicKey(minus(k1Order, 1), uECC_secp256k1()), negated(k1Generator, prime: k1Prime))
+        XCTAssertEqual(publicKey(minus(k1Order, 2), uECC_secp256k1()), negated(publicKey(two, uECC_secp256k1()), prime: k1Prime))
+        XCTAssertEqual(uECC_valid_public_key(publicKey(two, uECC_secp256k1()), uECC_secp256k1()), 1)
+    }
+
+    func testSharedSecretEdgeScalars() {
+        var one = [UInt8](repeating: 0, count: 32)
+        one[31] = 1
+
+        // k and n - k give points with the same x, so both share the peer's own x coordinate
+        for scalar in [one, minus(p256Order, 1)] {
+            XCTAssertEqual(sharedX(firstPublicKey, scalar, uECC_secp256r1()), Array(firstPublicKey[0..<32]), "\(scalar)")
+        }
+    }
+}
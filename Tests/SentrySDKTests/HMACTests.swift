@@ -0,0 +1,107 @@
+//
+//  HMACTests.swift
+//  SentrySDKTests
+//
+//  Copyright © 2024 Sentry Enterprises
+//
+
+import XCTest
+import SentrySecurity
+
+/**
+ HMAC-SHA256 and the HKDF built on it.
+ */
+final class HMACTests: XCTestCase {
+    // RFC 4231 section 4; test case 5 is truncated to 128 bits there
+    private let hmacVectors: [(key: [UInt8], data: [UInt8], mac: [UInt8])] = [
+        ([UInt8](repeating: 0x0b, count: 20), Array("Hi There".utf8),
+         bytes("b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7")),
+        (Array("Jefe".utf8), Array("what do ya want for nothing?".utf8),
+         bytes("5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843")),
+        ([UInt8](repeating: 0xaa, count: 20), [UInt8](repeating: 0xdd, count: 50),
+         bytes("773ea91e36800e46854db8ebd09181a72959098b3ef8c122d9635514ced565fe")),
+        ((1...25).map { UInt8($0) }, [UInt8](repeating: 0xcd, count: 50),
+         bytes("82558a389a443c0ea4cc819899f2083a85f0faa3e578f8077a2e3ff46729665b")),
+        ([UInt8](repeating: 0x0c, count: 20), Array("Test With Truncation".utf8),
+         bytes("a3b6167473100ee06e0c796c2955552b")),
+        ([UInt8](repeating: 0xaa, count: 131), Array("Test Using Larger Than Block-Size Key - Hash Key First".utf8),
+         bytes("60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54")),
+        ([UInt8](repeating: 0xaa, count: 131), Array("This is a test using a larger than block-size key and a larger than block-size data. The key needs to be hashed before being used by the HMAC algorithm.".utf8),
+         bytes("9b09ffa71b942fcb27635fbcd5b0e944bfdc63644f0713938a7f51535c3a35e2")),
+    ]
+
+    // RFC 5869 appendix A.1 to A.3
+    private let hkdfVectors: [(ikm: [UInt8], salt: [UInt8], info: [UInt8], prk: [UInt8], okm: [UInt8])] = [
+        ([UInt8](repeating: 0x0b, count: 22), (0x00...0x0c).map { UInt8($0) }, (0xf0...0xf9).map { UInt8($0) },
+         bytes("077709362c2e32df0ddc3f0dc47bba6390b6c73bb50f9c3122ec844ad7c2b3e5"),
+         bytes("3cb25f25faacd57a90434f64d0362f2a2d2d0a90cf1a5a4c5db02d56ecc4c5bf 34007208d5b887185865")),
+        ((0x00...0x4f).map { UInt8($0) }, (0x60...0xaf).map { UInt8($0) }, (0xb0...0xff).map { UInt8($0) },
+         bytes("06a6b88c5853361a06104c9ceb35b45cef760014904671014a193f40c15fc244"),
+         bytes("""
+            b11e398dc80327a1c8e7f78c596a49344f012eda2d4efad8a050cc4c19afa97c
+            59045a99cac7827271cb41c65e590e09da3275600c2f09b8367793a9aca3db71
+            cc30c58179ec3e87c14c01d5c1f3434f1d87
+            """)),
+        ([UInt8](repeating: 0x0b, count: 22), [], [],
+         bytes("19ef24a32c717b167f33a91d6f648bdf96596776afdb6377ac434c1c293ccb04"),
+         bytes("8da4e775a563c18f715f802a063c5a31b8a11f5c5ee1879ec3454e5f3c738d2d 9d201395faa4b61a96c8")),
+    ]
+
+    func testRFC4231() {
+        for (index, vector) in hmacVectors.enumerated() {
+            var mac = [UInt8](repeating: 0, count: Int(HMAC_SHA256_SIZE))
+            HMAC_SHA256(vector.key, vector.key.count, vector.data, vector.data.count, &mac)
+            XCTAssertEqual(Array(mac[0..<vector.mac.count]), vector.mac, "test case \(index + 1)")
+        }
+    }
+
+    func testPrecomputedPadsMatchOneShot() {
+        for (index, vector) in hmacVectors.enumerated() {
+            var ctx = hmac_sha256_ctx()
+            var state = hmac_sha256_state()
+            var mac = [UInt8](repeating: 0, count: Int(HMAC_SHA256_SIZE))
+
+            hmac_sha256_init(&ctx, vector.key, vector.key.count)
+
+            // the key state is reused: once whole, once in two pieces
+            HMAC_SHA256_ctx(&ctx, vector.data, vector.data.count, &mac)
+            XCTAssertEqual(Array(mac[0..<vector.mac.count]), vector.mac, "test case \(index + 1)")
+
+            let split = vector.data.count / 3
+            hmac_sha256_start(&state, &ctx)
+            hmac_sha256_update(&state, Array(vector.data[0..<split]), split)
+            hmac_sha256_update(&state, Array(vector.data[split...]), vector.data.count - split)
+            hmac_sha256_final(&state, &mac)
+            XCTAssertEqual(Array(mac[0..<vector.mac.count]), vector.mac, "test case \(index + 1), split")
+        }
+    }
+
+    func testRFC5869() {
+        for (index, vector) in hkdfVectors.enumerated() {
+            let length = vector.okm.count
+            var prk = [UInt8](repeating: 0, count: Int(HMAC_SHA256_SIZE))
+            var okm = [UInt8](repeating: 0, count: length)
+
+            hkdf_extract(vector.salt, vector.salt.count, vector.ikm, vector.ikm.count, &prk)
+            XCTAssertEqual(prk, vector.prk, "A.\(index + 1) PRK")
+
+            XCTAssertEqual(hkdf_expand(prk, prk.count, vector.info, vector.info.count, &okm, length), 0)
+            XCTAssertEqual(okm, vector.okm, "A.\(index + 1) expand")
+
+            okm = [UInt8](repeating: 0, count: length)
+            XCTAssertEqual(hkdf(vector.salt, vector.salt.count, vector.ikm, vector.ikm.count, vector.info, vector.info.count, &okm, length), 0)
+            XCTAssertEqual(okm, vector.okm, "A.\(index + 1) hkdf")
+        }
+    }
+
+    func testExpandLengthLimit() {
+        let vector = hkdfVectors[0]
+        // RFC 5869 allows at most 255 hash outputs
+        let maximum = 255 * Int(HMAC_SHA256_SIZE)
+        var okm = [UInt8](repeating: 0, count: maximum + 1)
+
+        XCTAssertEqual(hkdf_expand(vector.prk, vector.prk.count, vector.info, vector.info.count, &okm, maximum), 0)
+        XCTAssertEqual(Array(okm[0..<vector.okm.count]), vector.okm)
+        XCTAssertEqual(hkdf_expand(vector.prk, vector.prk.count, vector.info, vector.info.count, &okm, maximum + 1), -1)
+    }
+}
@@ -0,0 +1,93 @@
+//
+//  KDFTests.swift
+//  SentrySDKTests
+//
+//  Copyright © 2024 Sentry Enterprises
+//
+
+import XCTest
+import SentrySecurity
+
+/**
+ ANSI X9.63 key derivation, contiguous and scattered.
+ */
+final class KDFTests: XCTestCase {
+    private let sha256 = UInt16(METHOD_SHA256)
+    private let sha1 = UInt16(METHOD_SHA1)
+
+    func testX963Vectors() {
+        // NIST CAVS ANSI X9.63 SHA-256, no shared info, 128-bit key
+        let z = bytes("96c05619d56c328ab95fe84b18264b08725b85e33fd34f08")
+        var out = [UInt8](repeating: 0, count: 16)
+        XCTAssertEqual(x963_kdf(sha256, z, z.count, nil, 0, &out, 16), 0)
+        XCTAssertEqual(out, bytes("443024c3dae66b95e6f5670601558f71"))
+
+        // the secure channel's shared info, over several hash blocks (computed independently)
+        let secret = (0x20..<0x40).map { UInt8($0) }
+        let info: [UInt8] = [0x3C, 0x88, 0x10]
+        var long = [UInt8](repeating: 0, count: 77)
+        XCTAssertEqual(x963_kdf(sha256, secret, secret.count, info, info.count, &long, 77), 0)
+        XCTAssertEqual(long, bytes("""
+            938ba76fd42ada87e4740d198534ae25134719ba00e9c6e4e447e22fa4ffe840
+            2d5cd1cc7a38e5eeca1cd84b37058148038fa145eca3c222550796f8de9a2667
+            3c88c9e09127bfaaf375b1b959
+            """))
+
+        var sha1Out = [UInt8](repeating: 0, count: 48)
+        XCTAssertEqual(x963_kdf(sha1, secret, secret.count, info, info.count, &sha1Out, 48), 0)
+        XCTAssertEqual(sha1Out, bytes("""
+            73083392caa007755a7f3fc1cf73c6da139b0c87996318a46e1429fa40b1000c
+            c305b46c329ced8c536d754f273636ba
+            """))
+    }
+
+    /**
+     Runs `x963_kdf_scatter` into spans of the given lengths, each followed by a guard byte, and returns the spans concatenated. Fails the test if a guard byte was overwritten.
+     */
+    private func scatter(_ method: UInt16, _ z: [UInt8], _ info: [UInt8], _ lengths: [Int]) -> [UInt8] {
+        let guardByte: UInt8 = 0xEE
+        var buffer = [UInt8](repeating: guardByte, count: lengths.reduce(0, +) + lengths.count)
+
+        let result: Int32 = buffer.withUnsafeMutableBufferPointer { memory in
+            var offset = 0
+            var spans: [kdf_span] = []
+
+            for length in lengths {
+                spans.append(kdf_span(out: memory.baseAddress! + offset, len: length))
+                offset += length + 1
+            }
+            return x963_kdf_scatter(method, z, z.count, info, info.count, spans, UInt32(spans.count))
+        }
+        XCTAssertEqual(result, 0)
+
+        var joined: [UInt8] = []
+        var offset = 0
+        for length in lengths {
+            joined += buffer[offset..<(offset + length)]
+            XCTAssertEqual(buffer[offset + length], guardByte, "span of \(length) bytes overran")
+            offset += length + 1
+        }
+        return joined
+    }
+
+    func testScatterMatchesContiguous() {
+        var source = TestBytes(seed: 963)
+        // split points that fall inside, on and across hash-output boundaries, including empty spans
+        let layouts: [[Int]] = [[16, 16, 16, 16], [1, 31, 32], [0, 20, 0, 45], [100], [7, 13, 19, 23, 29]]
+
+        // Z shorter than, equal to and longer than a SHA block, where the midstate is reused
+        for zLength in [0, 20, 32, 55, 64, 65, 128, 130] {
+            let z = source.next(zLength)
+            let info = source.next(zLength % 7)
+
+            for method in [sha256, sha1] {
+                for lengths in layouts {
+                    let total = lengths.reduce(0, +)
+                    var expected = [UInt8](repeating: 0, count: total)
+                    XCTAssertEqual(x963_kdf(method, z, z.count, info, info.count, &expected, total), 0)
+                    XCTAssertEqual(scatter(method, z, info, lengths), expected, "method \(method), Z \(zLength) bytes, spans \(lengths)")
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,149 @@
+//
+//  SHATests.swift
+//  SentrySDKTests
+//
+//  Copyright © 2024 Sentry Enterprises
+//
+
+import XCTest
+import SentrySecurity
+
+/**
+ SHA-1 and SHA-256 for every block transform the host supports, each selected with `sha_set_impl()`.
+ */
+final class SHATests: XCTestCase {
+    private let transforms = [SHA_IMPL_PORTABLE, SHA_IMPL_SHANI, SHA_IMPL_AVX2, SHA_IMPL_SSSE3].map { UInt16($0) }
+    private var savedTransform: UInt16 = 0
+
+    // FIPS 180-4 examples: one block, two blocks, and one million "a"
+    private let vectors: [(message: [UInt8], sha1: [UInt8], sha256: [UInt8])] = [
+        ([], bytes("da39a3ee5e6b4b0d3255bfef95601890afd80709"),
+         bytes("e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855")),
+        (Array("abc".utf8), bytes("a9993e364706816aba3e25717850c26c9cd0d89d"),
+         bytes("ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad")),
+        (Array("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq".utf8), bytes("84983e441c3bd26ebaae4aa1f95129e5e54670f1"),
+         bytes("248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1")),
+        ([UInt8](repeating: 0x61, count: 1_000_000), bytes("34aa973cd4c4daa4f61eeb2bdbad27316534016f"),
+         bytes("cdc76e5c9914fb9281a1c7e284d73e67f1809a48a497200e046d39ccc7112cd0")),
+    ]
+
+    override func setUp() {
+        super.setUp()
+        savedTransform = sha_get_impl()
+    }
+
+    override func tearDown() {
+        _ = sha_set_impl(savedTransform)
+        super.tearDown()
+    }
+
+    /**
+     Runs `body` once for every transform the host supports, with that transform selected. The portable transforms run everywhere.
+     */
+    private func forEachTransform(_ body: (UInt16) -> Void) {
+        var tested = 0
+
+        for transform in transforms where sha_set_impl(transform) == 1 {
+            body(transform)
+            tested += 1
+        }
+        XCTAssertGreaterThanOrEqual(tested, 1)
+    }
+
+    /**
+     Hashes `message` through the streaming API in pieces of `piece` bytes.
+     */
+    private func streamed(_ method: Int32, _ message: [UInt8], piece: Int) -> [UInt8] {
+        var ctx = sha_ctx()
+        var digest = [UInt8](repeating: 0, count: method == METHOD_SHA1 ? 20 : 32)
+
+        sha_init(&ctx, UInt16(method))
+        for offset in stride(from: 0, to: message.count, by: piece) {
+            let end = min(offset + piece, message.count)
+            sha_update(&ctx, Array(message[offset..<end]), end - offset)
+        }
+        sha_final(&ctx, &digest)
+        return digest
+    }
+
+    private func oneShot(_ method: Int32, _ message: [UInt8]) -> [UInt8] {
+        var digest = [UInt8](repeating: 0, count: method == METHOD_SHA1 ? 20 : 32)
+
+        if method == METHOD_SHA1 {
+            SHA1(message, message.count, &digest)
+        } else {
+            SHA256(message, message.count, &digest)
+        }
+        return digest
+    }
+
+    func testFIPS180Vectors() {
+        forEachTransform { transform in
+            for vector in vectors {
+                XCTAssertEqual(oneShot(METHOD_SHA1, vector.message), vector.sha1, "transform \(transform), \(vector.message.count) bytes")
+                XCTAssertEqual(oneShot(METHOD_SHA256, vector.message), vector.sha256, "transform \(transform), \(vector.message.count) bytes")
+                XCTAssertEqual(streamed(METHOD_SHA1, vector.message, piece: 999), vector.sha1, "transform \(transform), \(vector.message.count) bytes")
+                XCTAssertEqual(streamed(METHOD_SHA256, vector.message, piece: 999), vector.sha256, "transform \(transform), \(vector.message.count) bytes")
+            }
+        }
+    }
+
+    func testTransformsMatchPortable() {
+        var source = TestBytes(seed: 180)
+        // every length up to three blocks, across the 55/56-byte padding boundary of each
+        let messages = (0...192).map { source.next($0) }
+
+        XCTAssertEqual(sha_set_impl(UInt16(SHA_IMPL_PORTABLE)), 1)
+        let expected = messages.map { (oneShot(METHOD_SHA1, $0), oneShot(METHOD_SHA256, $0)) }
+
+        forEachTransform { transform in
+            for (index, message) in messages.enumerated() {
+                XCTAssertEqual(oneShot(METHOD_SHA1, message), expected[index].0, "transform \(transform), \(message.count) bytes")
+                XCTAssertEqual(oneShot(METHOD_SHA256, message), expected[index].1, "transform \(transform), \(message.count) bytes")
+                XCTAssertEqual(streamed(METHOD_SHA256, message, piece: 7), expected[index].1, "transform \(transform), \(message.count) bytes")
+            }
+        }
+    }
+
+    /**
+     Hashes all `messages` in one `sha256_mb` call.
+     */
+    private func multiBuffer(_ messages: [[UInt8]]) -> [[UInt8]] {
+        let joined = messages.flatMap { $0 }
+        let lengths = messages.map { $0.count }
+        var digests = [UInt8](repeating: 0, count: 32 * messages.count)
+
+        joined.withUnsafeBufferPointer { input in
+            digests.withUnsafeMutableBufferPointer { output in
+                var message: [UnsafePointer<UInt8>?] = []
+                var digest: [UnsafeMutablePointer<UInt8>?] = []
+                var offset = 0
+
+                for (index, length) in lengths.enumerated() {
+                    message.append(input.baseAddress! + offset)
+                    digest.append(output.baseAddress! + (32 * index))
+                    offset += length
+                }
+                sha256_mb(message, lengths, digest, UInt32(lengths.count))
+            }
+        }
+        return stride(from: 0, to: digests.count, by: 32).map { Array(digests[$0..<($0 + 32)]) }
+    }
+
+    func testMultiBufferMatchesSingleBuffer() {
+        var source = TestBytes(seed: 17)
+        // more messages than lanes, with lengths that finish in different passes
+        let messages = (0..<30).map { source.next(($0 * 37) % 300) }
+
+        forEachTransform { transform in
+            let expected = messages.map { oneShot(METHOD_SHA256, $0) }
+            XCTAssertEqual(multiBuffer(messages), expected, "transform \(transform), \(sha256_mb_lanes()) lanes")
+
+            if transform == UInt16(SHA_IMPL_AVX2) {
+                XCTAssertEqual(sha256_mb_lanes(), 8)
+            } else if transform == UInt16(SHA_IMPL_SSSE3) {
+                XCTAssertEqual(sha256_mb_lanes(), 4)
+            }
+        }
+    }
+}
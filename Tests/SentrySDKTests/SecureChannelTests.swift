@@ -0,0 +1,304 @@
+//
+//  SecureChannelTests.swift
+//  SentrySDKTests
+//
+//  Copyright © 2024 Sentry Enterprises
+//
+
+import XCTest
+import SentrySecurity
+
+/**
+ Secure channel wrap/unwrap, checked against a card-side implementation built from the plain AES and AES-CMAC primitives.
+ */
+final class SecureChannelTests: XCTestCase {
+    // MARK: - Private Types
+
+    /// Keys and running state of one secure channel session.
+    private struct Session {
+        var keyENC: [UInt8]
+        var keyCMAC: [UInt8]
+        var keyRMAC: [UInt8]
+        var chainingValue: [UInt8]
+        var encryptionCounter: [UInt8] = .init(repeating: 0, count: 16)
+
+        init(_ source: inout TestBytes) {
+            keyENC = source.next(16)
+            keyCMAC = source.next(16)
+            keyRMAC = source.next(16)
+            chainingValue = source.next(16)
+        }
+    }
+
+    /// Heap copy of a byte array with a stable address, for the pointer fields of `secure_apdu_job`.
+    private final class Buffer {
+        let pointer: UnsafeMutablePointer<UInt8>
+
+        init(_ bytes: [UInt8], capacity: Int = 0) {
+            let count = max(bytes.count, capacity)
+            pointer = .allocate(capacity: count)
+            pointer.initialize(repeating: 0, count: count)
+            for (index, byte) in bytes.enumerated() {
+                pointer[index] = byte
+            }
+        }
+
+        deinit {
+            pointer.deallocate()
+        }
+
+        func bytes(_ count: Int) -> [UInt8] {
+            Array(UnsafeBufferPointer(start: pointer, count: count))
+        }
+    }
+
+    // Command data lengths: empty, around one block, and up to the largest Lc wrap() pads
+    private let commandLengths = [0, 1, 15, 16, 17, 64, 200, 239]
+    private let statusWord: [UInt8] = [0x90, 0x00]
+
+    // MARK: - Card Side
+
+    private func encryptBlock(_ key: [UInt8], _ block: [UInt8]) -> [UInt8] {
+        var key = key
+        var block = block
+        var out = [UInt8](repeating: 0, count: 16)
+
+        AES_128(&key, &block, &out)
+        return out
+    }
+
+    private func cbc(_ key: [UInt8], _ input: [UInt8], iv: [UInt8], encrypt: Bool) -> [UInt8] {
+        let length = UInt32(input.count)
+        var key = key
+        var input = input
+        var iv = iv
+        var out = [UInt8](repeating: 0, count: input.count)
+
+        if encrypt {
+            AES_128_CBC_Encrypt(&key, &input, &out, length, &iv)
+        } else {
+            AES_128_CBC_Decrypt(&key, &input, &out, length, &iv)
+        }
+        return out
+    }
+
+    private func cmac(_ key: [UInt8], _ message: [UInt8]) -> [UInt8] {
+        let length = Int32(message.count)
+        var key = key
+        var message = message
+        var mac = [UInt8](repeating: 0, count: 16)
+
+        AES_CMAC(&key, &message, length, &mac)
+        return mac
+    }
+
+    private func makeCommand(_ data: [UInt8], withLe: Bool) -> [UInt8] {
+        var command: [UInt8] = [0x84, 0xCB, 0x00, 0x00, UInt8(data.count)] + data
+
+        if withLe {
+            command.append(0x00)
+        }
+        return command
+    }
+
+    /**
+     What the card does with a wrapped command: verifies the C-MAC with the chaining value the host held before wrapping and decrypts the data with the incremented counter. Returns the command data and the new chaining value, or `nil` if the C-MAC or the padding is wrong.
+     */
+    private func cardReceive(_ wrapped: [UInt8], session: Session, previousChainingValue: [UInt8]) -> (data: [UInt8], chainingValue: [UInt8])? {
+        let macOffset = 5 + Int(wrapped[4]) - 8
+        let mac = cmac(session.keyCMAC, previousChainingValue + wrapped[0..<macOffset])
+
+        guard Array(wrapped[macOffset..<(macOffset + 8)]) == Array(mac[0..<8]) else { return nil }
+        guard macOffset > 5 else { return ([], mac) }
+
+        let iv = encryptBlock(session.keyENC, session.encryptionCounter)
+        var data = cbc(session.keyENC, Array(wrapped[5..<macOffset]), iv: iv, encrypt: false)
+
+        while data.last == 0x00 {
+            data.removeLast()
+        }
+        guard data.last == 0x80 else { return nil }
+        data.removeLast()
+        return (data, mac)
+    }
+
+    /**
+     What the card sends back: the response data encrypted under the counter with its top byte set to 0x80, then the first 8 bytes of the R-MAC over chaining value | encrypted data | status word.
+     */
+    private func cardRespond(_ data: [UInt8], session: Session) -> [UInt8] {
+        var encrypted: [UInt8] = []
+
+        if !data.isEmpty {
+            var padded = data + [0x80]
+            padded += [UInt8](repeating: 0, count: (16 - (padded.count % 16)) % 16)
+
+            var responseCounter = session.encryptionCounter
+            responseCounter[0] = 0x80
+            encrypted = cbc(session.keyENC, padded, iv: encryptBlock(session.keyENC, responseCounter), encrypt: true)
+        }
+
+        let mac = cmac(session.keyRMAC, session.chainingValue + encrypted + statusWord)
+        return encrypted + mac[0..<8] + statusWord
+    }
+
+    // MARK: - Host Side
+
+    private func hostWrap(_ command: [UInt8], session: inout Session) -> [UInt8] {
+        let length = UInt32(command.count)
+        var command = command
+        var wrapped = [UInt8](repeating: 0, count: 300)
+        var wrappedLength: UInt32 = 0
+
+        XCTAssertEqual(LibAuthWrap(&command, length, &wrapped, &wrappedLength, &session.keyENC, &session.keyCMAC, &session.chainingValue, &session.encryptionCounter), SUCCESS)
+        return Array(wrapped[0..<Int(wrappedLength)])
+    }
+
+    private func hostUnwrap(_ response: [UInt8], session: inout Session) -> (result: Int32, data: [UInt8]) {
+        let length = UInt32(response.count)
+        var response = response
+        var unwrapped = [UInt8](repeating: 0, count: response.count)
+        var unwrappedLength: UInt32 = 0
+
+        let result = LibAuthUnwrap(&response, length, &unwrapped, &unwrappedLength, &session.keyENC, &session.keyRMAC, &session.chainingValue, &session.encryptionCounter)
+        return (result, result == SUCCESS ? Array(unwrapped[0..<Int(unwrappedLength)]) : [])
+    }
+
+    // MARK: - Tests
+
+    func testWrapUnwrapRoundTrip() {
+        var source = TestBytes(seed: 3)
+        var session = Session(&source)
+
+        for (index, length) in commandLengths.enumerated() {
+            let data = source.next(length)
+            let previousChainingValue = session.chainingValue
+            let wrapped = hostWrap(makeCommand(data, withLe: index % 2 == 1), session: &session)
+
+            let received = cardReceive(wrapped, session: session, previousChainingValue: previousChainingValue)
+            XCTAssertEqual(received?.data, data, "command \(index)")
+            XCTAssertEqual(received?.chainingValue, session.chainingValue, "command \(index)")
+            if index % 2 == 1 {
+                XCTAssertEqual(wrapped.last, 0x00, "command \(index) lost its Le")
+            }
+
+            let reply = source.next((index * 37) % 220)
+            var response = cardRespond(reply, session: session)
+            XCTAssertEqual(hostUnwrap(response, session: &session).data, reply + statusWord, "response \(index)")
+
+            // a response that fails the R-MAC check must be rejected
+            response[0] ^= 0x01
+            XCTAssertNotEqual(hostUnwrap(response, session: &session).result, SUCCESS, "response \(index)")
+        }
+    }
+
+    func testSessionMatchesKeyAPI() {
+        var source = TestBytes(seed: 4)
+        var keyed = Session(&source)
+        var expanded = keyed
+        var session = secure_session()
+
+        LibAuthSessionOpen(&session, &expanded.keyENC, &expanded.keyCMAC, &expanded.keyRMAC)
+        for (index, length) in commandLengths.enumerated() {
+            var command = makeCommand(source.next(length), withLe: index % 2 == 0)
+            let commandLength = UInt32(command.count)
+            var wrapped = [UInt8](repeating: 0, count: 300)
+            var wrappedLength: UInt32 = 0
+
+            let expectedWrapped = hostWrap(command, session: &keyed)
+            XCTAssertEqual(LibAuthWrapSession(&command, commandLength, &wrapped, &wrappedLength, &session, &expanded.chainingValue, &expanded.encryptionCounter), SUCCESS)
+            XCTAssertEqual(Array(wrapped[0..<Int(wrappedLength)]), expectedWrapped, "command \(index)")
+
+            var response = cardRespond(source.next(length), session: keyed)
+            let responseLength = UInt32(response.count)
+            var unwrapped = [UInt8](repeating: 0, count: response.count)
+            var unwrappedLength: UInt32 = 0
+
+            let expectedUnwrapped = hostUnwrap(response, session: &keyed)
+            XCTAssertEqual(LibAuthUnwrapSession(&response, responseLength, &unwrapped, &unwrappedLength, &session, &expanded.chainingValue, &expanded.encryptionCounter), expectedUnwrapped.result)
+            XCTAssertEqual(Array(unwrapped[0..<Int(unwrappedLength)]), expectedUnwrapped.data, "response \(index)")
+        }
+
+        LibAuthSessionClose(&session)
+        let wiped = withUnsafeBytes(of: &session) { $0.allSatisfy { $0 == 0 } }
+        XCTAssertTrue(wiped, "LibAuthSessionClose left key material behind")
+    }
+
+    func testBatchMatchesSingleCalls() {
+        // more sessions than WRAP_BATCH_LANES, so the batch is split
+        let count = Int(WRAP_BATCH_LANES) + 3
+        var source = TestBytes(seed: 5)
+        var single = (0..<count).map { _ in Session(&source) }
+        let initial = single
+        let commands = (0..<count).map { makeCommand(source.next(($0 * 23) % 240), withLe: $0 % 2 == 1) }
+
+        // wrap: every job must produce what LibAuthWrap produces for its session
+        let expectedWrapped = (0..<count).map { hostWrap(commands[$0], session: &single[$0]) }
+
+        var buffers: [[Buffer]] = []
+        var jobs: [secure_apdu_job] = []
+        for index in 0..<count {
+            let job = [Buffer(commands[index]), Buffer([], capacity: 300), Buffer(initial[index].keyENC), Buffer(initial[index].keyCMAC), Buffer(initial[index].chainingValue), Buffer(initial[index].encryptionCounter)]
+            buffers.append(job)
+            jobs.append(secure_apdu_job(apdu_in: job[0].pointer, in_len: UInt32(commands[index].count), apdu_out: job[1].pointer, out_len: 0, key_enc: job[2].pointer, key_mac: job[3].pointer, chaining_value: job[4].pointer, encryption_counter: job[5].pointer, result: -1))
+        }
+
+        XCTAssertEqual(LibAuthWrapBatch(&jobs, UInt32(count)), SUCCESS)
+        for index in 0..<count {
+            XCTAssertEqual(jobs[index].result, SUCCESS, "job \(index)")
+            XCTAssertEqual(buffers[index][1].bytes(Int(jobs[index].out_len)), expectedWrapped[index], "job \(index)")
+            XCTAssertEqual(buffers[index][4].bytes(16), single[index].chainingValue, "job \(index)")
+            XCTAssertEqual(buffers[index][5].bytes(16), single[index].encryptionCounter, "job \(index)")
+        }
+
+        // unwrap: one response is tampered with and must fail in the batch just as it does alone
+        let tampered = 2
+        var responses = (0..<count).map { cardRespond(source.next(($0 * 31) % 200), session: single[$0]) }
+        responses[tampered][0] ^= 0x01
+        let expectedUnwrapped = (0..<count).map { hostUnwrap(responses[$0], session: &single[$0]) }
+
+        buffers = []
+        jobs = []
+        for index in 0..<count {
+            let job = [Buffer(responses[index]), Buffer([], capacity: responses[index].count), Buffer(single[index].keyENC), Buffer(single[index].keyRMAC), Buffer(single[index].chainingValue), Buffer(single[index].encryptionCounter)]
+            buffers.append(job)
+            jobs.append(secure_apdu_job(apdu_in: job[0].pointer, in_len: UInt32(responses[index].count), apdu_out: job[1].pointer, out_len: 0, key_enc: job[2].pointer, key_mac: job[3].pointer, chaining_value: job[4].pointer, encryption_counter: job[5].pointer, result: -1))
+        }
+
+        XCTAssertEqual(LibAuthUnwrapBatch(&jobs, UInt32(count)), expectedUnwrapped[tampered].result)
+        for index in 0..<count {
+            XCTAssertEqual(jobs[index].result, expectedUnwrapped[index].result, "job \(index)")
+            if expectedUnwrapped[index].result == SUCCESS {
+                XCTAssertEqual(buffers[index][1].bytes(Int(jobs[index].out_len)), expectedUnwrapped[index].data, "job \(index)")
+            }
+        }
+        XCTAssertNotEqual(expectedUnwrapped[tampered].result, SUCCESS)
+    }
+
+    func testECDHKeyDerivation() {
+        // Expected keys from an independent P-256 ECDH and ANSI X9.63 SHA-256 computation:
+        // Z = ECDH(host key, card key) | shses, shared info 3C 88 10, output KeyRespt | KeyENC | KeyCMAC | KeyRMAC
+        var privateKey = bytes("c9afa9d845ba75166b5c215767b1d6934e50c3db36e89b127b8a622b120f6721")
+        var shses = bytes("000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f")
+        let cardPublicKey = bytes("""
+            1ccbe91c075fc7f4f033bfa248db8fccd3565de94bbfb12f3c59ff46c271bf83
+            ce4014c68811f9a21a1fdb2c0e6113e06db7ca93b7404e78dc7ccd5ca89a4ca9
+            """)
+        let chainingValue = bytes("a0a1a2a3a4a5a6a7a8a9aaabacadaeaf")
+        var response: [UInt8] = [0x5F, 0x49, 0x41, 0x04] + cardPublicKey + [0x86, 0x10] + chainingValue
+        var keyRespt = [UInt8](repeating: 0, count: 16)
+        var keyENC = [UInt8](repeating: 0, count: 16)
+        var keyCMAC = [UInt8](repeating: 0, count: 16)
+        var keyRMAC = [UInt8](repeating: 0, count: 16)
+        var chaining = [UInt8](repeating: 0, count: 16)
+
+        XCTAssertEqual(LibCalcSecretKeys(&response, &shses, &privateKey, &keyRespt, &keyENC, &keyCMAC, &keyRMAC, &chaining), SUCCESS)
+        XCTAssertEqual(keyRespt, bytes("3b1970777a04eb99c8d2377fa6c7443a"))
+        XCTAssertEqual(keyENC, bytes("2b864f98142fcce904dda7a5d2440e86"))
+        XCTAssertEqual(keyCMAC, bytes("c410499d0c6fe6f307f6a91ca175c43d"))
+        XCTAssertEqual(keyRMAC, bytes("5addf9aa07f379c498f7ab53ca4978b5"))
+        XCTAssertEqual(chaining, chainingValue)
+
+        response[68] = 0x87
+        XCTAssertEqual(LibCalcSecretKeys(&response, &shses, &privateKey, &keyRespt, &keyENC, &keyCMAC, &keyRMAC, &chaining), ERROR_CRITERION)
+    }
+}
@@ -0,0 +1,42 @@
+//
+//  TestVectors.swift
+//  SentrySDKTests
+//
+//  Copyright © 2024 Sentry Enterprises
+//
+
+import Foundation
+
+/**
+ Decodes a hexadecimal test vector. Whitespace between the digits is ignored, so long vectors can be split over several lines.
+ */
+func bytes(_ hex: String) -> [UInt8] {
+    let digits = Array(hex.filter { !$0.isWhitespace })
+    var result: [UInt8] = []
+
+    for index in stride(from: 0, to: digits.count, by: 2) {
+        result.append(UInt8(String(digits[index...index + 1]), radix: 16)!)
+    }
+    return result
+}
+
+/**
+ Repeatable pseudo-random bytes for the equivalence tests, so a failing input can be reproduced from its seed.
+ */
+struct TestBytes {
+    private var state: UInt32
+
+    init(seed: UInt32) {
+        state = seed
+    }
+
+    mutating func next(_ count: Int) -> [UInt8] {
+        var result: [UInt8] = []
+
+        for _ in 0..<count {
+            state = state &* 1103515245 &+ 12345
+            result.append(UInt8(truncatingIfNeeded: state >> 16))
+        }
+        return result
+    }
+}